@@ -15,7 +15,12 @@ macro(setup_default_compiler_flags _project_name)
 		endif()
 
 		if(USE_SIMD_INSTRUCTIONS)
-			if(USE_AVX_INSTRUCTIONS)
+			if(USE_AVX512_INSTRUCTIONS)
+				target_compile_options(${_project_name} PRIVATE "/arch:AVX512")
+			elseif(USE_AVX2_INSTRUCTIONS OR USE_FMA_INSTRUCTIONS)
+				# MSVC only emits FMA instructions with AVX2
+				target_compile_options(${_project_name} PRIVATE "/arch:AVX2")
+			elseif(USE_AVX_INSTRUCTIONS)
 				target_compile_options(${_project_name} PRIVATE "/arch:AVX")
 			endif()
 		else()
@@ -36,11 +41,28 @@ macro(setup_default_compiler_flags _project_name)
 
 		if(CPU_INSTRUCTION_SET MATCHES "x86" OR CPU_INSTRUCTION_SET MATCHES "x64")
 			if(USE_SIMD_INSTRUCTIONS)
-				if(USE_AVX_INSTRUCTIONS)
+				if(USE_AVX512_INSTRUCTIONS)
+					# -mavx512f implies AVX2 but not FMA, MSVC enables it with /arch:AVX512
+					target_compile_options(${_project_name} PRIVATE "-mavx512f")
+					target_compile_options(${_project_name} PRIVATE "-mfma")
+					target_compile_options(${_project_name} PRIVATE "-mbmi")
+				elseif(USE_AVX2_INSTRUCTIONS)
+					# Every AVX2 CPU supports FMA, MSVC also enables it with /arch:AVX2
+					target_compile_options(${_project_name} PRIVATE "-mavx2")
+					target_compile_options(${_project_name} PRIVATE "-mfma")
+					target_compile_options(${_project_name} PRIVATE "-mbmi")
+				elseif(USE_AVX_INSTRUCTIONS)
 					target_compile_options(${_project_name} PRIVATE "-mavx")
 					target_compile_options(${_project_name} PRIVATE "-mbmi")
-				else()
+				elseif(USE_SSE4_INSTRUCTIONS)
 					target_compile_options(${_project_name} PRIVATE "-msse4.1")
+				else()
+					target_compile_options(${_project_name} PRIVATE "-msse2")
+				endif()
+
+				if(USE_FMA_INSTRUCTIONS)
+					# FMA requires AVX
+					target_compile_options(${_project_name} PRIVATE "-mfma")
 				endif()
 			else()
 				add_definitions(-DRTM_NO_INTRINSICS)
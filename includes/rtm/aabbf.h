@@ -0,0 +1,107 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "rtm/math.h"
+#include "rtm/matrix3x4f.h"
+#include "rtm/qvvf.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Creates an axis aligned bounding box from its center and its half extents.
+	//////////////////////////////////////////////////////////////////////////
+	inline aabbf RTM_SIMD_CALL aabb_set(vector4f_arg0 center, vector4f_arg1 extents) RTM_NO_EXCEPT
+	{
+		return aabbf{ center, extents };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates an axis aligned bounding box from its minimum and maximum corners.
+	//////////////////////////////////////////////////////////////////////////
+	inline aabbf RTM_SIMD_CALL aabb_from_min_max(vector4f_arg0 min, vector4f_arg1 max) RTM_NO_EXCEPT
+	{
+		const vector4f center = vector_mul(vector_add(min, max), 0.5f);
+		const vector4f extents = vector_mul(vector_sub(max, min), 0.5f);
+		return aabbf{ center, extents };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the minimum corner of an axis aligned bounding box.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL aabb_get_min(const aabbf& input) RTM_NO_EXCEPT
+	{
+		return vector_sub(input.center, input.extents);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the maximum corner of an axis aligned bounding box.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL aabb_get_max(const aabbf& input) RTM_NO_EXCEPT
+	{
+		return vector_add(input.center, input.extents);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the point lies inside or on the surface of the axis aligned bounding box.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL aabb_contains_point3(const aabbf& input, vector4f_arg0 point) RTM_NO_EXCEPT
+	{
+		return vector_all_less_equal3(vector_abs(vector_sub(point, input.center)), input.extents);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms an axis aligned bounding box by an affine matrix and returns
+	// the axis aligned bounding box that encloses the result.
+	// The center is transformed as a point and the new half extents are the
+	// projection of the old ones onto the absolute value of each matrix axis (Arvo).
+	// This is exact and avoids transforming the 8 corners.
+	//////////////////////////////////////////////////////////////////////////
+	inline aabbf RTM_SIMD_CALL aabb_transform(const aabbf& input, matrix3x4f_arg0 transform) RTM_NO_EXCEPT
+	{
+		const vector4f center = matrix_mul_point3(input.center, transform);
+
+		vector4f extents = vector_mul(vector_abs(transform.x_axis), vector_dup_x(input.extents));
+		extents = vector_mul_add(vector_abs(transform.y_axis), vector_dup_y(input.extents), extents);
+		extents = vector_mul_add(vector_abs(transform.z_axis), vector_dup_z(input.extents), extents);
+
+		return aabbf{ center, extents };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms an axis aligned bounding box by a QVV transform and returns
+	// the axis aligned bounding box that encloses the result.
+	// The QVV is converted into an affine matrix first, see aabb_transform(const aabbf&, matrix3x4f_arg0).
+	//////////////////////////////////////////////////////////////////////////
+	inline aabbf RTM_SIMD_CALL aabb_transform(const aabbf& input, qvvf_arg0 transform) RTM_NO_EXCEPT
+	{
+		return aabb_transform(input, matrix_from_qvv(transform));
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,346 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "rtm/math.h"
+#include "rtm/aabbf.h"
+#include "rtm/matrix3x3f_batch.h"
+#include "rtm/matrix3x4f.h"
+#include "rtm/qvvf.h"
+#include "rtm/scalarf_x8.h"
+#include "rtm/vector3f_x8.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/soa_common.h"
+
+#include <cstddef>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Transforms 8 axis aligned bounding boxes stored as a structure of arrays, one box per lane.
+		// See aabb_transform(const aabbf&, matrix3x4f_arg0) for details.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL aabb_transform_x8(const vector3f_x8& center, const vector3f_x8& extents,
+			const vector3f_x8& x_axis, const vector3f_x8& y_axis, const vector3f_x8& z_axis, const vector3f_x8& translation,
+			vector3f_x8& out_center, vector3f_x8& out_extents) RTM_NO_EXCEPT
+		{
+			out_center = vector_mul_add(x_axis, center.x, vector_mul_add(y_axis, center.y, vector_mul_add(z_axis, center.z, translation)));
+			out_extents = vector_mul_add(vector_abs(x_axis), extents.x, vector_mul_add(vector_abs(y_axis), extents.y, vector_mul(vector_abs(z_axis), extents.z)));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Loads and transposes 8 consecutive affine matrices.
+		//////////////////////////////////////////////////////////////////////////
+		inline void aabb_load_transforms_x8(const matrix3x4f* transforms,
+			vector3f_x8& out_x_axis, vector3f_x8& out_y_axis, vector3f_x8& out_z_axis, vector3f_x8& out_translation) RTM_NO_EXCEPT
+		{
+			constexpr size_t k_matrix_stride = sizeof(matrix3x4f) / sizeof(vector4f);
+
+			out_x_axis = matrix_load_axis3_x8(&transforms[0].x_axis, k_matrix_stride);
+			out_y_axis = matrix_load_axis3_x8(&transforms[0].y_axis, k_matrix_stride);
+			out_z_axis = matrix_load_axis3_x8(&transforms[0].z_axis, k_matrix_stride);
+			out_translation = matrix_load_axis3_x8(&transforms[0].w_axis, k_matrix_stride);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Loads and transposes 8 consecutive QVV transforms and builds their rotation and scale axes.
+		// The rotation matrices are built in structure of arrays form, see matrix_from_qvv(..).
+		//////////////////////////////////////////////////////////////////////////
+		inline void aabb_load_transforms_x8(const qvvf* transforms,
+			vector3f_x8& out_x_axis, vector3f_x8& out_y_axis, vector3f_x8& out_z_axis, vector3f_x8& out_translation) RTM_NO_EXCEPT
+		{
+			constexpr size_t k_qvv_stride = sizeof(qvvf) / sizeof(vector4f);
+
+			scalarf_x8 quat_x;
+			scalarf_x8 quat_y;
+			scalarf_x8 quat_z;
+			scalarf_x8 quat_w;
+			transpose_4x8(quat_to_vector(transforms[0].rotation), quat_to_vector(transforms[1].rotation), quat_to_vector(transforms[2].rotation), quat_to_vector(transforms[3].rotation),
+				quat_to_vector(transforms[4].rotation), quat_to_vector(transforms[5].rotation), quat_to_vector(transforms[6].rotation), quat_to_vector(transforms[7].rotation),
+				quat_x, quat_y, quat_z, quat_w);
+
+			out_translation = matrix_load_axis3_x8(&transforms[0].translation, k_qvv_stride);
+			const vector3f_x8 scale = matrix_load_axis3_x8(&transforms[0].scale, k_qvv_stride);
+
+			const scalarf_x8 x2 = scalar_add(quat_x, quat_x);
+			const scalarf_x8 y2 = scalar_add(quat_y, quat_y);
+			const scalarf_x8 z2 = scalar_add(quat_z, quat_z);
+			const scalarf_x8 xx = scalar_mul(quat_x, x2);
+			const scalarf_x8 xy = scalar_mul(quat_x, y2);
+			const scalarf_x8 xz = scalar_mul(quat_x, z2);
+			const scalarf_x8 yy = scalar_mul(quat_y, y2);
+			const scalarf_x8 yz = scalar_mul(quat_y, z2);
+			const scalarf_x8 zz = scalar_mul(quat_z, z2);
+			const scalarf_x8 wx = scalar_mul(quat_w, x2);
+			const scalarf_x8 wy = scalar_mul(quat_w, y2);
+			const scalarf_x8 wz = scalar_mul(quat_w, z2);
+
+			const scalarf_x8 one = scalar_set_x8(1.0f);
+			out_x_axis = vector_mul(vector3f_x8{ scalar_sub(one, scalar_add(yy, zz)), scalar_add(xy, wz), scalar_sub(xz, wy) }, scale.x);
+			out_y_axis = vector_mul(vector3f_x8{ scalar_sub(xy, wz), scalar_sub(one, scalar_add(xx, zz)), scalar_add(yz, wx) }, scale.y);
+			out_z_axis = vector_mul(vector3f_x8{ scalar_add(xz, wy), scalar_sub(yz, wx), scalar_sub(one, scalar_add(xx, yy)) }, scale.z);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Boxes stored as a structure of arrays: one array per center and extent component.
+		// The outputs can alias the inputs.
+		//////////////////////////////////////////////////////////////////////////
+		struct aabb_soa_stream
+		{
+			const float* inputs[6];
+			float* outputs[6];
+
+			void load_x8(size_t offset, vector3f_x8& out_center, vector3f_x8& out_extents) const RTM_NO_EXCEPT
+			{
+				out_center = vector3f_x8{ scalar_load_x8(inputs[0] + offset), scalar_load_x8(inputs[1] + offset), scalar_load_x8(inputs[2] + offset) };
+				out_extents = vector3f_x8{ scalar_load_x8(inputs[3] + offset), scalar_load_x8(inputs[4] + offset), scalar_load_x8(inputs[5] + offset) };
+			}
+
+			void store_x8(size_t offset, const vector3f_x8& center, const vector3f_x8& extents) const RTM_NO_EXCEPT
+			{
+				scalar_store_x8(center.x, outputs[0] + offset);
+				scalar_store_x8(center.y, outputs[1] + offset);
+				scalar_store_x8(center.z, outputs[2] + offset);
+				scalar_store_x8(extents.x, outputs[3] + offset);
+				scalar_store_x8(extents.y, outputs[4] + offset);
+				scalar_store_x8(extents.z, outputs[5] + offset);
+			}
+
+			// Loads the last 'num_remaining' boxes, the missing lanes are empty boxes
+			void load_remaining_x8(size_t offset, size_t num_remaining, vector3f_x8& out_center, vector3f_x8& out_extents) const RTM_NO_EXCEPT
+			{
+				float padded_values[6][8] = {};
+				for (size_t component_index = 0; component_index < 6; ++component_index)
+				{
+					for (size_t index = 0; index < num_remaining; ++index)
+						padded_values[component_index][index] = inputs[component_index][offset + index];
+				}
+
+				out_center = vector3f_x8{ scalar_load_x8(padded_values[0]), scalar_load_x8(padded_values[1]), scalar_load_x8(padded_values[2]) };
+				out_extents = vector3f_x8{ scalar_load_x8(padded_values[3]), scalar_load_x8(padded_values[4]), scalar_load_x8(padded_values[5]) };
+			}
+
+			void store_remaining_x8(size_t offset, size_t num_remaining, const vector3f_x8& center, const vector3f_x8& extents) const RTM_NO_EXCEPT
+			{
+				float padded_values[6][8];
+				scalar_store_x8(center.x, padded_values[0]);
+				scalar_store_x8(center.y, padded_values[1]);
+				scalar_store_x8(center.z, padded_values[2]);
+				scalar_store_x8(extents.x, padded_values[3]);
+				scalar_store_x8(extents.y, padded_values[4]);
+				scalar_store_x8(extents.z, padded_values[5]);
+
+				for (size_t component_index = 0; component_index < 6; ++component_index)
+				{
+					for (size_t index = 0; index < num_remaining; ++index)
+						outputs[component_index][offset + index] = padded_values[component_index][index];
+				}
+			}
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Boxes stored as an array of structures, they are transposed in registers
+		// into the structure of arrays form the kernel uses. The output can alias the input.
+		//////////////////////////////////////////////////////////////////////////
+		struct aabb_aos_stream
+		{
+			static constexpr size_t k_stride = sizeof(aabbf) / sizeof(vector4f);
+
+			const aabbf* inputs;
+			aabbf* outputs;
+
+			void load_x8(size_t offset, vector3f_x8& out_center, vector3f_x8& out_extents) const RTM_NO_EXCEPT
+			{
+				out_center = matrix_load_axis3_x8(&inputs[offset].center, k_stride);
+				out_extents = matrix_load_axis3_x8(&inputs[offset].extents, k_stride);
+			}
+
+			void store_x8(size_t offset, const vector3f_x8& center, const vector3f_x8& extents) const RTM_NO_EXCEPT
+			{
+				const scalarf_x8 zero = scalar_set_x8(0.0f);
+				matrix_store_axis3_x8(center, zero, &outputs[offset].center, k_stride);
+				matrix_store_axis3_x8(extents, zero, &outputs[offset].extents, k_stride);
+			}
+
+			// Loads the last 'num_remaining' boxes, the missing lanes are empty boxes
+			void load_remaining_x8(size_t offset, size_t num_remaining, vector3f_x8& out_center, vector3f_x8& out_extents) const RTM_NO_EXCEPT
+			{
+				aabbf padded_boxes[8];
+				for (size_t index = 0; index < 8; ++index)
+					padded_boxes[index] = index < num_remaining ? inputs[offset + index] : aabbf{ vector_zero(), vector_zero() };
+
+				out_center = matrix_load_axis3_x8(&padded_boxes[0].center, k_stride);
+				out_extents = matrix_load_axis3_x8(&padded_boxes[0].extents, k_stride);
+			}
+
+			void store_remaining_x8(size_t offset, size_t num_remaining, const vector3f_x8& center, const vector3f_x8& extents) const RTM_NO_EXCEPT
+			{
+				aabbf padded_boxes[8];
+				const scalarf_x8 zero = scalar_set_x8(0.0f);
+				matrix_store_axis3_x8(center, zero, &padded_boxes[0].center, k_stride);
+				matrix_store_axis3_x8(extents, zero, &padded_boxes[0].extents, k_stride);
+
+				for (size_t index = 0; index < num_remaining; ++index)
+					outputs[offset + index] = padded_boxes[index];
+			}
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Transforms 8 consecutive boxes by their transform, the box layout is abstracted by the stream.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename stream_type, typename transform_type>
+		inline void aabb_transform_batch8(const stream_type& boxes, size_t offset, const transform_type* transforms) RTM_NO_EXCEPT
+		{
+			vector3f_x8 center;
+			vector3f_x8 extents;
+			boxes.load_x8(offset, center, extents);
+
+			vector3f_x8 x_axis;
+			vector3f_x8 y_axis;
+			vector3f_x8 z_axis;
+			vector3f_x8 translation;
+			aabb_load_transforms_x8(transforms + offset, x_axis, y_axis, z_axis, translation);
+
+			vector3f_x8 out_center;
+			vector3f_x8 out_extents;
+			aabb_transform_x8(center, extents, x_axis, y_axis, z_axis, translation, out_center, out_extents);
+			boxes.store_x8(offset, out_center, out_extents);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Transforms the last 'num_remaining' boxes, fewer than 8. The missing lanes
+		// are padded with empty boxes and identity transforms.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename stream_type, typename transform_type>
+		inline void aabb_transform_remaining_x8(const stream_type& boxes, size_t offset, size_t num_remaining, const transform_type* transforms, const transform_type& identity) RTM_NO_EXCEPT
+		{
+			transform_type padded_transforms[8];
+			for (size_t index = 0; index < 8; ++index)
+				padded_transforms[index] = index < num_remaining ? transforms[offset + index] : identity;
+
+			vector3f_x8 center;
+			vector3f_x8 extents;
+			boxes.load_remaining_x8(offset, num_remaining, center, extents);
+
+			vector3f_x8 x_axis;
+			vector3f_x8 y_axis;
+			vector3f_x8 z_axis;
+			vector3f_x8 translation;
+			aabb_load_transforms_x8(&padded_transforms[0], x_axis, y_axis, z_axis, translation);
+
+			vector3f_x8 out_center;
+			vector3f_x8 out_extents;
+			aabb_transform_x8(center, extents, x_axis, y_axis, z_axis, translation, out_center, out_extents);
+			boxes.store_remaining_x8(offset, num_remaining, out_center, out_extents);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Transforms 'count' boxes 8 at a time, one box per SIMD lane.
+		// The box layout is abstracted by the stream.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename stream_type, typename transform_type>
+		inline void aabb_transform_batch(const stream_type& boxes, const transform_type* transforms, size_t count, const transform_type& identity) RTM_NO_EXCEPT
+		{
+			size_t offset = 0;
+			for (; offset + 8 <= count; offset += 8)
+				aabb_transform_batch8(boxes, offset, transforms);
+
+			if (offset < count)
+				aabb_transform_remaining_x8(boxes, offset, count - offset, transforms, identity);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms 'count' axis aligned bounding boxes stored as a structure of arrays
+	// by their own affine matrix, see aabb_transform(const aabbf&, matrix3x4f_arg0).
+	// The boxes use the same layout as frustum_cull_aabbs(..): one array per center
+	// and extent component. Groups of 8 matrices are transposed into structure of
+	// arrays form and transformed in parallel, one box per SIMD lane.
+	// The outputs can safely alias the inputs.
+	//////////////////////////////////////////////////////////////////////////
+	inline void aabb_transform_batch(const float* centers_x, const float* centers_y, const float* centers_z,
+		const float* extents_x, const float* extents_y, const float* extents_z, const matrix3x4f* transforms,
+		float* out_centers_x, float* out_centers_y, float* out_centers_z,
+		float* out_extents_x, float* out_extents_y, float* out_extents_z, size_t count) RTM_NO_EXCEPT
+	{
+		const rtm_impl::aabb_soa_stream boxes = { { centers_x, centers_y, centers_z, extents_x, extents_y, extents_z }, { out_centers_x, out_centers_y, out_centers_z, out_extents_x, out_extents_y, out_extents_z } };
+		rtm_impl::aabb_transform_batch(boxes, transforms, count, matrix3x4f(matrix_identity()));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms 'count' axis aligned bounding boxes stored as a structure of arrays
+	// by their own QVV transform, see aabb_transform(const aabbf&, qvvf_arg1).
+	// The boxes use the same layout as frustum_cull_aabbs(..): one array per center
+	// and extent component. Groups of 8 transforms are transposed into structure of arrays
+	// form, their rotation matrices are built and they are transformed in parallel.
+	// The outputs can safely alias the inputs.
+	//////////////////////////////////////////////////////////////////////////
+	inline void aabb_transform_batch(const float* centers_x, const float* centers_y, const float* centers_z,
+		const float* extents_x, const float* extents_y, const float* extents_z, const qvvf* transforms,
+		float* out_centers_x, float* out_centers_y, float* out_centers_z,
+		float* out_extents_x, float* out_extents_y, float* out_extents_z, size_t count) RTM_NO_EXCEPT
+	{
+		const rtm_impl::aabb_soa_stream boxes = { { centers_x, centers_y, centers_z, extents_x, extents_y, extents_z }, { out_centers_x, out_centers_y, out_centers_z, out_extents_x, out_extents_y, out_extents_z } };
+		rtm_impl::aabb_transform_batch(boxes, transforms, count, qvvf(qvv_identity()));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms 'count' axis aligned bounding boxes by their own affine matrix:
+	// outputs[i] = aabb_transform(inputs[i], transforms[i])
+	// With AVX, groups of 8 boxes are transposed in registers and transformed with the
+	// kernel of the structure of arrays version above. Otherwise, the box transposes cost more than
+	// they save and the boxes are transformed one at a time.
+	// The output can safely alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void aabb_transform_batch(const aabbf* inputs, const matrix3x4f* transforms, aabbf* outputs, size_t count) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		const rtm_impl::aabb_aos_stream boxes = { inputs, outputs };
+		rtm_impl::aabb_transform_batch(boxes, transforms, count, matrix3x4f(matrix_identity()));
+#else
+		for (size_t index = 0; index < count; ++index)
+			outputs[index] = aabb_transform(inputs[index], transforms[index]);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms 'count' axis aligned bounding boxes by their own QVV transform:
+	// outputs[i] = aabb_transform(inputs[i], transforms[i])
+	// Groups of 8 boxes are transposed in registers and transformed with the
+	// kernel of the structure of arrays version above.
+	// The output can safely alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void aabb_transform_batch(const aabbf* inputs, const qvvf* transforms, aabbf* outputs, size_t count) RTM_NO_EXCEPT
+	{
+		const rtm_impl::aabb_aos_stream boxes = { inputs, outputs };
+		rtm_impl::aabb_transform_batch(boxes, transforms, count, qvvf(qvv_identity()));
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
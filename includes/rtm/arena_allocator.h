@@ -0,0 +1,106 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "rtm/math.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/error.h"
+#include "rtm/impl/memory_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// A linear (bump) allocator over a memory buffer provided by the caller.
+	// Allocations are carved out of the buffer in order and are only released all at once
+	// with arena_reset(..) which makes it well suited for per frame scratch memory.
+	// The arena never allocates or frees the buffer itself.
+	//////////////////////////////////////////////////////////////////////////
+	struct arena_allocator
+	{
+		uint8_t*	buffer;
+		size_t		capacity;
+		size_t		offset;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates an arena that allocates from the provided buffer.
+	//////////////////////////////////////////////////////////////////////////
+	inline arena_allocator arena_create(void* buffer, size_t capacity) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(buffer != nullptr || capacity == 0, "Invalid arena buffer");
+		return arena_allocator{ static_cast<uint8_t*>(buffer), capacity, 0 };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Allocates memory with the specified alignment, a cache line by default.
+	// Returns nullptr if the arena does not have enough space left.
+	//////////////////////////////////////////////////////////////////////////
+	inline void* arena_allocate(arena_allocator& arena, size_t size, size_t alignment = rtm_impl::k_cache_line_size) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(rtm_impl::is_power_of_two(alignment), "Alignment must be a power of two");
+
+		// Align the address, the buffer itself might not be aligned
+		const uintptr_t buffer_address = reinterpret_cast<uintptr_t>(arena.buffer);
+		const size_t aligned_offset = rtm_impl::align_to(buffer_address + arena.offset, alignment) - buffer_address;
+		if (aligned_offset > arena.capacity || size > arena.capacity - aligned_offset)
+			return nullptr;
+
+		arena.offset = aligned_offset + size;
+		return arena.buffer + aligned_offset;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Allocates an uninitialized array aligned to a cache line or to the type alignment if larger.
+	// Returns nullptr if the arena does not have enough space left.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename value_type>
+	inline value_type* arena_allocate_array(arena_allocator& arena, size_t num_values) RTM_NO_EXCEPT
+	{
+		const size_t alignment = alignof(value_type) > rtm_impl::k_cache_line_size ? alignof(value_type) : rtm_impl::k_cache_line_size;
+		return static_cast<value_type*>(arena_allocate(arena, sizeof(value_type) * num_values, alignment));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Releases every allocation at once. The memory previously returned must no longer be used.
+	//////////////////////////////////////////////////////////////////////////
+	inline void arena_reset(arena_allocator& arena) RTM_NO_EXCEPT
+	{
+		arena.offset = 0;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns how many bytes are in use, including the alignment padding.
+	//////////////////////////////////////////////////////////////////////////
+	inline size_t arena_get_used_size(const arena_allocator& arena) RTM_NO_EXCEPT
+	{
+		return arena.offset;
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,298 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "rtm/math.h"
+#include "rtm/matrix3x4f_batch.h"
+#include "rtm/quatf_batch.h"
+#include "rtm/qvvf_batch.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(RTM_CPU_DISPATCH) && defined(_MSC_VER)
+	#include <intrin.h>
+#elif defined(RTM_CPU_DISPATCH)
+	#include <cpuid.h>
+#endif
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+//////////////////////////////////////////////////////////////////////////
+// Only the functions in the rtm::dispatch namespace select their instruction set
+// at runtime. The regular rtm::*_batch functions are compiled for the baseline and
+// never dispatch, callers opt in by calling e.g. rtm::dispatch::qvv_mul_batch(..).
+//////////////////////////////////////////////////////////////////////////
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// The instruction sets the batch functions can be dispatched to at runtime.
+	// 'generic' is used on platforms without runtime dispatch and refers to the
+	// batch functions compiled for the compilation baseline.
+	//////////////////////////////////////////////////////////////////////////
+	enum class cpu_isa : uint32_t
+	{
+		generic,
+		sse2,
+		avx2,		// Includes FMA
+		avx512,		// AVX-512F, includes AVX2 and FMA
+	};
+
+	namespace rtm_impl
+	{
+#if defined(RTM_CPU_DISPATCH)
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the [eax, ebx, ecx, edx] registers of the CPUID instruction.
+		//////////////////////////////////////////////////////////////////////////
+		inline void cpuid(uint32_t leaf, uint32_t sub_leaf, uint32_t registers[4]) RTM_NO_EXCEPT
+		{
+#if defined(_MSC_VER)
+			int values[4];
+			__cpuidex(values, int(leaf), int(sub_leaf));
+			for (int index = 0; index < 4; ++index)
+				registers[index] = uint32_t(values[index]);
+#else
+			registers[0] = registers[1] = registers[2] = registers[3] = 0;
+			__cpuid_count(leaf, sub_leaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns which register states the OS saves on context switches (XCR0).
+		//////////////////////////////////////////////////////////////////////////
+		inline uint64_t read_xcr0() RTM_NO_EXCEPT
+		{
+#if defined(_MSC_VER)
+			return _xgetbv(0);
+#else
+			uint32_t eax;
+			uint32_t edx;
+			__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+			return (uint64_t(edx) << 32) | eax;
+#endif
+		}
+#endif
+
+		//////////////////////////////////////////////////////////////////////////
+		// Queries the CPU for the best instruction set it and the OS support.
+		//////////////////////////////////////////////////////////////////////////
+		inline cpu_isa detect_cpu_isa() RTM_NO_EXCEPT
+		{
+#if defined(RTM_CPU_DISPATCH)
+			uint32_t registers[4];
+			cpuid(0, 0, registers);
+			const uint32_t max_leaf = registers[0];
+
+			cpuid(1, 0, registers);
+			const uint32_t leaf1_ecx = registers[2];
+			const bool has_fma = (leaf1_ecx & (1U << 12)) != 0;
+			const bool has_osxsave = (leaf1_ecx & (1U << 27)) != 0;
+			const bool has_avx = (leaf1_ecx & (1U << 28)) != 0;
+
+			if (!has_osxsave || !has_avx || !has_fma || max_leaf < 7)
+				return cpu_isa::sse2;
+
+			// The OS must save the XMM and YMM registers
+			const uint64_t xcr0 = read_xcr0();
+			if ((xcr0 & 0x6) != 0x6)
+				return cpu_isa::sse2;
+
+			cpuid(7, 0, registers);
+			const uint32_t leaf7_ebx = registers[1];
+			const bool has_avx2 = (leaf7_ebx & (1U << 5)) != 0;
+			const bool has_avx512f = (leaf7_ebx & (1U << 16)) != 0;
+
+			if (!has_avx2)
+				return cpu_isa::sse2;
+
+			// The OS must also save the opmask and ZMM registers
+			if (!has_avx512f || (xcr0 & 0xE0) != 0xE0)
+				return cpu_isa::avx2;
+
+			return cpu_isa::avx512;
+#else
+			return cpu_isa::generic;
+#endif
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the best instruction set supported by the current CPU.
+	// The CPU is only queried once.
+	//////////////////////////////////////////////////////////////////////////
+	inline cpu_isa get_cpu_isa() RTM_NO_EXCEPT
+	{
+		static const cpu_isa s_isa = rtm_impl::detect_cpu_isa();
+		return s_isa;
+	}
+
+	namespace dispatch
+	{
+#if defined(RTM_CPU_DISPATCH)
+		//////////////////////////////////////////////////////////////////////////
+		// The batch functions compiled for every instruction set.
+		// The SSE2 versions are the generic batch functions compiled for the compilation
+		// baseline. They have no SSE4 specific code paths and thus no SSE4 version.
+		// Dispatch is only enabled when the baseline is below AVX (see rtm/math.h) which
+		// ensures the SSE2 versions never contain wider instructions.
+		// A version must only be called when get_cpu_isa() supports its instruction set.
+		//////////////////////////////////////////////////////////////////////////
+		namespace sse2
+		{
+			inline void quat_mul_batch(const quatf* lhs, const quatf* rhs, quatf* output, size_t count) RTM_NO_EXCEPT { rtm::quat_mul_batch(lhs, rhs, output, count); }
+			inline void quat_mul_vector3_batch(const vector4f* vectors, const quatf* rotations, vector4f* output, size_t count) RTM_NO_EXCEPT { rtm::quat_mul_vector3_batch(vectors, rotations, output, count); }
+			inline void qvv_mul_batch(const qvvf* lhs, const qvvf* rhs, qvvf* output, size_t count) RTM_NO_EXCEPT { rtm::qvv_mul_batch(lhs, rhs, output, count); }
+			inline void matrix_mul_point3_batch(const vector4f* points, matrix3x4f_arg1 mtx, vector4f* output, size_t count) RTM_NO_EXCEPT { rtm::matrix_mul_point3_batch(points, mtx, output, count); }
+		}
+
+		namespace avx2
+		{
+			inline void quat_mul_batch(const quatf* lhs, const quatf* rhs, quatf* output, size_t count) RTM_NO_EXCEPT { rtm_impl::quat_mul_batch_avx2(lhs, rhs, output, count); }
+			inline void quat_mul_vector3_batch(const vector4f* vectors, const quatf* rotations, vector4f* output, size_t count) RTM_NO_EXCEPT { rtm_impl::quat_mul_vector3_batch_avx2(vectors, rotations, output, count); }
+			inline void qvv_mul_batch(const qvvf* lhs, const qvvf* rhs, qvvf* output, size_t count) RTM_NO_EXCEPT { rtm_impl::qvv_mul_batch_avx2(lhs, rhs, output, count); }
+			inline void matrix_mul_point3_batch(const vector4f* points, matrix3x4f_arg1 mtx, vector4f* output, size_t count) RTM_NO_EXCEPT { rtm_impl::matrix_mul_point3_batch_avx2(points, mtx, output, count); }
+		}
+
+		namespace avx512
+		{
+			inline void quat_mul_batch(const quatf* lhs, const quatf* rhs, quatf* output, size_t count) RTM_NO_EXCEPT { rtm_impl::quat_mul_batch_avx512(lhs, rhs, output, count); }
+			inline void quat_mul_vector3_batch(const vector4f* vectors, const quatf* rotations, vector4f* output, size_t count) RTM_NO_EXCEPT { rtm_impl::quat_mul_vector3_batch_avx512(vectors, rotations, output, count); }
+			// The AVX-512 version gathers and scatters every component, it measures twice as slow as the AVX2 version
+			inline void qvv_mul_batch(const qvvf* lhs, const qvvf* rhs, qvvf* output, size_t count) RTM_NO_EXCEPT { rtm_impl::qvv_mul_batch_avx2(lhs, rhs, output, count); }
+			inline void matrix_mul_point3_batch(const vector4f* points, matrix3x4f_arg1 mtx, vector4f* output, size_t count) RTM_NO_EXCEPT { rtm_impl::matrix_mul_point3_batch_avx512(points, mtx, output, count); }
+		}
+#endif
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// The batch functions selected for an instruction set.
+		//////////////////////////////////////////////////////////////////////////
+		struct dispatch_function_table
+		{
+			cpu_isa isa;
+			void (*quat_mul_batch)(const quatf* lhs, const quatf* rhs, quatf* output, size_t count);
+			void (*quat_mul_vector3_batch)(const vector4f* vectors, const quatf* rotations, vector4f* output, size_t count);
+			void (*qvv_mul_batch)(const qvvf* lhs, const qvvf* rhs, qvvf* output, size_t count);
+			void (*matrix_mul_point3_batch)(const vector4f* points, matrix3x4f_arg1 mtx, vector4f* output, size_t count);
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the batch functions for the requested instruction set, or for the
+		// best one supported by the CPU if it isn't supported.
+		//////////////////////////////////////////////////////////////////////////
+		inline dispatch_function_table make_dispatch_function_table(cpu_isa isa) RTM_NO_EXCEPT
+		{
+#if defined(RTM_CPU_DISPATCH)
+			const cpu_isa cpu_best_isa = get_cpu_isa();
+			if (isa == cpu_isa::generic || uint32_t(isa) > uint32_t(cpu_best_isa))
+				isa = cpu_best_isa;
+
+			switch (isa)
+			{
+			case cpu_isa::avx512:
+				return dispatch_function_table{ isa, dispatch::avx512::quat_mul_batch, dispatch::avx512::quat_mul_vector3_batch, dispatch::avx512::qvv_mul_batch, dispatch::avx512::matrix_mul_point3_batch };
+			case cpu_isa::avx2:
+				return dispatch_function_table{ isa, dispatch::avx2::quat_mul_batch, dispatch::avx2::quat_mul_vector3_batch, dispatch::avx2::qvv_mul_batch, dispatch::avx2::matrix_mul_point3_batch };
+			default:
+				return dispatch_function_table{ cpu_isa::sse2, dispatch::sse2::quat_mul_batch, dispatch::sse2::quat_mul_vector3_batch, dispatch::sse2::qvv_mul_batch, dispatch::sse2::matrix_mul_point3_batch };
+			}
+#else
+			(void)isa;
+			return dispatch_function_table{ cpu_isa::generic, rtm::quat_mul_batch, rtm::quat_mul_vector3_batch, rtm::qvv_mul_batch, rtm::matrix_mul_point3_batch };
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the batch functions in use, they are selected the first time this is called.
+		//////////////////////////////////////////////////////////////////////////
+		inline dispatch_function_table& get_dispatch_function_table() RTM_NO_EXCEPT
+		{
+			static dispatch_function_table s_table = make_dispatch_function_table(get_cpu_isa());
+			return s_table;
+		}
+	}
+
+	namespace dispatch
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the instruction set the batch functions are dispatched to.
+		//////////////////////////////////////////////////////////////////////////
+		inline cpu_isa get_dispatch_isa() RTM_NO_EXCEPT
+		{
+			return rtm_impl::get_dispatch_function_table().isa;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Overrides the instruction set the batch functions are dispatched to, e.g. to compare them.
+		// If the CPU doesn't support it, the best instruction set it supports is used instead.
+		// This is not thread safe and must not be called while batch functions are running.
+		//////////////////////////////////////////////////////////////////////////
+		inline void set_dispatch_isa(cpu_isa isa) RTM_NO_EXCEPT
+		{
+			rtm_impl::get_dispatch_function_table() = rtm_impl::make_dispatch_function_table(isa);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Multiplies 'count' pairs of quaternions with the best instruction set available.
+		// See rtm::quat_mul_batch(..) for details.
+		//////////////////////////////////////////////////////////////////////////
+		inline void quat_mul_batch(const quatf* lhs, const quatf* rhs, quatf* output, size_t count) RTM_NO_EXCEPT
+		{
+			rtm_impl::get_dispatch_function_table().quat_mul_batch(lhs, rhs, output, count);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Rotates 'count' 3D vectors by their matching quaternion with the best instruction set available.
+		// See rtm::quat_mul_vector3_batch(..) for details.
+		//////////////////////////////////////////////////////////////////////////
+		inline void quat_mul_vector3_batch(const vector4f* vectors, const quatf* rotations, vector4f* output, size_t count) RTM_NO_EXCEPT
+		{
+			rtm_impl::get_dispatch_function_table().quat_mul_vector3_batch(vectors, rotations, output, count);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Multiplies 'count' pairs of QVV transforms with the best instruction set available.
+		// See rtm::qvv_mul_batch(..) for details.
+		//////////////////////////////////////////////////////////////////////////
+		inline void qvv_mul_batch(const qvvf* lhs, const qvvf* rhs, qvvf* output, size_t count) RTM_NO_EXCEPT
+		{
+			rtm_impl::get_dispatch_function_table().qvv_mul_batch(lhs, rhs, output, count);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Transforms 'count' 3D points by the same affine matrix with the best instruction set available.
+		// See rtm::matrix_mul_point3_batch(..) for details.
+		//////////////////////////////////////////////////////////////////////////
+		inline void matrix_mul_point3_batch(const vector4f* points, matrix3x4f_arg1 mtx, vector4f* output, size_t count) RTM_NO_EXCEPT
+		{
+			rtm_impl::get_dispatch_function_table().matrix_mul_point3_batch(points, mtx, output, count);
+		}
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,296 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/quatd.h"
+#include "rtm/vector4d.h"
+#include "rtm/matrix3x4d.h"
+#include "rtm/scalard.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/dualquat_common.h"
+#include "rtm/impl/qvv_common.h"
+
+#include <cstddef>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the input quaternion with every component multiplied by a scalar.
+		//////////////////////////////////////////////////////////////////////////
+		inline quatd RTM_SIMD_CALL dualquat_scale_part(quatd_arg0 input, double scale) RTM_NO_EXCEPT
+		{
+			return vector_to_quat(vector_mul(quat_to_vector(input), scale));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns accumulator + (input * weight) for every component of the quaternion.
+		//////////////////////////////////////////////////////////////////////////
+		inline quatd RTM_SIMD_CALL dualquat_mul_add_part(quatd_arg0 input, double weight, quatd_arg2 accumulator) RTM_NO_EXCEPT
+		{
+			return vector_to_quat(vector_mul_add(quat_to_vector(input), weight, quat_to_vector(accumulator)));
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Casts a dual quaternion float32 variant to a float64 variant.
+	//////////////////////////////////////////////////////////////////////////
+	inline dualquatd RTM_SIMD_CALL dualquat_cast(const dualquatf& input) RTM_NO_EXCEPT
+	{
+		return dualquatd{ quat_cast(input.real), quat_cast(input.dual) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a dual quaternion from a rotation quaternion and a translation.
+	// The rotation is applied first, followed by the translation.
+	//////////////////////////////////////////////////////////////////////////
+	inline dualquatd RTM_SIMD_CALL dualquat_from_rotation_translation(quatd_arg0 rotation, vector4d_arg1 translation) RTM_NO_EXCEPT
+	{
+		// dual = 0.5 * translation * rotation, with the translation as a pure quaternion
+		const quatd translation_quat = vector_to_quat(vector_mix<mix4::x, mix4::y, mix4::z, mix4::d>(translation, vector_zero()));
+		const quatd dual = rtm_impl::dualquat_scale_part(quat_mul(rotation, translation_quat), 0.5);
+		return dualquat_set(rotation, dual);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a dual quaternion from a QVV transform.
+	// Dual quaternions represent rigid transforms, the 3D scale is ignored.
+	//////////////////////////////////////////////////////////////////////////
+	inline dualquatd RTM_SIMD_CALL dualquat_from_qvv(qvvd_arg0 transform) RTM_NO_EXCEPT
+	{
+		return dualquat_from_rotation_translation(transform.rotation, transform.translation);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a dual quaternion from a 3x4 affine matrix.
+	// Dual quaternions represent rigid transforms, the 3D scale is removed.
+	//////////////////////////////////////////////////////////////////////////
+	inline dualquatd RTM_SIMD_CALL dualquat_from_matrix(matrix3x4d_arg0 input) RTM_NO_EXCEPT
+	{
+		const quatd rotation = quat_from_matrix(matrix_remove_scale(input));
+		return dualquat_from_rotation_translation(rotation, input.w_axis);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the rotation part of a normalized dual quaternion.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatd RTM_SIMD_CALL dualquat_get_rotation(dualquatd_arg0 input) RTM_NO_EXCEPT
+	{
+		return input.real;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the translation part of a normalized dual quaternion.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d RTM_SIMD_CALL dualquat_get_translation(dualquatd_arg0 input) RTM_NO_EXCEPT
+	{
+		// translation = 2.0 * dual * conjugate(real)
+		const quatd translation_quat = quat_mul(quat_conjugate(input.real), input.dual);
+		return vector_mul(quat_to_vector(translation_quat), 2.0);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts a normalized dual quaternion into a QVV transform with a [1,1,1] 3D scale.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvd RTM_SIMD_CALL qvv_from_dualquat(dualquatd_arg0 input) RTM_NO_EXCEPT
+	{
+		return qvv_set(input.real, dualquat_get_translation(input), vector_set(1.0));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts a normalized dual quaternion into a 3x4 affine matrix.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x4d RTM_SIMD_CALL matrix_from_dualquat(dualquatd_arg0 input) RTM_NO_EXCEPT
+	{
+		return matrix_from_qvv(input.real, dualquat_get_translation(input), vector_set(1.0));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies two dual quaternions.
+	// Multiplication order is as follow: local_to_world = dualquat_mul(local_to_object, object_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline dualquatd RTM_SIMD_CALL dualquat_mul(dualquatd_arg0 lhs, dualquatd_arg1 rhs) RTM_NO_EXCEPT
+	{
+		const quatd real = quat_mul(lhs.real, rhs.real);
+		const quatd dual = vector_to_quat(vector_add(quat_to_vector(quat_mul(lhs.real, rhs.dual)), quat_to_vector(quat_mul(lhs.dual, rhs.real))));
+		return dualquat_set(real, dual);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies a normalized dual quaternion and a 3D point.
+	// Multiplication order is as follow: world_position = dualquat_mul_point3(local_position, local_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d RTM_SIMD_CALL dualquat_mul_point3(vector4d_arg0 point, dualquatd_arg1 dq) RTM_NO_EXCEPT
+	{
+		return vector_add(quat_mul_vector3(point, dq.real), dualquat_get_translation(dq));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies a normalized dual quaternion and a 3D vector, the translation is ignored.
+	// Multiplication order is as follow: world_direction = dualquat_mul_vector3(local_direction, local_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d RTM_SIMD_CALL dualquat_mul_vector3(vector4d_arg0 vec3, dualquatd_arg1 dq) RTM_NO_EXCEPT
+	{
+		return quat_mul_vector3(vec3, dq.real);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the inverse of a normalized dual quaternion.
+	//////////////////////////////////////////////////////////////////////////
+	inline dualquatd RTM_SIMD_CALL dualquat_inverse(dualquatd_arg0 input) RTM_NO_EXCEPT
+	{
+		return dualquat_set(quat_conjugate(input.real), quat_conjugate(input.dual));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a normalized dual quaternion.
+	// The real part is normalized and the dual part is made orthogonal to it.
+	//////////////////////////////////////////////////////////////////////////
+	inline dualquatd RTM_SIMD_CALL dualquat_normalize(dualquatd_arg0 input) RTM_NO_EXCEPT
+	{
+		const double length_recip = quat_length_reciprocal(input.real);
+		const vector4d real = vector_mul(quat_to_vector(input.real), length_recip);
+		const vector4d dual = vector_mul(quat_to_vector(input.dual), length_recip);
+
+		// Remove the part of the dual that isn't orthogonal to the real part
+		const double real_dot_dual = vector_dot(real, dual);
+		return dualquat_set(vector_to_quat(real), vector_to_quat(vector_neg_mul_sub(real, vector_set(real_dot_dual), dual)));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the input dual quaternion is normalized, otherwise false.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL dualquat_is_normalized(dualquatd_arg0 input, double threshold = 0.00001) RTM_NO_EXCEPT
+	{
+		const double real_dot_dual = vector_dot(quat_to_vector(input.real), quat_to_vector(input.dual));
+		return quat_is_normalized(input.real, threshold) && scalar_abs(real_dot_dual) < threshold;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the two dual quaternions are nearly equal component wise, otherwise false.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL dualquat_near_equal(dualquatd_arg0 lhs, dualquatd_arg1 rhs, double threshold = 0.00001) RTM_NO_EXCEPT
+	{
+		return quat_near_equal(lhs.real, rhs.real, threshold) && quat_near_equal(lhs.dual, rhs.dual, threshold);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the linear interpolation between start and end for a given alpha value.
+	// This is also known as dual quaternion linear blending (DLB): the result is normalized
+	// and the shortest path is taken.
+	//////////////////////////////////////////////////////////////////////////
+	inline dualquatd RTM_SIMD_CALL dualquat_lerp(dualquatd_arg0 start, dualquatd_arg1 end, double alpha) RTM_NO_EXCEPT
+	{
+		// If both rotations are on opposite ends of the hypersphere, we flip the end dual quaternion
+		const double end_weight = vector_dot(quat_to_vector(start.real), quat_to_vector(end.real)) >= 0.0 ? alpha : -alpha;
+		const double start_weight = 1.0 - alpha;
+
+		const quatd real = rtm_impl::dualquat_mul_add_part(end.real, end_weight, rtm_impl::dualquat_scale_part(start.real, start_weight));
+		const quatd dual = rtm_impl::dualquat_mul_add_part(end.dual, end_weight, rtm_impl::dualquat_scale_part(start.dual, start_weight));
+		return dualquat_normalize(dualquat_set(real, dual));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the weighted blend of multiple dual quaternions.
+	// This is dual quaternion linear blending (DLB): every input takes the shortest path
+	// relative to the first input and the result is normalized.
+	// Weights are expected to sum to 1.0.
+	//////////////////////////////////////////////////////////////////////////
+	inline dualquatd dualquat_blend(const dualquatd* inputs, const double* weights, size_t count) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(inputs != nullptr && weights != nullptr && count != 0, "Invalid dual quaternion blend inputs");
+
+		const vector4d pivot = quat_to_vector(inputs[0].real);
+		quatd real = rtm_impl::dualquat_scale_part(inputs[0].real, weights[0]);
+		quatd dual = rtm_impl::dualquat_scale_part(inputs[0].dual, weights[0]);
+
+		for (size_t input_index = 1; input_index < count; ++input_index)
+		{
+			const dualquatd& input = inputs[input_index];
+			const double weight = vector_dot(pivot, quat_to_vector(input.real)) >= 0.0 ? weights[input_index] : -weights[input_index];
+
+			real = rtm_impl::dualquat_mul_add_part(input.real, weight, real);
+			dual = rtm_impl::dualquat_mul_add_part(input.dual, weight, dual);
+		}
+
+		return dualquat_normalize(dualquat_set(real, dual));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the screw linear interpolation (ScLERP) between start and end for a given alpha value.
+	// Both inputs must be normalized. The interpolated transform follows a constant speed screw
+	// motion (a rotation around an axis combined with a translation along it) and the shortest path is taken.
+	//////////////////////////////////////////////////////////////////////////
+	inline dualquatd RTM_SIMD_CALL dualquat_sclerp(dualquatd_arg0 start, dualquatd_arg1 end, double alpha) RTM_NO_EXCEPT
+	{
+		constexpr double epsilon = 1.0e-9;
+
+		// Relative transform from start to end such that end = dualquat_mul(start, delta)
+		dualquatd delta = dualquat_mul(dualquat_inverse(start), end);
+		if (quat_get_w(delta.real) < 0.0)
+			delta = dualquat_set(quat_neg(delta.real), quat_neg(delta.dual));
+
+		// Raise the relative transform to the power of alpha using its screw parameters:
+		// real = [sin(angle / 2) * axis, cos(angle / 2)]
+		// dual = [sin(angle / 2) * moment + (pitch / 2) * cos(angle / 2) * axis, -(pitch / 2) * sin(angle / 2)]
+		const vector4d real_xyz = quat_to_vector(delta.real);
+		const double sin_half_angle = scalar_sqrt(vector_length_squared3(real_xyz));
+
+		dualquatd delta_alpha;
+		if (sin_half_angle < epsilon)
+		{
+			// No rotation, the screw motion is a pure translation
+			delta_alpha = dualquat_set(quat_identity(), rtm_impl::dualquat_scale_part(delta.dual, alpha));
+		}
+		else
+		{
+			const double cos_half_angle = quat_get_w(delta.real);
+			const double half_angle = scalar_atan2(sin_half_angle, cos_half_angle);
+			const double inv_sin_half_angle = 1.0 / sin_half_angle;
+
+			const vector4d axis = vector_mul(real_xyz, inv_sin_half_angle);
+			const double half_pitch = -quat_get_w(delta.dual) * inv_sin_half_angle;
+			const vector4d moment = vector_mul(vector_neg_mul_sub(axis, vector_set(half_pitch * cos_half_angle), quat_to_vector(delta.dual)), inv_sin_half_angle);
+
+			double sin_half_angle_alpha;
+			double cos_half_angle_alpha;
+			scalar_sincos(half_angle * alpha, sin_half_angle_alpha, cos_half_angle_alpha);
+			const double half_pitch_alpha = half_pitch * alpha;
+
+			const vector4d real = vector_mul(axis, sin_half_angle_alpha);
+			const vector4d dual = vector_mul_add(axis, half_pitch_alpha * cos_half_angle_alpha, vector_mul(moment, sin_half_angle_alpha));
+			delta_alpha = dualquat_set(vector_to_quat(vector_mix<mix4::x, mix4::y, mix4::z, mix4::a>(real, vector_set(cos_half_angle_alpha))), vector_to_quat(vector_mix<mix4::x, mix4::y, mix4::z, mix4::a>(dual, vector_set(-half_pitch_alpha * sin_half_angle_alpha))));
+		}
+
+		return dualquat_mul(start, delta_alpha);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
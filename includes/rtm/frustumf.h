@@ -0,0 +1,272 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "rtm/math.h"
+#include "rtm/aabbf.h"
+#include "rtm/matrix4x4f.h"
+#include "rtm/planef.h"
+#include "rtm/scalarf_x8.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Normalizes a frustum plane extracted from a projection matrix.
+		// Infinite projections have a plane at infinity with a zero normal (the far plane,
+		// or the near plane with reverse-Z) which would become NaN once normalized.
+		// It is replaced by a plane that never culls.
+		//////////////////////////////////////////////////////////////////////////
+		inline planef RTM_SIMD_CALL frustum_plane_normalize(vector4f_arg0 plane) RTM_NO_EXCEPT
+		{
+			if (vector_length_squared3(plane) < 1.0e-12f)
+				return vector_set(0.0f, 0.0f, 0.0f, std::numeric_limits<float>::max());
+
+			return plane_normalize(plane);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Extracts the 6 frustum planes from a view-projection matrix.
+	// The matrix must transform row vectors: clip = point * view_projection.
+	// The depth range determines where the near plane lies in clip space.
+	// The resulting planes are normalized and point towards the inside of the frustum.
+	// With infinite projections, the plane at infinity never culls.
+	//////////////////////////////////////////////////////////////////////////
+	inline frustumf RTM_SIMD_CALL frustum_from_view_projection(matrix4x4f_arg0 view_projection, clip_depth_range depth_range = clip_depth_range::zero_to_one) RTM_NO_EXCEPT
+	{
+		// Each clip space component is the dot product of the point with a matrix column
+		const matrix4x4f columns = matrix_transpose(view_projection);
+
+		frustumf result;
+		result.planes[0] = rtm_impl::frustum_plane_normalize(vector_add(columns.w_axis, columns.x_axis));		// Left:	w + x >= 0
+		result.planes[1] = rtm_impl::frustum_plane_normalize(vector_sub(columns.w_axis, columns.x_axis));		// Right:	w - x >= 0
+		result.planes[2] = rtm_impl::frustum_plane_normalize(vector_add(columns.w_axis, columns.y_axis));		// Bottom:	w + y >= 0
+		result.planes[3] = rtm_impl::frustum_plane_normalize(vector_sub(columns.w_axis, columns.y_axis));		// Top:		w - y >= 0
+
+		if (depth_range == clip_depth_range::zero_to_one)
+			result.planes[4] = rtm_impl::frustum_plane_normalize(columns.z_axis);								// Near:	z >= 0
+		else
+			result.planes[4] = rtm_impl::frustum_plane_normalize(vector_add(columns.w_axis, columns.z_axis));	// Near:	w + z >= 0
+
+		result.planes[5] = rtm_impl::frustum_plane_normalize(vector_sub(columns.w_axis, columns.z_axis));		// Far:		w - z >= 0
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the sphere is inside or intersects the frustum, false otherwise.
+	// The test is conservative: spheres near the frustum corners can be reported as visible.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL frustum_intersects_sphere(const frustumf& frustum, vector4f_arg0 center, float radius) RTM_NO_EXCEPT
+	{
+		for (const planef& plane : frustum.planes)
+		{
+			if (plane_signed_distance(plane, center) < -radius)
+				return false;
+		}
+
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the axis aligned box is inside or intersects the frustum, false otherwise.
+	// The box is described by its center and its half extents.
+	// The test is conservative: boxes near the frustum corners can be reported as visible.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL frustum_intersects_aabb(const frustumf& frustum, vector4f_arg0 center, vector4f_arg1 extents) RTM_NO_EXCEPT
+	{
+		for (const planef& plane : frustum.planes)
+		{
+			// Projected radius of the box onto the plane normal
+			const float radius = vector_dot3(vector_abs(plane), extents);
+			if (plane_signed_distance(plane, center) < -radius)
+				return false;
+		}
+
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the axis aligned box is inside or intersects the frustum, false otherwise.
+	// See frustum_intersects_aabb(const frustumf&, vector4f_arg0, vector4f_arg1) for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL frustum_intersects_aabb(const frustumf& frustum, const aabbf& box) RTM_NO_EXCEPT
+	{
+		return frustum_intersects_aabb(frustum, box.center, box.extents);
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// A frustum plane broadcast over 8 lanes.
+		//////////////////////////////////////////////////////////////////////////
+		struct plane_x8
+		{
+			scalarf_x8 x;
+			scalarf_x8 y;
+			scalarf_x8 z;
+			scalarf_x8 w;
+		};
+
+		inline plane_x8 RTM_SIMD_CALL plane_broadcast_x8(vector4f_arg0 plane) RTM_NO_EXCEPT
+		{
+			return plane_x8{ scalar_set_x8(vector_get_x(plane)), scalar_set_x8(vector_get_y(plane)), scalar_set_x8(vector_get_z(plane)), scalar_set_x8(vector_get_w(plane)) };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the signed distance between a plane and 8 points.
+		//////////////////////////////////////////////////////////////////////////
+		inline scalarf_x8 RTM_SIMD_CALL plane_signed_distance_x8(const plane_x8& plane, const scalarf_x8& x, const scalarf_x8& y, const scalarf_x8& z) RTM_NO_EXCEPT
+		{
+			return scalar_mul_add(plane.z, z, scalar_mul_add(plane.y, y, scalar_mul_add(plane.x, x, plane.w)));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the signed distance between a plane and the furthest corner of 8 boxes in front of it.
+		// The box centers and half extents are stored in the first 6 values.
+		//////////////////////////////////////////////////////////////////////////
+		inline scalarf_x8 RTM_SIMD_CALL plane_box_max_distance_x8(const plane_x8& plane, const plane_x8& abs_normal, const scalarf_x8* values) RTM_NO_EXCEPT
+		{
+			const scalarf_x8 distance = plane_signed_distance_x8(plane, values[0], values[1], values[2]);
+			const scalarf_x8 radius = scalar_mul_add(abs_normal.z, values[5], scalar_mul_add(abs_normal.y, values[4], scalar_mul(abs_normal.x, values[3])));
+			return scalar_add(distance, radius);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Evaluates a visibility function over 'count' objects, 8 at a time, and packs the result as a bit mask.
+		// The function receives the 'num_inputs' SoA streams loaded for 8 objects and returns 8 visibility bits.
+		// The remainder is padded with zeros in a temporary buffer and the unused bits are cleared.
+		//////////////////////////////////////////////////////////////////////////
+		template<size_t num_inputs, typename function_type>
+		inline void frustum_cull_batch(const float* const (&inputs)[num_inputs], size_t count, uint32_t* out_visibility, function_type function) RTM_NO_EXCEPT
+		{
+			scalarf_x8 values[num_inputs];
+			uint32_t visibility = 0;
+
+			size_t offset = 0;
+			for (; offset + 8 <= count; offset += 8)
+			{
+				for (size_t input_index = 0; input_index < num_inputs; ++input_index)
+					values[input_index] = scalar_load_x8(inputs[input_index] + offset);
+
+				visibility |= function(values) << (offset % 32);
+
+				if ((offset % 32) == 24)
+				{
+					out_visibility[offset / 32] = visibility;
+					visibility = 0;
+				}
+			}
+
+			if (offset < count)
+			{
+				const size_t num_remaining = count - offset;
+				for (size_t input_index = 0; input_index < num_inputs; ++input_index)
+				{
+					float input_buffer[8] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+					for (size_t index = 0; index < num_remaining; ++index)
+						input_buffer[index] = inputs[input_index][offset + index];
+
+					values[input_index] = scalar_load_x8(&input_buffer[0]);
+				}
+
+				const uint32_t remaining_mask = (1U << num_remaining) - 1;
+				visibility |= (function(values) & remaining_mask) << (offset % 32);
+			}
+
+			if ((count % 32) != 0)
+				out_visibility[count / 32] = visibility;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Tests 'count' spheres against the frustum and writes their visibility as a bit mask.
+	// Sphere centers and radii are provided as SoA streams.
+	// Bit (i % 32) of out_visibility[i / 32] is set if sphere i is inside or intersects the frustum.
+	// The output must hold (count + 31) / 32 entries, unused trailing bits are cleared.
+	// Spheres are processed 8 at a time and all 6 planes are tested without branching.
+	// See frustum_intersects_sphere(const frustumf&, vector4f_arg0, float) for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline void frustum_cull_spheres(const frustumf& frustum, const float* centers_x, const float* centers_y, const float* centers_z, const float* radii, size_t count, uint32_t* out_visibility) RTM_NO_EXCEPT
+	{
+		rtm_impl::plane_x8 planes[6];
+		for (size_t plane_index = 0; plane_index < 6; ++plane_index)
+			planes[plane_index] = rtm_impl::plane_broadcast_x8(frustum.planes[plane_index]);
+
+		const float* const inputs[4] = { centers_x, centers_y, centers_z, radii };
+		rtm_impl::frustum_cull_batch(inputs, count, out_visibility,
+			[&planes](const scalarf_x8* values)
+			{
+				// A sphere is visible if it isn't fully behind any plane: distance + radius >= 0
+				scalarf_x8 min_distance = rtm_impl::plane_signed_distance_x8(planes[0], values[0], values[1], values[2]);
+				for (size_t plane_index = 1; plane_index < 6; ++plane_index)
+					min_distance = scalar_min(min_distance, rtm_impl::plane_signed_distance_x8(planes[plane_index], values[0], values[1], values[2]));
+
+				return mask_get_bits(scalar_greater_equal(scalar_add(min_distance, values[3]), scalar_set_x8(0.0f)));
+			});
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Tests 'count' axis aligned boxes against the frustum and writes their visibility as a bit mask.
+	// Box centers and half extents are provided as SoA streams.
+	// Bit (i % 32) of out_visibility[i / 32] is set if box i is inside or intersects the frustum.
+	// The output must hold (count + 31) / 32 entries, unused trailing bits are cleared.
+	// Boxes are processed 8 at a time and all 6 planes are tested without branching.
+	// See frustum_intersects_aabb(const frustumf&, vector4f_arg0, vector4f_arg1) for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline void frustum_cull_aabbs(const frustumf& frustum, const float* centers_x, const float* centers_y, const float* centers_z,
+		const float* extents_x, const float* extents_y, const float* extents_z, size_t count, uint32_t* out_visibility) RTM_NO_EXCEPT
+	{
+		rtm_impl::plane_x8 planes[6];
+		rtm_impl::plane_x8 abs_normals[6];
+		for (size_t plane_index = 0; plane_index < 6; ++plane_index)
+		{
+			planes[plane_index] = rtm_impl::plane_broadcast_x8(frustum.planes[plane_index]);
+			abs_normals[plane_index] = rtm_impl::plane_broadcast_x8(vector_abs(frustum.planes[plane_index]));
+		}
+
+		const float* const inputs[6] = { centers_x, centers_y, centers_z, extents_x, extents_y, extents_z };
+		rtm_impl::frustum_cull_batch(inputs, count, out_visibility,
+			[&planes, &abs_normals](const scalarf_x8* values)
+			{
+				// A box is visible if it isn't fully behind any plane: distance + dot(|normal|, extents) >= 0
+				scalarf_x8 min_distance = rtm_impl::plane_box_max_distance_x8(planes[0], abs_normals[0], values);
+				for (size_t plane_index = 1; plane_index < 6; ++plane_index)
+					min_distance = scalar_min(min_distance, rtm_impl::plane_box_max_distance_x8(planes[plane_index], abs_normals[plane_index], values));
+
+				return mask_get_bits(scalar_greater_equal(min_distance, scalar_set_x8(0.0f)));
+			});
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
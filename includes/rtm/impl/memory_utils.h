@@ -25,9 +25,11 @@
 // SOFTWARE.
 ////////////////////////////////////////////////////////////////////////////////
 
+#include "rtm/math.h"
 #include "rtm/impl/compiler_utils.h"
 #include "rtm/impl/error.h"
 
+#include <atomic>
 #include <cstdint>
 #include <cstring>
 #include <type_traits>
@@ -48,6 +50,12 @@ namespace rtm
 {
 	namespace rtm_impl
 	{
+		//////////////////////////////////////////////////////////////////////////
+		// The cache line size assumed for alignment and padding purposes.
+		// This is correct for most x64 and ARM processors.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr size_t k_cache_line_size = 64;
+
 		//////////////////////////////////////////////////////////////////////////
 		// Allows static branching without any warnings
 		//////////////////////////////////////////////////////////////////////////
@@ -253,6 +261,49 @@ namespace rtm
 		{
 			std::memcpy(output, &input, sizeof(DataType));
 		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Hints the CPU to bring the cache line that contains the address into the L1 cache.
+		// Prefetching never faults, the address can safely point past the end of an array.
+		//////////////////////////////////////////////////////////////////////////
+		inline void memory_prefetch(const void* address) RTM_NO_EXCEPT
+		{
+#if defined(RTM_SSE2_INTRINSICS)
+			_mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#elif defined(__clang__) || defined(__GNUC__)
+			__builtin_prefetch(address, 0, 3);
+#elif defined(_MSC_VER) && defined(RTM_NEON_INTRINSICS)
+			__prefetch(address);
+#else
+			(void)address;
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Prefetches every cache line that overlaps the [address, address + size) range.
+		// An element that straddles two cache lines is fully prefetched.
+		//////////////////////////////////////////////////////////////////////////
+		inline void memory_prefetch_range(const void* address, size_t size) RTM_NO_EXCEPT
+		{
+			const uintptr_t first_line = reinterpret_cast<uintptr_t>(address) & ~uintptr_t(k_cache_line_size - 1);
+			const uintptr_t last_line = (reinterpret_cast<uintptr_t>(address) + size - 1) & ~uintptr_t(k_cache_line_size - 1);
+			for (uintptr_t line = first_line; line <= last_line; line += k_cache_line_size)
+				memory_prefetch(reinterpret_cast<const void*>(line));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Orders the non-temporal stores issued before it with the stores that follow.
+		// Non-temporal stores are weakly ordered, this must be called before another
+		// thread or device can observe their result.
+		//////////////////////////////////////////////////////////////////////////
+		inline void memory_stream_fence() RTM_NO_EXCEPT
+		{
+#if defined(RTM_SSE2_INTRINSICS)
+			_mm_sfence();
+#else
+			std::atomic_thread_fence(std::memory_order_release);
+#endif
+		}
 	}
 }
 
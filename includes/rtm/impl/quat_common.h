@@ -57,8 +57,12 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline quatd RTM_SIMD_CALL quat_set(double x, double y, double z, double w) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_set_pd(w, z, y, x);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return quatd{ _mm_set_pd(y, x), _mm_set_pd(w, z) };
+#elif defined(RTM_NEON64_INTRINSICS)
+		return quatd{ vsetq_lane_f64(y, vdupq_n_f64(x), 1), vsetq_lane_f64(w, vdupq_n_f64(z), 1) };
 #else
 		return quatd{ x, y, z, w };
 #endif
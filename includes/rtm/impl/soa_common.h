@@ -0,0 +1,256 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/scalarf_x8.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstddef>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Transposes 4 vectors from array of structures form into structure of arrays form
+		// where each output holds a single component of all 4 inputs, one input per lane.
+		// The transpose is its own inverse and it is also used to convert back.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL transpose_4x4(vector4f_arg0 input0, vector4f_arg1 input1, vector4f_arg2 input2, vector4f_arg3 input3,
+			vector4f& out_x, vector4f& out_y, vector4f& out_z, vector4f& out_w) RTM_NO_EXCEPT
+		{
+#if defined(RTM_NEON_INTRINSICS)
+			const float32x4x2_t x0x1z0z1_y0y1w0w1 = vtrnq_f32(input0, input1);
+			const float32x4x2_t x2x3z2z3_y2y3w2w3 = vtrnq_f32(input2, input3);
+
+			out_x = vcombine_f32(vget_low_f32(x0x1z0z1_y0y1w0w1.val[0]), vget_low_f32(x2x3z2z3_y2y3w2w3.val[0]));
+			out_y = vcombine_f32(vget_low_f32(x0x1z0z1_y0y1w0w1.val[1]), vget_low_f32(x2x3z2z3_y2y3w2w3.val[1]));
+			out_z = vcombine_f32(vget_high_f32(x0x1z0z1_y0y1w0w1.val[0]), vget_high_f32(x2x3z2z3_y2y3w2w3.val[0]));
+			out_w = vcombine_f32(vget_high_f32(x0x1z0z1_y0y1w0w1.val[1]), vget_high_f32(x2x3z2z3_y2y3w2w3.val[1]));
+#else
+			const vector4f x0x1y0y1 = vector_mix<mix4::x, mix4::a, mix4::y, mix4::b>(input0, input1);
+			const vector4f z0z1w0w1 = vector_mix<mix4::z, mix4::c, mix4::w, mix4::d>(input0, input1);
+			const vector4f x2x3y2y3 = vector_mix<mix4::x, mix4::a, mix4::y, mix4::b>(input2, input3);
+			const vector4f z2z3w2w3 = vector_mix<mix4::z, mix4::c, mix4::w, mix4::d>(input2, input3);
+
+			out_x = vector_mix<mix4::x, mix4::y, mix4::a, mix4::b>(x0x1y0y1, x2x3y2y3);
+			out_y = vector_mix<mix4::z, mix4::w, mix4::c, mix4::d>(x0x1y0y1, x2x3y2y3);
+			out_z = vector_mix<mix4::x, mix4::y, mix4::a, mix4::b>(z0z1w0w1, z2z3w2w3);
+			out_w = vector_mix<mix4::z, mix4::w, mix4::c, mix4::d>(z0z1w0w1, z2z3w2w3);
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Transposes 8 vectors from array of structures form into structure of arrays form
+		// where each output holds a single component of all 8 inputs, one input per lane.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL transpose_4x8(vector4f_arg0 input0, vector4f_arg1 input1, vector4f_arg2 input2, vector4f_arg3 input3,
+			vector4f_arg4 input4, vector4f_arg5 input5, vector4f_arg6 input6, vector4f_arg7 input7,
+			scalarf_x8& out_x, scalarf_x8& out_y, scalarf_x8& out_z, scalarf_x8& out_w) RTM_NO_EXCEPT
+		{
+#if defined(RTM_AVX_INTRINSICS)
+			// Pair up the inputs 4 apart so that the in-lane shuffles below transpose both halves at once
+			const __m256 row0 = _mm256_insertf128_ps(_mm256_castps128_ps256(input0), input4, 1);
+			const __m256 row1 = _mm256_insertf128_ps(_mm256_castps128_ps256(input1), input5, 1);
+			const __m256 row2 = _mm256_insertf128_ps(_mm256_castps128_ps256(input2), input6, 1);
+			const __m256 row3 = _mm256_insertf128_ps(_mm256_castps128_ps256(input3), input7, 1);
+
+			const __m256 x0x1y0y1 = _mm256_unpacklo_ps(row0, row1);
+			const __m256 z0z1w0w1 = _mm256_unpackhi_ps(row0, row1);
+			const __m256 x2x3y2y3 = _mm256_unpacklo_ps(row2, row3);
+			const __m256 z2z3w2w3 = _mm256_unpackhi_ps(row2, row3);
+
+			out_x = _mm256_shuffle_ps(x0x1y0y1, x2x3y2y3, _MM_SHUFFLE(1, 0, 1, 0));
+			out_y = _mm256_shuffle_ps(x0x1y0y1, x2x3y2y3, _MM_SHUFFLE(3, 2, 3, 2));
+			out_z = _mm256_shuffle_ps(z0z1w0w1, z2z3w2w3, _MM_SHUFFLE(1, 0, 1, 0));
+			out_w = _mm256_shuffle_ps(z0z1w0w1, z2z3w2w3, _MM_SHUFFLE(3, 2, 3, 2));
+#else
+			transpose_4x4(input0, input1, input2, input3, out_x.lo, out_y.lo, out_z.lo, out_w.lo);
+			transpose_4x4(input4, input5, input6, input7, out_x.hi, out_y.hi, out_z.hi, out_w.hi);
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Transposes 4 wide scalars from structure of arrays form back into 8 vectors.
+		// This is the inverse of transpose_4x8.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL transpose_8x4(const scalarf_x8& input_x, const scalarf_x8& input_y, const scalarf_x8& input_z, const scalarf_x8& input_w,
+			vector4f& out0, vector4f& out1, vector4f& out2, vector4f& out3,
+			vector4f& out4, vector4f& out5, vector4f& out6, vector4f& out7) RTM_NO_EXCEPT
+		{
+#if defined(RTM_AVX_INTRINSICS)
+			const __m256 x0y0x1y1 = _mm256_unpacklo_ps(input_x, input_y);
+			const __m256 x2y2x3y3 = _mm256_unpackhi_ps(input_x, input_y);
+			const __m256 z0w0z1w1 = _mm256_unpacklo_ps(input_z, input_w);
+			const __m256 z2w2z3w3 = _mm256_unpackhi_ps(input_z, input_w);
+
+			const __m256 row0 = _mm256_shuffle_ps(x0y0x1y1, z0w0z1w1, _MM_SHUFFLE(1, 0, 1, 0));
+			const __m256 row1 = _mm256_shuffle_ps(x0y0x1y1, z0w0z1w1, _MM_SHUFFLE(3, 2, 3, 2));
+			const __m256 row2 = _mm256_shuffle_ps(x2y2x3y3, z2w2z3w3, _MM_SHUFFLE(1, 0, 1, 0));
+			const __m256 row3 = _mm256_shuffle_ps(x2y2x3y3, z2w2z3w3, _MM_SHUFFLE(3, 2, 3, 2));
+
+			out0 = _mm256_castps256_ps128(row0);
+			out1 = _mm256_castps256_ps128(row1);
+			out2 = _mm256_castps256_ps128(row2);
+			out3 = _mm256_castps256_ps128(row3);
+			out4 = _mm256_extractf128_ps(row0, 1);
+			out5 = _mm256_extractf128_ps(row1, 1);
+			out6 = _mm256_extractf128_ps(row2, 1);
+			out7 = _mm256_extractf128_ps(row3, 1);
+#else
+			transpose_4x4(input_x.lo, input_y.lo, input_z.lo, input_w.lo, out0, out1, out2, out3);
+			transpose_4x4(input_x.hi, input_y.hi, input_z.hi, input_w.hi, out4, out5, out6, out7);
+#endif
+		}
+
+#if defined(RTM_AVX512_INTRINSICS) || defined(RTM_CPU_DISPATCH)
+		//////////////////////////////////////////////////////////////////////////
+		// Loads 8 entries of 4 components each, 'stride' floats apart, and transposes
+		// them into structure of arrays form, one entry per lane.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX2 inline void avx_load_transpose_4x8(const float* input, size_t stride, __m256& out_x, __m256& out_y, __m256& out_z, __m256& out_w) RTM_NO_EXCEPT
+		{
+			const __m256 row0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(input + stride * 0)), _mm_loadu_ps(input + stride * 4), 1);
+			const __m256 row1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(input + stride * 1)), _mm_loadu_ps(input + stride * 5), 1);
+			const __m256 row2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(input + stride * 2)), _mm_loadu_ps(input + stride * 6), 1);
+			const __m256 row3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(input + stride * 3)), _mm_loadu_ps(input + stride * 7), 1);
+
+			const __m256 x0x1y0y1 = _mm256_unpacklo_ps(row0, row1);
+			const __m256 z0z1w0w1 = _mm256_unpackhi_ps(row0, row1);
+			const __m256 x2x3y2y3 = _mm256_unpacklo_ps(row2, row3);
+			const __m256 z2z3w2w3 = _mm256_unpackhi_ps(row2, row3);
+
+			out_x = _mm256_shuffle_ps(x0x1y0y1, x2x3y2y3, _MM_SHUFFLE(1, 0, 1, 0));
+			out_y = _mm256_shuffle_ps(x0x1y0y1, x2x3y2y3, _MM_SHUFFLE(3, 2, 3, 2));
+			out_z = _mm256_shuffle_ps(z0z1w0w1, z2z3w2w3, _MM_SHUFFLE(1, 0, 1, 0));
+			out_w = _mm256_shuffle_ps(z0z1w0w1, z2z3w2w3, _MM_SHUFFLE(3, 2, 3, 2));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Transposes 8 lanes from structure of arrays form back into 8 entries of
+		// 4 components each and writes them 'stride' floats apart.
+		// This is the inverse of avx_load_transpose_4x8.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX2 inline void avx_transpose_store_4x8(__m256 input_x, __m256 input_y, __m256 input_z, __m256 input_w, size_t stride, float* output) RTM_NO_EXCEPT
+		{
+			const __m256 x0y0x1y1 = _mm256_unpacklo_ps(input_x, input_y);
+			const __m256 x2y2x3y3 = _mm256_unpackhi_ps(input_x, input_y);
+			const __m256 z0w0z1w1 = _mm256_unpacklo_ps(input_z, input_w);
+			const __m256 z2w2z3w3 = _mm256_unpackhi_ps(input_z, input_w);
+
+			const __m256 row0 = _mm256_shuffle_ps(x0y0x1y1, z0w0z1w1, _MM_SHUFFLE(1, 0, 1, 0));
+			const __m256 row1 = _mm256_shuffle_ps(x0y0x1y1, z0w0z1w1, _MM_SHUFFLE(3, 2, 3, 2));
+			const __m256 row2 = _mm256_shuffle_ps(x2y2x3y3, z2w2z3w3, _MM_SHUFFLE(1, 0, 1, 0));
+			const __m256 row3 = _mm256_shuffle_ps(x2y2x3y3, z2w2z3w3, _MM_SHUFFLE(3, 2, 3, 2));
+
+			_mm_storeu_ps(output + stride * 0, _mm256_castps256_ps128(row0));
+			_mm_storeu_ps(output + stride * 1, _mm256_castps256_ps128(row1));
+			_mm_storeu_ps(output + stride * 2, _mm256_castps256_ps128(row2));
+			_mm_storeu_ps(output + stride * 3, _mm256_castps256_ps128(row3));
+			_mm_storeu_ps(output + stride * 4, _mm256_extractf128_ps(row0, 1));
+			_mm_storeu_ps(output + stride * 5, _mm256_extractf128_ps(row1, 1));
+			_mm_storeu_ps(output + stride * 6, _mm256_extractf128_ps(row2, 1));
+			_mm_storeu_ps(output + stride * 7, _mm256_extractf128_ps(row3, 1));
+		}
+#endif
+
+#if defined(RTM_AVX512_INTRINSICS) || defined(RTM_CPU_DISPATCH)
+		//////////////////////////////////////////////////////////////////////////
+		// Returns a mask with the lower 'num_lanes' lanes enabled, clamped to [0, 16].
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX512 inline __mmask16 avx512_lane_mask(int32_t num_lanes) RTM_NO_EXCEPT
+		{
+			return num_lanes >= 16 ? __mmask16(0xFFFF) : (num_lanes <= 0 ? __mmask16(0) : __mmask16((1U << num_lanes) - 1));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Loads up to 16 consecutive 4 component entries and transposes them into
+		// structure of arrays form, one entry per lane.
+		// Lanes past 'count' are set to zero and their memory is never touched.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX512 inline void avx512_load_transpose_4x16(const float* input, uint32_t count, __m512& out_x, __m512& out_y, __m512& out_z, __m512& out_w) RTM_NO_EXCEPT
+		{
+			const int32_t num_floats = int32_t(count) * 4;
+			const __m512 row0 = _mm512_maskz_loadu_ps(avx512_lane_mask(num_floats - 0), input + 0);
+			const __m512 row1 = _mm512_maskz_loadu_ps(avx512_lane_mask(num_floats - 16), input + 16);
+			const __m512 row2 = _mm512_maskz_loadu_ps(avx512_lane_mask(num_floats - 32), input + 32);
+			const __m512 row3 = _mm512_maskz_loadu_ps(avx512_lane_mask(num_floats - 48), input + 48);
+
+			// Deinterleave pairs of rows: [x0..x7 y0..y7] and [z0..z7 w0..w7]
+			const __m512i xy_indices = _mm512_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28, 1, 5, 9, 13, 17, 21, 25, 29);
+			const __m512i zw_indices = _mm512_setr_epi32(2, 6, 10, 14, 18, 22, 26, 30, 3, 7, 11, 15, 19, 23, 27, 31);
+			const __m512 xy_lo = _mm512_permutex2var_ps(row0, xy_indices, row1);
+			const __m512 zw_lo = _mm512_permutex2var_ps(row0, zw_indices, row1);
+			const __m512 xy_hi = _mm512_permutex2var_ps(row2, xy_indices, row3);
+			const __m512 zw_hi = _mm512_permutex2var_ps(row2, zw_indices, row3);
+
+			// Merge the low and high halves
+			const __m512i lo_indices = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 16, 17, 18, 19, 20, 21, 22, 23);
+			const __m512i hi_indices = _mm512_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15, 24, 25, 26, 27, 28, 29, 30, 31);
+			out_x = _mm512_permutex2var_ps(xy_lo, lo_indices, xy_hi);
+			out_y = _mm512_permutex2var_ps(xy_lo, hi_indices, xy_hi);
+			out_z = _mm512_permutex2var_ps(zw_lo, lo_indices, zw_hi);
+			out_w = _mm512_permutex2var_ps(zw_lo, hi_indices, zw_hi);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Transposes 16 lanes from structure of arrays form back into up to 16
+		// consecutive 4 component entries and writes them.
+		// Lanes past 'count' are not written.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX512 inline void avx512_transpose_store_4x16(__m512 input_x, __m512 input_y, __m512 input_z, __m512 input_w, uint32_t count, float* output) RTM_NO_EXCEPT
+		{
+			// Split into [x0..x7 y0..y7] and [x8..x15 y8..y15], same with [zw]
+			const __m512i lo_indices = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 16, 17, 18, 19, 20, 21, 22, 23);
+			const __m512i hi_indices = _mm512_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15, 24, 25, 26, 27, 28, 29, 30, 31);
+			const __m512 xy_lo = _mm512_permutex2var_ps(input_x, lo_indices, input_y);
+			const __m512 xy_hi = _mm512_permutex2var_ps(input_x, hi_indices, input_y);
+			const __m512 zw_lo = _mm512_permutex2var_ps(input_z, lo_indices, input_w);
+			const __m512 zw_hi = _mm512_permutex2var_ps(input_z, hi_indices, input_w);
+
+			// Interleave back into [x0 y0 z0 w0 x1 y1 z1 w1 ..]
+			const __m512i row_even_indices = _mm512_setr_epi32(0, 8, 16, 24, 1, 9, 17, 25, 2, 10, 18, 26, 3, 11, 19, 27);
+			const __m512i row_odd_indices = _mm512_setr_epi32(4, 12, 20, 28, 5, 13, 21, 29, 6, 14, 22, 30, 7, 15, 23, 31);
+			const __m512 row0 = _mm512_permutex2var_ps(xy_lo, row_even_indices, zw_lo);
+			const __m512 row1 = _mm512_permutex2var_ps(xy_lo, row_odd_indices, zw_lo);
+			const __m512 row2 = _mm512_permutex2var_ps(xy_hi, row_even_indices, zw_hi);
+			const __m512 row3 = _mm512_permutex2var_ps(xy_hi, row_odd_indices, zw_hi);
+
+			const int32_t num_floats = int32_t(count) * 4;
+			_mm512_mask_storeu_ps(output + 0, avx512_lane_mask(num_floats - 0), row0);
+			_mm512_mask_storeu_ps(output + 16, avx512_lane_mask(num_floats - 16), row1);
+			_mm512_mask_storeu_ps(output + 32, avx512_lane_mask(num_floats - 32), row2);
+			_mm512_mask_storeu_ps(output + 48, avx512_lane_mask(num_floats - 48), row3);
+		}
+#endif
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
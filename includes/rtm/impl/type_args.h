@@ -83,6 +83,10 @@ namespace rtm
 	using qvvf_arg1 = const qvvf;
 	using qvvf_argn = const qvvf&;
 
+	using dualquatf_arg0 = const dualquatf;
+	using dualquatf_arg1 = const dualquatf;
+	using dualquatf_argn = const dualquatf&;
+
 	using matrix3x3f_arg0 = const matrix3x3f;
 	using matrix3x3f_arg1 = const matrix3x3f&;
 	using matrix3x3f_argn = const matrix3x3f&;
@@ -146,6 +150,10 @@ namespace rtm
 	using qvvf_arg1 = const qvvf;
 	using qvvf_argn = const qvvf&;
 
+	using dualquatf_arg0 = const dualquatf;
+	using dualquatf_arg1 = const dualquatf;
+	using dualquatf_argn = const dualquatf&;
+
 	using matrix3x3f_arg0 = const matrix3x3f;
 	using matrix3x3f_arg1 = const matrix3x3f;
 	using matrix3x3f_argn = const matrix3x3f&;
@@ -207,6 +215,10 @@ namespace rtm
 	using qvvf_arg1 = const qvvf&;
 	using qvvf_argn = const qvvf&;
 
+	using dualquatf_arg0 = const dualquatf&;
+	using dualquatf_arg1 = const dualquatf&;
+	using dualquatf_argn = const dualquatf&;
+
 	using matrix3x3f_arg0 = const matrix3x3f&;
 	using matrix3x3f_arg1 = const matrix3x3f&;
 	using matrix3x3f_argn = const matrix3x3f&;
@@ -268,6 +280,10 @@ namespace rtm
 	using qvvf_arg1 = const qvvf&;
 	using qvvf_argn = const qvvf&;
 
+	using dualquatf_arg0 = const dualquatf&;
+	using dualquatf_arg1 = const dualquatf&;
+	using dualquatf_argn = const dualquatf&;
+
 	using matrix3x3f_arg0 = const matrix3x3f&;
 	using matrix3x3f_arg1 = const matrix3x3f&;
 	using matrix3x3f_argn = const matrix3x3f&;
@@ -334,6 +350,10 @@ namespace rtm
 	using qvvf_arg1 = const qvvf&;
 	using qvvf_argn = const qvvf&;
 
+	using dualquatf_arg0 = const dualquatf&;
+	using dualquatf_arg1 = const dualquatf&;
+	using dualquatf_argn = const dualquatf&;
+
 	using matrix3x3f_arg0 = const matrix3x3f&;
 	using matrix3x3f_arg1 = const matrix3x3f&;
 	using matrix3x3f_argn = const matrix3x3f&;
@@ -391,6 +411,10 @@ namespace rtm
 	using qvvf_arg1 = const qvvf&;
 	using qvvf_argn = const qvvf&;
 
+	using dualquatf_arg0 = const dualquatf&;
+	using dualquatf_arg1 = const dualquatf&;
+	using dualquatf_argn = const dualquatf&;
+
 	using matrix3x3f_arg0 = const matrix3x3f&;
 	using matrix3x3f_arg1 = const matrix3x3f&;
 	using matrix3x3f_argn = const matrix3x3f&;
@@ -403,4 +427,224 @@ namespace rtm
 	using matrix4x4f_arg1 = const matrix4x4f&;
 	using matrix4x4f_argn = const matrix4x4f&;
 #endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// The double precision types only fit in a single register with AVX (__m256d).
+	// Otherwise, they are made of multiple registers and passed by const& except on ARM64.
+	//////////////////////////////////////////////////////////////////////////
+
+#if defined(RTM_AVX_INTRINSICS) && defined(RTM_USE_VECTORCALL)
+	// On x64 with __vectorcall, the first 6x vector4d/quatd arguments can be passed by value in a register,
+	// everything else afterwards is passed by const&. They can also be returned by register.
+	using vector4d_arg0 = const vector4d;
+	using vector4d_arg1 = const vector4d;
+	using vector4d_arg2 = const vector4d;
+	using vector4d_arg3 = const vector4d;
+	using vector4d_arg4 = const vector4d;
+	using vector4d_arg5 = const vector4d;
+	using vector4d_arg6 = const vector4d&;
+	using vector4d_arg7 = const vector4d&;
+	using vector4d_argn = const vector4d&;
+
+	using quatd_arg0 = const quatd;
+	using quatd_arg1 = const quatd;
+	using quatd_arg2 = const quatd;
+	using quatd_arg3 = const quatd;
+	using quatd_arg4 = const quatd;
+	using quatd_arg5 = const quatd;
+	using quatd_arg6 = const quatd&;
+	using quatd_arg7 = const quatd&;
+	using quatd_argn = const quatd&;
+
+	using mask4q_arg0 = const mask4q;
+	using mask4q_arg1 = const mask4q;
+	using mask4q_arg2 = const mask4q;
+	using mask4q_arg3 = const mask4q;
+	using mask4q_arg4 = const mask4q;
+	using mask4q_arg5 = const mask4q;
+	using mask4q_arg6 = const mask4q&;
+	using mask4q_arg7 = const mask4q&;
+	using mask4q_argn = const mask4q&;
+
+	// With __vectorcall, vector aggregates are also passed by register and they can use up to 4 registers.
+
+	using qvvd_arg0 = const qvvd;
+	using qvvd_arg1 = const qvvd;
+	using qvvd_argn = const qvvd&;
+
+	using dualquatd_arg0 = const dualquatd;
+	using dualquatd_arg1 = const dualquatd;
+	using dualquatd_argn = const dualquatd&;
+
+	using matrix3x3d_arg0 = const matrix3x3d;
+	using matrix3x3d_arg1 = const matrix3x3d&;
+	using matrix3x3d_argn = const matrix3x3d&;
+
+	using matrix3x4d_arg0 = const matrix3x4d;
+	using matrix3x4d_arg1 = const matrix3x4d&;
+	using matrix3x4d_argn = const matrix3x4d&;
+
+	using matrix4x4d_arg0 = const matrix4x4d;
+	using matrix4x4d_arg1 = const matrix4x4d&;
+	using matrix4x4d_argn = const matrix4x4d&;
+#elif defined(RTM_AVX_INTRINSICS) && defined(__x86_64__)
+	// On x64 with gcc and clang, the first 8x vector4d/quatd arguments can be passed by value in a register,
+	// everything else afterwards is passed by const&. They can also be returned by register.
+	using vector4d_arg0 = const vector4d;
+	using vector4d_arg1 = const vector4d;
+	using vector4d_arg2 = const vector4d;
+	using vector4d_arg3 = const vector4d;
+	using vector4d_arg4 = const vector4d;
+	using vector4d_arg5 = const vector4d;
+	using vector4d_arg6 = const vector4d;
+	using vector4d_arg7 = const vector4d;
+	using vector4d_argn = const vector4d&;
+
+	using quatd_arg0 = const quatd;
+	using quatd_arg1 = const quatd;
+	using quatd_arg2 = const quatd;
+	using quatd_arg3 = const quatd;
+	using quatd_arg4 = const quatd;
+	using quatd_arg5 = const quatd;
+	using quatd_arg6 = const quatd;
+	using quatd_arg7 = const quatd;
+	using quatd_argn = const quatd&;
+
+	using mask4q_arg0 = const mask4q;
+	using mask4q_arg1 = const mask4q;
+	using mask4q_arg2 = const mask4q;
+	using mask4q_arg3 = const mask4q;
+	using mask4q_arg4 = const mask4q;
+	using mask4q_arg5 = const mask4q;
+	using mask4q_arg6 = const mask4q;
+	using mask4q_arg7 = const mask4q;
+	using mask4q_argn = const mask4q&;
+
+	// Aggregates are not returned by register, we pass them by const&
+
+	using qvvd_arg0 = const qvvd&;
+	using qvvd_arg1 = const qvvd&;
+	using qvvd_argn = const qvvd&;
+
+	using dualquatd_arg0 = const dualquatd&;
+	using dualquatd_arg1 = const dualquatd&;
+	using dualquatd_argn = const dualquatd&;
+
+	using matrix3x3d_arg0 = const matrix3x3d&;
+	using matrix3x3d_arg1 = const matrix3x3d&;
+	using matrix3x3d_argn = const matrix3x3d&;
+
+	using matrix3x4d_arg0 = const matrix3x4d&;
+	using matrix3x4d_arg1 = const matrix3x4d&;
+	using matrix3x4d_argn = const matrix3x4d&;
+
+	using matrix4x4d_arg0 = const matrix4x4d&;
+	using matrix4x4d_arg1 = const matrix4x4d&;
+	using matrix4x4d_argn = const matrix4x4d&;
+#elif defined(RTM_NEON64_INTRINSICS)
+	// On ARM64 NEON, vector4d/quatd/mask4q are a pair of registers and the first 4x can be passed by value
+	// in registers, everything else afterwards is passed by const&. They can also be returned by register.
+	using vector4d_arg0 = const vector4d;
+	using vector4d_arg1 = const vector4d;
+	using vector4d_arg2 = const vector4d;
+	using vector4d_arg3 = const vector4d;
+	using vector4d_arg4 = const vector4d&;
+	using vector4d_arg5 = const vector4d&;
+	using vector4d_arg6 = const vector4d&;
+	using vector4d_arg7 = const vector4d&;
+	using vector4d_argn = const vector4d&;
+
+	using quatd_arg0 = const quatd;
+	using quatd_arg1 = const quatd;
+	using quatd_arg2 = const quatd;
+	using quatd_arg3 = const quatd;
+	using quatd_arg4 = const quatd&;
+	using quatd_arg5 = const quatd&;
+	using quatd_arg6 = const quatd&;
+	using quatd_arg7 = const quatd&;
+	using quatd_argn = const quatd&;
+
+	using mask4q_arg0 = const mask4q;
+	using mask4q_arg1 = const mask4q;
+	using mask4q_arg2 = const mask4q;
+	using mask4q_arg3 = const mask4q;
+	using mask4q_arg4 = const mask4q&;
+	using mask4q_arg5 = const mask4q&;
+	using mask4q_arg6 = const mask4q&;
+	using mask4q_arg7 = const mask4q&;
+	using mask4q_argn = const mask4q&;
+
+	// Aggregates made of more than 4 registers are passed by const&
+
+	using qvvd_arg0 = const qvvd&;
+	using qvvd_arg1 = const qvvd&;
+	using qvvd_argn = const qvvd&;
+
+	using dualquatd_arg0 = const dualquatd&;
+	using dualquatd_arg1 = const dualquatd&;
+	using dualquatd_argn = const dualquatd&;
+
+	using matrix3x3d_arg0 = const matrix3x3d&;
+	using matrix3x3d_arg1 = const matrix3x3d&;
+	using matrix3x3d_argn = const matrix3x3d&;
+
+	using matrix3x4d_arg0 = const matrix3x4d&;
+	using matrix3x4d_arg1 = const matrix3x4d&;
+	using matrix3x4d_argn = const matrix3x4d&;
+
+	using matrix4x4d_arg0 = const matrix4x4d&;
+	using matrix4x4d_arg1 = const matrix4x4d&;
+	using matrix4x4d_argn = const matrix4x4d&;
+#else
+	// On every other platform, everything is passed by const&
+	using vector4d_arg0 = const vector4d&;
+	using vector4d_arg1 = const vector4d&;
+	using vector4d_arg2 = const vector4d&;
+	using vector4d_arg3 = const vector4d&;
+	using vector4d_arg4 = const vector4d&;
+	using vector4d_arg5 = const vector4d&;
+	using vector4d_arg6 = const vector4d&;
+	using vector4d_arg7 = const vector4d&;
+	using vector4d_argn = const vector4d&;
+
+	using quatd_arg0 = const quatd&;
+	using quatd_arg1 = const quatd&;
+	using quatd_arg2 = const quatd&;
+	using quatd_arg3 = const quatd&;
+	using quatd_arg4 = const quatd&;
+	using quatd_arg5 = const quatd&;
+	using quatd_arg6 = const quatd&;
+	using quatd_arg7 = const quatd&;
+	using quatd_argn = const quatd&;
+
+	using mask4q_arg0 = const mask4q&;
+	using mask4q_arg1 = const mask4q&;
+	using mask4q_arg2 = const mask4q&;
+	using mask4q_arg3 = const mask4q&;
+	using mask4q_arg4 = const mask4q&;
+	using mask4q_arg5 = const mask4q&;
+	using mask4q_arg6 = const mask4q&;
+	using mask4q_arg7 = const mask4q&;
+	using mask4q_argn = const mask4q&;
+
+	using qvvd_arg0 = const qvvd&;
+	using qvvd_arg1 = const qvvd&;
+	using qvvd_argn = const qvvd&;
+
+	using dualquatd_arg0 = const dualquatd&;
+	using dualquatd_arg1 = const dualquatd&;
+	using dualquatd_argn = const dualquatd&;
+
+	using matrix3x3d_arg0 = const matrix3x3d&;
+	using matrix3x3d_arg1 = const matrix3x3d&;
+	using matrix3x3d_argn = const matrix3x3d&;
+
+	using matrix3x4d_arg0 = const matrix3x4d&;
+	using matrix3x4d_arg1 = const matrix3x4d&;
+	using matrix3x4d_argn = const matrix3x4d&;
+
+	using matrix4x4d_arg0 = const matrix4x4d&;
+	using matrix4x4d_arg1 = const matrix4x4d&;
+	using matrix4x4d_argn = const matrix4x4d&;
+#endif
 }
@@ -103,10 +103,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Creates a vector4 from all 4 components.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_set(double x, double y, double z, double w) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_set(double x, double y, double z, double w) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_set_pd(w, z, y, x);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_set_pd(y, x), _mm_set_pd(w, z) };
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ vsetq_lane_f64(y, vdupq_n_f64(x), 1), vsetq_lane_f64(w, vdupq_n_f64(z), 1) };
 #else
 		return vector4d{ x, y, z, w };
 #endif
@@ -115,10 +119,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Creates a vector4 from the [xyz] components and sets [w] to 0.0.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_set(double x, double y, double z) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_set(double x, double y, double z) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_set_pd(0.0, z, y, x);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_set_pd(y, x), _mm_set_pd(0.0, z) };
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ vsetq_lane_f64(y, vdupq_n_f64(x), 1), vsetq_lane_f64(z, vdupq_n_f64(0.0), 0) };
 #else
 		return vector4d{ x, y, z, 0.0 };
 #endif
@@ -127,11 +135,16 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Creates a vector4 from a single value for all 4 components.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_set(double xyzw) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_set(double xyzw) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_set1_pd(xyzw);
+#elif defined(RTM_SSE2_INTRINSICS)
 		const __m128d xyzw_pd = _mm_set1_pd(xyzw);
 		return vector4d{ xyzw_pd, xyzw_pd };
+#elif defined(RTM_NEON64_INTRINSICS)
+		const float64x2_t xyzw_pd = vdupq_n_f64(xyzw);
+		return vector4d{ xyzw_pd, xyzw_pd };
 #else
 		return vector4d{ xyzw, xyzw, xyzw, xyzw };
 #endif
@@ -144,7 +157,11 @@ namespace rtm
 	inline vector4d RTM_SIMD_CALL vector_set(scalard xyzw) RTM_NO_EXCEPT
 	{
 		const __m128d xyzw_pd = _mm_shuffle_pd(xyzw, xyzw, 0);
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_insertf128_pd(_mm256_castpd128_pd256(xyzw_pd), xyzw_pd, 1);
+#else
 		return vector4d{ xyzw_pd, xyzw_pd };
+#endif
 	}
 #endif
 
@@ -221,9 +238,14 @@ namespace rtm
 				{
 				case vector_constants::zero:
 				default:
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+					return _mm256_setzero_pd();
+#elif defined(RTM_SSE2_INTRINSICS)
 					const __m128d zero_pd = _mm_setzero_pd();
 					return vector4d{ zero_pd, zero_pd };
+#elif defined(RTM_NEON64_INTRINSICS)
+					const float64x2_t zero_pd = vdupq_n_f64(0.0);
+					return vector4d{ zero_pd, zero_pd };
 #else
 					return vector_set(0.0);
 #endif
@@ -36,8 +36,12 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline mask4q RTM_SIMD_CALL mask_set(uint64_t x, uint64_t y, uint64_t z, uint64_t w) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_castsi256_pd(_mm256_set_epi64x(w, z, y, x));
+#elif defined(RTM_SSE2_INTRINSICS)
 		return mask4q{ _mm_castsi128_pd(_mm_set_epi64x(y, x)), _mm_castsi128_pd(_mm_set_epi64x(w, z)) };
+#elif defined(RTM_NEON64_INTRINSICS)
+		return mask4q{ vsetq_lane_u64(y, vdupq_n_u64(x), 1), vsetq_lane_u64(w, vdupq_n_u64(z), 1) };
 #else
 		return mask4q{ x, y, z, w };
 #endif
@@ -46,15 +50,24 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the mask4q [x] component.
 	//////////////////////////////////////////////////////////////////////////
-	inline uint64_t RTM_SIMD_CALL mask_get_x(const mask4q& input) RTM_NO_EXCEPT
+	inline uint64_t RTM_SIMD_CALL mask_get_x(mask4q_arg0 input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+#if defined(_M_X64)
+		return _mm_cvtsi128_si64(_mm_castpd_si128(_mm256_castpd256_pd128(input)));
+#else
+		// Just sign extend on 32bit systems
+		return (uint64_t)_mm_cvtsi128_si32(_mm_castpd_si128(_mm256_castpd256_pd128(input)));
+#endif
+#elif defined(RTM_SSE2_INTRINSICS)
 #if defined(_M_X64)
 		return _mm_cvtsi128_si64(_mm_castpd_si128(input.xy));
 #else
 		// Just sign extend on 32bit systems
 		return (uint64_t)_mm_cvtsi128_si32(_mm_castpd_si128(input.xy));
 #endif
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vgetq_lane_u64(input.xy, 0);
 #else
 		return input.x;
 #endif
@@ -63,15 +76,24 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the mask4q [y] component.
 	//////////////////////////////////////////////////////////////////////////
-	inline uint64_t RTM_SIMD_CALL mask_get_y(const mask4q& input) RTM_NO_EXCEPT
+	inline uint64_t RTM_SIMD_CALL mask_get_y(mask4q_arg0 input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+#if defined(_M_X64)
+		return _mm_cvtsi128_si64(_mm_castpd_si128(_mm_permute_pd(_mm256_castpd256_pd128(input), 1)));
+#else
+		// Just sign extend on 32bit systems
+		return (uint64_t)_mm_cvtsi128_si32(_mm_castpd_si128(_mm_permute_pd(_mm256_castpd256_pd128(input), 1)));
+#endif
+#elif defined(RTM_SSE2_INTRINSICS)
 #if defined(_M_X64)
 		return _mm_cvtsi128_si64(_mm_castpd_si128(_mm_shuffle_pd(input.xy, input.xy, 1)));
 #else
 		// Just sign extend on 32bit systems
 		return (uint64_t)_mm_cvtsi128_si32(_mm_castpd_si128(_mm_shuffle_pd(input.xy, input.xy, 1)));
 #endif
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vgetq_lane_u64(input.xy, 1);
 #else
 		return input.y;
 #endif
@@ -80,15 +102,24 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the mask4q [z] component.
 	//////////////////////////////////////////////////////////////////////////
-	inline uint64_t RTM_SIMD_CALL mask_get_z(const mask4q& input) RTM_NO_EXCEPT
+	inline uint64_t RTM_SIMD_CALL mask_get_z(mask4q_arg0 input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+#if defined(_M_X64)
+		return _mm_cvtsi128_si64(_mm_castpd_si128(_mm256_extractf128_pd(input, 1)));
+#else
+		// Just sign extend on 32bit systems
+		return (uint64_t)_mm_cvtsi128_si32(_mm_castpd_si128(_mm256_extractf128_pd(input, 1)));
+#endif
+#elif defined(RTM_SSE2_INTRINSICS)
 #if defined(_M_X64)
 		return _mm_cvtsi128_si64(_mm_castpd_si128(input.zw));
 #else
 		// Just sign extend on 32bit systems
 		return (uint64_t)_mm_cvtsi128_si32(_mm_castpd_si128(input.zw));
 #endif
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vgetq_lane_u64(input.zw, 0);
 #else
 		return input.z;
 #endif
@@ -97,15 +128,24 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the mask4q [w] component.
 	//////////////////////////////////////////////////////////////////////////
-	inline uint64_t RTM_SIMD_CALL mask_get_w(const mask4q& input) RTM_NO_EXCEPT
+	inline uint64_t RTM_SIMD_CALL mask_get_w(mask4q_arg0 input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+#if defined(_M_X64)
+		return _mm_cvtsi128_si64(_mm_castpd_si128(_mm_permute_pd(_mm256_extractf128_pd(input, 1), 1)));
+#else
+		// Just sign extend on 32bit systems
+		return (uint64_t)_mm_cvtsi128_si32(_mm_castpd_si128(_mm_permute_pd(_mm256_extractf128_pd(input, 1), 1)));
+#endif
+#elif defined(RTM_SSE2_INTRINSICS)
 #if defined(_M_X64)
 		return _mm_cvtsi128_si64(_mm_castpd_si128(_mm_shuffle_pd(input.zw, input.zw, 1)));
 #else
 		// Just sign extend on 32bit systems
 		return (uint64_t)_mm_cvtsi128_si32(_mm_castpd_si128(_mm_shuffle_pd(input.zw, input.zw, 1)));
 #endif
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vgetq_lane_u64(input.zw, 1);
 #else
 		return input.w;
 #endif
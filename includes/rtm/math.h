@@ -30,6 +30,14 @@
 //////////////////////////////////////////////////////////////////////////
 
 #if !defined(RTM_NO_INTRINSICS)
+	#if defined(__AVX512F__)
+		#define RTM_AVX512_INTRINSICS
+		#define RTM_AVX_INTRINSICS
+		#define RTM_SSE4_INTRINSICS
+		#define RTM_SSE3_INTRINSICS
+		#define RTM_SSE2_INTRINSICS
+	#endif
+
 	#if defined(__AVX__)
 		#define RTM_AVX_INTRINSICS
 		#define RTM_SSE4_INTRINSICS
@@ -37,6 +45,10 @@
 		#define RTM_SSE2_INTRINSICS
 	#endif
 
+	#if (defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))) && !defined(RTM_NO_FMA_INTRINSICS)
+		#define RTM_FMA_INTRINSICS
+	#endif
+
 	#if defined(__SSE4_1__)
 		#define RTM_SSE4_INTRINSICS
 		#define RTM_SSE3_INTRINSICS
@@ -107,6 +119,42 @@
 	#endif
 #endif
 
+//////////////////////////////////////////////////////////////////////////
+// Runtime CPU dispatch, see rtm/cpu_dispatch.h
+// The kernels for instruction sets above the compilation baseline are compiled
+// with per function target attributes. Define RTM_NO_CPU_DISPATCH to disable them.
+// The lowest tier runs the batch functions compiled for the baseline, dispatch is
+// thus only enabled when the baseline is below AVX.
+// The AVX2 kernels are also used by the AVX-512 batch functions, the baseline
+// might not include FMA.
+//////////////////////////////////////////////////////////////////////////
+#if defined(RTM_SSE2_INTRINSICS) && (defined(__clang__) || defined(__GNUC__))
+	#define RTM_IMPL_TARGET_AVX2 __attribute__((target("avx2,fma")))
+	#define RTM_IMPL_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma")))
+#endif
+
+#if defined(RTM_SSE2_INTRINSICS) && !defined(RTM_AVX_INTRINSICS) && !defined(RTM_NO_CPU_DISPATCH)
+	#if defined(__clang__) || defined(__GNUC__)
+		#define RTM_CPU_DISPATCH
+	#elif defined(_MSC_VER) && _MSC_VER >= 1910
+		// MSVC allows every intrinsic regardless of the /arch switch
+		#define RTM_CPU_DISPATCH
+	#endif
+#endif
+
+#if defined(RTM_CPU_DISPATCH) && defined(RTM_AVX_INTRINSICS)
+	#error "Runtime dispatch requires a compilation baseline below AVX, its lowest tier runs the baseline batch functions"
+#endif
+
+#if !defined(RTM_IMPL_TARGET_AVX2)
+	#define RTM_IMPL_TARGET_AVX2
+	#define RTM_IMPL_TARGET_AVX512
+#endif
+
+#if defined(RTM_CPU_DISPATCH) && !defined(RTM_AVX_INTRINSICS)
+	#include <immintrin.h>
+#endif
+
 // By default, we include the type definitions and error handling
 #include "rtm/impl/error.h"
 #include "rtm/types.h"
@@ -53,7 +53,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Converts a 3x3 matrix into a rotation quaternion.
 	//////////////////////////////////////////////////////////////////////////
-	inline quatd quat_from_matrix(const matrix3x3d& input) RTM_NO_EXCEPT
+	inline quatd RTM_SIMD_CALL quat_from_matrix(matrix3x3d_arg0 input) RTM_NO_EXCEPT
 	{
 		return rtm_impl::quat_from_matrix(input.x_axis, input.y_axis, input.z_axis);
 	}
@@ -62,7 +62,7 @@ namespace rtm
 	// Multiplies two 3x3 matrices.
 	// Multiplication order is as follow: local_to_world = matrix_mul(local_to_object, object_to_world)
 	//////////////////////////////////////////////////////////////////////////
-	inline matrix3x3d RTM_SIMD_CALL matrix_mul(const matrix3x3d& lhs, const matrix3x3d& rhs) RTM_NO_EXCEPT
+	inline matrix3x3d RTM_SIMD_CALL matrix_mul(matrix3x3d_arg0 lhs, matrix3x3d_arg1 rhs) RTM_NO_EXCEPT
 	{
 		vector4d tmp = vector_mul(vector_dup_x(lhs.x_axis), rhs.x_axis);
 		tmp = vector_mul_add(vector_dup_y(lhs.x_axis), rhs.y_axis, tmp);
@@ -86,7 +86,7 @@ namespace rtm
 	// Multiplies a 3x3 matrix and a 3D vector.
 	// Multiplication order is as follow: world_position = matrix_mul(local_position, local_to_world)
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d RTM_SIMD_CALL matrix_mul_vector3(const vector4d& vec3, const matrix3x3d& mtx) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL matrix_mul_vector3(vector4d_arg0 vec3, matrix3x3d_arg1 mtx) RTM_NO_EXCEPT
 	{
 		vector4d tmp;
 
@@ -100,7 +100,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Transposes a 3x3 matrix.
 	//////////////////////////////////////////////////////////////////////////
-	inline matrix3x3d RTM_SIMD_CALL matrix_transpose(const matrix3x3d& input) RTM_NO_EXCEPT
+	inline matrix3x3d RTM_SIMD_CALL matrix_transpose(matrix3x3d_arg0 input) RTM_NO_EXCEPT
 	{
 		const vector4d v00_v01_v10_v11 = vector_mix<mix4::x, mix4::y, mix4::a, mix4::b>(input.x_axis, input.y_axis);
 		const vector4d v02_v03_v12_v13 = vector_mix<mix4::z, mix4::w, mix4::c, mix4::d>(input.x_axis, input.y_axis);
@@ -114,7 +114,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Inverses a 3x3 matrix.
 	//////////////////////////////////////////////////////////////////////////
-	inline matrix3x3d RTM_SIMD_CALL matrix_inverse(const matrix3x3d& input) RTM_NO_EXCEPT
+	inline matrix3x3d RTM_SIMD_CALL matrix_inverse(matrix3x3d_arg0 input) RTM_NO_EXCEPT
 	{
 		const vector4d v00_v01_v10_v11 = vector_mix<mix4::x, mix4::y, mix4::a, mix4::b>(input.x_axis, input.y_axis);
 		const vector4d v02_v03_v12_v13 = vector_mix<mix4::z, mix4::w, mix4::c, mix4::d>(input.x_axis, input.y_axis);
@@ -173,7 +173,7 @@ namespace rtm
 	// TODO: Implement rotation recovering, perhaps in a separate function and rename this
 	// one to matrix_remove_non_zero_scale(..)
 	//////////////////////////////////////////////////////////////////////////
-	inline matrix3x3d matrix_remove_scale(const matrix3x3d& input) RTM_NO_EXCEPT
+	inline matrix3x3d RTM_SIMD_CALL matrix_remove_scale(matrix3x3d_arg0 input) RTM_NO_EXCEPT
 	{
 		matrix3x3d result;
 		result.x_axis = vector_normalize3(input.x_axis, input.x_axis);
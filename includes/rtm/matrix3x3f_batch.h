@@ -0,0 +1,139 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "rtm/math.h"
+#include "rtm/matrix3x3f.h"
+#include "rtm/scalarf_x8.h"
+#include "rtm/vector3f_x8.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/soa_common.h"
+
+#include <cstddef>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Loads 8 3D axes, 'stride' vectors apart, and transposes them, one axis per lane.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector3f_x8 RTM_SIMD_CALL matrix_load_axis3_x8(const vector4f* axes, size_t stride) RTM_NO_EXCEPT
+		{
+			vector3f_x8 result;
+			scalarf_x8 w;
+			transpose_4x8(axes[0 * stride], axes[1 * stride], axes[2 * stride], axes[3 * stride],
+				axes[4 * stride], axes[5 * stride], axes[6 * stride], axes[7 * stride],
+				result.x, result.y, result.z, w);
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Transposes the 8 lanes back into 3D axes and writes them 'stride' vectors apart.
+		// The [w] component of every axis is set to the provided value.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL matrix_store_axis3_x8(const vector3f_x8& input, const scalarf_x8& w, vector4f* axes, size_t stride) RTM_NO_EXCEPT
+		{
+			transpose_8x4(input.x, input.y, input.z, w,
+				axes[0 * stride], axes[1 * stride], axes[2 * stride], axes[3 * stride],
+				axes[4 * stride], axes[5 * stride], axes[6 * stride], axes[7 * stride]);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Inverses 8 3x3 matrices stored as a structure of arrays, one matrix per lane.
+		// The adjugate columns are the cross products of the input axes, once transposed
+		// in structure of arrays form this simply swaps which component goes where.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL matrix_inverse_x8(const vector3f_x8& x_axis, const vector3f_x8& y_axis, const vector3f_x8& z_axis,
+			vector3f_x8& out_x_axis, vector3f_x8& out_y_axis, vector3f_x8& out_z_axis) RTM_NO_EXCEPT
+		{
+			const vector3f_x8 yz_cross = vector_cross3(y_axis, z_axis);
+			const vector3f_x8 zx_cross = vector_cross3(z_axis, x_axis);
+			const vector3f_x8 xy_cross = vector_cross3(x_axis, y_axis);
+
+			const scalarf_x8 det = vector_dot3(x_axis, yz_cross);
+			const scalarf_x8 inv_det = scalar_reciprocal(det);
+
+			out_x_axis = vector_mul(vector3f_x8{ yz_cross.x, zx_cross.x, xy_cross.x }, inv_det);
+			out_y_axis = vector_mul(vector3f_x8{ yz_cross.y, zx_cross.y, xy_cross.y }, inv_det);
+			out_z_axis = vector_mul(vector3f_x8{ yz_cross.z, zx_cross.z, xy_cross.z }, inv_det);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Inverses 8 consecutive 3x3 matrices. The output can alias the input.
+		//////////////////////////////////////////////////////////////////////////
+		inline void matrix_inverse_batch8(const matrix3x3f* inputs, matrix3x3f* outputs) RTM_NO_EXCEPT
+		{
+			constexpr size_t k_stride = sizeof(matrix3x3f) / sizeof(vector4f);
+
+			const vector3f_x8 x_axis = matrix_load_axis3_x8(&inputs[0].x_axis, k_stride);
+			const vector3f_x8 y_axis = matrix_load_axis3_x8(&inputs[0].y_axis, k_stride);
+			const vector3f_x8 z_axis = matrix_load_axis3_x8(&inputs[0].z_axis, k_stride);
+
+			vector3f_x8 inv_x_axis;
+			vector3f_x8 inv_y_axis;
+			vector3f_x8 inv_z_axis;
+			matrix_inverse_x8(x_axis, y_axis, z_axis, inv_x_axis, inv_y_axis, inv_z_axis);
+
+			const scalarf_x8 zero = scalar_set_x8(0.0f);
+			matrix_store_axis3_x8(inv_x_axis, zero, &outputs[0].x_axis, k_stride);
+			matrix_store_axis3_x8(inv_y_axis, zero, &outputs[0].y_axis, k_stride);
+			matrix_store_axis3_x8(inv_z_axis, zero, &outputs[0].z_axis, k_stride);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses 'count' 3x3 matrices: outputs[i] = matrix_inverse(inputs[i])
+	// Groups of 8 matrices are transposed into structure of arrays form and
+	// inverted with their cofactors in parallel, one matrix per SIMD lane.
+	// The remainder is padded with identity matrices.
+	// Results can differ slightly from matrix_inverse(..) due to the different
+	// evaluation order. The output can safely alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_inverse_batch(const matrix3x3f* inputs, matrix3x3f* outputs, size_t count) RTM_NO_EXCEPT
+	{
+		size_t index = 0;
+		for (; index + 8 <= count; index += 8)
+			rtm_impl::matrix_inverse_batch8(inputs + index, outputs + index);
+
+		if (index < count)
+		{
+			const size_t num_remaining = count - index;
+
+			matrix3x3f padded[8];
+			for (size_t offset = 0; offset < 8; ++offset)
+				padded[offset] = offset < num_remaining ? inputs[index + offset] : matrix3x3f(matrix_identity());
+
+			rtm_impl::matrix_inverse_batch8(&padded[0], &padded[0]);
+
+			for (size_t offset = 0; offset < num_remaining; ++offset)
+				outputs[index + offset] = padded[offset];
+		}
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -39,7 +39,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Converts a translation vector into a 3x4 affine matrix.
 	//////////////////////////////////////////////////////////////////////////
-	inline matrix3x4d matrix_from_translation(const vector4d& translation) RTM_NO_EXCEPT
+	inline matrix3x4d RTM_SIMD_CALL matrix_from_translation(vector4d_arg0 translation) RTM_NO_EXCEPT
 	{
 		return matrix3x4d{ vector_set(1.0, 0.0, 0.0, 0.0), vector_set(0.0, 1.0, 0.0, 0.0), vector_set(0.0, 0.0, 1.0, 0.0), translation };
 	}
@@ -47,7 +47,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Sets a 3x4 affine matrix from a rotation quaternion, translation, and 3D scale.
 	//////////////////////////////////////////////////////////////////////////
-	inline matrix3x4d matrix_from_qvv(const quatd& quat, const vector4d& translation, const vector4d& scale) RTM_NO_EXCEPT
+	inline matrix3x4d RTM_SIMD_CALL matrix_from_qvv(quatd_arg0 quat, vector4d_arg1 translation, vector4d_arg2 scale) RTM_NO_EXCEPT
 	{
 		RTM_ASSERT(quat_is_normalized(quat), "Quaternion is not normalized");
 
@@ -73,7 +73,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Converts a QVV transform into a 3x4 affine matrix.
 	//////////////////////////////////////////////////////////////////////////
-	inline matrix3x4d matrix_from_qvv(const qvvd& transform) RTM_NO_EXCEPT
+	inline matrix3x4d RTM_SIMD_CALL matrix_from_qvv(qvvd_arg0 transform) RTM_NO_EXCEPT
 	{
 		return matrix_from_qvv(transform.rotation, transform.translation, transform.scale);
 	}
@@ -98,7 +98,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Converts a 3x4 affine matrix into a rotation quaternion.
 	//////////////////////////////////////////////////////////////////////////
-	inline quatd quat_from_matrix(const matrix3x4d& input) RTM_NO_EXCEPT
+	inline quatd RTM_SIMD_CALL quat_from_matrix(matrix3x4d_arg0 input) RTM_NO_EXCEPT
 	{
 		return rtm_impl::quat_from_matrix(input.x_axis, input.y_axis, input.z_axis);
 	}
@@ -107,7 +107,7 @@ namespace rtm
 	// Multiplies two 3x4 affine matrices.
 	// Multiplication order is as follow: local_to_world = matrix_mul(local_to_object, object_to_world)
 	//////////////////////////////////////////////////////////////////////////
-	inline matrix3x4d matrix_mul(const matrix3x4d& lhs, const matrix3x4d& rhs) RTM_NO_EXCEPT
+	inline matrix3x4d RTM_SIMD_CALL matrix_mul(matrix3x4d_arg0 lhs, matrix3x4d_arg1 rhs) RTM_NO_EXCEPT
 	{
 		vector4d tmp = vector_mul(vector_dup_x(lhs.x_axis), rhs.x_axis);
 		tmp = vector_mul_add(vector_dup_y(lhs.x_axis), rhs.y_axis, tmp);
@@ -135,7 +135,7 @@ namespace rtm
 	// Multiplies a 3x4 affine matrix and a 3D point.
 	// Multiplication order is as follow: world_position = matrix_mul(local_position, local_to_world)
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d matrix_mul_point3(const vector4d& point, const matrix3x4d& mtx) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL matrix_mul_point3(vector4d_arg0 point, matrix3x4d_arg1 mtx) RTM_NO_EXCEPT
 	{
 		vector4d tmp0;
 		vector4d tmp1;
@@ -147,6 +147,21 @@ namespace rtm
 		return vector_add(tmp0, tmp1);
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies a 3x4 affine matrix and a 3D vector, the translation is ignored.
+	// Multiplication order is as follow: world_direction = matrix_mul_vector3(local_direction, local_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d RTM_SIMD_CALL matrix_mul_vector3(vector4d_arg0 vec3, matrix3x4d_arg1 mtx) RTM_NO_EXCEPT
+	{
+		vector4d tmp;
+
+		tmp = vector_mul(vector_dup_x(vec3), mtx.x_axis);
+		tmp = vector_mul_add(vector_dup_y(vec3), mtx.y_axis, tmp);
+		tmp = vector_mul_add(vector_dup_z(vec3), mtx.z_axis, tmp);
+
+		return tmp;
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Transposes a 3x4 affine matrix.
 	// Note: This transposes the upper 3x3 rotation/scale part of the matrix
@@ -155,7 +170,7 @@ namespace rtm
 	// The most common usage of an affine transpose operation is to construct the
 	// inverse transpose used to transform normal bi-vectors.
 	//////////////////////////////////////////////////////////////////////////
-	inline matrix3x3d matrix_transpose(const matrix3x4d& input) RTM_NO_EXCEPT
+	inline matrix3x3d RTM_SIMD_CALL matrix_transpose(matrix3x4d_arg0 input) RTM_NO_EXCEPT
 	{
 		const vector4d v00_v01_v10_v11 = vector_mix<mix4::x, mix4::y, mix4::a, mix4::b>(input.x_axis, input.y_axis);
 		const vector4d v02_v03_v12_v13 = vector_mix<mix4::z, mix4::w, mix4::c, mix4::d>(input.x_axis, input.y_axis);
@@ -169,7 +184,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Inverses a 3x4 affine matrix.
 	//////////////////////////////////////////////////////////////////////////
-	inline matrix3x4d matrix_inverse(const matrix3x4d& input) RTM_NO_EXCEPT
+	inline matrix3x4d RTM_SIMD_CALL matrix_inverse(matrix3x4d_arg0 input) RTM_NO_EXCEPT
 	{
 		// Invert the 3x3 portion of the matrix that contains the rotation and 3D scale
 		const vector4d v00_v01_v10_v11 = vector_mix<mix4::x, mix4::y, mix4::a, mix4::b>(input.x_axis, input.y_axis);
@@ -234,7 +249,7 @@ namespace rtm
 	// TODO: Implement rotation recovering, perhaps in a separate function and rename this
 	// one to matrix_remove_non_zero_scale(..)
 	//////////////////////////////////////////////////////////////////////////
-	inline matrix3x4d matrix_remove_scale(const matrix3x4d& input) RTM_NO_EXCEPT
+	inline matrix3x4d RTM_SIMD_CALL matrix_remove_scale(matrix3x4d_arg0 input) RTM_NO_EXCEPT
 	{
 		matrix3x4d result;
 		result.x_axis = vector_normalize3(input.x_axis, input.x_axis);
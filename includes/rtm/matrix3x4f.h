@@ -78,6 +78,19 @@ namespace rtm
 		return matrix_from_qvv(transform.rotation, transform.translation, transform.scale);
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Writes a 3x4 affine matrix with non-temporal stores that bypass the cache.
+	// The matrix spans a full cache line when the output is 64 bytes aligned.
+	// See vector_store_stream(vector4f_arg0, float*) for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL matrix_store_stream(matrix3x4f_arg0 input, matrix3x4f* output) RTM_NO_EXCEPT
+	{
+		vector_store_stream(input.x_axis, &output->x_axis);
+		vector_store_stream(input.y_axis, &output->y_axis);
+		vector_store_stream(input.z_axis, &output->z_axis);
+		vector_store_stream(input.w_axis, &output->w_axis);
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the desired 3x4 affine matrix axis.
 	//////////////////////////////////////////////////////////////////////////
@@ -147,6 +160,21 @@ namespace rtm
 		return vector_add(tmp0, tmp1);
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies a 3x4 affine matrix and a 3D vector, the translation is ignored.
+	// Multiplication order is as follow: world_direction = matrix_mul_vector3(local_direction, local_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL matrix_mul_vector3(vector4f_arg0 vec3, matrix3x4f_arg1 mtx) RTM_NO_EXCEPT
+	{
+		vector4f tmp;
+
+		tmp = vector_mul(vector_dup_x(vec3), mtx.x_axis);
+		tmp = vector_mul_add(vector_dup_y(vec3), mtx.y_axis, tmp);
+		tmp = vector_mul_add(vector_dup_z(vec3), mtx.z_axis, tmp);
+
+		return tmp;
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Transposes a 3x4 affine matrix.
 	// Note: This transposes the upper 3x3 rotation/scale part of the matrix
@@ -0,0 +1,273 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/matrix3x3f_batch.h"
+#include "rtm/matrix3x4f.h"
+#include "rtm/scalarf_x8.h"
+#include "rtm/strided_span.h"
+#include "rtm/vector3f_x8.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/soa_common.h"
+
+#include <cstddef>
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+#if defined(RTM_CPU_DISPATCH)
+		//////////////////////////////////////////////////////////////////////////
+		// AVX2 and FMA version of matrix_mul_point3_batch(..), 8 points are processed at a time.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX2 inline void matrix_mul_point3_batch_avx2(const vector4f* points, matrix3x4f_arg1 mtx, vector4f* output, size_t count) RTM_NO_EXCEPT
+		{
+			const __m256 x_axis_x = _mm256_set1_ps(vector_get_x(mtx.x_axis));
+			const __m256 x_axis_y = _mm256_set1_ps(vector_get_y(mtx.x_axis));
+			const __m256 x_axis_z = _mm256_set1_ps(vector_get_z(mtx.x_axis));
+			const __m256 x_axis_w = _mm256_set1_ps(vector_get_w(mtx.x_axis));
+			const __m256 y_axis_x = _mm256_set1_ps(vector_get_x(mtx.y_axis));
+			const __m256 y_axis_y = _mm256_set1_ps(vector_get_y(mtx.y_axis));
+			const __m256 y_axis_z = _mm256_set1_ps(vector_get_z(mtx.y_axis));
+			const __m256 y_axis_w = _mm256_set1_ps(vector_get_w(mtx.y_axis));
+			const __m256 z_axis_x = _mm256_set1_ps(vector_get_x(mtx.z_axis));
+			const __m256 z_axis_y = _mm256_set1_ps(vector_get_y(mtx.z_axis));
+			const __m256 z_axis_z = _mm256_set1_ps(vector_get_z(mtx.z_axis));
+			const __m256 z_axis_w = _mm256_set1_ps(vector_get_w(mtx.z_axis));
+			const __m256 w_axis_x = _mm256_set1_ps(vector_get_x(mtx.w_axis));
+			const __m256 w_axis_y = _mm256_set1_ps(vector_get_y(mtx.w_axis));
+			const __m256 w_axis_z = _mm256_set1_ps(vector_get_z(mtx.w_axis));
+			const __m256 w_axis_w = _mm256_set1_ps(vector_get_w(mtx.w_axis));
+
+			size_t index = 0;
+			for (; index + 8 <= count; index += 8)
+			{
+				__m256 point_x;
+				__m256 point_y;
+				__m256 point_z;
+				__m256 point_w;
+				avx_load_transpose_4x8(reinterpret_cast<const float*>(points + index), 4, point_x, point_y, point_z, point_w);
+
+				// Same evaluation order as matrix_mul_point3(..)
+				const __m256 result_x = _mm256_add_ps(_mm256_fmadd_ps(point_y, y_axis_x, _mm256_mul_ps(point_x, x_axis_x)), _mm256_fmadd_ps(point_z, z_axis_x, w_axis_x));
+				const __m256 result_y = _mm256_add_ps(_mm256_fmadd_ps(point_y, y_axis_y, _mm256_mul_ps(point_x, x_axis_y)), _mm256_fmadd_ps(point_z, z_axis_y, w_axis_y));
+				const __m256 result_z = _mm256_add_ps(_mm256_fmadd_ps(point_y, y_axis_z, _mm256_mul_ps(point_x, x_axis_z)), _mm256_fmadd_ps(point_z, z_axis_z, w_axis_z));
+				const __m256 result_w = _mm256_add_ps(_mm256_fmadd_ps(point_y, y_axis_w, _mm256_mul_ps(point_x, x_axis_w)), _mm256_fmadd_ps(point_z, z_axis_w, w_axis_w));
+
+				avx_transpose_store_4x8(result_x, result_y, result_z, result_w, 4, reinterpret_cast<float*>(output + index));
+			}
+
+			for (; index < count; ++index)
+				output[index] = matrix_mul_point3(points[index], mtx);
+		}
+#endif
+
+#if defined(RTM_AVX512_INTRINSICS) || defined(RTM_CPU_DISPATCH)
+		//////////////////////////////////////////////////////////////////////////
+		// AVX-512 version of matrix_mul_point3_batch(..), 16 points are processed at a time and
+		// the remainder is handled with masked loads and stores.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX512 inline void matrix_mul_point3_batch_avx512(const vector4f* points, matrix3x4f_arg1 mtx, vector4f* output, size_t count) RTM_NO_EXCEPT
+		{
+			const __m512 x_axis_x = _mm512_set1_ps(vector_get_x(mtx.x_axis));
+			const __m512 x_axis_y = _mm512_set1_ps(vector_get_y(mtx.x_axis));
+			const __m512 x_axis_z = _mm512_set1_ps(vector_get_z(mtx.x_axis));
+			const __m512 x_axis_w = _mm512_set1_ps(vector_get_w(mtx.x_axis));
+			const __m512 y_axis_x = _mm512_set1_ps(vector_get_x(mtx.y_axis));
+			const __m512 y_axis_y = _mm512_set1_ps(vector_get_y(mtx.y_axis));
+			const __m512 y_axis_z = _mm512_set1_ps(vector_get_z(mtx.y_axis));
+			const __m512 y_axis_w = _mm512_set1_ps(vector_get_w(mtx.y_axis));
+			const __m512 z_axis_x = _mm512_set1_ps(vector_get_x(mtx.z_axis));
+			const __m512 z_axis_y = _mm512_set1_ps(vector_get_y(mtx.z_axis));
+			const __m512 z_axis_z = _mm512_set1_ps(vector_get_z(mtx.z_axis));
+			const __m512 z_axis_w = _mm512_set1_ps(vector_get_w(mtx.z_axis));
+			const __m512 w_axis_x = _mm512_set1_ps(vector_get_x(mtx.w_axis));
+			const __m512 w_axis_y = _mm512_set1_ps(vector_get_y(mtx.w_axis));
+			const __m512 w_axis_z = _mm512_set1_ps(vector_get_z(mtx.w_axis));
+			const __m512 w_axis_w = _mm512_set1_ps(vector_get_w(mtx.w_axis));
+
+			for (size_t offset = 0; offset < count; offset += 16)
+			{
+				const size_t num_remaining = count - offset;
+				const uint32_t num_lanes = num_remaining >= 16 ? 16 : uint32_t(num_remaining);
+
+				__m512 point_x;
+				__m512 point_y;
+				__m512 point_z;
+				__m512 point_w;
+				avx512_load_transpose_4x16(reinterpret_cast<const float*>(points + offset), num_lanes, point_x, point_y, point_z, point_w);
+
+				// Same evaluation order as matrix_mul_point3(..)
+				const __m512 result_x = _mm512_add_ps(_mm512_fmadd_ps(point_y, y_axis_x, _mm512_mul_ps(point_x, x_axis_x)), _mm512_fmadd_ps(point_z, z_axis_x, w_axis_x));
+				const __m512 result_y = _mm512_add_ps(_mm512_fmadd_ps(point_y, y_axis_y, _mm512_mul_ps(point_x, x_axis_y)), _mm512_fmadd_ps(point_z, z_axis_y, w_axis_y));
+				const __m512 result_z = _mm512_add_ps(_mm512_fmadd_ps(point_y, y_axis_z, _mm512_mul_ps(point_x, x_axis_z)), _mm512_fmadd_ps(point_z, z_axis_z, w_axis_z));
+				const __m512 result_w = _mm512_add_ps(_mm512_fmadd_ps(point_y, y_axis_w, _mm512_mul_ps(point_x, x_axis_w)), _mm512_fmadd_ps(point_z, z_axis_w, w_axis_w));
+
+				avx512_transpose_store_4x16(result_x, result_y, result_z, result_w, num_lanes, reinterpret_cast<float*>(output + offset));
+			}
+		}
+#endif
+
+		//////////////////////////////////////////////////////////////////////////
+		// Inverses 8 consecutive 3x4 affine matrices. When 'is_rigid' is true, the 3x3 portion
+		// is assumed to be orthonormal and it is inverted with a transpose.
+		// The output can alias the input.
+		//////////////////////////////////////////////////////////////////////////
+		inline void matrix_inverse_batch8(const matrix3x4f* inputs, matrix3x4f* outputs, bool is_rigid) RTM_NO_EXCEPT
+		{
+			constexpr size_t k_stride = sizeof(matrix3x4f) / sizeof(vector4f);
+
+			const vector3f_x8 x_axis = matrix_load_axis3_x8(&inputs[0].x_axis, k_stride);
+			const vector3f_x8 y_axis = matrix_load_axis3_x8(&inputs[0].y_axis, k_stride);
+			const vector3f_x8 z_axis = matrix_load_axis3_x8(&inputs[0].z_axis, k_stride);
+			const vector3f_x8 translation = matrix_load_axis3_x8(&inputs[0].w_axis, k_stride);
+
+			vector3f_x8 inv_x_axis;
+			vector3f_x8 inv_y_axis;
+			vector3f_x8 inv_z_axis;
+			if (is_rigid)
+			{
+				// In structure of arrays form, the transpose is free
+				inv_x_axis = vector3f_x8{ x_axis.x, y_axis.x, z_axis.x };
+				inv_y_axis = vector3f_x8{ x_axis.y, y_axis.y, z_axis.y };
+				inv_z_axis = vector3f_x8{ x_axis.z, y_axis.z, z_axis.z };
+			}
+			else
+				matrix_inverse_x8(x_axis, y_axis, z_axis, inv_x_axis, inv_y_axis, inv_z_axis);
+
+			// Invert the translation
+			const vector3f_x8 tmp0 = vector_mul(inv_z_axis, translation.z);
+			const vector3f_x8 tmp1 = vector_mul_add(inv_y_axis, vector3f_x8{ translation.y, translation.y, translation.y }, tmp0);
+			const vector3f_x8 inv_translation = vector_neg(vector_mul_add(inv_x_axis, vector3f_x8{ translation.x, translation.x, translation.x }, tmp1));
+
+			const scalarf_x8 zero = scalar_set_x8(0.0f);
+			matrix_store_axis3_x8(inv_x_axis, zero, &outputs[0].x_axis, k_stride);
+			matrix_store_axis3_x8(inv_y_axis, zero, &outputs[0].y_axis, k_stride);
+			matrix_store_axis3_x8(inv_z_axis, zero, &outputs[0].z_axis, k_stride);
+			matrix_store_axis3_x8(inv_translation, scalar_set_x8(1.0f), &outputs[0].w_axis, k_stride);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Inverses 'count' 3x4 affine matrices 8 at a time, the remainder is padded with identity matrices.
+		//////////////////////////////////////////////////////////////////////////
+		inline void matrix_inverse_batch(const matrix3x4f* inputs, matrix3x4f* outputs, size_t count, bool is_rigid) RTM_NO_EXCEPT
+		{
+			size_t index = 0;
+			for (; index + 8 <= count; index += 8)
+				matrix_inverse_batch8(inputs + index, outputs + index, is_rigid);
+
+			if (index < count)
+			{
+				const size_t num_remaining = count - index;
+
+				matrix3x4f padded[8];
+				for (size_t offset = 0; offset < 8; ++offset)
+					padded[offset] = offset < num_remaining ? inputs[index + offset] : matrix3x4f(matrix_identity());
+
+				matrix_inverse_batch8(&padded[0], &padded[0], is_rigid);
+
+				for (size_t offset = 0; offset < num_remaining; ++offset)
+					outputs[index + offset] = padded[offset];
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms 'count' 3D points by the same affine matrix: output[i] = matrix_mul_point3(points[i], mtx)
+	// See matrix_mul_point3(vector4f_arg0, matrix3x4f_arg0) for details.
+	// The output can safely alias the input points.
+	// With AVX-512, 16 points are processed at a time and the remainder is
+	// handled with masked loads and stores.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_mul_point3_batch(const vector4f* points, matrix3x4f_arg1 mtx, vector4f* output, size_t count) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX512_INTRINSICS)
+		rtm_impl::matrix_mul_point3_batch_avx512(points, mtx, output, count);
+#else
+		for (size_t index = 0; index < count; ++index)
+			output[index] = matrix_mul_point3(points[index], mtx);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms 3D points read from a strided view by the same affine matrix: output[i] = matrix_mul_point3(points[i], mtx)
+	// The number of points is output.size and the input must be at least as large.
+	// The points are processed in place, no gather copy is needed.
+	// The output can safely alias the input points when they share the same layout.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_mul_point3_batch(const strided_span<const float4f>& points, matrix3x4f_arg1 mtx, const strided_span<float4f>& output) RTM_NO_EXCEPT
+	{
+		rtm_impl::strided_span_check_sizes(points, output);
+
+		const size_t count = output.size;
+		for (size_t index = 0; index < count; ++index)
+			vector_store(matrix_mul_point3(vector_load(points, index), mtx), output, index);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms 3D points stored as 3 floats and read from a strided view by the same affine matrix.
+	// Only the [xyz] components of the output are written.
+	// See matrix_mul_point3_batch(const strided_span<const float4f>&, matrix3x4f_arg1, const strided_span<float4f>&) for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_mul_point3_batch(const strided_span<const float3f>& points, matrix3x4f_arg1 mtx, const strided_span<float3f>& output) RTM_NO_EXCEPT
+	{
+		rtm_impl::strided_span_check_sizes(points, output);
+
+		const size_t count = output.size;
+		for (size_t index = 0; index < count; ++index)
+			vector_store3(matrix_mul_point3(vector_load3(points, index), mtx), output, index);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses 'count' 3x4 affine matrices: outputs[i] = matrix_inverse(inputs[i])
+	// Groups of 8 matrices are transposed into structure of arrays form and
+	// inverted with their cofactors in parallel, one matrix per SIMD lane.
+	// Results can differ slightly from matrix_inverse(..) due to the different
+	// evaluation order. The output can safely alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_inverse_batch(const matrix3x4f* inputs, matrix3x4f* outputs, size_t count) RTM_NO_EXCEPT
+	{
+		rtm_impl::matrix_inverse_batch(inputs, outputs, count, false);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses 'count' rigid 3x4 affine matrices made of a rotation and a translation.
+	// The 3x3 portion must be orthonormal (no scale) and it is inverted with a transpose
+	// which is cheaper and more accurate than matrix_inverse_batch(..).
+	// The output can safely alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_inverse_rigid_batch(const matrix3x4f* inputs, matrix3x4f* outputs, size_t count) RTM_NO_EXCEPT
+	{
+		rtm_impl::matrix_inverse_batch(inputs, outputs, count, true);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -54,7 +54,7 @@ namespace rtm
 	// Multiplies two 4x4 matrices.
 	// Multiplication order is as follow: local_to_world = matrix_mul(local_to_object, object_to_world)
 	//////////////////////////////////////////////////////////////////////////
-	inline matrix4x4d RTM_SIMD_CALL matrix_mul(const matrix4x4d& lhs, const matrix4x4d& rhs) RTM_NO_EXCEPT
+	inline matrix4x4d RTM_SIMD_CALL matrix_mul(matrix4x4d_arg0 lhs, matrix4x4d_arg1 rhs) RTM_NO_EXCEPT
 	{
 		vector4d tmp = vector_mul(vector_dup_x(lhs.x_axis), rhs.x_axis);
 		tmp = vector_mul_add(vector_dup_y(lhs.x_axis), rhs.y_axis, tmp);
@@ -82,7 +82,7 @@ namespace rtm
 	// Multiplies a 4x4 matrix and a 4D vector.
 	// Multiplication order is as follow: world_position = matrix_mul(local_position, local_to_world)
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d RTM_SIMD_CALL matrix_mul_vector(const vector4d& vec4, const matrix4x4d& mtx) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL matrix_mul_vector(vector4d_arg0 vec4, matrix4x4d_arg1 mtx) RTM_NO_EXCEPT
 	{
 		vector4d tmp;
 
@@ -97,7 +97,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Transposes a 4x4 matrix.
 	//////////////////////////////////////////////////////////////////////////
-	inline matrix4x4d RTM_SIMD_CALL matrix_transpose(const matrix4x4d& input) RTM_NO_EXCEPT
+	inline matrix4x4d RTM_SIMD_CALL matrix_transpose(matrix4x4d_arg0 input) RTM_NO_EXCEPT
 	{
 		vector4d tmp0 = vector_mix<mix4::x, mix4::y, mix4::a, mix4::b>(input.x_axis, input.y_axis);
 		vector4d tmp1 = vector_mix<mix4::z, mix4::w, mix4::c, mix4::d>(input.x_axis, input.y_axis);
@@ -114,7 +114,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Inverses a 4x4 matrix.
 	//////////////////////////////////////////////////////////////////////////
-	inline matrix4x4d RTM_SIMD_CALL matrix_inverse(const matrix4x4d& input) RTM_NO_EXCEPT
+	inline matrix4x4d RTM_SIMD_CALL matrix_inverse(matrix4x4d_arg0 input) RTM_NO_EXCEPT
 	{
 		matrix4x4d input_transposed = matrix_transpose(input);
 
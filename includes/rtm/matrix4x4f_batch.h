@@ -0,0 +1,149 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "rtm/math.h"
+#include "rtm/matrix4x4f.h"
+#include "rtm/scalarf_x8.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/soa_common.h"
+
+#include <cstddef>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane: (a * b) - (c * d)
+		//////////////////////////////////////////////////////////////////////////
+		inline scalarf_x8 RTM_SIMD_CALL scalar_det2_x8(const scalarf_x8& a, const scalarf_x8& b, const scalarf_x8& c, const scalarf_x8& d) RTM_NO_EXCEPT
+		{
+			return scalar_neg_mul_sub(c, d, scalar_mul(a, b));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane: (a0 * b0) - (a1 * b1) + (a2 * b2)
+		//////////////////////////////////////////////////////////////////////////
+		inline scalarf_x8 RTM_SIMD_CALL scalar_cofactor3_x8(const scalarf_x8& a0, const scalarf_x8& b0, const scalarf_x8& a1, const scalarf_x8& b1, const scalarf_x8& a2, const scalarf_x8& b2) RTM_NO_EXCEPT
+		{
+			return scalar_mul_add(a2, b2, scalar_neg_mul_sub(a1, b1, scalar_mul(a0, b0)));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Inverses 8 consecutive 4x4 matrices. The output can alias the input.
+		// The matrices are transposed into structure of arrays form, m[row][column],
+		// and inverted with the Laplace expansion: the 12 2x2 determinants of the
+		// top and bottom row pairs yield the determinant and every cofactor.
+		//////////////////////////////////////////////////////////////////////////
+		inline void matrix_inverse_batch8(const matrix4x4f* inputs, matrix4x4f* outputs) RTM_NO_EXCEPT
+		{
+			scalarf_x8 m[4][4];
+			transpose_4x8(inputs[0].x_axis, inputs[1].x_axis, inputs[2].x_axis, inputs[3].x_axis, inputs[4].x_axis, inputs[5].x_axis, inputs[6].x_axis, inputs[7].x_axis, m[0][0], m[0][1], m[0][2], m[0][3]);
+			transpose_4x8(inputs[0].y_axis, inputs[1].y_axis, inputs[2].y_axis, inputs[3].y_axis, inputs[4].y_axis, inputs[5].y_axis, inputs[6].y_axis, inputs[7].y_axis, m[1][0], m[1][1], m[1][2], m[1][3]);
+			transpose_4x8(inputs[0].z_axis, inputs[1].z_axis, inputs[2].z_axis, inputs[3].z_axis, inputs[4].z_axis, inputs[5].z_axis, inputs[6].z_axis, inputs[7].z_axis, m[2][0], m[2][1], m[2][2], m[2][3]);
+			transpose_4x8(inputs[0].w_axis, inputs[1].w_axis, inputs[2].w_axis, inputs[3].w_axis, inputs[4].w_axis, inputs[5].w_axis, inputs[6].w_axis, inputs[7].w_axis, m[3][0], m[3][1], m[3][2], m[3][3]);
+
+			// 2x2 determinants of the top two rows
+			const scalarf_x8 s0 = scalar_det2_x8(m[0][0], m[1][1], m[1][0], m[0][1]);
+			const scalarf_x8 s1 = scalar_det2_x8(m[0][0], m[1][2], m[1][0], m[0][2]);
+			const scalarf_x8 s2 = scalar_det2_x8(m[0][0], m[1][3], m[1][0], m[0][3]);
+			const scalarf_x8 s3 = scalar_det2_x8(m[0][1], m[1][2], m[1][1], m[0][2]);
+			const scalarf_x8 s4 = scalar_det2_x8(m[0][1], m[1][3], m[1][1], m[0][3]);
+			const scalarf_x8 s5 = scalar_det2_x8(m[0][2], m[1][3], m[1][2], m[0][3]);
+
+			// 2x2 determinants of the bottom two rows
+			const scalarf_x8 c0 = scalar_det2_x8(m[2][0], m[3][1], m[3][0], m[2][1]);
+			const scalarf_x8 c1 = scalar_det2_x8(m[2][0], m[3][2], m[3][0], m[2][2]);
+			const scalarf_x8 c2 = scalar_det2_x8(m[2][0], m[3][3], m[3][0], m[2][3]);
+			const scalarf_x8 c3 = scalar_det2_x8(m[2][1], m[3][2], m[3][1], m[2][2]);
+			const scalarf_x8 c4 = scalar_det2_x8(m[2][1], m[3][3], m[3][1], m[2][3]);
+			const scalarf_x8 c5 = scalar_det2_x8(m[2][2], m[3][3], m[3][2], m[2][3]);
+
+			const scalarf_x8 det = scalar_add(scalar_cofactor3_x8(s0, c5, s1, c4, s2, c3), scalar_cofactor3_x8(s3, c2, s4, c1, s5, c0));
+			const scalarf_x8 inv_det = scalar_reciprocal(det);
+			const scalarf_x8 neg_inv_det = scalar_neg(inv_det);
+
+			scalarf_x8 r[4][4];
+			r[0][0] = scalar_mul(scalar_cofactor3_x8(m[1][1], c5, m[1][2], c4, m[1][3], c3), inv_det);
+			r[0][1] = scalar_mul(scalar_cofactor3_x8(m[0][1], c5, m[0][2], c4, m[0][3], c3), neg_inv_det);
+			r[0][2] = scalar_mul(scalar_cofactor3_x8(m[3][1], s5, m[3][2], s4, m[3][3], s3), inv_det);
+			r[0][3] = scalar_mul(scalar_cofactor3_x8(m[2][1], s5, m[2][2], s4, m[2][3], s3), neg_inv_det);
+
+			r[1][0] = scalar_mul(scalar_cofactor3_x8(m[1][0], c5, m[1][2], c2, m[1][3], c1), neg_inv_det);
+			r[1][1] = scalar_mul(scalar_cofactor3_x8(m[0][0], c5, m[0][2], c2, m[0][3], c1), inv_det);
+			r[1][2] = scalar_mul(scalar_cofactor3_x8(m[3][0], s5, m[3][2], s2, m[3][3], s1), neg_inv_det);
+			r[1][3] = scalar_mul(scalar_cofactor3_x8(m[2][0], s5, m[2][2], s2, m[2][3], s1), inv_det);
+
+			r[2][0] = scalar_mul(scalar_cofactor3_x8(m[1][0], c4, m[1][1], c2, m[1][3], c0), inv_det);
+			r[2][1] = scalar_mul(scalar_cofactor3_x8(m[0][0], c4, m[0][1], c2, m[0][3], c0), neg_inv_det);
+			r[2][2] = scalar_mul(scalar_cofactor3_x8(m[3][0], s4, m[3][1], s2, m[3][3], s0), inv_det);
+			r[2][3] = scalar_mul(scalar_cofactor3_x8(m[2][0], s4, m[2][1], s2, m[2][3], s0), neg_inv_det);
+
+			r[3][0] = scalar_mul(scalar_cofactor3_x8(m[1][0], c3, m[1][1], c1, m[1][2], c0), neg_inv_det);
+			r[3][1] = scalar_mul(scalar_cofactor3_x8(m[0][0], c3, m[0][1], c1, m[0][2], c0), inv_det);
+			r[3][2] = scalar_mul(scalar_cofactor3_x8(m[3][0], s3, m[3][1], s1, m[3][2], s0), neg_inv_det);
+			r[3][3] = scalar_mul(scalar_cofactor3_x8(m[2][0], s3, m[2][1], s1, m[2][2], s0), inv_det);
+
+			transpose_8x4(r[0][0], r[0][1], r[0][2], r[0][3], outputs[0].x_axis, outputs[1].x_axis, outputs[2].x_axis, outputs[3].x_axis, outputs[4].x_axis, outputs[5].x_axis, outputs[6].x_axis, outputs[7].x_axis);
+			transpose_8x4(r[1][0], r[1][1], r[1][2], r[1][3], outputs[0].y_axis, outputs[1].y_axis, outputs[2].y_axis, outputs[3].y_axis, outputs[4].y_axis, outputs[5].y_axis, outputs[6].y_axis, outputs[7].y_axis);
+			transpose_8x4(r[2][0], r[2][1], r[2][2], r[2][3], outputs[0].z_axis, outputs[1].z_axis, outputs[2].z_axis, outputs[3].z_axis, outputs[4].z_axis, outputs[5].z_axis, outputs[6].z_axis, outputs[7].z_axis);
+			transpose_8x4(r[3][0], r[3][1], r[3][2], r[3][3], outputs[0].w_axis, outputs[1].w_axis, outputs[2].w_axis, outputs[3].w_axis, outputs[4].w_axis, outputs[5].w_axis, outputs[6].w_axis, outputs[7].w_axis);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses 'count' 4x4 matrices: outputs[i] = matrix_inverse(inputs[i])
+	// Groups of 8 matrices are transposed into structure of arrays form and
+	// inverted with their cofactors in parallel, one matrix per SIMD lane.
+	// The remainder is padded with identity matrices.
+	// Results can differ slightly from matrix_inverse(..) due to the different
+	// evaluation order. The output can safely alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_inverse_batch(const matrix4x4f* inputs, matrix4x4f* outputs, size_t count) RTM_NO_EXCEPT
+	{
+		size_t index = 0;
+		for (; index + 8 <= count; index += 8)
+			rtm_impl::matrix_inverse_batch8(inputs + index, outputs + index);
+
+		if (index < count)
+		{
+			const size_t num_remaining = count - index;
+
+			matrix4x4f padded[8];
+			for (size_t offset = 0; offset < 8; ++offset)
+				padded[offset] = offset < num_remaining ? inputs[index + offset] : matrix4x4f(matrix_identity());
+
+			rtm_impl::matrix_inverse_batch8(&padded[0], &padded[0]);
+
+			for (size_t offset = 0; offset < num_remaining; ++offset)
+				outputs[index + offset] = padded[offset];
+		}
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
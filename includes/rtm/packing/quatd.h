@@ -37,7 +37,7 @@ namespace rtm
 	// Returns the quaternion on the hypersphere with a positive [w] component
 	// that represents the same 3D rotation as the input.
 	//////////////////////////////////////////////////////////////////////////
-	inline quatd quat_ensure_positive_w(const quatd& input) RTM_NO_EXCEPT
+	inline quatd RTM_SIMD_CALL quat_ensure_positive_w(quatd_arg0 input) RTM_NO_EXCEPT
 	{
 		return quat_get_w(input) >= 0.0 ? input : quat_neg(input);
 	}
@@ -46,7 +46,7 @@ namespace rtm
 	// Returns a quaternion constructed from a vector3 representing the [xyz]
 	// components while reconstructing the [w] component by assuming it is positive.
 	//////////////////////////////////////////////////////////////////////////
-	inline quatd quat_from_positive_w(const vector4d& input) RTM_NO_EXCEPT
+	inline quatd RTM_SIMD_CALL quat_from_positive_w(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
 		// Operation order is important here, due to rounding, ((1.0 - (X*X)) - Y*Y) - Z*Z is more accurate than 1.0 - dot3(xyz, xyz)
 		double w_squared = ((1.0 - vector_get_x(input) * vector_get_x(input)) - vector_get_y(input) * vector_get_y(input)) - vector_get_z(input) * vector_get_z(input);
@@ -0,0 +1,495 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/matrix3x4f.h"
+#include "rtm/matrix3x4f_batch.h"
+#include "rtm/qvvf.h"
+#include "rtm/qvvf_batch.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/memory_utils.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Processes a single chunk of a parallel workload.
+	// Tasks must not throw: the workload lives on the stack of the calling thread and
+	// other threads can still be executing its chunks when an exception unwinds it.
+	//////////////////////////////////////////////////////////////////////////
+	using parallel_task_function = void (*)(void* task_data, size_t chunk_index);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Runs the chunks of parallel workloads, this is the hook to plug an existing job system.
+	// run(context, task, task_data, num_chunks) must call task(task_data, chunk_index) exactly
+	// once for every chunk index in [0, num_chunks), in any order and from any thread, and it
+	// must only return once every call completed. The calling thread should help execute chunks.
+	// Tasks never block: a job system can safely run them on its worker threads.
+	//////////////////////////////////////////////////////////////////////////
+	struct parallel_executor
+	{
+		void (*run)(void* context, parallel_task_function task, void* task_data, size_t num_chunks);
+		void* context;
+	};
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// How many bytes of output each chunk writes. The inputs and outputs of a chunk
+		// remain in the L2 cache while it is processed.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr size_t k_parallel_chunk_output_size = 16 * 1024;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Chunks hold a multiple of this many entries. It matches the widest batch kernels
+		// and with entries of 4 bytes or more, chunks span whole cache lines.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr size_t k_parallel_chunk_granularity = 16;
+
+		inline void parallel_run_serial(void* context, parallel_task_function task, void* task_data, size_t num_chunks)
+		{
+			(void)context;
+			for (size_t chunk_index = 0; chunk_index < num_chunks; ++chunk_index)
+				task(task_data, chunk_index);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Whether the current thread is executing a parallel task. Nested parallel
+		// workloads run serially on the thread that executes their parent task.
+		//////////////////////////////////////////////////////////////////////////
+		inline bool& parallel_get_is_in_task() RTM_NO_EXCEPT
+		{
+			static thread_local bool is_in_task = false;
+			return is_in_task;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// The range of chunk indices [begin, end) left for a thread, packed into a single word.
+		// The owner pops from the front and other threads steal from the back. Every queue
+		// lives on its own cache line, the thread_pool aligns their allocation.
+		//////////////////////////////////////////////////////////////////////////
+		struct parallel_queue
+		{
+			std::atomic<uint64_t> range;
+			uint8_t padding[k_cache_line_size - sizeof(std::atomic<uint64_t>)];
+		};
+
+		inline uint64_t parallel_pack_range(uint32_t begin, uint32_t end) RTM_NO_EXCEPT
+		{
+			return (uint64_t(end) << 32) | uint64_t(begin);
+		}
+
+		inline bool parallel_queue_pop_front(parallel_queue& queue, uint32_t& out_chunk_index) RTM_NO_EXCEPT
+		{
+			uint64_t range = queue.range.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				const uint32_t begin = uint32_t(range);
+				const uint32_t end = uint32_t(range >> 32);
+				if (begin >= end)
+					return false;
+
+				if (queue.range.compare_exchange_weak(range, parallel_pack_range(begin + 1, end), std::memory_order_relaxed))
+				{
+					out_chunk_index = begin;
+					return true;
+				}
+			}
+		}
+
+		inline bool parallel_queue_steal_back(parallel_queue& queue, uint32_t& out_chunk_index) RTM_NO_EXCEPT
+		{
+			uint64_t range = queue.range.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				const uint32_t begin = uint32_t(range);
+				const uint32_t end = uint32_t(range >> 32);
+				if (begin >= end)
+					return false;
+
+				if (queue.range.compare_exchange_weak(range, parallel_pack_range(begin, end - 1), std::memory_order_relaxed))
+				{
+					out_chunk_index = end - 1;
+					return true;
+				}
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// A workload in flight on a thread_pool, it lives on the stack of the calling thread.
+		//////////////////////////////////////////////////////////////////////////
+		struct parallel_job
+		{
+			parallel_task_function task;
+			void* task_data;
+			parallel_queue* queues;
+			uint32_t num_queues;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Executes the chunks of a thread before stealing from the others. No chunk is ever
+		// added to a queue: once every queue was found empty, the workload is complete
+		// besides the chunks still executing on other threads.
+		//////////////////////////////////////////////////////////////////////////
+		inline void parallel_execute(const parallel_job& job, uint32_t queue_index)
+		{
+			bool& is_in_task = parallel_get_is_in_task();
+			is_in_task = true;
+
+			uint32_t chunk_index;
+			while (parallel_queue_pop_front(job.queues[queue_index], chunk_index))
+				job.task(job.task_data, chunk_index);
+
+			// Thieves start with the next queue to spread out
+			for (uint32_t offset = 1; offset < job.num_queues; ++offset)
+			{
+				parallel_queue& victim = job.queues[(queue_index + offset) % job.num_queues];
+				while (parallel_queue_steal_back(victim, chunk_index))
+					job.task(job.task_data, chunk_index);
+			}
+
+			is_in_task = false;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Runs every chunk on the calling thread.
+	//////////////////////////////////////////////////////////////////////////
+	inline parallel_executor parallel_executor_serial() RTM_NO_EXCEPT
+	{
+		return parallel_executor{ rtm_impl::parallel_run_serial, nullptr };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// A pool of std::thread workers that executes parallel workloads with work stealing.
+	// Every thread, including the caller, starts with a contiguous range of chunks and
+	// steals single chunks from the end of the other ranges once its own is exhausted.
+	// Workers sleep between workloads. Concurrent workloads from several threads are
+	// executed one after the other and nested workloads run serially.
+	//////////////////////////////////////////////////////////////////////////
+	class thread_pool
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// Creates a pool where 'num_threads' threads execute workloads, the caller included.
+		// With 0, the number of hardware threads is used.
+		//////////////////////////////////////////////////////////////////////////
+		explicit thread_pool(uint32_t num_threads = 0)
+			: m_workers()
+			, m_queue_buffer()
+			, m_queues(nullptr)
+			, m_run_mutex()
+			, m_mutex()
+			, m_wake_condition()
+			, m_idle_condition()
+			, m_job(nullptr)
+			, m_job_generation(0)
+			, m_num_active_workers(0)
+			, m_is_shutting_down(false)
+		{
+			if (num_threads == 0)
+				num_threads = std::thread::hardware_concurrency();
+
+			if (num_threads == 0)
+				num_threads = 1;
+
+			// Operator new only honors the alignment of the atomic, over-allocate to align on a cache line
+			m_queue_buffer.reset(new uint8_t[sizeof(rtm_impl::parallel_queue) * num_threads + rtm_impl::k_cache_line_size - 1]);
+			m_queues = reinterpret_cast<rtm_impl::parallel_queue*>(rtm_impl::align_to(m_queue_buffer.get(), rtm_impl::k_cache_line_size));
+			for (uint32_t queue_index = 0; queue_index < num_threads; ++queue_index)
+				new(&m_queues[queue_index]) rtm_impl::parallel_queue{ { 0 }, {} };
+
+			// The calling thread uses the first queue
+			m_workers.reserve(num_threads - 1);
+			for (uint32_t queue_index = 1; queue_index < num_threads; ++queue_index)
+				m_workers.emplace_back(&thread_pool::worker_main, this, queue_index);
+		}
+
+		~thread_pool()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_is_shutting_down = true;
+			}
+
+			m_wake_condition.notify_all();
+
+			for (std::thread& worker : m_workers)
+				worker.join();
+		}
+
+		thread_pool(const thread_pool&) = delete;
+		thread_pool& operator=(const thread_pool&) = delete;
+
+		uint32_t get_num_threads() const RTM_NO_EXCEPT { return uint32_t(m_workers.size()) + 1; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns an executor that runs workloads on this pool, it must outlive the executor.
+		//////////////////////////////////////////////////////////////////////////
+		parallel_executor get_executor() RTM_NO_EXCEPT { return parallel_executor{ &thread_pool::run_callback, this }; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Calls task(task_data, chunk_index) for every chunk and returns once they all completed.
+		// The task must not throw, see parallel_task_function.
+		//////////////////////////////////////////////////////////////////////////
+		void run(parallel_task_function task, void* task_data, size_t num_chunks)
+		{
+			RTM_ASSERT(num_chunks <= 0xFFFFFFFFULL, "Too many chunks");
+
+			if (num_chunks <= 1 || m_workers.empty() || rtm_impl::parallel_get_is_in_task())
+			{
+				rtm_impl::parallel_run_serial(nullptr, task, task_data, num_chunks);
+				return;
+			}
+
+			std::lock_guard<std::mutex> run_lock(m_run_mutex);
+
+			const uint32_t num_queues = get_num_threads();
+			for (uint32_t queue_index = 0; queue_index < num_queues; ++queue_index)
+			{
+				const uint32_t begin = uint32_t((num_chunks * queue_index) / num_queues);
+				const uint32_t end = uint32_t((num_chunks * (queue_index + 1)) / num_queues);
+				m_queues[queue_index].range.store(rtm_impl::parallel_pack_range(begin, end), std::memory_order_relaxed);
+			}
+
+			const rtm_impl::parallel_job job = { task, task_data, m_queues, num_queues };
+
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_job = &job;
+				++m_job_generation;
+			}
+
+			m_wake_condition.notify_all();
+
+			rtm_impl::parallel_execute(job, 0);
+
+			// Workers that did not join the job yet will not see it, wait for the others to finish their last chunk
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_job = nullptr;
+			m_idle_condition.wait(lock, [this]() { return m_num_active_workers == 0; });
+		}
+
+	private:
+		static void run_callback(void* context, parallel_task_function task, void* task_data, size_t num_chunks)
+		{
+			static_cast<thread_pool*>(context)->run(task, task_data, num_chunks);
+		}
+
+		void worker_main(uint32_t queue_index)
+		{
+			uint64_t last_job_generation = 0;
+			for (;;)
+			{
+				const rtm_impl::parallel_job* job;
+
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+					m_wake_condition.wait(lock, [this, last_job_generation]() { return m_is_shutting_down || (m_job != nullptr && m_job_generation != last_job_generation); });
+					if (m_is_shutting_down)
+						return;
+
+					job = m_job;
+					last_job_generation = m_job_generation;
+					++m_num_active_workers;
+				}
+
+				rtm_impl::parallel_execute(*job, queue_index);
+
+				bool is_last_worker;
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					--m_num_active_workers;
+					is_last_worker = m_num_active_workers == 0;
+				}
+
+				if (is_last_worker)
+					m_idle_condition.notify_one();
+			}
+		}
+
+		std::vector<std::thread>					m_workers;
+		std::unique_ptr<uint8_t[]>					m_queue_buffer;
+		rtm_impl::parallel_queue*					m_queues;			// Cache line aligned within m_queue_buffer
+
+		std::mutex									m_run_mutex;		// Serializes workloads submitted from several threads
+		std::mutex									m_mutex;			// Protects the members below
+		std::condition_variable						m_wake_condition;
+		std::condition_variable						m_idle_condition;
+		const rtm_impl::parallel_job*				m_job;
+		uint64_t									m_job_generation;
+		uint32_t									m_num_active_workers;
+		bool										m_is_shutting_down;
+	};
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Splits [0, count) into chunks of 'chunk_size' entries that start at 'first_boundary'.
+		// When it is not zero, a shorter leading chunk covers [0, first_boundary).
+		//////////////////////////////////////////////////////////////////////////
+		template<typename function_type>
+		struct parallel_for_task
+		{
+			const function_type* function;
+			size_t count;
+			size_t chunk_size;
+			size_t first_boundary;
+		};
+
+		template<typename function_type>
+		inline void parallel_for_chunk(void* task_data, size_t chunk_index)
+		{
+			const parallel_for_task<function_type>& task = *static_cast<const parallel_for_task<function_type>*>(task_data);
+
+			// Chunk 'chunk_index' ends at this boundary, the leading chunk counts as one
+			const size_t num_leading_chunks = task.first_boundary != 0 ? 1 : 0;
+			const size_t end_boundary = task.first_boundary + (chunk_index + 1 - num_leading_chunks) * task.chunk_size;
+
+			const size_t begin = chunk_index == 0 ? 0 : (end_boundary - task.chunk_size);
+			const size_t end = end_boundary < task.count ? end_boundary : task.count;
+			(*task.function)(begin, end);
+		}
+
+		template<typename function_type>
+		inline void parallel_for(const parallel_executor& executor, size_t count, size_t chunk_size, size_t first_boundary, const function_type& function)
+		{
+			RTM_ASSERT(chunk_size != 0, "Chunks cannot be empty");
+
+			if (first_boundary >= count || count - first_boundary <= chunk_size)
+			{
+				// Too small to be worth splitting
+				if (count != 0)
+					function(size_t(0), count);
+				return;
+			}
+
+			const size_t num_leading_chunks = first_boundary != 0 ? 1 : 0;
+			const size_t num_chunks = num_leading_chunks + (count - first_boundary + chunk_size - 1) / chunk_size;
+
+			parallel_for_task<function_type> task = { &function, count, chunk_size, first_boundary };
+			executor.run(executor.context, &parallel_for_chunk<function_type>, &task, num_chunks);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Splits an array workload into cache sized chunks whose outputs start on a cache line.
+		// Threads never write to the same cache line, except for the one shared by the
+		// leading chunk when the output is not aligned to its entries.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename output_type, typename function_type>
+		inline void parallel_for_output(const parallel_executor& executor, const output_type* output, size_t count, const function_type& function)
+		{
+			const size_t entry_size = sizeof(output_type);
+			size_t chunk_size = (k_parallel_chunk_output_size / entry_size) & ~(k_parallel_chunk_granularity - 1);
+			if (chunk_size == 0)
+				chunk_size = k_parallel_chunk_granularity;
+
+			// The first entry that starts a cache line, if any
+			size_t first_boundary = 0;
+			while (first_boundary < k_cache_line_size && !is_aligned_to(output + first_boundary, k_cache_line_size))
+				++first_boundary;
+
+			if (first_boundary == k_cache_line_size)
+				first_boundary = 0;
+
+			parallel_for(executor, count, chunk_size, first_boundary, function);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Splits [0, count) into chunks of 'chunk_size' entries and calls function(begin, end)
+	// for each of them with the executor. Workloads of a single chunk run on the calling thread.
+	// Choose the chunk size so that every chunk writes whole cache lines to avoid false sharing.
+	// The function must not throw, see parallel_task_function.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename function_type>
+	inline void parallel_for(const parallel_executor& executor, size_t count, size_t chunk_size, const function_type& function)
+	{
+		rtm_impl::parallel_for(executor, count, chunk_size, 0, function);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies 'count' pairs of QVV transforms with the executor: output[i] = qvv_mul(lhs[i], rhs[i])
+	// The arrays are split into cache sized chunks that are processed with qvv_mul_batch(..).
+	// Each chunk looks for negative scale on its own, see qvv_mul_batch(..) for details.
+	// The output can safely alias either input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_mul_batch(const parallel_executor& executor, const qvvf* lhs, const qvvf* rhs, qvvf* output, size_t count)
+	{
+		rtm_impl::parallel_for_output(executor, output, count, [lhs, rhs, output](size_t begin, size_t end) { qvv_mul_batch(lhs + begin, rhs + begin, output + begin, end - begin); });
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies 'count' pairs of QVV transforms ignoring 3D scale with the executor.
+	// See qvv_mul_batch(const parallel_executor&, ..) for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_mul_no_scale_batch(const parallel_executor& executor, const qvvf* lhs, const qvvf* rhs, qvvf* output, size_t count)
+	{
+		rtm_impl::parallel_for_output(executor, output, count, [lhs, rhs, output](size_t begin, size_t end) { qvv_mul_no_scale_batch(lhs + begin, rhs + begin, output + begin, end - begin); });
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms 'count' 3D points by the same affine matrix with the executor.
+	// See matrix_mul_point3_batch(const vector4f*, ..) for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_mul_point3_batch(const parallel_executor& executor, const vector4f* points, matrix3x4f_arg1 mtx, vector4f* output, size_t count)
+	{
+		const matrix3x4f matrix = mtx;
+		rtm_impl::parallel_for_output(executor, output, count, [points, &matrix, output](size_t begin, size_t end) { matrix_mul_point3_batch(points + begin, matrix, output + begin, end - begin); });
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses 'count' 3x4 affine matrices with the executor.
+	// See matrix_inverse_batch(const matrix3x4f*, ..) for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_inverse_batch(const parallel_executor& executor, const matrix3x4f* inputs, matrix3x4f* outputs, size_t count)
+	{
+		rtm_impl::parallel_for_output(executor, outputs, count, [inputs, outputs](size_t begin, size_t end) { matrix_inverse_batch(inputs + begin, outputs + begin, end - begin); });
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses 'count' rigid 3x4 affine matrices with the executor.
+	// See matrix_inverse_rigid_batch(const matrix3x4f*, ..) for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_inverse_rigid_batch(const parallel_executor& executor, const matrix3x4f* inputs, matrix3x4f* outputs, size_t count)
+	{
+		rtm_impl::parallel_for_output(executor, outputs, count, [inputs, outputs](size_t begin, size_t end) { matrix_inverse_rigid_batch(inputs + begin, outputs + begin, end - begin); });
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
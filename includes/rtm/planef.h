@@ -0,0 +1,88 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "rtm/math.h"
+#include "rtm/scalarf.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a plane from its normal and its signed distance from the origin.
+	//////////////////////////////////////////////////////////////////////////
+	inline planef RTM_SIMD_CALL plane_set(vector4f_arg0 normal, float distance) RTM_NO_EXCEPT
+	{
+		return vector_set(vector_get_x(normal), vector_get_y(normal), vector_get_z(normal), distance);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a plane from its normal and a point that lies on it.
+	//////////////////////////////////////////////////////////////////////////
+	inline planef RTM_SIMD_CALL plane_from_point_normal(vector4f_arg0 point, vector4f_arg1 normal) RTM_NO_EXCEPT
+	{
+		return plane_set(normal, -vector_dot3(normal, point));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the plane normal.
+	// Note: The [w] component of the returned vector is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL plane_get_normal(vector4f_arg0 plane) RTM_NO_EXCEPT
+	{
+		return plane;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the plane signed distance from the origin.
+	//////////////////////////////////////////////////////////////////////////
+	inline float RTM_SIMD_CALL plane_get_distance(vector4f_arg0 plane) RTM_NO_EXCEPT
+	{
+		return vector_get_w(plane);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a plane with a unit length normal that represents the same plane.
+	// Both the normal and the distance are scaled by the reciprocal of the normal length.
+	//////////////////////////////////////////////////////////////////////////
+	inline planef RTM_SIMD_CALL plane_normalize(vector4f_arg0 plane) RTM_NO_EXCEPT
+	{
+		return vector_mul(plane, vector_length_reciprocal3(plane));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the signed distance between a plane and a 3D point.
+	// The distance is positive if the point is in front of the plane.
+	// Note: The plane must be normalized for the distance to be in world units.
+	//////////////////////////////////////////////////////////////////////////
+	inline float RTM_SIMD_CALL plane_signed_distance(vector4f_arg0 plane, vector4f_arg1 point) RTM_NO_EXCEPT
+	{
+		return vector_dot3(plane, point) + vector_get_w(plane);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
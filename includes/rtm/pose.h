@@ -0,0 +1,309 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "rtm/math.h"
+#include "rtm/matrix3x4f.h"
+#include "rtm/qvvf.h"
+#include "rtm/qvvf_x4.h"
+#include "rtm/qvvf_x8.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/memory_utils.h"
+#include "rtm/impl/soa_common.h"
+
+#include <cstddef>
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// The parent index of root bones.
+	//////////////////////////////////////////////////////////////////////////
+	constexpr uint16_t k_invalid_bone_index = 0xFFFF;
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Prefetches the object space transform of the parent of a bone. The parent is reached
+		// through its index which hardware prefetchers cannot predict.
+		// The parent might not be computed yet, its cache line is then brought in for writing.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename qvv_type>
+		inline void pose_prefetch_parent(const uint16_t* parent_indices, const qvv_type* object_transforms, size_t bone_index) RTM_NO_EXCEPT
+		{
+			const uint16_t parent_index = parent_indices[bone_index];
+			if (parent_index != k_invalid_bone_index)
+				memory_prefetch_range(object_transforms + parent_index, sizeof(qvv_type));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Loads 4 QVV transforms from arbitrary indices and transposes them, one transform per lane.
+		//////////////////////////////////////////////////////////////////////////
+		inline qvvf_x4 RTM_SIMD_CALL qvv_gather_x4(const qvvf* transforms, const uint16_t* indices) RTM_NO_EXCEPT
+		{
+			const qvvf& input0 = transforms[indices[0]];
+			const qvvf& input1 = transforms[indices[1]];
+			const qvvf& input2 = transforms[indices[2]];
+			const qvvf& input3 = transforms[indices[3]];
+
+			qvvf_x4 result;
+			vector4f w;
+			transpose_4x4(quat_to_vector(input0.rotation), quat_to_vector(input1.rotation), quat_to_vector(input2.rotation), quat_to_vector(input3.rotation),
+				result.rotation.x, result.rotation.y, result.rotation.z, result.rotation.w);
+			transpose_4x4(input0.translation, input1.translation, input2.translation, input3.translation,
+				result.translation.x, result.translation.y, result.translation.z, w);
+			transpose_4x4(input0.scale, input1.scale, input2.scale, input3.scale,
+				result.scale.x, result.scale.y, result.scale.z, w);
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Converts 4 QVV transforms into 3x4 affine matrices and writes them to consecutive outputs.
+		// The rotation matrices are built in structure of arrays form, see matrix_from_qvv(..).
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL matrix_from_qvv_x4(const qvvf_x4& input, matrix3x4f* outputs) RTM_NO_EXCEPT
+		{
+			const quatf_x4& quat = input.rotation;
+
+			const vector4f x2 = vector_add(quat.x, quat.x);
+			const vector4f y2 = vector_add(quat.y, quat.y);
+			const vector4f z2 = vector_add(quat.z, quat.z);
+			const vector4f xx = vector_mul(quat.x, x2);
+			const vector4f xy = vector_mul(quat.x, y2);
+			const vector4f xz = vector_mul(quat.x, z2);
+			const vector4f yy = vector_mul(quat.y, y2);
+			const vector4f yz = vector_mul(quat.y, z2);
+			const vector4f zz = vector_mul(quat.z, z2);
+			const vector4f wx = vector_mul(quat.w, x2);
+			const vector4f wy = vector_mul(quat.w, y2);
+			const vector4f wz = vector_mul(quat.w, z2);
+
+			const vector4f zero = vector_zero();
+			const vector4f one = vector_set(1.0f);
+
+			vector4f axis0;
+			vector4f axis1;
+			vector4f axis2;
+			vector4f axis3;
+			transpose_4x4(vector_mul(vector_sub(one, vector_add(yy, zz)), input.scale.x), vector_mul(vector_add(xy, wz), input.scale.x), vector_mul(vector_sub(xz, wy), input.scale.x), zero,
+				axis0, axis1, axis2, axis3);
+			outputs[0].x_axis = axis0;
+			outputs[1].x_axis = axis1;
+			outputs[2].x_axis = axis2;
+			outputs[3].x_axis = axis3;
+
+			transpose_4x4(vector_mul(vector_sub(xy, wz), input.scale.y), vector_mul(vector_sub(one, vector_add(xx, zz)), input.scale.y), vector_mul(vector_add(yz, wx), input.scale.y), zero,
+				axis0, axis1, axis2, axis3);
+			outputs[0].y_axis = axis0;
+			outputs[1].y_axis = axis1;
+			outputs[2].y_axis = axis2;
+			outputs[3].y_axis = axis3;
+
+			transpose_4x4(vector_mul(vector_add(xz, wy), input.scale.z), vector_mul(vector_sub(yz, wx), input.scale.z), vector_mul(vector_sub(one, vector_add(xx, yy)), input.scale.z), zero,
+				axis0, axis1, axis2, axis3);
+			outputs[0].z_axis = axis0;
+			outputs[1].z_axis = axis1;
+			outputs[2].z_axis = axis2;
+			outputs[3].z_axis = axis3;
+
+			transpose_4x4(input.translation.x, input.translation.y, input.translation.z, one,
+				axis0, axis1, axis2, axis3);
+			outputs[0].w_axis = axis0;
+			outputs[1].w_axis = axis1;
+			outputs[2].w_axis = axis2;
+			outputs[3].w_axis = axis3;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Computes the object space transform of a single bone from its parent.
+		//////////////////////////////////////////////////////////////////////////
+		inline void pose_bone_local_to_object(const qvvf* local_transforms, const uint16_t* parent_indices, qvvf* out_object_transforms, matrix3x4f* out_palette, store_mode palette_mode, size_t bone_index) RTM_NO_EXCEPT
+		{
+			const uint16_t parent_index = parent_indices[bone_index];
+			if (parent_index == k_invalid_bone_index)
+				out_object_transforms[bone_index] = local_transforms[bone_index];
+			else
+			{
+				RTM_ASSERT(parent_index < bone_index, "Parent bones must be sorted before their children");
+				out_object_transforms[bone_index] = qvv_mul(local_transforms[bone_index], out_object_transforms[parent_index]);
+			}
+
+			if (out_palette == nullptr)
+				return;
+
+			if (palette_mode == store_mode::streaming)
+				matrix_store_stream(matrix_from_qvv(out_object_transforms[bone_index]), out_palette + bone_index);
+			else
+				out_palette[bone_index] = matrix_from_qvv(out_object_transforms[bone_index]);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Computes the object space transforms of several skeleton instances in lockstep,
+		// see pose_local_to_object(const qvvf_x4*, ..) for details.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename qvv_type>
+		inline void pose_local_to_object_lockstep(const qvv_type* local_transforms, const uint16_t* parent_indices, qvv_type* out_object_transforms, size_t num_bones, size_t prefetch_distance) RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(local_transforms != nullptr && parent_indices != nullptr && out_object_transforms != nullptr, "Invalid pose transforms or hierarchy");
+
+			for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+			{
+				if (prefetch_distance != 0 && bone_index + prefetch_distance < num_bones)
+				{
+					memory_prefetch_range(local_transforms + bone_index + prefetch_distance, sizeof(qvv_type));
+					pose_prefetch_parent(parent_indices, out_object_transforms, bone_index + prefetch_distance);
+				}
+
+				const uint16_t parent_index = parent_indices[bone_index];
+				if (parent_index == k_invalid_bone_index)
+					out_object_transforms[bone_index] = local_transforms[bone_index];
+				else
+				{
+					RTM_ASSERT(parent_index < bone_index, "Parent bones must be sorted before their children");
+					out_object_transforms[bone_index] = qvv_mul(local_transforms[bone_index], out_object_transforms[parent_index]);
+				}
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the object space transforms of a skeleton from its local space transforms:
+	// object[i] = qvv_mul(local[i], object[parent_indices[i]])
+	// Root bones have a parent index of k_invalid_bone_index and their object space
+	// transform is their local space transform. Every other bone must be sorted after its parent.
+	// The object space transforms can optionally be converted into a matrix palette, it can be null.
+	// Bones are processed in groups of 4: when every parent in a group was computed before it,
+	// as is the case for siblings, the group is evaluated in structure of arrays form, one
+	// bone per SIMD lane. Otherwise, the bones of the group are evaluated one at a time.
+	// The local transforms and the object space transforms of their parents are prefetched
+	// 'prefetch_distance' bones ahead, a distance of 0 disables software prefetching.
+	// The object space transforms can safely alias the local space transforms.
+	// The [w] component of the object space translations is undefined.
+	// With store_mode::streaming, the palette is written with non-temporal stores and fenced
+	// before returning, e.g. when it is written directly into a GPU upload buffer.
+	//////////////////////////////////////////////////////////////////////////
+	inline void pose_local_to_object(const qvvf* local_transforms, const uint16_t* parent_indices,
+		qvvf* out_object_transforms, matrix3x4f* out_palette, size_t num_bones, store_mode palette_mode = store_mode::cached,
+		size_t prefetch_distance = k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(local_transforms != nullptr && parent_indices != nullptr && out_object_transforms != nullptr, "Invalid pose transforms or hierarchy");
+
+		const size_t num_grouped_bones = num_bones & ~size_t(3);
+		for (size_t bone_index = 0; bone_index < num_grouped_bones; bone_index += 4)
+		{
+			if (prefetch_distance != 0 && bone_index + prefetch_distance + 4 <= num_bones)
+			{
+				const size_t prefetch_index = bone_index + prefetch_distance;
+				rtm_impl::memory_prefetch_range(local_transforms + prefetch_index, sizeof(qvvf) * 4);
+
+				// Consecutive siblings share their parent, it is only prefetched once
+				uint16_t last_parent_index = k_invalid_bone_index;
+				for (size_t group_index = 0; group_index < 4; ++group_index)
+				{
+					if (parent_indices[prefetch_index + group_index] != last_parent_index)
+						rtm_impl::pose_prefetch_parent(parent_indices, out_object_transforms, prefetch_index + group_index);
+					last_parent_index = parent_indices[prefetch_index + group_index];
+				}
+			}
+
+			// Roots are tested explicitly, their invalid parent index is lower than the bone index in large poses
+			const uint16_t* group_parent_indices = parent_indices + bone_index;
+			bool is_group_independent = true;
+			for (size_t group_index = 0; group_index < 4; ++group_index)
+			{
+				const uint16_t parent_index = group_parent_indices[group_index];
+				is_group_independent &= parent_index != k_invalid_bone_index && parent_index < bone_index;
+			}
+
+			if (is_group_independent)
+			{
+				const qvvf_x4 local = qvv_load_x4(local_transforms + bone_index);
+				const qvvf_x4 parent = rtm_impl::qvv_gather_x4(out_object_transforms, group_parent_indices);
+				const qvvf_x4 object = qvv_mul(local, parent);
+
+				qvv_store_x4(object, out_object_transforms + bone_index);
+
+				if (out_palette == nullptr)
+					continue;
+
+				if (palette_mode == store_mode::streaming)
+				{
+					// Each matrix is written whole to fill the write combining buffers one cache line at a time
+					matrix3x4f matrices[4];
+					rtm_impl::matrix_from_qvv_x4(object, &matrices[0]);
+					matrix_store_stream(matrices[0], out_palette + bone_index + 0);
+					matrix_store_stream(matrices[1], out_palette + bone_index + 1);
+					matrix_store_stream(matrices[2], out_palette + bone_index + 2);
+					matrix_store_stream(matrices[3], out_palette + bone_index + 3);
+				}
+				else
+					rtm_impl::matrix_from_qvv_x4(object, out_palette + bone_index);
+			}
+			else
+			{
+				for (size_t group_index = 0; group_index < 4; ++group_index)
+					rtm_impl::pose_bone_local_to_object(local_transforms, parent_indices, out_object_transforms, out_palette, palette_mode, bone_index + group_index);
+			}
+		}
+
+		for (size_t bone_index = num_grouped_bones; bone_index < num_bones; ++bone_index)
+			rtm_impl::pose_bone_local_to_object(local_transforms, parent_indices, out_object_transforms, out_palette, palette_mode, bone_index);
+
+		if (out_palette != nullptr && palette_mode == store_mode::streaming)
+			rtm_impl::memory_stream_fence();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the object space transforms of 4 instances of the same skeleton in lockstep,
+	// one instance per SIMD lane: local_transforms[bone] holds that bone for every instance.
+	// The hierarchy is walked once and every qvv_mul(..) evaluates the 4 instances together
+	// which hides its latency along parent to child chains.
+	// See pose_local_to_object(const qvvf*, ..) for the hierarchy requirements.
+	// Poses can be converted to and from this layout with qvv_load_x4(..) and qvv_store_x4(..).
+	// Bones are prefetched 'prefetch_distance' ahead like the single instance variant.
+	// The object space transforms can safely alias the local space transforms.
+	//////////////////////////////////////////////////////////////////////////
+	inline void pose_local_to_object(const qvvf_x4* local_transforms, const uint16_t* parent_indices,
+		qvvf_x4* out_object_transforms, size_t num_bones, size_t prefetch_distance = k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		rtm_impl::pose_local_to_object_lockstep(local_transforms, parent_indices, out_object_transforms, num_bones, prefetch_distance);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the object space transforms of 8 instances of the same skeleton in lockstep,
+	// one instance per SIMD lane. See pose_local_to_object(const qvvf_x4*, ..) for details.
+	// This is best suited for AVX, the 4 wide variant is usually faster without it.
+	// Note: qvvf_x8 is 32 bytes aligned with AVX which operator new only honors with C++17.
+	//////////////////////////////////////////////////////////////////////////
+	inline void pose_local_to_object(const qvvf_x8* local_transforms, const uint16_t* parent_indices,
+		qvvf_x8* out_object_transforms, size_t num_bones, size_t prefetch_distance = k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		rtm_impl::pose_local_to_object_lockstep(local_transforms, parent_indices, out_object_transforms, num_bones, prefetch_distance);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -46,7 +46,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Loads an unaligned quaternion from memory.
 	//////////////////////////////////////////////////////////////////////////
-	inline quatd quat_unaligned_load(const double* input) RTM_NO_EXCEPT
+	inline quatd RTM_SIMD_CALL quat_unaligned_load(const double* input) RTM_NO_EXCEPT
 	{
 		return quat_set(input[0], input[1], input[2], input[3]);
 	}
@@ -54,9 +54,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Casts a vector4 to a quaternion.
 	//////////////////////////////////////////////////////////////////////////
-	inline quatd vector_to_quat(const vector4d& input) RTM_NO_EXCEPT
+	inline quatd RTM_SIMD_CALL vector_to_quat(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return input;
+#elif defined(RTM_SSE2_INTRINSICS) || defined(RTM_NEON64_INTRINSICS)
 		return quatd{ input.xy, input.zw };
 #else
 		return quatd{ input.x, input.y, input.z, input.w };
@@ -66,10 +68,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Casts a quaternion float32 variant to a float64 variant.
 	//////////////////////////////////////////////////////////////////////////
-	inline quatd quat_cast(const quatf& input) RTM_NO_EXCEPT
+	inline quatd RTM_SIMD_CALL quat_cast(quatf_arg0 input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_cvtps_pd(input);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return quatd{ _mm_cvtps_pd(input), _mm_cvtps_pd(_mm_shuffle_ps(input, input, _MM_SHUFFLE(3, 2, 3, 2))) };
+#elif defined(RTM_NEON64_INTRINSICS)
+		return quatd{ vcvt_f64_f32(vget_low_f32(input)), vcvt_high_f64_f32(input) };
 #elif defined(RTM_NEON_INTRINSICS)
 		return quatd{ double(vgetq_lane_f32(input, 0)), double(vgetq_lane_f32(input, 1)), double(vgetq_lane_f32(input, 2)), double(vgetq_lane_f32(input, 3)) };
 #else
@@ -80,10 +86,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the quaternion [x] component (real part).
 	//////////////////////////////////////////////////////////////////////////
-	inline double quat_get_x(const quatd& input) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL quat_get_x(quatd_arg0 input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm_cvtsd_f64(_mm256_castpd256_pd128(input));
+#elif defined(RTM_SSE2_INTRINSICS)
 		return _mm_cvtsd_f64(input.xy);
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vgetq_lane_f64(input.xy, 0);
 #else
 		return input.x;
 #endif
@@ -92,10 +102,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the quaternion [y] component (real part).
 	//////////////////////////////////////////////////////////////////////////
-	inline double quat_get_y(const quatd& input) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL quat_get_y(quatd_arg0 input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm_cvtsd_f64(_mm_permute_pd(_mm256_castpd256_pd128(input), 1));
+#elif defined(RTM_SSE2_INTRINSICS)
 		return _mm_cvtsd_f64(_mm_shuffle_pd(input.xy, input.xy, 1));
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vgetq_lane_f64(input.xy, 1);
 #else
 		return input.y;
 #endif
@@ -104,10 +118,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the quaternion [z] component (real part).
 	//////////////////////////////////////////////////////////////////////////
-	inline double quat_get_z(const quatd& input) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL quat_get_z(quatd_arg0 input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm_cvtsd_f64(_mm256_extractf128_pd(input, 1));
+#elif defined(RTM_SSE2_INTRINSICS)
 		return _mm_cvtsd_f64(input.zw);
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vgetq_lane_f64(input.zw, 0);
 #else
 		return input.z;
 #endif
@@ -116,10 +134,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the quaternion [w] component (imaginary part).
 	//////////////////////////////////////////////////////////////////////////
-	inline double quat_get_w(const quatd& input) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL quat_get_w(quatd_arg0 input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm_cvtsd_f64(_mm_permute_pd(_mm256_extractf128_pd(input, 1), 1));
+#elif defined(RTM_SSE2_INTRINSICS)
 		return _mm_cvtsd_f64(_mm_shuffle_pd(input.zw, input.zw, 1));
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vgetq_lane_f64(input.zw, 1);
 #else
 		return input.w;
 #endif
@@ -128,7 +150,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Writes a quaternion to unaligned memory.
 	//////////////////////////////////////////////////////////////////////////
-	inline void quat_unaligned_write(const quatd& input, double* output) RTM_NO_EXCEPT
+	inline void RTM_SIMD_CALL quat_unaligned_write(quatd_arg0 input, double* output) RTM_NO_EXCEPT
 	{
 		RTM_ASSERT(rtm_impl::is_aligned(output), "Invalid alignment");
 		output[0] = quat_get_x(input);
@@ -148,9 +170,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the quaternion conjugate.
 	//////////////////////////////////////////////////////////////////////////
-	inline quatd quat_conjugate(const quatd& input) RTM_NO_EXCEPT
+	inline quatd RTM_SIMD_CALL quat_conjugate(quatd_arg0 input) RTM_NO_EXCEPT
 	{
+#if defined(RTM_NEON64_INTRINSICS)
+		alignas(16) constexpr double signs_zw[2] = { -1.0, 1.0 };
+		return quatd{ vnegq_f64(input.xy), vmulq_f64(input.zw, vld1q_f64(&signs_zw[0])) };
+#else
 		return quat_set(-quat_get_x(input), -quat_get_y(input), -quat_get_z(input), quat_get_w(input));
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -158,8 +185,34 @@ namespace rtm
 	// Note that due to floating point rounding, the result might not be perfectly normalized.
 	// Multiplication order is as follow: local_to_world = quat_mul(local_to_object, object_to_world)
 	//////////////////////////////////////////////////////////////////////////
-	inline quatd quat_mul(const quatd& lhs, const quatd& rhs) RTM_NO_EXCEPT
+	inline quatd RTM_SIMD_CALL quat_mul(quatd_arg0 lhs, quatd_arg1 rhs) RTM_NO_EXCEPT
 	{
+#if defined(RTM_NEON64_INTRINSICS)
+		alignas(16) constexpr double signs_pn[2] = { 1.0, -1.0 };
+		alignas(16) constexpr double signs_np[2] = { -1.0, 1.0 };
+
+		// Each half of the result is a sum of four products between a swizzled lhs half
+		// and a broadcast rhs component with the appropriate signs applied.
+		const float64x2_t r_x_nx = vmulq_f64(vdupq_laneq_f64(rhs.xy, 0), vld1q_f64(&signs_pn[0]));
+		const float64x2_t r_y = vdupq_laneq_f64(rhs.xy, 1);
+		const float64x2_t r_nz_z = vmulq_f64(vdupq_laneq_f64(rhs.zw, 0), vld1q_f64(&signs_np[0]));
+		const float64x2_t r_w = vdupq_laneq_f64(rhs.zw, 1);
+
+		const float64x2_t l_yx = vextq_f64(lhs.xy, lhs.xy, 1);
+		const float64x2_t l_wz = vextq_f64(lhs.zw, lhs.zw, 1);
+
+		float64x2_t xy = vmulq_f64(lhs.xy, r_w);
+		xy = vfmaq_f64(xy, l_wz, r_x_nx);
+		xy = vfmaq_f64(xy, lhs.zw, r_y);
+		xy = vfmaq_f64(xy, l_yx, r_nz_z);
+
+		float64x2_t zw = vmulq_f64(lhs.zw, r_w);
+		zw = vfmaq_f64(zw, l_yx, r_x_nx);
+		zw = vfmsq_f64(zw, lhs.xy, r_y);
+		zw = vfmsq_f64(zw, l_wz, r_nz_z);
+
+		return quatd{ xy, zw };
+#else
 		double lhs_x = quat_get_x(lhs);
 		double lhs_y = quat_get_y(lhs);
 		double lhs_z = quat_get_z(lhs);
@@ -176,13 +229,14 @@ namespace rtm
 		double w = (rhs_w * lhs_w) - (rhs_x * lhs_x) - (rhs_y * lhs_y) - (rhs_z * lhs_z);
 
 		return quat_set(x, y, z, w);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Multiplies a quaternion and a 3D vector, rotating it.
 	// Multiplication order is as follow: world_position = quat_mul_vector3(local_position, local_to_world)
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d quat_mul_vector3(const vector4d& vector, const quatd& rotation) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL quat_mul_vector3(vector4d_arg0 vector, quatd_arg1 rotation) RTM_NO_EXCEPT
 	{
 		quatd vector_quat = quat_set(vector_get_x(vector), vector_get_y(vector), vector_get_z(vector), 0.0);
 		quatd inv_rotation = quat_conjugate(rotation);
@@ -192,7 +246,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the squared length/norm of the quaternion.
 	//////////////////////////////////////////////////////////////////////////
-	inline double quat_length_squared(const quatd& input) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL quat_length_squared(quatd_arg0 input) RTM_NO_EXCEPT
 	{
 		// TODO: Use dot instruction
 		return (quat_get_x(input) * quat_get_x(input)) + (quat_get_y(input) * quat_get_y(input)) + (quat_get_z(input) * quat_get_z(input)) + (quat_get_w(input) * quat_get_w(input));
@@ -201,7 +255,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the length/norm of the quaternion.
 	//////////////////////////////////////////////////////////////////////////
-	inline double quat_length(const quatd& input) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL quat_length(quatd_arg0 input) RTM_NO_EXCEPT
 	{
 		// TODO: Use intrinsics to avoid scalar coercion
 		return scalar_sqrt(quat_length_squared(input));
@@ -210,7 +264,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the reciprocal length/norm of the quaternion.
 	//////////////////////////////////////////////////////////////////////////
-	inline double quat_length_reciprocal(const quatd& input) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL quat_length_reciprocal(quatd_arg0 input) RTM_NO_EXCEPT
 	{
 		// TODO: Use recip instruction
 		return 1.0 / quat_length(input);
@@ -221,7 +275,7 @@ namespace rtm
 	// Note that if the input quaternion is invalid (pure zero or with NaN/Inf),
 	// the result is undefined.
 	//////////////////////////////////////////////////////////////////////////
-	inline quatd quat_normalize(const quatd& input) RTM_NO_EXCEPT
+	inline quatd RTM_SIMD_CALL quat_normalize(quatd_arg0 input) RTM_NO_EXCEPT
 	{
 		// TODO: Use high precision recip sqrt function and vector_mul
 		double length = quat_length(input);
@@ -234,7 +288,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the linear interpolation between start and end for a given alpha value.
 	//////////////////////////////////////////////////////////////////////////
-	inline quatd quat_lerp(const quatd& start, const quatd& end, double alpha) RTM_NO_EXCEPT
+	inline quatd RTM_SIMD_CALL quat_lerp(quatd_arg0 start, quatd_arg1 end, double alpha) RTM_NO_EXCEPT
 	{
 		// To ensure we take the shortest path, we apply a bias if the dot product is negative
 		vector4d start_vector = quat_to_vector(start);
@@ -242,7 +296,7 @@ namespace rtm
 		double dot = vector_dot(start_vector, end_vector);
 		double bias = dot >= 0.0 ? 1.0 : -1.0;
 		// TODO: Test with this instead: Rotation = (B * Alpha) + (A * (Bias * (1.f - Alpha)));
-		vector4d value = vector_add(start_vector, vector_mul(vector_sub(vector_mul(end_vector, bias), start_vector), alpha));
+		vector4d value = vector_mul_add(vector_sub(vector_mul(end_vector, bias), start_vector), alpha, start_vector);
 		//vector4d value = vector_add(vector_mul(end_vector, alpha), vector_mul(start_vector, bias * (1.0 - alpha)));
 		return quat_normalize(vector_to_quat(value));
 	}
@@ -250,12 +304,196 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns a component wise negated quaternion.
 	//////////////////////////////////////////////////////////////////////////
-	inline quatd quat_neg(const quatd& input) RTM_NO_EXCEPT
+	inline quatd RTM_SIMD_CALL quat_neg(quatd_arg0 input) RTM_NO_EXCEPT
 	{
 		return vector_to_quat(vector_mul(quat_to_vector(input), -1.0));
 	}
 
 
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Per lane evaluates sin(alpha * angle) / sin(angle) where cos(angle) = dot_minus_one + 1.0
+		// and alpha and angle are within [0.0, 1.0] and [0.0, PI/2] respectively.
+		// The ratio is expanded as a series in (dot - 1.0), see "A Fast and Accurate Algorithm
+		// for Computing SLERP" (Eberly 2011). Each term is the previous one multiplied by
+		// (alpha^2 / (i * (2i + 1)) - i / (2i + 1)) * (dot - 1.0). The series is truncated after 12 terms
+		// and the last term is replaced by a minimax fit that accounts for the remainder.
+		// The max absolute error of the ratio is 7.6e-8 before rounding.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4d RTM_SIMD_CALL slerp_fast_weights(vector4d_arg0 alpha, vector4d_arg1 dot_minus_one) RTM_NO_EXCEPT
+		{
+			const vector4d alpha_sq = vector_mul(alpha, alpha);
+			const vector4d one = vector_set(1.0);
+
+			// Last term with the remainder correction
+			const vector4d remainder = vector_mul_add(dot_minus_one, vector_set(-3.61298012809466360), one);
+			vector4d result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 2.37848825323043030e-3), vector_set(2.00691297009131820e-1)), dot_minus_one), remainder, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0 / (11.0 * 23.0)), vector_set(11.0 / 23.0)), dot_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0 / (10.0 * 21.0)), vector_set(10.0 / 21.0)), dot_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0 / (9.0 * 19.0)), vector_set(9.0 / 19.0)), dot_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0 / (8.0 * 17.0)), vector_set(8.0 / 17.0)), dot_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0 / (7.0 * 15.0)), vector_set(7.0 / 15.0)), dot_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0 / (6.0 * 13.0)), vector_set(6.0 / 13.0)), dot_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0 / (5.0 * 11.0)), vector_set(5.0 / 11.0)), dot_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0 / (4.0 * 9.0)), vector_set(4.0 / 9.0)), dot_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0 / (3.0 * 7.0)), vector_set(3.0 / 7.0)), dot_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0 / (2.0 * 5.0)), vector_set(2.0 / 5.0)), dot_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0 / (1.0 * 3.0)), vector_set(1.0 / 3.0)), dot_minus_one), result, one);
+			return vector_mul(alpha, result);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the logarithm of a normalized quaternion: [axis * half angle, 0.0]
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4d RTM_SIMD_CALL quat_log_normalized(quatd_arg0 input) RTM_NO_EXCEPT
+		{
+			const vector4d input_vector = quat_to_vector(input);
+			const double sin_half_angle = vector_length3(input_vector);
+			const double half_angle = vector_get_x(vector_atan2(vector_set(sin_half_angle), vector_set(quat_get_w(input))));
+
+			// When the angle is very small, sin(x) / x is 1.0 and the logarithm is the vector part
+			const double scale = sin_half_angle >= 1.0e-8 ? (half_angle / sin_half_angle) : 1.0;
+			return vector_mul(vector_set(quat_get_x(input), quat_get_y(input), quat_get_z(input), 0.0), scale);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the exponential of a pure quaternion [axis * half angle, 0.0], the inverse of quat_log_normalized(..).
+		//////////////////////////////////////////////////////////////////////////
+		inline quatd RTM_SIMD_CALL quat_exp_pure(vector4d_arg0 input) RTM_NO_EXCEPT
+		{
+			const double half_angle = vector_length3(input);
+
+			vector4d sin_half_angle;
+			vector4d cos_half_angle;
+			vector_sincos(vector_set(half_angle), sin_half_angle, cos_half_angle);
+
+			const double scale = half_angle >= 1.0e-8 ? (vector_get_x(sin_half_angle) / half_angle) : 1.0;
+			return vector_to_quat(vector_mix<mix4::x, mix4::y, mix4::z, mix4::d>(vector_mul(input, scale), cos_half_angle));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the inner squad control point of 'rotation' given its neighbors.
+		// control = rotation * exp(-(log(rotation^-1 * next) + log(rotation^-1 * prev)) / 4)
+		//////////////////////////////////////////////////////////////////////////
+		inline quatd RTM_SIMD_CALL quat_squad_control_point(quatd_arg0 prev, quatd_arg1 rotation, quatd_arg2 next) RTM_NO_EXCEPT
+		{
+			const quatd inv_rotation = quat_conjugate(rotation);
+			const vector4d log_next = quat_log_normalized(quat_mul(next, inv_rotation));
+			const vector4d log_prev = quat_log_normalized(quat_mul(prev, inv_rotation));
+			const quatd delta = quat_exp_pure(vector_mul(vector_add(log_next, log_prev), -0.25));
+			return quat_mul(delta, rotation);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the spherical interpolation between start and end without taking the shortest path.
+		// Squad blends its key and tangent rotations with it: they can move into opposite
+		// hemispheres during a segment and flipping one of them would make the curve jump.
+		//////////////////////////////////////////////////////////////////////////
+		inline quatd RTM_SIMD_CALL quat_slerp_no_flip(quatd_arg0 start, quatd_arg1 end, double alpha) RTM_NO_EXCEPT
+		{
+			const vector4d start_vector = quat_to_vector(start);
+			const vector4d end_vector = quat_to_vector(end);
+			const double dot = vector_dot(start_vector, end_vector);
+
+			// Below this angle, sin(angle) loses too much precision and nlerp is just as accurate
+			if (scalar_abs(dot) >= 1.0 - 1.0e-12)
+				return quat_normalize(vector_to_quat(vector_lerp(start_vector, end_vector, alpha)));
+
+			// The three sines are evaluated together: [sin((1 - alpha) * angle), sin(alpha * angle), sin(angle), 0]
+			const double angle = scalar_acos(dot);
+			const vector4d sines = vector_sin(vector_mul(vector_set(1.0 - alpha, alpha, 1.0, 0.0), angle));
+
+			const double inv_sin_angle = 1.0 / vector_get_z(sines);
+			const double start_weight = vector_get_x(sines) * inv_sin_angle;
+			const double end_weight = vector_get_y(sines) * inv_sin_angle;
+			return vector_to_quat(vector_mul_add(start_vector, start_weight, vector_mul(end_vector, end_weight)));
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the spherical interpolation between start and end for a given alpha value.
+	// The shortest path is taken and the angular velocity is constant.
+	// When both rotations are nearly equal, a normalized linear interpolation is used instead.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatd RTM_SIMD_CALL quat_slerp(quatd_arg0 start, quatd_arg1 end, double alpha) RTM_NO_EXCEPT
+	{
+		const vector4d start_vector = quat_to_vector(start);
+		const vector4d end_vector = quat_to_vector(end);
+		const double dot = vector_dot(start_vector, end_vector);
+
+		// To ensure we take the shortest path, we apply a bias if the dot product is negative
+		const double bias = dot >= 0.0 ? 1.0 : -1.0;
+		const double abs_dot = dot * bias;
+
+		// Below this angle, sin(angle) loses too much precision and nlerp is just as accurate
+		if (abs_dot >= 1.0 - 1.0e-12)
+			return quat_lerp(start, end, alpha);
+
+		// The three sines are evaluated together: [sin((1 - alpha) * angle), sin(alpha * angle), sin(angle), 0]
+		const double angle = scalar_acos(abs_dot);
+		const vector4d sines = vector_sin(vector_mul(vector_set(1.0 - alpha, alpha, 1.0, 0.0), angle));
+
+		const double inv_sin_angle = 1.0 / vector_get_z(sines);
+		const double start_weight = vector_get_x(sines) * inv_sin_angle;
+		const double end_weight = vector_get_y(sines) * inv_sin_angle * bias;
+		return vector_to_quat(vector_mul_add(start_vector, start_weight, vector_mul(end_vector, end_weight)));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns an approximation of the spherical interpolation between start and end for a given alpha value.
+	// The shortest path is taken. The interpolation weights sin(alpha * angle) / sin(angle) are evaluated
+	// with a polynomial in the dot product without any division or trigonometric function.
+	// The polynomial is the same as the float32 variant, the max absolute error on the result components is 1.1e-7.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatd RTM_SIMD_CALL quat_slerp_fast(quatd_arg0 start, quatd_arg1 end, double alpha) RTM_NO_EXCEPT
+	{
+		const vector4d start_vector = quat_to_vector(start);
+		const vector4d end_vector = quat_to_vector(end);
+		const double dot = vector_dot(start_vector, end_vector);
+
+		// To ensure we take the shortest path, we apply a bias if the dot product is negative
+		const double bias = dot >= 0.0 ? 1.0 : -1.0;
+		const double dot_minus_one = dot * bias - 1.0;
+
+		const vector4d weights = rtm_impl::slerp_fast_weights(vector_set(1.0 - alpha, alpha, 0.0, 0.0), vector_set(dot_minus_one));
+		const double start_weight = vector_get_x(weights);
+		const double end_weight = vector_get_y(weights) * bias;
+		return vector_to_quat(vector_mul_add(start_vector, start_weight, vector_mul(end_vector, end_weight)));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the spherical quadrangle interpolation between start and end for a given alpha value.
+	// The start and end tangents are inner control points, see quat_squad_setup(..).
+	// squad = slerp(slerp(start, end, alpha), slerp(start_tangent, end_tangent, alpha), 2 * alpha * (1 - alpha))
+	// The outer interpolation doesn't take the shortest path to keep the curve continuous.
+	// When consecutive segments share their keys and tangents, the resulting curve is C1 continuous.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatd RTM_SIMD_CALL quat_squad(quatd_arg0 start, quatd_arg1 start_tangent, quatd_arg2 end_tangent, quatd_arg3 end, double alpha) RTM_NO_EXCEPT
+	{
+		const quatd key_rotation = quat_slerp(start, end, alpha);
+		const quatd tangent_rotation = quat_slerp(start_tangent, end_tangent, alpha);
+		return rtm_impl::quat_slerp_no_flip(key_rotation, tangent_rotation, 2.0 * alpha * (1.0 - alpha));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the inner control points of the squad segment between start and end
+	// given the previous and next keys. The keys are first moved in the same hemisphere
+	// as their predecessor to take the shortest path.
+	// The aligned end rotation is written to out_end, it should be used with quat_squad(..).
+	// For the first and last segments, the first and last keys can be duplicated.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL quat_squad_setup(quatd_arg0 prev, quatd_arg1 start, quatd_arg2 end, quatd_arg3 next, quatd& out_start_tangent, quatd& out_end_tangent, quatd& out_end) RTM_NO_EXCEPT
+	{
+		const quatd aligned_prev = vector_dot(quat_to_vector(prev), quat_to_vector(start)) >= 0.0 ? prev : quat_neg(prev);
+		const quatd aligned_end = vector_dot(quat_to_vector(start), quat_to_vector(end)) >= 0.0 ? end : quat_neg(end);
+		const quatd aligned_next = vector_dot(quat_to_vector(aligned_end), quat_to_vector(next)) >= 0.0 ? next : quat_neg(next);
+
+		out_start_tangent = rtm_impl::quat_squad_control_point(aligned_prev, start, aligned_end);
+		out_end_tangent = rtm_impl::quat_squad_control_point(start, aligned_end, aligned_next);
+		out_end = aligned_end;
+	}
+
 
 	//////////////////////////////////////////////////////////////////////////
 	// Conversion to/from axis/angle/euler
@@ -266,7 +504,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the rotation axis and rotation angle that make up the input quaternion.
 	//////////////////////////////////////////////////////////////////////////
-	inline void quat_to_axis_angle(const quatd& input, vector4d& out_axis, angled& out_angle) RTM_NO_EXCEPT
+	inline void RTM_SIMD_CALL quat_to_axis_angle(quatd_arg0 input, vector4d& out_axis, angled& out_angle) RTM_NO_EXCEPT
 	{
 		constexpr double epsilon = 1.0e-8;
 		constexpr double epsilon_squared = epsilon * epsilon;
@@ -280,7 +518,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the rotation axis part of the input quaternion.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d quat_get_axis(const quatd& input) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL quat_get_axis(quatd_arg0 input) RTM_NO_EXCEPT
 	{
 		constexpr double epsilon = 1.0e-8;
 		constexpr double epsilon_squared = epsilon * epsilon;
@@ -292,7 +530,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the rotation angle part of the input quaternion.
 	//////////////////////////////////////////////////////////////////////////
-	inline angled quat_get_angle(const quatd& input) RTM_NO_EXCEPT
+	inline angled RTM_SIMD_CALL quat_get_angle(quatd_arg0 input) RTM_NO_EXCEPT
 	{
 		return radians(scalar_acos(quat_get_w(input)) * 2.0);
 	}
@@ -300,12 +538,12 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Creates a quaternion from a rotation axis and a rotation angle.
 	//////////////////////////////////////////////////////////////////////////
-	inline quatd quat_from_axis_angle(const vector4d& axis, angled angle) RTM_NO_EXCEPT
+	inline quatd RTM_SIMD_CALL quat_from_axis_angle(vector4d_arg0 axis, angled angle) RTM_NO_EXCEPT
 	{
 		double s, c;
 		scalar_sincos(0.5 * angle.as_radians(), s, c);
 
-		return quat_set(s * vector_get_x(axis), s * vector_get_y(axis), s * vector_get_z(axis), c);
+		return vector_to_quat(vector_mix<mix4::x, mix4::y, mix4::z, mix4::a>(vector_mul(axis, s), vector_set(c)));
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -314,19 +552,27 @@ namespace rtm
 	// Yaw is around the Z axis (up)
 	// Roll is around the X axis (forward)
 	//////////////////////////////////////////////////////////////////////////
-	inline quatd quat_from_euler(angled pitch, angled yaw, angled roll) RTM_NO_EXCEPT
+	inline quatd RTM_SIMD_CALL quat_from_euler(angled pitch, angled yaw, angled roll) RTM_NO_EXCEPT
 	{
-		double sp, sy, sr;
-		double cp, cy, cr;
-
-		scalar_sincos(pitch.as_radians() * 0.5, sp, cp);
-		scalar_sincos(yaw.as_radians() * 0.5, sy, cy);
-		scalar_sincos(roll.as_radians() * 0.5, sr, cr);
-
-		return quat_set(cr * sp * sy - sr * cp * cy,
-			-cr * sp * cy - sr * cp * sy,
-			cr * cp * sy - sr * sp * cy,
-			cr * cp * cy + sr * sp * sy);
+		// The three half angles are evaluated at once: [sp, sy, sr] and [cp, cy, cr]
+		const vector4d half_angles = vector_mul(vector_set(pitch.as_radians(), yaw.as_radians(), roll.as_radians(), 0.0), 0.5);
+		vector4d sin_angles;
+		vector4d cos_angles;
+		vector_sincos(half_angles, sin_angles, cos_angles);
+
+		// x = cr * sp * sy - sr * cp * cy
+		// y = -cr * sp * cy - sr * cp * sy
+		// z = cr * cp * sy - sr * sp * cy
+		// w = cr * cp * cy + sr * sp * sy
+		const vector4d sp_sp_cp_cp = vector_mix<mix4::x, mix4::x, mix4::a, mix4::a>(sin_angles, cos_angles);
+		const vector4d sy_cy_sy_cy = vector_mix<mix4::y, mix4::b, mix4::y, mix4::b>(sin_angles, cos_angles);
+		const vector4d cp_cp_sp_sp = vector_mix<mix4::a, mix4::a, mix4::x, mix4::x>(sin_angles, cos_angles);
+		const vector4d cy_sy_cy_sy = vector_mix<mix4::b, mix4::y, mix4::b, mix4::y>(sin_angles, cos_angles);
+
+		const vector4d cr_terms = vector_mul(vector_mul(sp_sp_cp_cp, sy_cy_sy_cy), vector_set(1.0, -1.0, 1.0, 1.0));
+		const vector4d sr_terms = vector_mul(vector_mul(cp_cp_sp_sp, cy_sy_cy_sy), vector_set(-1.0, -1.0, -1.0, 1.0));
+		const vector4d result = vector_mul_add(cr_terms, vector_dup_z(cos_angles), vector_mul(sr_terms, vector_dup_z(sin_angles)));
+		return vector_to_quat(result);
 	}
 
 
@@ -340,7 +586,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if the input quaternion does not contain any NaN or Inf, otherwise false.
 	//////////////////////////////////////////////////////////////////////////
-	inline bool quat_is_finite(const quatd& input) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL quat_is_finite(quatd_arg0 input) RTM_NO_EXCEPT
 	{
 		return scalar_is_finite(quat_get_x(input)) && scalar_is_finite(quat_get_y(input)) && scalar_is_finite(quat_get_z(input)) && scalar_is_finite(quat_get_w(input));
 	}
@@ -348,7 +594,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if the input quaternion is normalized, otherwise false.
 	//////////////////////////////////////////////////////////////////////////
-	inline bool quat_is_normalized(const quatd& input, double threshold = 0.00001) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL quat_is_normalized(quatd_arg0 input, double threshold = 0.00001) RTM_NO_EXCEPT
 	{
 		double length_squared = quat_length_squared(input);
 		return scalar_abs(length_squared - 1.0) < threshold;
@@ -357,7 +603,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if the two quaternions are nearly equal component wise, otherwise false.
 	//////////////////////////////////////////////////////////////////////////
-	inline bool quat_near_equal(const quatd& lhs, const quatd& rhs, double threshold = 0.00001) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL quat_near_equal(quatd_arg0 lhs, quatd_arg1 rhs, double threshold = 0.00001) RTM_NO_EXCEPT
 	{
 		return vector_all_near_equal(quat_to_vector(lhs), quat_to_vector(rhs), threshold);
 	}
@@ -366,7 +612,7 @@ namespace rtm
 	// Returns true if the input quaternion is nearly equal to the identity quaternion
 	// by comparing its rotation angle.
 	//////////////////////////////////////////////////////////////////////////
-	inline bool quat_near_identity(const quatd& input, angled threshold_angle = radians(0.00284714461)) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL quat_near_identity(quatd_arg0 input, angled threshold_angle = radians(0.00284714461)) RTM_NO_EXCEPT
 	{
 		// See the quatf version of quat_near_identity for details.
 		const double positive_w_angle = scalar_acos(scalar_abs(quat_get_w(input))) * 2.0;
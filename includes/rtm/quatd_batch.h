@@ -0,0 +1,72 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/quatd.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstddef>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Interpolates 'count' pairs of quaternions: output[i] = quat_slerp(start[i], end[i], alpha)
+	// See quat_slerp(quatd_arg0, quatd_arg1, double) for details.
+	// The output can safely alias either input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_slerp_batch(const quatd* start, const quatd* end, double alpha, quatd* output, size_t count) RTM_NO_EXCEPT
+	{
+		for (size_t index = 0; index < count; ++index)
+			output[index] = quat_slerp(start[index], end[index], alpha);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Interpolates 'count' pairs of quaternions: output[i] = quat_slerp_fast(start[i], end[i], alpha)
+	// See quat_slerp_fast(quatd_arg0, quatd_arg1, double) for details.
+	// The output can safely alias either input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_slerp_fast_batch(const quatd* start, const quatd* end, double alpha, quatd* output, size_t count) RTM_NO_EXCEPT
+	{
+		for (size_t index = 0; index < count; ++index)
+			output[index] = quat_slerp_fast(start[index], end[index], alpha);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Interpolates 'count' squad segments: output[i] = quat_squad(start[i], start_tangent[i], end_tangent[i], end[i], alpha)
+	// See quat_squad(quatd_arg0, quatd_arg1, quatd_arg2, quatd_arg3, double) for details.
+	// The output can safely alias any input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_squad_batch(const quatd* start, const quatd* start_tangent, const quatd* end_tangent, const quatd* end, double alpha, quatd* output, size_t count) RTM_NO_EXCEPT
+	{
+		for (size_t index = 0; index < count; ++index)
+			output[index] = quat_squad(start[index], start_tangent[index], end_tangent[index], end[index], alpha);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -67,10 +67,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Casts a quaternion float64 variant to a float32 variant.
 	//////////////////////////////////////////////////////////////////////////
-	inline quatf RTM_SIMD_CALL quat_cast(const quatd& input) RTM_NO_EXCEPT
+	inline quatf RTM_SIMD_CALL quat_cast(quatd_arg0 input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_cvtpd_ps(input);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return _mm_shuffle_ps(_mm_cvtpd_ps(input.xy), _mm_cvtpd_ps(input.zw), _MM_SHUFFLE(1, 0, 1, 0));
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vcvt_high_f32_f64(vcvt_f32_f64(input.xy), input.zw);
 #else
 		return quat_set(float(input.x), float(input.y), float(input.z), float(input.w));
 #endif
@@ -144,6 +148,15 @@ namespace rtm
 		output[3] = quat_get_w(input);
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Writes a quaternion to 16 bytes aligned memory with a non-temporal store that bypasses the cache.
+	// See vector_store_stream(vector4f_arg0, float*) for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL quat_store_stream(quatf_arg0 input, float* output) RTM_NO_EXCEPT
+	{
+		vector_store_stream(quat_to_vector(input), output);
+	}
+
 
 
 	//////////////////////////////////////////////////////////////////////////
@@ -202,6 +215,16 @@ namespace rtm
 		__m128 lxrw_lyrw_lzrw_lwrw = _mm_mul_ps(r_wwww, lhs);
 		__m128 l_wzyx = _mm_shuffle_ps(lhs, lhs,_MM_SHUFFLE(0, 1, 2, 3));
 
+#if defined(RTM_FMA_INTRINSICS)
+		// Applying the signs to the broadcast rhs components is exact, this lets us accumulate
+		// every product with a fused multiply-add
+		__m128 l_zwxy = _mm_shuffle_ps(l_wzyx, l_wzyx, _MM_SHUFFLE(2, 3, 0, 1));
+		__m128 l_yxwz = _mm_shuffle_ps(l_zwxy, l_zwxy, _MM_SHUFFLE(0, 1, 2, 3));
+
+		__m128 result = _mm_fmadd_ps(_mm_mul_ps(r_xxxx, control_wzyx), l_wzyx, lxrw_lyrw_lzrw_lwrw);
+		result = _mm_fmadd_ps(_mm_mul_ps(r_yyyy, control_zwxy), l_zwxy, result);
+		return _mm_fmadd_ps(_mm_mul_ps(r_zzzz, control_yxwz), l_yxwz, result);
+#else
 		__m128 lwrx_lzrx_lyrx_lxrx = _mm_mul_ps(r_xxxx, l_wzyx);
 		__m128 l_zwxy = _mm_shuffle_ps(l_wzyx, l_wzyx,_MM_SHUFFLE(2, 3, 0, 1));
 
@@ -218,6 +241,7 @@ namespace rtm
 		__m128 nlyrz_lxrz_lwrz_wlzrz = _mm_mul_ps(lyrz_lxrz_lwrz_lzrz, control_yxwz);
 		__m128 result1 = _mm_add_ps(lzry_lwry_nlxry_nlyry, nlyrz_lxrz_lwrz_wlzrz);
 		return _mm_add_ps(result0, result1);
+#endif
 #elif defined(RTM_NEON_INTRINSICS)
 		alignas(16) constexpr float control_wzyx_f[4] = { 1.0f, -1.0f, 1.0f, -1.0f };
 		alignas(16) constexpr float control_zwxy_f[4] = { 1.0f, 1.0f, -1.0f, -1.0f };
@@ -238,14 +262,14 @@ namespace rtm
 		float32x4_t l_yxwz = vrev64q_f32(lhs);
 		float32x4_t l_wzyx = vcombine_f32(vget_high_f32(l_yxwz), vget_low_f32(l_yxwz));
 		float32x4_t lwrx_lzrx_lyrx_lxrx = vmulq_f32(r_xxxx, l_wzyx);
-		float32x4_t result0 = vmlaq_f32(lxrw_lyrw_lzrw_lwrw, lwrx_lzrx_lyrx_lxrx, control_wzyx);
+		float32x4_t result0 = vector_mul_add(lwrx_lzrx_lyrx_lxrx, control_wzyx, lxrw_lyrw_lzrw_lwrw);
 
 		float32x4_t l_zwxy = vrev64q_u32(l_wzyx);
 		float32x4_t lzry_lwry_lxry_lyry = vmulq_f32(r_yyyy, l_zwxy);
-		float32x4_t result1 = vmlaq_f32(result0, lzry_lwry_lxry_lyry, control_zwxy);
+		float32x4_t result1 = vector_mul_add(lzry_lwry_lxry_lyry, control_zwxy, result0);
 
 		float32x4_t lyrz_lxrz_lwrz_lzrz = vmulq_f32(r_zzzz, l_yxwz);
-		return vmlaq_f32(result1, lyrz_lxrz_lwrz_lzrz, control_yxwz);
+		return vector_mul_add(lyrz_lxrz_lwrz_lzrz, control_yxwz, result1);
 #else
 		float lhs_x = quat_get_x(lhs);
 		float lhs_y = quat_get_y(lhs);
@@ -389,7 +413,7 @@ namespace rtm
 		__m128 bias = _mm_and_ps(dot, _mm_set_ps1(-0.0f));
 
 		// Lerp the rotation after applying the bias
-		__m128 interpolated_rotation = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(_mm_xor_ps(end, bias), start), _mm_set_ps1(alpha)), start);
+		__m128 interpolated_rotation = vector_mul_add(_mm_sub_ps(_mm_xor_ps(end, bias), start), alpha, start);
 
 		// Now we need to normalize the resulting rotation. We first calculate the
 		// dot product to get the length squared: dot(interpolated_rotation, interpolated_rotation)
@@ -489,6 +513,190 @@ namespace rtm
 	}
 
 
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Per lane evaluates sin(alpha * angle) / sin(angle) where cos(angle) = dot_minus_one + 1.0
+		// and alpha and angle are within [0.0, 1.0] and [0.0, PI/2] respectively.
+		// The ratio is expanded as a series in (dot - 1.0), see "A Fast and Accurate Algorithm
+		// for Computing SLERP" (Eberly 2011). Each term is the previous one multiplied by
+		// (alpha^2 / (i * (2i + 1)) - i / (2i + 1)) * (dot - 1.0). The series is truncated after 12 terms
+		// and the last term is replaced by a minimax fit that accounts for the remainder.
+		// The max absolute error of the ratio is 7.6e-8 before rounding.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL slerp_fast_weights(vector4f_arg0 alpha, vector4f_arg1 dot_minus_one) RTM_NO_EXCEPT
+		{
+			const vector4f alpha_sq = vector_mul(alpha, alpha);
+			const vector4f one = vector_set(1.0f);
+
+			// Last term with the remainder correction
+			const vector4f remainder = vector_mul_add(dot_minus_one, vector_set(-3.61298012809466360f), one);
+			vector4f result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 2.37848825323043030e-3f), vector_set(2.00691297009131820e-1f)), dot_minus_one), remainder, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0f / (11.0f * 23.0f)), vector_set(11.0f / 23.0f)), dot_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0f / (10.0f * 21.0f)), vector_set(10.0f / 21.0f)), dot_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0f / (9.0f * 19.0f)), vector_set(9.0f / 19.0f)), dot_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0f / (8.0f * 17.0f)), vector_set(8.0f / 17.0f)), dot_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0f / (7.0f * 15.0f)), vector_set(7.0f / 15.0f)), dot_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0f / (6.0f * 13.0f)), vector_set(6.0f / 13.0f)), dot_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0f / (5.0f * 11.0f)), vector_set(5.0f / 11.0f)), dot_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0f / (4.0f * 9.0f)), vector_set(4.0f / 9.0f)), dot_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0f / (3.0f * 7.0f)), vector_set(3.0f / 7.0f)), dot_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0f / (2.0f * 5.0f)), vector_set(2.0f / 5.0f)), dot_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_sub(vector_mul(alpha_sq, 1.0f / (1.0f * 3.0f)), vector_set(1.0f / 3.0f)), dot_minus_one), result, one);
+			return vector_mul(alpha, result);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the logarithm of a normalized quaternion: [axis * half angle, 0.0]
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL quat_log_normalized(quatf_arg0 input) RTM_NO_EXCEPT
+		{
+			const vector4f input_vector = quat_to_vector(input);
+			const float sin_half_angle = vector_length3(input_vector);
+			const float half_angle = vector_get_x(vector_atan2(vector_set(sin_half_angle), vector_set(quat_get_w(input))));
+
+			// When the angle is very small, sin(x) / x is 1.0 and the logarithm is the vector part
+			const float scale = sin_half_angle >= 1.0e-6f ? (half_angle / sin_half_angle) : 1.0f;
+			return vector_mul(vector_set(quat_get_x(input), quat_get_y(input), quat_get_z(input), 0.0f), scale);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the exponential of a pure quaternion [axis * half angle, 0.0], the inverse of quat_log_normalized(..).
+		//////////////////////////////////////////////////////////////////////////
+		inline quatf RTM_SIMD_CALL quat_exp_pure(vector4f_arg0 input) RTM_NO_EXCEPT
+		{
+			const float half_angle = vector_length3(input);
+
+			vector4f sin_half_angle;
+			vector4f cos_half_angle;
+			vector_sincos(vector_set(half_angle), sin_half_angle, cos_half_angle);
+
+			const float scale = half_angle >= 1.0e-6f ? (vector_get_x(sin_half_angle) / half_angle) : 1.0f;
+			return vector_to_quat(vector_mix<mix4::x, mix4::y, mix4::z, mix4::d>(vector_mul(input, scale), cos_half_angle));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the inner squad control point of 'rotation' given its neighbors.
+		// control = rotation * exp(-(log(rotation^-1 * next) + log(rotation^-1 * prev)) / 4)
+		//////////////////////////////////////////////////////////////////////////
+		inline quatf RTM_SIMD_CALL quat_squad_control_point(quatf_arg0 prev, quatf_arg1 rotation, quatf_arg2 next) RTM_NO_EXCEPT
+		{
+			const quatf inv_rotation = quat_conjugate(rotation);
+			const vector4f log_next = quat_log_normalized(quat_mul(next, inv_rotation));
+			const vector4f log_prev = quat_log_normalized(quat_mul(prev, inv_rotation));
+			const quatf delta = quat_exp_pure(vector_mul(vector_add(log_next, log_prev), -0.25f));
+			return quat_mul(delta, rotation);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the spherical interpolation between start and end without taking the shortest path.
+		// Squad blends its key and tangent rotations with it: they can move into opposite
+		// hemispheres during a segment and flipping one of them would make the curve jump.
+		//////////////////////////////////////////////////////////////////////////
+		inline quatf RTM_SIMD_CALL quat_slerp_no_flip(quatf_arg0 start, quatf_arg1 end, float alpha) RTM_NO_EXCEPT
+		{
+			const vector4f start_vector = quat_to_vector(start);
+			const vector4f end_vector = quat_to_vector(end);
+			const float dot = vector_dot(start_vector, end_vector);
+
+			// Below this angle, sin(angle) loses too much precision and nlerp is just as accurate
+			if (scalar_abs(dot) >= 0.99999f)
+				return quat_normalize(vector_to_quat(vector_lerp(start_vector, end_vector, alpha)));
+
+			// The three sines are evaluated together: [sin((1 - alpha) * angle), sin(alpha * angle), sin(angle), 0]
+			const float angle = scalar_acos(dot);
+			const vector4f sines = vector_sin(vector_mul(vector_set(1.0f - alpha, alpha, 1.0f, 0.0f), angle));
+
+			const float inv_sin_angle = 1.0f / vector_get_z(sines);
+			const float start_weight = vector_get_x(sines) * inv_sin_angle;
+			const float end_weight = vector_get_y(sines) * inv_sin_angle;
+			return vector_to_quat(vector_mul_add(start_vector, start_weight, vector_mul(end_vector, end_weight)));
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the spherical interpolation between start and end for a given alpha value.
+	// The shortest path is taken and the angular velocity is constant.
+	// When both rotations are nearly equal, a normalized linear interpolation is used instead.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf RTM_SIMD_CALL quat_slerp(quatf_arg0 start, quatf_arg1 end, float alpha) RTM_NO_EXCEPT
+	{
+		const vector4f start_vector = quat_to_vector(start);
+		const vector4f end_vector = quat_to_vector(end);
+		const float dot = vector_dot(start_vector, end_vector);
+
+		// To ensure we take the shortest path, we apply a bias if the dot product is negative
+		const float bias = dot >= 0.0f ? 1.0f : -1.0f;
+		const float abs_dot = dot * bias;
+
+		// Below this angle, sin(angle) loses too much precision and nlerp is just as accurate
+		if (abs_dot >= 0.99999f)
+			return quat_lerp(start, end, alpha);
+
+		// The three sines are evaluated together: [sin((1 - alpha) * angle), sin(alpha * angle), sin(angle), 0]
+		const float angle = scalar_acos(abs_dot);
+		const vector4f sines = vector_sin(vector_mul(vector_set(1.0f - alpha, alpha, 1.0f, 0.0f), angle));
+
+		const float inv_sin_angle = 1.0f / vector_get_z(sines);
+		const float start_weight = vector_get_x(sines) * inv_sin_angle;
+		const float end_weight = vector_get_y(sines) * inv_sin_angle * bias;
+		return vector_to_quat(vector_mul_add(start_vector, start_weight, vector_mul(end_vector, end_weight)));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns an approximation of the spherical interpolation between start and end for a given alpha value.
+	// The shortest path is taken. The interpolation weights sin(alpha * angle) / sin(angle) are evaluated
+	// with a polynomial in the dot product without any division or trigonometric function.
+	// The max absolute error on the result components is 2.6e-7.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf RTM_SIMD_CALL quat_slerp_fast(quatf_arg0 start, quatf_arg1 end, float alpha) RTM_NO_EXCEPT
+	{
+		const vector4f start_vector = quat_to_vector(start);
+		const vector4f end_vector = quat_to_vector(end);
+		const float dot = vector_dot(start_vector, end_vector);
+
+		// To ensure we take the shortest path, we apply a bias if the dot product is negative
+		const float bias = dot >= 0.0f ? 1.0f : -1.0f;
+		const float dot_minus_one = dot * bias - 1.0f;
+
+		const vector4f weights = rtm_impl::slerp_fast_weights(vector_set(1.0f - alpha, alpha, 0.0f, 0.0f), vector_set(dot_minus_one));
+		const float start_weight = vector_get_x(weights);
+		const float end_weight = vector_get_y(weights) * bias;
+		return vector_to_quat(vector_mul_add(start_vector, start_weight, vector_mul(end_vector, end_weight)));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the spherical quadrangle interpolation between start and end for a given alpha value.
+	// The start and end tangents are inner control points, see quat_squad_setup(..).
+	// squad = slerp(slerp(start, end, alpha), slerp(start_tangent, end_tangent, alpha), 2 * alpha * (1 - alpha))
+	// The outer interpolation doesn't take the shortest path to keep the curve continuous.
+	// When consecutive segments share their keys and tangents, the resulting curve is C1 continuous.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf RTM_SIMD_CALL quat_squad(quatf_arg0 start, quatf_arg1 start_tangent, quatf_arg2 end_tangent, quatf_arg3 end, float alpha) RTM_NO_EXCEPT
+	{
+		const quatf key_rotation = quat_slerp(start, end, alpha);
+		const quatf tangent_rotation = quat_slerp(start_tangent, end_tangent, alpha);
+		return rtm_impl::quat_slerp_no_flip(key_rotation, tangent_rotation, 2.0f * alpha * (1.0f - alpha));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the inner control points of the squad segment between start and end
+	// given the previous and next keys. The keys are first moved in the same hemisphere
+	// as their predecessor to take the shortest path.
+	// The aligned end rotation is written to out_end, it should be used with quat_squad(..).
+	// For the first and last segments, the first and last keys can be duplicated.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL quat_squad_setup(quatf_arg0 prev, quatf_arg1 start, quatf_arg2 end, quatf_arg3 next, quatf& out_start_tangent, quatf& out_end_tangent, quatf& out_end) RTM_NO_EXCEPT
+	{
+		const quatf aligned_prev = vector_dot(quat_to_vector(prev), quat_to_vector(start)) >= 0.0f ? prev : quat_neg(prev);
+		const quatf aligned_end = vector_dot(quat_to_vector(start), quat_to_vector(end)) >= 0.0f ? end : quat_neg(end);
+		const quatf aligned_next = vector_dot(quat_to_vector(aligned_end), quat_to_vector(next)) >= 0.0f ? next : quat_neg(next);
+
+		out_start_tangent = rtm_impl::quat_squad_control_point(aligned_prev, start, aligned_end);
+		out_end_tangent = rtm_impl::quat_squad_control_point(start, aligned_end, aligned_next);
+		out_end = aligned_end;
+	}
+
 
 	//////////////////////////////////////////////////////////////////////////
 	// Conversion to/from axis/angle/euler
@@ -538,7 +746,7 @@ namespace rtm
 		float s, c;
 		scalar_sincos(0.5f * angle.as_radians(), s, c);
 
-		return quat_set(s * vector_get_x(axis), s * vector_get_y(axis), s * vector_get_z(axis), c);
+		return vector_to_quat(vector_mix<mix4::x, mix4::y, mix4::z, mix4::a>(vector_mul(axis, s), vector_set(c)));
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -549,17 +757,25 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline quatf RTM_SIMD_CALL quat_from_euler(anglef pitch, anglef yaw, anglef roll) RTM_NO_EXCEPT
 	{
-		float sp, sy, sr;
-		float cp, cy, cr;
-
-		scalar_sincos(pitch.as_radians() * 0.5f, sp, cp);
-		scalar_sincos(yaw.as_radians() * 0.5f, sy, cy);
-		scalar_sincos(roll.as_radians() * 0.5f, sr, cr);
-
-		return quat_set(cr * sp * sy - sr * cp * cy,
-			-cr * sp * cy - sr * cp * sy,
-			cr * cp * sy - sr * sp * cy,
-			cr * cp * cy + sr * sp * sy);
+		// The three half angles are evaluated at once: [sp, sy, sr] and [cp, cy, cr]
+		const vector4f half_angles = vector_mul(vector_set(pitch.as_radians(), yaw.as_radians(), roll.as_radians(), 0.0f), 0.5f);
+		vector4f sin_angles;
+		vector4f cos_angles;
+		vector_sincos(half_angles, sin_angles, cos_angles);
+
+		// x = cr * sp * sy - sr * cp * cy
+		// y = -cr * sp * cy - sr * cp * sy
+		// z = cr * cp * sy - sr * sp * cy
+		// w = cr * cp * cy + sr * sp * sy
+		const vector4f sp_sp_cp_cp = vector_mix<mix4::x, mix4::x, mix4::a, mix4::a>(sin_angles, cos_angles);
+		const vector4f sy_cy_sy_cy = vector_mix<mix4::y, mix4::b, mix4::y, mix4::b>(sin_angles, cos_angles);
+		const vector4f cp_cp_sp_sp = vector_mix<mix4::a, mix4::a, mix4::x, mix4::x>(sin_angles, cos_angles);
+		const vector4f cy_sy_cy_sy = vector_mix<mix4::b, mix4::y, mix4::b, mix4::y>(sin_angles, cos_angles);
+
+		const vector4f cr_terms = vector_mul(vector_mul(sp_sp_cp_cp, sy_cy_sy_cy), vector_set(1.0f, -1.0f, 1.0f, 1.0f));
+		const vector4f sr_terms = vector_mul(vector_mul(cp_cp_sp_sp, cy_sy_cy_sy), vector_set(-1.0f, -1.0f, -1.0f, 1.0f));
+		const vector4f result = vector_mul_add(cr_terms, vector_dup_z(cos_angles), vector_mul(sr_terms, vector_dup_z(sin_angles)));
+		return vector_to_quat(result);
 	}
 
 
@@ -0,0 +1,384 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/quatf.h"
+#include "rtm/quatf_x4.h"
+#include "rtm/strided_span.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/soa_common.h"
+
+#include <cstddef>
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+#if defined(RTM_AVX512_INTRINSICS) || defined(RTM_CPU_DISPATCH)
+		//////////////////////////////////////////////////////////////////////////
+		// 8 quaternions in structure of arrays form, one per AVX lane.
+		//////////////////////////////////////////////////////////////////////////
+		struct quatf_x8_avx
+		{
+			__m256 x;
+			__m256 y;
+			__m256 z;
+			__m256 w;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// 8 3D vectors in structure of arrays form, one per AVX lane.
+		//////////////////////////////////////////////////////////////////////////
+		struct vector3f_x8_avx
+		{
+			__m256 x;
+			__m256 y;
+			__m256 z;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per lane quaternion multiplication, see quat_mul(quatf_arg0, quatf_arg1) for details.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX2 inline quatf_x8_avx quat_mul_x8_avx2(const quatf_x8_avx& lhs, const quatf_x8_avx& rhs) RTM_NO_EXCEPT
+		{
+			const __m256 x = _mm256_fnmadd_ps(rhs.z, lhs.y, _mm256_fmadd_ps(rhs.y, lhs.z, _mm256_fmadd_ps(rhs.x, lhs.w, _mm256_mul_ps(rhs.w, lhs.x))));
+			const __m256 y = _mm256_fmadd_ps(rhs.z, lhs.x, _mm256_fmadd_ps(rhs.y, lhs.w, _mm256_fnmadd_ps(rhs.x, lhs.z, _mm256_mul_ps(rhs.w, lhs.y))));
+			const __m256 z = _mm256_fmadd_ps(rhs.z, lhs.w, _mm256_fnmadd_ps(rhs.y, lhs.x, _mm256_fmadd_ps(rhs.x, lhs.y, _mm256_mul_ps(rhs.w, lhs.z))));
+			const __m256 w = _mm256_fnmadd_ps(rhs.z, lhs.z, _mm256_fnmadd_ps(rhs.y, lhs.y, _mm256_fnmadd_ps(rhs.x, lhs.x, _mm256_mul_ps(rhs.w, lhs.w))));
+			return quatf_x8_avx{ x, y, z, w };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per lane rotation of a 3D vector by a quaternion, see quat_mul_vector3(vector4f_arg0, quatf_arg1) for details.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX2 inline vector3f_x8_avx quat_mul_vector3_x8_avx2(const vector3f_x8_avx& vector, const quatf_x8_avx& rotation) RTM_NO_EXCEPT
+		{
+			// t = 2 * cross(rotation.xyz, vector)
+			// result = vector + (rotation.w * t) + cross(rotation.xyz, t)
+			const __m256 cross_rv_x = _mm256_fmsub_ps(rotation.y, vector.z, _mm256_mul_ps(rotation.z, vector.y));
+			const __m256 cross_rv_y = _mm256_fmsub_ps(rotation.z, vector.x, _mm256_mul_ps(rotation.x, vector.z));
+			const __m256 cross_rv_z = _mm256_fmsub_ps(rotation.x, vector.y, _mm256_mul_ps(rotation.y, vector.x));
+			const __m256 t_x = _mm256_add_ps(cross_rv_x, cross_rv_x);
+			const __m256 t_y = _mm256_add_ps(cross_rv_y, cross_rv_y);
+			const __m256 t_z = _mm256_add_ps(cross_rv_z, cross_rv_z);
+
+			const __m256 cross_rt_x = _mm256_fmsub_ps(rotation.y, t_z, _mm256_mul_ps(rotation.z, t_y));
+			const __m256 cross_rt_y = _mm256_fmsub_ps(rotation.z, t_x, _mm256_mul_ps(rotation.x, t_z));
+			const __m256 cross_rt_z = _mm256_fmsub_ps(rotation.x, t_y, _mm256_mul_ps(rotation.y, t_x));
+
+			const __m256 x = _mm256_fmadd_ps(t_x, rotation.w, _mm256_add_ps(vector.x, cross_rt_x));
+			const __m256 y = _mm256_fmadd_ps(t_y, rotation.w, _mm256_add_ps(vector.y, cross_rt_y));
+			const __m256 z = _mm256_fmadd_ps(t_z, rotation.w, _mm256_add_ps(vector.z, cross_rt_z));
+			return vector3f_x8_avx{ x, y, z };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// AVX2 and FMA version of quat_mul_batch(..), 8 quaternions are processed at a time.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX2 inline void quat_mul_batch_avx2(const quatf* lhs, const quatf* rhs, quatf* output, size_t count) RTM_NO_EXCEPT
+		{
+			size_t index = 0;
+			for (; index + 8 <= count; index += 8)
+			{
+				quatf_x8_avx lhs_x8;
+				quatf_x8_avx rhs_x8;
+				avx_load_transpose_4x8(reinterpret_cast<const float*>(lhs + index), 4, lhs_x8.x, lhs_x8.y, lhs_x8.z, lhs_x8.w);
+				avx_load_transpose_4x8(reinterpret_cast<const float*>(rhs + index), 4, rhs_x8.x, rhs_x8.y, rhs_x8.z, rhs_x8.w);
+
+				const quatf_x8_avx result = quat_mul_x8_avx2(lhs_x8, rhs_x8);
+				avx_transpose_store_4x8(result.x, result.y, result.z, result.w, 4, reinterpret_cast<float*>(output + index));
+			}
+
+			for (; index < count; ++index)
+				output[index] = quat_mul(lhs[index], rhs[index]);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// AVX2 and FMA version of quat_mul_vector3_batch(..), 8 vectors are processed at a time.
+		// The [w] component of the output is 0.0 except for the remainder.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX2 inline void quat_mul_vector3_batch_avx2(const vector4f* vectors, const quatf* rotations, vector4f* output, size_t count) RTM_NO_EXCEPT
+		{
+			size_t index = 0;
+			for (; index + 8 <= count; index += 8)
+			{
+				vector3f_x8_avx vector_x8;
+				quatf_x8_avx rotation_x8;
+				__m256 vector_w;
+				avx_load_transpose_4x8(reinterpret_cast<const float*>(vectors + index), 4, vector_x8.x, vector_x8.y, vector_x8.z, vector_w);
+				avx_load_transpose_4x8(reinterpret_cast<const float*>(rotations + index), 4, rotation_x8.x, rotation_x8.y, rotation_x8.z, rotation_x8.w);
+
+				const vector3f_x8_avx result = quat_mul_vector3_x8_avx2(vector_x8, rotation_x8);
+				avx_transpose_store_4x8(result.x, result.y, result.z, _mm256_setzero_ps(), 4, reinterpret_cast<float*>(output + index));
+			}
+
+			for (; index < count; ++index)
+				output[index] = quat_mul_vector3(vectors[index], rotations[index]);
+		}
+#endif
+
+#if defined(RTM_AVX512_INTRINSICS) || defined(RTM_CPU_DISPATCH)
+		//////////////////////////////////////////////////////////////////////////
+		// 16 quaternions in structure of arrays form, one per AVX-512 lane.
+		//////////////////////////////////////////////////////////////////////////
+		struct quatf_x16
+		{
+			__m512 x;
+			__m512 y;
+			__m512 z;
+			__m512 w;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// 16 3D vectors in structure of arrays form, one per AVX-512 lane.
+		//////////////////////////////////////////////////////////////////////////
+		struct vector3f_x16
+		{
+			__m512 x;
+			__m512 y;
+			__m512 z;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per lane quaternion multiplication, see quat_mul(quatf_arg0, quatf_arg1) for details.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX512 inline quatf_x16 quat_mul_x16(const quatf_x16& lhs, const quatf_x16& rhs) RTM_NO_EXCEPT
+		{
+			const __m512 x = _mm512_fnmadd_ps(rhs.z, lhs.y, _mm512_fmadd_ps(rhs.y, lhs.z, _mm512_fmadd_ps(rhs.x, lhs.w, _mm512_mul_ps(rhs.w, lhs.x))));
+			const __m512 y = _mm512_fmadd_ps(rhs.z, lhs.x, _mm512_fmadd_ps(rhs.y, lhs.w, _mm512_fnmadd_ps(rhs.x, lhs.z, _mm512_mul_ps(rhs.w, lhs.y))));
+			const __m512 z = _mm512_fmadd_ps(rhs.z, lhs.w, _mm512_fnmadd_ps(rhs.y, lhs.x, _mm512_fmadd_ps(rhs.x, lhs.y, _mm512_mul_ps(rhs.w, lhs.z))));
+			const __m512 w = _mm512_fnmadd_ps(rhs.z, lhs.z, _mm512_fnmadd_ps(rhs.y, lhs.y, _mm512_fnmadd_ps(rhs.x, lhs.x, _mm512_mul_ps(rhs.w, lhs.w))));
+			return quatf_x16{ x, y, z, w };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per lane rotation of a 3D vector by a quaternion, see quat_mul_vector3(vector4f_arg0, quatf_arg1) for details.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX512 inline vector3f_x16 quat_mul_vector3_x16(const vector3f_x16& vector, const quatf_x16& rotation) RTM_NO_EXCEPT
+		{
+			// t = 2 * cross(rotation.xyz, vector)
+			// result = vector + (rotation.w * t) + cross(rotation.xyz, t)
+			const __m512 cross_rv_x = _mm512_fmsub_ps(rotation.y, vector.z, _mm512_mul_ps(rotation.z, vector.y));
+			const __m512 cross_rv_y = _mm512_fmsub_ps(rotation.z, vector.x, _mm512_mul_ps(rotation.x, vector.z));
+			const __m512 cross_rv_z = _mm512_fmsub_ps(rotation.x, vector.y, _mm512_mul_ps(rotation.y, vector.x));
+			const __m512 t_x = _mm512_add_ps(cross_rv_x, cross_rv_x);
+			const __m512 t_y = _mm512_add_ps(cross_rv_y, cross_rv_y);
+			const __m512 t_z = _mm512_add_ps(cross_rv_z, cross_rv_z);
+
+			const __m512 cross_rt_x = _mm512_fmsub_ps(rotation.y, t_z, _mm512_mul_ps(rotation.z, t_y));
+			const __m512 cross_rt_y = _mm512_fmsub_ps(rotation.z, t_x, _mm512_mul_ps(rotation.x, t_z));
+			const __m512 cross_rt_z = _mm512_fmsub_ps(rotation.x, t_y, _mm512_mul_ps(rotation.y, t_x));
+
+			const __m512 x = _mm512_fmadd_ps(t_x, rotation.w, _mm512_add_ps(vector.x, cross_rt_x));
+			const __m512 y = _mm512_fmadd_ps(t_y, rotation.w, _mm512_add_ps(vector.y, cross_rt_y));
+			const __m512 z = _mm512_fmadd_ps(t_z, rotation.w, _mm512_add_ps(vector.z, cross_rt_z));
+			return vector3f_x16{ x, y, z };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// AVX-512 version of quat_mul_batch(..), 16 quaternions are processed at a time and
+		// the remainder is handled with masked loads and stores.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX512 inline void quat_mul_batch_avx512(const quatf* lhs, const quatf* rhs, quatf* output, size_t count) RTM_NO_EXCEPT
+		{
+			for (size_t offset = 0; offset < count; offset += 16)
+			{
+				const size_t num_remaining = count - offset;
+				const uint32_t num_lanes = num_remaining >= 16 ? 16 : uint32_t(num_remaining);
+
+				quatf_x16 lhs_x16;
+				quatf_x16 rhs_x16;
+				avx512_load_transpose_4x16(reinterpret_cast<const float*>(lhs + offset), num_lanes, lhs_x16.x, lhs_x16.y, lhs_x16.z, lhs_x16.w);
+				avx512_load_transpose_4x16(reinterpret_cast<const float*>(rhs + offset), num_lanes, rhs_x16.x, rhs_x16.y, rhs_x16.z, rhs_x16.w);
+
+				const quatf_x16 result = quat_mul_x16(lhs_x16, rhs_x16);
+				avx512_transpose_store_4x16(result.x, result.y, result.z, result.w, num_lanes, reinterpret_cast<float*>(output + offset));
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// AVX-512 version of quat_mul_vector3_batch(..), 16 vectors are processed at a time and
+		// the remainder is handled with masked loads and stores. The [w] component of the output is 0.0.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX512 inline void quat_mul_vector3_batch_avx512(const vector4f* vectors, const quatf* rotations, vector4f* output, size_t count) RTM_NO_EXCEPT
+		{
+			for (size_t offset = 0; offset < count; offset += 16)
+			{
+				const size_t num_remaining = count - offset;
+				const uint32_t num_lanes = num_remaining >= 16 ? 16 : uint32_t(num_remaining);
+
+				vector3f_x16 vector_x16;
+				quatf_x16 rotation_x16;
+				__m512 vector_w;
+				avx512_load_transpose_4x16(reinterpret_cast<const float*>(vectors + offset), num_lanes, vector_x16.x, vector_x16.y, vector_x16.z, vector_w);
+				avx512_load_transpose_4x16(reinterpret_cast<const float*>(rotations + offset), num_lanes, rotation_x16.x, rotation_x16.y, rotation_x16.z, rotation_x16.w);
+
+				const vector3f_x16 result = quat_mul_vector3_x16(vector_x16, rotation_x16);
+				avx512_transpose_store_4x16(result.x, result.y, result.z, _mm512_setzero_ps(), num_lanes, reinterpret_cast<float*>(output + offset));
+			}
+		}
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies 'count' pairs of quaternions: output[i] = quat_mul(lhs[i], rhs[i])
+	// See quat_mul(quatf_arg0, quatf_arg1) for details.
+	// The output can safely alias either input.
+	// With AVX-512, 16 quaternions are processed at a time and the remainder is
+	// handled with masked loads and stores.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_mul_batch(const quatf* lhs, const quatf* rhs, quatf* output, size_t count) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX512_INTRINSICS)
+		rtm_impl::quat_mul_batch_avx512(lhs, rhs, output, count);
+#else
+		for (size_t index = 0; index < count; ++index)
+			output[index] = quat_mul(lhs[index], rhs[index]);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Rotates 'count' 3D vectors by their matching quaternion: output[i] = quat_mul_vector3(vectors[i], rotations[i])
+	// See quat_mul_vector3(vector4f_arg0, quatf_arg1) for details.
+	// The output can safely alias the input vectors.
+	// With AVX-512, 16 vectors are processed at a time and the remainder is
+	// handled with masked loads and stores. The [w] component of the output is then 0.0.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_mul_vector3_batch(const vector4f* vectors, const quatf* rotations, vector4f* output, size_t count) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX512_INTRINSICS)
+		rtm_impl::quat_mul_vector3_batch_avx512(vectors, rotations, output, count);
+#else
+		for (size_t index = 0; index < count; ++index)
+			output[index] = quat_mul_vector3(vectors[index], rotations[index]);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies pairs of quaternions read from strided views: output[i] = quat_mul(lhs[i], rhs[i])
+	// The number of quaternions is output.size and the inputs must be at least as large.
+	// The quaternions are processed 4 at a time in place, no gather copy is needed.
+	// The output can safely alias either input when they share the same layout.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_mul_batch(const strided_span<const float4f>& lhs, const strided_span<const float4f>& rhs, const strided_span<float4f>& output) RTM_NO_EXCEPT
+	{
+		rtm_impl::strided_span_check_sizes(lhs, output);
+		rtm_impl::strided_span_check_sizes(rhs, output);
+
+		const size_t count = output.size;
+		size_t index = 0;
+		for (; index + 4 <= count; index += 4)
+			quat_store_x4(quat_mul(quat_load_x4(lhs, index), quat_load_x4(rhs, index)), output, index);
+
+		for (; index < count; ++index)
+			quat_store(quat_mul(quat_load(lhs, index), quat_load(rhs, index)), output, index);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Rotates 3D vectors by their matching quaternion read from strided views: output[i] = quat_mul_vector3(vectors[i], rotations[i])
+	// The number of vectors is output.size and the inputs must be at least as large.
+	// The vectors are processed 4 at a time in place, no gather copy is needed.
+	// The output can safely alias the input vectors when they share the same layout.
+	// The [w] component of the output is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_mul_vector3_batch(const strided_span<const float4f>& vectors, const strided_span<const float4f>& rotations, const strided_span<float4f>& output) RTM_NO_EXCEPT
+	{
+		rtm_impl::strided_span_check_sizes(vectors, output);
+		rtm_impl::strided_span_check_sizes(rotations, output);
+
+		const size_t count = output.size;
+		size_t index = 0;
+		for (; index + 4 <= count; index += 4)
+			vector_store3_x4(quat_mul_vector3(vector_load3_x4(vectors, index), quat_load_x4(rotations, index)), output, index);
+
+		for (; index < count; ++index)
+			vector_store(quat_mul_vector3(vector_load(vectors, index), quat_load(rotations, index)), output, index);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Rotates 3D vectors stored as 3 floats by their matching quaternion read from strided views.
+	// Only the [xyz] components of the output are written.
+	// See quat_mul_vector3_batch(const strided_span<const float4f>&, const strided_span<const float4f>&, const strided_span<float4f>&) for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_mul_vector3_batch(const strided_span<const float3f>& vectors, const strided_span<const float4f>& rotations, const strided_span<float3f>& output) RTM_NO_EXCEPT
+	{
+		rtm_impl::strided_span_check_sizes(vectors, output);
+		rtm_impl::strided_span_check_sizes(rotations, output);
+
+		const size_t count = output.size;
+		size_t index = 0;
+		for (; index + 4 <= count; index += 4)
+			vector_store3_x4(quat_mul_vector3(vector_load3_x4(vectors, index), quat_load_x4(rotations, index)), output, index);
+
+		for (; index < count; ++index)
+			vector_store3(quat_mul_vector3(vector_load3(vectors, index), quat_load(rotations, index)), output, index);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Interpolates 'count' pairs of quaternions: output[i] = quat_slerp(start[i], end[i], alpha)
+	// See quat_slerp(quatf_arg0, quatf_arg1, float) for details.
+	// The output can safely alias either input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_slerp_batch(const quatf* start, const quatf* end, float alpha, quatf* output, size_t count) RTM_NO_EXCEPT
+	{
+		for (size_t index = 0; index < count; ++index)
+			output[index] = quat_slerp(start[index], end[index], alpha);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Interpolates 'count' pairs of quaternions: output[i] = quat_slerp_fast(start[i], end[i], alpha)
+	// See quat_slerp_fast(quatf_arg0, quatf_arg1, float) for details.
+	// The output can safely alias either input.
+	// The quaternions are processed 4 at a time without branching.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_slerp_fast_batch(const quatf* start, const quatf* end, float alpha, quatf* output, size_t count) RTM_NO_EXCEPT
+	{
+		size_t index = 0;
+		for (; index + 4 <= count; index += 4)
+			quat_store_x4(quat_slerp_fast(quat_load_x4(start + index), quat_load_x4(end + index), alpha), output + index);
+
+		for (; index < count; ++index)
+			output[index] = quat_slerp_fast(start[index], end[index], alpha);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Interpolates 'count' squad segments: output[i] = quat_squad(start[i], start_tangent[i], end_tangent[i], end[i], alpha)
+	// See quat_squad(quatf_arg0, quatf_arg1, quatf_arg2, quatf_arg3, float) for details.
+	// The output can safely alias any input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_squad_batch(const quatf* start, const quatf* start_tangent, const quatf* end_tangent, const quatf* end, float alpha, quatf* output, size_t count) RTM_NO_EXCEPT
+	{
+		for (size_t index = 0; index < count; ++index)
+			output[index] = quat_squad(start[index], start_tangent[index], end_tangent[index], end[index], alpha);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,194 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/quatf.h"
+#include "rtm/vector3f_x4.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/soa_common.h"
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Setters, getters, and casts
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Replicates a quaternion into all 4 lanes.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf_x4 RTM_SIMD_CALL quat_broadcast_x4(quatf_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4f input_v = quat_to_vector(input);
+		return quatf_x4{ vector_dup_x(input_v), vector_dup_y(input_v), vector_dup_z(input_v), vector_dup_w(input_v) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 4 consecutive quaternions and transposes them, one quaternion per lane.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf_x4 RTM_SIMD_CALL quat_load_x4(const quatf* inputs) RTM_NO_EXCEPT
+	{
+		quatf_x4 result;
+		rtm_impl::transpose_4x4(quat_to_vector(inputs[0]), quat_to_vector(inputs[1]), quat_to_vector(inputs[2]), quat_to_vector(inputs[3]), result.x, result.y, result.z, result.w);
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transposes the 4 lanes back into quaternions and writes them to consecutive outputs.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL quat_store_x4(const quatf_x4& input, quatf* outputs) RTM_NO_EXCEPT
+	{
+		vector4f output0;
+		vector4f output1;
+		vector4f output2;
+		vector4f output3;
+		rtm_impl::transpose_4x4(input.x, input.y, input.z, input.w, output0, output1, output2, output3);
+
+		outputs[0] = vector_to_quat(output0);
+		outputs[1] = vector_to_quat(output1);
+		outputs[2] = vector_to_quat(output2);
+		outputs[3] = vector_to_quat(output3);
+	}
+
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Arithmetic
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane quaternion conjugate.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf_x4 RTM_SIMD_CALL quat_conjugate(const quatf_x4& input) RTM_NO_EXCEPT
+	{
+		return quatf_x4{ vector_neg(input.x), vector_neg(input.y), vector_neg(input.z), input.w };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane quaternion multiplication, see quat_mul(quatf_arg0, quatf_arg1) for details.
+	// Multiplication order is as follow: local_to_world = quat_mul(local_to_object, object_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf_x4 RTM_SIMD_CALL quat_mul(const quatf_x4& lhs, const quatf_x4& rhs) RTM_NO_EXCEPT
+	{
+		const vector4f x = vector_neg_mul_sub(rhs.z, lhs.y, vector_mul_add(rhs.y, lhs.z, vector_mul_add(rhs.x, lhs.w, vector_mul(rhs.w, lhs.x))));
+		const vector4f y = vector_mul_add(rhs.z, lhs.x, vector_mul_add(rhs.y, lhs.w, vector_neg_mul_sub(rhs.x, lhs.z, vector_mul(rhs.w, lhs.y))));
+		const vector4f z = vector_mul_add(rhs.z, lhs.w, vector_neg_mul_sub(rhs.y, lhs.x, vector_mul_add(rhs.x, lhs.y, vector_mul(rhs.w, lhs.z))));
+		const vector4f w = vector_neg_mul_sub(rhs.z, lhs.z, vector_neg_mul_sub(rhs.y, lhs.y, vector_neg_mul_sub(rhs.x, lhs.x, vector_mul(rhs.w, lhs.w))));
+		return quatf_x4{ x, y, z, w };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane rotation of a 3D vector by a quaternion.
+	// Multiplication order is as follow: world_position = quat_mul_vector3(local_position, local_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x4 RTM_SIMD_CALL quat_mul_vector3(const vector3f_x4& vector, const quatf_x4& rotation) RTM_NO_EXCEPT
+	{
+		// Equivalent to rotation * vector * conjugate(rotation) but cheaper to evaluate
+		// t = 2 * cross(rotation.xyz, vector)
+		// result = vector + (rotation.w * t) + cross(rotation.xyz, t)
+		const vector3f_x4 rotation_xyz{ rotation.x, rotation.y, rotation.z };
+		const vector3f_x4 cross_rv = vector_cross3(rotation_xyz, vector);
+		const vector3f_x4 t = vector_add(cross_rv, cross_rv);
+		const vector3f_x4 cross_rt = vector_cross3(rotation_xyz, t);
+
+		const vector4f x = vector_mul_add(t.x, rotation.w, vector_add(vector.x, cross_rt.x));
+		const vector4f y = vector_mul_add(t.y, rotation.w, vector_add(vector.y, cross_rt.y));
+		const vector4f z = vector_mul_add(t.z, rotation.w, vector_add(vector.z, cross_rt.z));
+		return vector3f_x4{ x, y, z };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane 4D dot product of two quaternions.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL quat_dot(const quatf_x4& lhs, const quatf_x4& rhs) RTM_NO_EXCEPT
+	{
+		return vector_mul_add(lhs.w, rhs.w, vector_mul_add(lhs.z, rhs.z, vector_mul_add(lhs.y, rhs.y, vector_mul(lhs.x, rhs.x))));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane squared length of the quaternion.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL quat_length_squared(const quatf_x4& input) RTM_NO_EXCEPT
+	{
+		return quat_dot(input, input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane normalization of the quaternion.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf_x4 RTM_SIMD_CALL quat_normalize(const quatf_x4& input) RTM_NO_EXCEPT
+	{
+		const vector4f inv_len = vector_sqrt_reciprocal(quat_length_squared(input));
+		return quatf_x4{ vector_mul(input.x, inv_len), vector_mul(input.y, inv_len), vector_mul(input.z, inv_len), vector_mul(input.w, inv_len) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane linear interpolation between start and end for a given alpha value.
+	// Each lane takes the shortest path and the result is normalized.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf_x4 RTM_SIMD_CALL quat_lerp(const quatf_x4& start, const quatf_x4& end, float alpha) RTM_NO_EXCEPT
+	{
+		// To ensure we take the shortest path, we flip the end rotation of lanes where the dot product is negative
+		const mask4i is_positive = vector_greater_equal(quat_dot(start, end), vector_zero());
+		const vector4f end_x = vector_select(is_positive, end.x, vector_neg(end.x));
+		const vector4f end_y = vector_select(is_positive, end.y, vector_neg(end.y));
+		const vector4f end_z = vector_select(is_positive, end.z, vector_neg(end.z));
+		const vector4f end_w = vector_select(is_positive, end.w, vector_neg(end.w));
+
+		const vector4f alpha_v = vector_set(alpha);
+		const vector4f x = vector_mul_add(vector_sub(end_x, start.x), alpha_v, start.x);
+		const vector4f y = vector_mul_add(vector_sub(end_y, start.y), alpha_v, start.y);
+		const vector4f z = vector_mul_add(vector_sub(end_z, start.z), alpha_v, start.z);
+		const vector4f w = vector_mul_add(vector_sub(end_w, start.w), alpha_v, start.w);
+		return quat_normalize(quatf_x4{ x, y, z, w });
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane approximation of the spherical interpolation between start and end for a given alpha value.
+	// Each lane takes the shortest path, see quat_slerp_fast(quatf_arg0, quatf_arg1, float) for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf_x4 RTM_SIMD_CALL quat_slerp_fast(const quatf_x4& start, const quatf_x4& end, float alpha) RTM_NO_EXCEPT
+	{
+		// To ensure we take the shortest path, we flip the end weight of lanes where the dot product is negative
+		const vector4f dot = quat_dot(start, end);
+		const vector4f bias = vector_select(vector_greater_equal(dot, vector_zero()), vector_set(1.0f), vector_set(-1.0f));
+		const vector4f dot_minus_one = vector_sub(vector_abs(dot), vector_set(1.0f));
+
+		const vector4f start_weight = rtm_impl::slerp_fast_weights(vector_set(1.0f - alpha), dot_minus_one);
+		const vector4f end_weight = vector_mul(rtm_impl::slerp_fast_weights(vector_set(alpha), dot_minus_one), bias);
+
+		const vector4f x = vector_mul_add(start.x, start_weight, vector_mul(end.x, end_weight));
+		const vector4f y = vector_mul_add(start.y, start_weight, vector_mul(end.y, end_weight));
+		const vector4f z = vector_mul_add(start.z, start_weight, vector_mul(end.z, end_weight));
+		const vector4f w = vector_mul_add(start.w, start_weight, vector_mul(end.w, end_weight));
+		return quatf_x4{ x, y, z, w };
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
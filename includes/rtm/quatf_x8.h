@@ -0,0 +1,170 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/quatf.h"
+#include "rtm/scalarf_x8.h"
+#include "rtm/vector3f_x8.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/soa_common.h"
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Setters, getters, and casts
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Replicates a quaternion into all 8 lanes.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf_x8 RTM_SIMD_CALL quat_broadcast_x8(quatf_arg0 input) RTM_NO_EXCEPT
+	{
+		return quatf_x8{ scalar_set_x8(quat_get_x(input)), scalar_set_x8(quat_get_y(input)), scalar_set_x8(quat_get_z(input)), scalar_set_x8(quat_get_w(input)) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 8 consecutive quaternions and transposes them, one quaternion per lane.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf_x8 RTM_SIMD_CALL quat_load_x8(const quatf* inputs) RTM_NO_EXCEPT
+	{
+		quatf_x8 result;
+		rtm_impl::transpose_4x8(quat_to_vector(inputs[0]), quat_to_vector(inputs[1]), quat_to_vector(inputs[2]), quat_to_vector(inputs[3]),
+			quat_to_vector(inputs[4]), quat_to_vector(inputs[5]), quat_to_vector(inputs[6]), quat_to_vector(inputs[7]),
+			result.x, result.y, result.z, result.w);
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transposes the 8 lanes back into quaternions and writes them to consecutive outputs.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL quat_store_x8(const quatf_x8& input, quatf* outputs) RTM_NO_EXCEPT
+	{
+		vector4f tmp[8];
+		rtm_impl::transpose_8x4(input.x, input.y, input.z, input.w, tmp[0], tmp[1], tmp[2], tmp[3], tmp[4], tmp[5], tmp[6], tmp[7]);
+
+		for (int index = 0; index < 8; ++index)
+			outputs[index] = vector_to_quat(tmp[index]);
+	}
+
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Arithmetic
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane quaternion conjugate.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf_x8 RTM_SIMD_CALL quat_conjugate(const quatf_x8& input) RTM_NO_EXCEPT
+	{
+		return quatf_x8{ scalar_neg(input.x), scalar_neg(input.y), scalar_neg(input.z), input.w };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane quaternion multiplication, see quat_mul(quatf_arg0, quatf_arg1) for details.
+	// Multiplication order is as follow: local_to_world = quat_mul(local_to_object, object_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf_x8 RTM_SIMD_CALL quat_mul(const quatf_x8& lhs, const quatf_x8& rhs) RTM_NO_EXCEPT
+	{
+		const scalarf_x8 x = scalar_neg_mul_sub(rhs.z, lhs.y, scalar_mul_add(rhs.y, lhs.z, scalar_mul_add(rhs.x, lhs.w, scalar_mul(rhs.w, lhs.x))));
+		const scalarf_x8 y = scalar_mul_add(rhs.z, lhs.x, scalar_mul_add(rhs.y, lhs.w, scalar_neg_mul_sub(rhs.x, lhs.z, scalar_mul(rhs.w, lhs.y))));
+		const scalarf_x8 z = scalar_mul_add(rhs.z, lhs.w, scalar_neg_mul_sub(rhs.y, lhs.x, scalar_mul_add(rhs.x, lhs.y, scalar_mul(rhs.w, lhs.z))));
+		const scalarf_x8 w = scalar_neg_mul_sub(rhs.z, lhs.z, scalar_neg_mul_sub(rhs.y, lhs.y, scalar_neg_mul_sub(rhs.x, lhs.x, scalar_mul(rhs.w, lhs.w))));
+		return quatf_x8{ x, y, z, w };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane rotation of a 3D vector by a quaternion.
+	// Multiplication order is as follow: world_position = quat_mul_vector3(local_position, local_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x8 RTM_SIMD_CALL quat_mul_vector3(const vector3f_x8& vector, const quatf_x8& rotation) RTM_NO_EXCEPT
+	{
+		// Equivalent to rotation * vector * conjugate(rotation) but cheaper to evaluate
+		// t = 2 * cross(rotation.xyz, vector)
+		// result = vector + (rotation.w * t) + cross(rotation.xyz, t)
+		const vector3f_x8 rotation_xyz{ rotation.x, rotation.y, rotation.z };
+		const vector3f_x8 cross_rv = vector_cross3(rotation_xyz, vector);
+		const vector3f_x8 t = vector_add(cross_rv, cross_rv);
+		const vector3f_x8 cross_rt = vector_cross3(rotation_xyz, t);
+
+		const scalarf_x8 x = scalar_mul_add(t.x, rotation.w, scalar_add(vector.x, cross_rt.x));
+		const scalarf_x8 y = scalar_mul_add(t.y, rotation.w, scalar_add(vector.y, cross_rt.y));
+		const scalarf_x8 z = scalar_mul_add(t.z, rotation.w, scalar_add(vector.z, cross_rt.z));
+		return vector3f_x8{ x, y, z };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane 4D dot product of two quaternions.
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf_x8 RTM_SIMD_CALL quat_dot(const quatf_x8& lhs, const quatf_x8& rhs) RTM_NO_EXCEPT
+	{
+		return scalar_mul_add(lhs.w, rhs.w, scalar_mul_add(lhs.z, rhs.z, scalar_mul_add(lhs.y, rhs.y, scalar_mul(lhs.x, rhs.x))));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane squared length of the quaternion.
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf_x8 RTM_SIMD_CALL quat_length_squared(const quatf_x8& input) RTM_NO_EXCEPT
+	{
+		return quat_dot(input, input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane normalization of the quaternion.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf_x8 RTM_SIMD_CALL quat_normalize(const quatf_x8& input) RTM_NO_EXCEPT
+	{
+		const scalarf_x8 inv_len = scalar_sqrt_reciprocal(quat_length_squared(input));
+		return quatf_x8{ scalar_mul(input.x, inv_len), scalar_mul(input.y, inv_len), scalar_mul(input.z, inv_len), scalar_mul(input.w, inv_len) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane linear interpolation between start and end for a given alpha value.
+	// Each lane takes the shortest path and the result is normalized.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf_x8 RTM_SIMD_CALL quat_lerp(const quatf_x8& start, const quatf_x8& end, float alpha) RTM_NO_EXCEPT
+	{
+		// To ensure we take the shortest path, we flip the end rotation of lanes where the dot product is negative
+		const mask8i is_positive = scalar_greater_equal(quat_dot(start, end), scalar_set_x8(0.0f));
+		const scalarf_x8 end_x = scalar_select(is_positive, end.x, scalar_neg(end.x));
+		const scalarf_x8 end_y = scalar_select(is_positive, end.y, scalar_neg(end.y));
+		const scalarf_x8 end_z = scalar_select(is_positive, end.z, scalar_neg(end.z));
+		const scalarf_x8 end_w = scalar_select(is_positive, end.w, scalar_neg(end.w));
+
+		const scalarf_x8 alpha_v = scalar_set_x8(alpha);
+		const scalarf_x8 x = scalar_mul_add(scalar_sub(end_x, start.x), alpha_v, start.x);
+		const scalarf_x8 y = scalar_mul_add(scalar_sub(end_y, start.y), alpha_v, start.y);
+		const scalarf_x8 z = scalar_mul_add(scalar_sub(end_z, start.z), alpha_v, start.z);
+		const scalarf_x8 w = scalar_mul_add(scalar_sub(end_w, start.w), alpha_v, start.w);
+		return quat_normalize(quatf_x8{ x, y, z, w });
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
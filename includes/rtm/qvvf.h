@@ -39,7 +39,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Casts a QVV transform float64 variant to a float32 variant.
 	//////////////////////////////////////////////////////////////////////////
-	inline qvvf RTM_SIMD_CALL qvv_cast(const qvvd& input) RTM_NO_EXCEPT
+	inline qvvf RTM_SIMD_CALL qvv_cast(qvvd_arg0 input) RTM_NO_EXCEPT
 	{
 		return qvvf{ quat_cast(input.rotation), vector_cast(input.translation), vector_cast(input.scale) };
 	}
@@ -0,0 +1,276 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/quatf_batch.h"
+#include "rtm/qvvf.h"
+#include "rtm/qvvf_x4.h"
+#include "rtm/strided_span.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/soa_common.h"
+
+#include <cstddef>
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+#if defined(RTM_AVX512_INTRINSICS) || defined(RTM_CPU_DISPATCH)
+		//////////////////////////////////////////////////////////////////////////
+		// AVX2 and FMA version of qvv_mul_batch(..), 8 transforms are processed at a time.
+		// Groups of 8 transforms that contain negative scale are evaluated with qvv_mul(..).
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX2 inline void qvv_mul_batch_avx2(const qvvf* lhs, const qvvf* rhs, qvvf* output, size_t count) RTM_NO_EXCEPT
+		{
+			// A qvvf is 12 floats: rotation [0, 4), translation [4, 8), scale [8, 12)
+			const __m256 zero = _mm256_setzero_ps();
+
+			size_t index = 0;
+			for (; index + 8 <= count; index += 8)
+			{
+				const float* lhs_floats = reinterpret_cast<const float*>(lhs + index);
+				const float* rhs_floats = reinterpret_cast<const float*>(rhs + index);
+
+				quatf_x8_avx lhs_rotation;
+				quatf_x8_avx rhs_rotation;
+				avx_load_transpose_4x8(lhs_floats + 0, 12, lhs_rotation.x, lhs_rotation.y, lhs_rotation.z, lhs_rotation.w);
+				avx_load_transpose_4x8(rhs_floats + 0, 12, rhs_rotation.x, rhs_rotation.y, rhs_rotation.z, rhs_rotation.w);
+
+				__m256 lhs_translation[4];
+				__m256 rhs_translation[4];
+				avx_load_transpose_4x8(lhs_floats + 4, 12, lhs_translation[0], lhs_translation[1], lhs_translation[2], lhs_translation[3]);
+				avx_load_transpose_4x8(rhs_floats + 4, 12, rhs_translation[0], rhs_translation[1], rhs_translation[2], rhs_translation[3]);
+
+				__m256 lhs_scale[4];
+				__m256 rhs_scale[4];
+				avx_load_transpose_4x8(lhs_floats + 8, 12, lhs_scale[0], lhs_scale[1], lhs_scale[2], lhs_scale[3]);
+				avx_load_transpose_4x8(rhs_floats + 8, 12, rhs_scale[0], rhs_scale[1], rhs_scale[2], rhs_scale[3]);
+
+				// Groups with negative scale go through a matrix and are handled one by one
+				const __m256 min_scale = _mm256_min_ps(_mm256_min_ps(_mm256_min_ps(lhs_scale[0], rhs_scale[0]), _mm256_min_ps(lhs_scale[1], rhs_scale[1])), _mm256_min_ps(lhs_scale[2], rhs_scale[2]));
+				if (_mm256_movemask_ps(_mm256_cmp_ps(min_scale, zero, _CMP_LT_OQ)) != 0)
+				{
+					for (size_t lane_index = 0; lane_index < 8; ++lane_index)
+						output[index + lane_index] = qvv_mul(lhs[index + lane_index], rhs[index + lane_index]);
+					continue;
+				}
+
+				const quatf_x8_avx rotation = quat_mul_x8_avx2(lhs_rotation, rhs_rotation);
+
+				const vector3f_x8_avx scaled_translation{ _mm256_mul_ps(lhs_translation[0], rhs_scale[0]), _mm256_mul_ps(lhs_translation[1], rhs_scale[1]), _mm256_mul_ps(lhs_translation[2], rhs_scale[2]) };
+				const vector3f_x8_avx rotated_translation = quat_mul_vector3_x8_avx2(scaled_translation, rhs_rotation);
+
+				float* output_floats = reinterpret_cast<float*>(output + index);
+				avx_transpose_store_4x8(rotation.x, rotation.y, rotation.z, rotation.w, 12, output_floats + 0);
+				avx_transpose_store_4x8(
+					_mm256_add_ps(rotated_translation.x, rhs_translation[0]),
+					_mm256_add_ps(rotated_translation.y, rhs_translation[1]),
+					_mm256_add_ps(rotated_translation.z, rhs_translation[2]),
+					zero, 12, output_floats + 4);
+				avx_transpose_store_4x8(
+					_mm256_mul_ps(lhs_scale[0], rhs_scale[0]),
+					_mm256_mul_ps(lhs_scale[1], rhs_scale[1]),
+					_mm256_mul_ps(lhs_scale[2], rhs_scale[2]),
+					_mm256_mul_ps(lhs_scale[3], rhs_scale[3]), 12, output_floats + 8);
+			}
+
+			for (; index < count; ++index)
+				output[index] = qvv_mul(lhs[index], rhs[index]);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// AVX2 and FMA version of qvv_mul_no_scale_batch(..), 8 transforms are processed at a time.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX2 inline void qvv_mul_no_scale_batch_avx2(const qvvf* lhs, const qvvf* rhs, qvvf* output, size_t count) RTM_NO_EXCEPT
+		{
+			const __m256 zero = _mm256_setzero_ps();
+			const __m256 one = _mm256_set1_ps(1.0f);
+
+			size_t index = 0;
+			for (; index + 8 <= count; index += 8)
+			{
+				const float* lhs_floats = reinterpret_cast<const float*>(lhs + index);
+				const float* rhs_floats = reinterpret_cast<const float*>(rhs + index);
+
+				// We only need the rotation and translation
+				quatf_x8_avx lhs_rotation;
+				quatf_x8_avx rhs_rotation;
+				avx_load_transpose_4x8(lhs_floats + 0, 12, lhs_rotation.x, lhs_rotation.y, lhs_rotation.z, lhs_rotation.w);
+				avx_load_transpose_4x8(rhs_floats + 0, 12, rhs_rotation.x, rhs_rotation.y, rhs_rotation.z, rhs_rotation.w);
+
+				__m256 lhs_translation[4];
+				__m256 rhs_translation[4];
+				avx_load_transpose_4x8(lhs_floats + 4, 12, lhs_translation[0], lhs_translation[1], lhs_translation[2], lhs_translation[3]);
+				avx_load_transpose_4x8(rhs_floats + 4, 12, rhs_translation[0], rhs_translation[1], rhs_translation[2], rhs_translation[3]);
+
+				const quatf_x8_avx rotation = quat_mul_x8_avx2(lhs_rotation, rhs_rotation);
+
+				const vector3f_x8_avx translation{ lhs_translation[0], lhs_translation[1], lhs_translation[2] };
+				const vector3f_x8_avx rotated_translation = quat_mul_vector3_x8_avx2(translation, rhs_rotation);
+
+				float* output_floats = reinterpret_cast<float*>(output + index);
+				avx_transpose_store_4x8(rotation.x, rotation.y, rotation.z, rotation.w, 12, output_floats + 0);
+				avx_transpose_store_4x8(
+					_mm256_add_ps(rotated_translation.x, rhs_translation[0]),
+					_mm256_add_ps(rotated_translation.y, rhs_translation[1]),
+					_mm256_add_ps(rotated_translation.z, rhs_translation[2]),
+					zero, 12, output_floats + 4);
+				avx_transpose_store_4x8(one, one, one, one, 12, output_floats + 8);
+			}
+
+			for (; index < count; ++index)
+				output[index] = qvv_mul_no_scale(lhs[index], rhs[index]);
+		}
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies 'count' pairs of QVV transforms: output[i] = qvv_mul(lhs[i], rhs[i])
+	// See qvv_mul(qvvf_arg0, qvvf_arg1) for details.
+	// The output can safely alias either input.
+	// A cheap pre-pass looks for negative scale. When none is present, as is most
+	// often the case, the transforms are processed 4 at a time without branching.
+	// Otherwise, groups of 4 transforms that contain negative scale are evaluated with qvv_mul(..).
+	// With AVX-512, the AVX2 version processes 8 transforms at a time: gathering and
+	// scattering every component to process 16 at a time measures twice as slow.
+	// The [w] component of the output translation is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_mul_batch(const qvvf* lhs, const qvvf* rhs, qvvf* output, size_t count) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX512_INTRINSICS)
+		rtm_impl::qvv_mul_batch_avx2(lhs, rhs, output, count);
+#else
+		// Pre-pass to find out if any transform has negative scale, we only need the smallest value
+		vector4f min_scale = vector_set(1.0f);
+		for (size_t index = 0; index < count; ++index)
+			min_scale = vector_min(min_scale, vector_min(lhs[index].scale, rhs[index].scale));
+
+		const bool has_negative_scale = vector_any_less_than3(min_scale, vector_zero());
+
+		size_t index = 0;
+		if (has_negative_scale)
+		{
+			for (; index + 4 <= count; index += 4)
+				qvv_store_x4(qvv_mul(qvv_load_x4(lhs + index), qvv_load_x4(rhs + index)), output + index);
+		}
+		else
+		{
+			for (; index + 4 <= count; index += 4)
+				qvv_store_x4(rtm_impl::qvv_mul_positive_scale(qvv_load_x4(lhs + index), qvv_load_x4(rhs + index)), output + index);
+		}
+
+		for (; index < count; ++index)
+			output[index] = qvv_mul(lhs[index], rhs[index]);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies 'count' pairs of QVV transforms ignoring 3D scale: output[i] = qvv_mul_no_scale(lhs[i], rhs[i])
+	// See qvv_mul_no_scale(qvvf_arg0, qvvf_arg1) for details.
+	// The output can safely alias either input.
+	// The transforms are processed 4 at a time without branching (8 with AVX-512, see qvv_mul_batch(..)).
+	// The [w] component of the output translation is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_mul_no_scale_batch(const qvvf* lhs, const qvvf* rhs, qvvf* output, size_t count) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX512_INTRINSICS)
+		rtm_impl::qvv_mul_no_scale_batch_avx2(lhs, rhs, output, count);
+#else
+		size_t index = 0;
+		for (; index + 4 <= count; index += 4)
+			qvv_store_x4(qvv_mul_no_scale(qvv_load_x4(lhs + index), qvv_load_x4(rhs + index)), output + index);
+
+		for (; index < count; ++index)
+			output[index] = qvv_mul_no_scale(lhs[index], rhs[index]);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies pairs of QVV transforms read from strided views: output[i] = qvv_mul(lhs[i], rhs[i])
+	// The number of transforms is output.size and the inputs must be at least as large.
+	// This lets the transforms live inside larger structures, they are processed in place
+	// 4 at a time without a gather copy. Negative scale is handled as with qvv_mul_batch(..).
+	// The output can safely alias either input when they share the same layout.
+	// The [w] component of the output translation is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_mul_batch(const strided_span<const qvvf>& lhs, const strided_span<const qvvf>& rhs, const strided_span<qvvf>& output) RTM_NO_EXCEPT
+	{
+		rtm_impl::strided_span_check_sizes(lhs, output);
+		rtm_impl::strided_span_check_sizes(rhs, output);
+
+		const size_t count = output.size;
+
+		// Pre-pass to find out if any transform has negative scale, we only need the smallest value
+		vector4f min_scale = vector_set(1.0f);
+		for (size_t index = 0; index < count; ++index)
+			min_scale = vector_min(min_scale, vector_min(qvv_load(lhs, index).scale, qvv_load(rhs, index).scale));
+
+		const bool has_negative_scale = vector_any_less_than3(min_scale, vector_zero());
+
+		size_t index = 0;
+		if (has_negative_scale)
+		{
+			for (; index + 4 <= count; index += 4)
+				qvv_store_x4(qvv_mul(qvv_load_x4(lhs, index), qvv_load_x4(rhs, index)), output, index);
+		}
+		else
+		{
+			for (; index + 4 <= count; index += 4)
+				qvv_store_x4(rtm_impl::qvv_mul_positive_scale(qvv_load_x4(lhs, index), qvv_load_x4(rhs, index)), output, index);
+		}
+
+		for (; index < count; ++index)
+			qvv_store(qvv_mul(qvv_load(lhs, index), qvv_load(rhs, index)), output, index);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies pairs of QVV transforms read from strided views ignoring 3D scale: output[i] = qvv_mul_no_scale(lhs[i], rhs[i])
+	// The number of transforms is output.size and the inputs must be at least as large.
+	// The transforms are processed in place 4 at a time without branching.
+	// The output can safely alias either input when they share the same layout.
+	// The [w] component of the output translation is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_mul_no_scale_batch(const strided_span<const qvvf>& lhs, const strided_span<const qvvf>& rhs, const strided_span<qvvf>& output) RTM_NO_EXCEPT
+	{
+		rtm_impl::strided_span_check_sizes(lhs, output);
+		rtm_impl::strided_span_check_sizes(rhs, output);
+
+		const size_t count = output.size;
+		size_t index = 0;
+		for (; index + 4 <= count; index += 4)
+			qvv_store_x4(qvv_mul_no_scale(qvv_load_x4(lhs, index), qvv_load_x4(rhs, index)), output, index);
+
+		for (; index < count; ++index)
+			qvv_store(qvv_mul_no_scale(qvv_load(lhs, index), qvv_load(rhs, index)), output, index);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
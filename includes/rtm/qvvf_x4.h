@@ -0,0 +1,182 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/qvvf.h"
+#include "rtm/quatf_x4.h"
+#include "rtm/vector3f_x4.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/qvv_common.h"
+#include "rtm/impl/soa_common.h"
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Setters, getters, and casts
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 4 consecutive QVV transforms and transposes them, one transform per lane.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf_x4 RTM_SIMD_CALL qvv_load_x4(const qvvf* inputs) RTM_NO_EXCEPT
+	{
+		qvvf_x4 result;
+		vector4f w;
+		rtm_impl::transpose_4x4(quat_to_vector(inputs[0].rotation), quat_to_vector(inputs[1].rotation), quat_to_vector(inputs[2].rotation), quat_to_vector(inputs[3].rotation),
+			result.rotation.x, result.rotation.y, result.rotation.z, result.rotation.w);
+		rtm_impl::transpose_4x4(inputs[0].translation, inputs[1].translation, inputs[2].translation, inputs[3].translation,
+			result.translation.x, result.translation.y, result.translation.z, w);
+		rtm_impl::transpose_4x4(inputs[0].scale, inputs[1].scale, inputs[2].scale, inputs[3].scale,
+			result.scale.x, result.scale.y, result.scale.z, w);
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transposes the 4 lanes back into QVV transforms and writes them to consecutive outputs.
+	// Note: The [w] component of the output translation and scale is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL qvv_store_x4(const qvvf_x4& input, qvvf* outputs) RTM_NO_EXCEPT
+	{
+		vector4f rotation0;
+		vector4f rotation1;
+		vector4f rotation2;
+		vector4f rotation3;
+		rtm_impl::transpose_4x4(input.rotation.x, input.rotation.y, input.rotation.z, input.rotation.w, rotation0, rotation1, rotation2, rotation3);
+
+		vector4f translation0;
+		vector4f translation1;
+		vector4f translation2;
+		vector4f translation3;
+		rtm_impl::transpose_4x4(input.translation.x, input.translation.y, input.translation.z, input.translation.z, translation0, translation1, translation2, translation3);
+
+		vector4f scale0;
+		vector4f scale1;
+		vector4f scale2;
+		vector4f scale3;
+		rtm_impl::transpose_4x4(input.scale.x, input.scale.y, input.scale.z, input.scale.z, scale0, scale1, scale2, scale3);
+
+		outputs[0] = qvv_set(vector_to_quat(rotation0), translation0, scale0);
+		outputs[1] = qvv_set(vector_to_quat(rotation1), translation1, scale1);
+		outputs[2] = qvv_set(vector_to_quat(rotation2), translation2, scale2);
+		outputs[3] = qvv_set(vector_to_quat(rotation3), translation3, scale3);
+	}
+
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Arithmetic
+	//////////////////////////////////////////////////////////////////////////
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Per lane multiplication of two QVV transforms that have no negative scale.
+		// Unlike qvv_mul(const qvvf_x4&, const qvvf_x4&), this never branches.
+		//////////////////////////////////////////////////////////////////////////
+		inline qvvf_x4 RTM_SIMD_CALL qvv_mul_positive_scale(const qvvf_x4& lhs, const qvvf_x4& rhs) RTM_NO_EXCEPT
+		{
+			const quatf_x4 rotation = quat_mul(lhs.rotation, rhs.rotation);
+			const vector3f_x4 translation = vector_add(quat_mul_vector3(vector_mul(lhs.translation, rhs.scale), rhs.rotation), rhs.translation);
+			const vector3f_x4 scale = vector_mul(lhs.scale, rhs.scale);
+			return qvvf_x4{ rotation, translation, scale };
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane multiplication of two QVV transforms, see qvv_mul(qvvf_arg0, qvvf_arg1) for details.
+	// Multiplication order is as follow: local_to_world = qvv_mul(local_to_object, object_to_world)
+	// NOTE: When negative scale is present in any lane, all lanes are evaluated with the scalar
+	// code path which is considerably slower.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf_x4 RTM_SIMD_CALL qvv_mul(const qvvf_x4& lhs, const qvvf_x4& rhs) RTM_NO_EXCEPT
+	{
+		const vector4f lhs_min_scale = vector_min(vector_min(lhs.scale.x, lhs.scale.y), lhs.scale.z);
+		const vector4f rhs_min_scale = vector_min(vector_min(rhs.scale.x, rhs.scale.y), rhs.scale.z);
+		const vector4f min_scale = vector_min(lhs_min_scale, rhs_min_scale);
+
+		if (vector_any_less_than(min_scale, vector_zero()))
+		{
+			// If we have negative scale, the scalar code path handles it by going through a matrix
+			qvvf lhs_qvv[4];
+			qvvf rhs_qvv[4];
+			qvv_store_x4(lhs, &lhs_qvv[0]);
+			qvv_store_x4(rhs, &rhs_qvv[0]);
+
+			qvvf result_qvv[4];
+			for (int index = 0; index < 4; ++index)
+				result_qvv[index] = qvv_mul(lhs_qvv[index], rhs_qvv[index]);
+
+			return qvv_load_x4(&result_qvv[0]);
+		}
+
+		return rtm_impl::qvv_mul_positive_scale(lhs, rhs);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane multiplication of two QVV transforms ignoring 3D scale.
+	// The resulting QVV transforms with have a [1,1,1] 3D scale.
+	// Multiplication order is as follow: local_to_world = qvv_mul(local_to_object, object_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf_x4 RTM_SIMD_CALL qvv_mul_no_scale(const qvvf_x4& lhs, const qvvf_x4& rhs) RTM_NO_EXCEPT
+	{
+		const quatf_x4 rotation = quat_mul(lhs.rotation, rhs.rotation);
+		const vector3f_x4 translation = vector_add(quat_mul_vector3(lhs.translation, rhs.rotation), rhs.translation);
+		const vector4f one = vector_set(1.0f);
+		return qvvf_x4{ rotation, translation, vector3f_x4{ one, one, one } };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane multiplication of a QVV transform and a 3D point.
+	// Multiplication order is as follow: world_position = qvv_mul_point3(local_position, local_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x4 RTM_SIMD_CALL qvv_mul_point3(const vector3f_x4& point, const qvvf_x4& qvv) RTM_NO_EXCEPT
+	{
+		return vector_add(quat_mul_vector3(vector_mul(qvv.scale, point), qvv.rotation), qvv.translation);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane multiplication of a QVV transform and a 3D point ignoring 3D scale.
+	// Multiplication order is as follow: world_position = qvv_mul_point3_no_scale(local_position, local_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x4 RTM_SIMD_CALL qvv_mul_point3_no_scale(const vector3f_x4& point, const qvvf_x4& qvv) RTM_NO_EXCEPT
+	{
+		return vector_add(quat_mul_vector3(point, qvv.rotation), qvv.translation);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns QVV transforms with the rotation part normalized.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf_x4 RTM_SIMD_CALL qvv_normalize(const qvvf_x4& input) RTM_NO_EXCEPT
+	{
+		return qvvf_x4{ quat_normalize(input.rotation), input.translation, input.scale };
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,176 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "rtm/math.h"
+#include "rtm/qvvf.h"
+#include "rtm/quatf_x8.h"
+#include "rtm/scalarf_x8.h"
+#include "rtm/vector3f_x8.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/qvv_common.h"
+#include "rtm/impl/soa_common.h"
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Setters, getters, and casts
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 8 consecutive QVV transforms and transposes them, one transform per lane.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf_x8 RTM_SIMD_CALL qvv_load_x8(const qvvf* inputs) RTM_NO_EXCEPT
+	{
+		qvvf_x8 result;
+		scalarf_x8 w;
+		rtm_impl::transpose_4x8(quat_to_vector(inputs[0].rotation), quat_to_vector(inputs[1].rotation), quat_to_vector(inputs[2].rotation), quat_to_vector(inputs[3].rotation),
+			quat_to_vector(inputs[4].rotation), quat_to_vector(inputs[5].rotation), quat_to_vector(inputs[6].rotation), quat_to_vector(inputs[7].rotation),
+			result.rotation.x, result.rotation.y, result.rotation.z, result.rotation.w);
+		rtm_impl::transpose_4x8(inputs[0].translation, inputs[1].translation, inputs[2].translation, inputs[3].translation,
+			inputs[4].translation, inputs[5].translation, inputs[6].translation, inputs[7].translation,
+			result.translation.x, result.translation.y, result.translation.z, w);
+		rtm_impl::transpose_4x8(inputs[0].scale, inputs[1].scale, inputs[2].scale, inputs[3].scale,
+			inputs[4].scale, inputs[5].scale, inputs[6].scale, inputs[7].scale,
+			result.scale.x, result.scale.y, result.scale.z, w);
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transposes the 8 lanes back into QVV transforms and writes them to consecutive outputs.
+	// Note: The [w] component of the output translation and scale is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL qvv_store_x8(const qvvf_x8& input, qvvf* outputs) RTM_NO_EXCEPT
+	{
+		vector4f rotations[8];
+		rtm_impl::transpose_8x4(input.rotation.x, input.rotation.y, input.rotation.z, input.rotation.w,
+			rotations[0], rotations[1], rotations[2], rotations[3], rotations[4], rotations[5], rotations[6], rotations[7]);
+
+		vector4f translations[8];
+		rtm_impl::transpose_8x4(input.translation.x, input.translation.y, input.translation.z, input.translation.z,
+			translations[0], translations[1], translations[2], translations[3], translations[4], translations[5], translations[6], translations[7]);
+
+		vector4f scales[8];
+		rtm_impl::transpose_8x4(input.scale.x, input.scale.y, input.scale.z, input.scale.z,
+			scales[0], scales[1], scales[2], scales[3], scales[4], scales[5], scales[6], scales[7]);
+
+		for (int index = 0; index < 8; ++index)
+			outputs[index] = qvv_set(vector_to_quat(rotations[index]), translations[index], scales[index]);
+	}
+
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Arithmetic
+	//////////////////////////////////////////////////////////////////////////
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Per lane multiplication of two QVV transforms that have no negative scale.
+		// Unlike qvv_mul(const qvvf_x8&, const qvvf_x8&), this never branches.
+		//////////////////////////////////////////////////////////////////////////
+		inline qvvf_x8 RTM_SIMD_CALL qvv_mul_positive_scale(const qvvf_x8& lhs, const qvvf_x8& rhs) RTM_NO_EXCEPT
+		{
+			const quatf_x8 rotation = quat_mul(lhs.rotation, rhs.rotation);
+			const vector3f_x8 translation = vector_add(quat_mul_vector3(vector_mul(lhs.translation, rhs.scale), rhs.rotation), rhs.translation);
+			const vector3f_x8 scale = vector_mul(lhs.scale, rhs.scale);
+			return qvvf_x8{ rotation, translation, scale };
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane multiplication of two QVV transforms, see qvv_mul(qvvf_arg0, qvvf_arg1) for details.
+	// Multiplication order is as follow: local_to_world = qvv_mul(local_to_object, object_to_world)
+	// NOTE: When negative scale is present in any lane, all lanes are evaluated with the scalar
+	// code path which is considerably slower.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf_x8 RTM_SIMD_CALL qvv_mul(const qvvf_x8& lhs, const qvvf_x8& rhs) RTM_NO_EXCEPT
+	{
+		const scalarf_x8 lhs_min_scale = scalar_min(scalar_min(lhs.scale.x, lhs.scale.y), lhs.scale.z);
+		const scalarf_x8 rhs_min_scale = scalar_min(scalar_min(rhs.scale.x, rhs.scale.y), rhs.scale.z);
+		const scalarf_x8 min_scale = scalar_min(lhs_min_scale, rhs_min_scale);
+
+		if (mask_get_bits(scalar_less_than(min_scale, scalar_set_x8(0.0f))) != 0)
+		{
+			// If we have negative scale, the scalar code path handles it by going through a matrix
+			qvvf lhs_qvv[8];
+			qvvf rhs_qvv[8];
+			qvv_store_x8(lhs, &lhs_qvv[0]);
+			qvv_store_x8(rhs, &rhs_qvv[0]);
+
+			qvvf result_qvv[8];
+			for (int index = 0; index < 8; ++index)
+				result_qvv[index] = qvv_mul(lhs_qvv[index], rhs_qvv[index]);
+
+			return qvv_load_x8(&result_qvv[0]);
+		}
+
+		return rtm_impl::qvv_mul_positive_scale(lhs, rhs);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane multiplication of two QVV transforms ignoring 3D scale.
+	// The resulting QVV transforms with have a [1,1,1] 3D scale.
+	// Multiplication order is as follow: local_to_world = qvv_mul(local_to_object, object_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf_x8 RTM_SIMD_CALL qvv_mul_no_scale(const qvvf_x8& lhs, const qvvf_x8& rhs) RTM_NO_EXCEPT
+	{
+		const quatf_x8 rotation = quat_mul(lhs.rotation, rhs.rotation);
+		const vector3f_x8 translation = vector_add(quat_mul_vector3(lhs.translation, rhs.rotation), rhs.translation);
+		const scalarf_x8 one = scalar_set_x8(1.0f);
+		return qvvf_x8{ rotation, translation, vector3f_x8{ one, one, one } };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane multiplication of a QVV transform and a 3D point.
+	// Multiplication order is as follow: world_position = qvv_mul_point3(local_position, local_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x8 RTM_SIMD_CALL qvv_mul_point3(const vector3f_x8& point, const qvvf_x8& qvv) RTM_NO_EXCEPT
+	{
+		return vector_add(quat_mul_vector3(vector_mul(qvv.scale, point), qvv.rotation), qvv.translation);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane multiplication of a QVV transform and a 3D point ignoring 3D scale.
+	// Multiplication order is as follow: world_position = qvv_mul_point3_no_scale(local_position, local_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x8 RTM_SIMD_CALL qvv_mul_point3_no_scale(const vector3f_x8& point, const qvvf_x8& qvv) RTM_NO_EXCEPT
+	{
+		return vector_add(quat_mul_vector3(point, qvv.rotation), qvv.translation);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns QVV transforms with the rotation part normalized.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf_x8 RTM_SIMD_CALL qvv_normalize(const qvvf_x8& input) RTM_NO_EXCEPT
+	{
+		return qvvf_x8{ quat_normalize(input.rotation), input.translation, input.scale };
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -35,6 +35,95 @@ RTM_IMPL_FILE_PRAGMA_PUSH
 
 namespace rtm
 {
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Constants used by the sine and cosine approximations.
+		// The angle is first remapped into [-PI, PI] with a two part Cody-Waite reduction
+		// (2 * PI = hi + lo where hi is exactly representable as a float32) and then reflected
+		// into [-PI/2, PI/2] where minimax polynomials (fit with the Remez algorithm over [0, PI/2]) are evaluated:
+		// sin(x) ~= x + x^3 * (c3 + x^2 * (c5 + ... + x^2 * c17))
+		// cos(x) ~= 1 + x^2 * (c2 + x^2 * (c4 + ... + x^2 * c16))
+		// The sine polynomial has a max relative error of 2.3e-18 and the cosine polynomial
+		// a max absolute error of 2.9e-17, both below float64 rounding.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr double k_sincos_inv_two_pi_f64 = 0.159154943091895335768883763372514362;		// 1 / (2 * PI)
+		constexpr double k_sincos_two_pi_hi_f64 = 6.28318548202514648438;							// 2 * PI = hi + lo
+		constexpr double k_sincos_two_pi_lo_f64 = -1.74845560007449702546e-7;
+		constexpr double k_sincos_pi_f64 = 3.14159265358979323846264338327950288;
+		constexpr double k_sincos_half_pi_f64 = 1.57079632679489661923132169163975144;
+		constexpr double k_sincos_max_reduction_f64 = 1.0e8;		// The reduction loses accuracy past this magnitude
+
+		constexpr double k_sin_c3_f64 = -1.66666666666666657415e-1;
+		constexpr double k_sin_c5_f64 = 8.33333333333332454407e-3;
+		constexpr double k_sin_c7_f64 = -1.98412698412606580602e-4;
+		constexpr double k_sin_c9_f64 = 2.75573192205367531739e-6;
+		constexpr double k_sin_c11_f64 = -2.50521077700182228275e-8;
+		constexpr double k_sin_c13_f64 = 1.60589859035041788387e-10;
+		constexpr double k_sin_c15_f64 = -7.64420663124797695487e-13;
+		constexpr double k_sin_c17_f64 = 2.73397758673825889537e-15;
+
+		constexpr double k_cos_c2_f64 = -5.00000000000000000000e-1;
+		constexpr double k_cos_c4_f64 = 4.16666666666664908814e-2;
+		constexpr double k_cos_c6_f64 = -1.38888888888714879741e-3;
+		constexpr double k_cos_c8_f64 = 2.48015872950502265395e-5;
+		constexpr double k_cos_c10_f64 = -2.75573180574325839138e-7;
+		constexpr double k_cos_c12_f64 = 2.08766471554355756449e-9;
+		constexpr double k_cos_c14_f64 = -1.14651379758042931938e-11;
+		constexpr double k_cos_c16_f64 = 4.63247844006541882927e-14;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Constants used by the inverse trigonometric approximations.
+		// Both families evaluate an odd minimax polynomial (fit with the Remez algorithm
+		// for relative error) of the form: f(x) ~= x + x^3 * (c3 + x^2 * (c5 + ...))
+		// asin(x) is fit over [0, 0.5], larger inputs use asin(x) = PI/2 - 2 * asin(sqrt((1 - x) / 2)).
+		// atan(x) is fit over [0, tan(PI/8)], larger inputs use atan(x) = PI/4 + atan((x - 1) / (x + 1))
+		// and atan(x) = PI/2 - atan(1 / x).
+		// With accuracy::high, the asin polynomial has a max relative error of 2.7e-17 and the
+		// atan polynomial 2.5e-17. With accuracy::low, they are 4.8e-9 and 2.1e-8.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr double k_inv_trig_quarter_pi_f64 = 0.785398163397448309615660845819875721;
+		constexpr double k_inv_trig_tan_pi_8_f64 = 0.414213562373095048801688724209698079;		// tan(PI / 8)
+		constexpr double k_inv_trig_tan_3pi_8_f64 = 2.41421356237309504880168872420969808;		// tan(3 * PI / 8)
+
+		constexpr double k_asin_c3_f64 = 1.66666666666666657415e-1;
+		constexpr double k_asin_c5_f64 = 7.49999999999998029354e-2;
+		constexpr double k_asin_c7_f64 = 4.46428571429504303381e-2;
+		constexpr double k_asin_c9_f64 = 3.03819444284719498983e-2;
+		constexpr double k_asin_c11_f64 = 2.23721603489387098340e-2;
+		constexpr double k_asin_c13_f64 = 1.73527112730215253567e-2;
+		constexpr double k_asin_c15_f64 = 1.39661683401876967475e-2;
+		constexpr double k_asin_c17_f64 = 1.15311594788719187082e-2;
+		constexpr double k_asin_c19_f64 = 9.96920958744928337181e-3;
+		constexpr double k_asin_c21_f64 = 7.03157717653970972677e-3;
+		constexpr double k_asin_c23_f64 = 1.29934267257846621652e-2;
+		constexpr double k_asin_c25_f64 = -7.81278825271460725110e-3;
+		constexpr double k_asin_c27_f64 = 2.38698445184603348646e-2;
+
+		constexpr double k_asin_low_c3_f64 = 1.66667524817684875593e-1;
+		constexpr double k_asin_low_c5_f64 = 7.49529765327776736905e-2;
+		constexpr double k_asin_low_c7_f64 = 4.54703746444002979143e-2;
+		constexpr double k_asin_low_c9_f64 = 2.41795212971519374312e-2;
+		constexpr double k_asin_low_c11_f64 = 4.21662971446405548948e-2;
+
+		constexpr double k_atan_c3_f64 = -3.33333333333333314830e-1;
+		constexpr double k_atan_c5_f64 = 1.99999999999996486144e-1;
+		constexpr double k_atan_c7_f64 = -1.42857142855739693843e-1;
+		constexpr double k_atan_c9_f64 = 1.11111110907132493164e-1;
+		constexpr double k_atan_c11_f64 = -9.09090769703757850539e-2;
+		constexpr double k_atan_c13_f64 = 7.69225591592511692696e-2;
+		constexpr double k_atan_c15_f64 = -6.66552863392110700458e-2;
+		constexpr double k_atan_c17_f64 = 5.86684907315103143510e-2;
+		constexpr double k_atan_c19_f64 = -5.12998341171095953439e-2;
+		constexpr double k_atan_c21_f64 = 4.04838188538122617510e-2;
+		constexpr double k_atan_c23_f64 = -2.06636838184164652044e-2;
+
+		constexpr double k_atan_low_c3_f64 = -3.33329491384452114566e-1;
+		constexpr double k_atan_low_c5_f64 = 1.99777100219692582694e-1;
+		constexpr double k_atan_low_c7_f64 = -1.38776787051482525248e-1;
+		constexpr double k_atan_low_c9_f64 = 8.05372260535445333440e-2;
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Creates a scalar from a floating point value.
 	//////////////////////////////////////////////////////////////////////////
@@ -110,6 +199,31 @@ namespace rtm
 		return std::fabs(input);
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the rounded input using banker's rounding (half to even).
+	// scalar_round_bankers(2.5) = 2.0
+	// scalar_round_bankers(1.5) = 2.0
+	// scalar_round_bankers(1.2) = 1.0
+	// scalar_round_bankers(-2.5) = -2.0
+	//////////////////////////////////////////////////////////////////////////
+	inline double scalar_round_bankers(double input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE4_INTRINSICS)
+		const __m128d value = _mm_set1_pd(input);
+		return _mm_cvtsd_f64(_mm_round_sd(value, value, 0x8));
+#else
+		// Adding and subtracting 2^52 forces the fractional part out of the mantissa and the
+		// default IEEE 754 rounding mode (round half to even) rounds it for us.
+		// Inputs that large have no fractional part and are returned unchanged.
+		constexpr double fractional_limit = 4503599627370496.0;
+		if (!(scalar_abs(input) < fractional_limit))
+			return input;
+
+		const double offset = input >= 0.0 ? fractional_limit : -fractional_limit;
+		return (input + offset) - offset;
+#endif
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the square root of the input.
 	//////////////////////////////////////////////////////////////////////////
@@ -144,46 +258,201 @@ namespace rtm
 	}
 #endif
 
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Remaps an angle into [-PI/2, PI/2] for the sine and cosine polynomials.
+		// sin(x) = sin(PI - x) while cos(x) = -cos(PI - x), the cosine sign is returned.
+		//////////////////////////////////////////////////////////////////////////
+		inline double sincos_remap(double angle, double& out_cos_sign) RTM_NO_EXCEPT
+		{
+			// Remap our input in the [-PI, PI] range
+			const double quotient = scalar_round_bankers(angle * k_sincos_inv_two_pi_f64);
+			double x = (angle - quotient * k_sincos_two_pi_hi_f64) - quotient * k_sincos_two_pi_lo_f64;
+
+			// Reflect our input in the [-PI/2, PI/2] range
+			out_cos_sign = 1.0;
+			if (scalar_abs(x) > k_sincos_half_pi_f64)
+			{
+				x = (x >= 0.0 ? k_sincos_pi_f64 : -k_sincos_pi_f64) - x;
+				out_cos_sign = -1.0;
+			}
+
+			return x;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Evaluates the sine polynomial over [-PI/2, PI/2].
+		//////////////////////////////////////////////////////////////////////////
+		inline double sin_poly(double x) RTM_NO_EXCEPT
+		{
+			const double x2 = x * x;
+			double poly = k_sin_c15_f64 + x2 * k_sin_c17_f64;
+			poly = k_sin_c13_f64 + x2 * poly;
+			poly = k_sin_c11_f64 + x2 * poly;
+			poly = k_sin_c9_f64 + x2 * poly;
+			poly = k_sin_c7_f64 + x2 * poly;
+			poly = k_sin_c5_f64 + x2 * poly;
+			poly = k_sin_c3_f64 + x2 * poly;
+			return x + x * x2 * poly;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Evaluates the cosine polynomial over [-PI/2, PI/2].
+		//////////////////////////////////////////////////////////////////////////
+		inline double cos_poly(double x) RTM_NO_EXCEPT
+		{
+			const double x2 = x * x;
+			double poly = k_cos_c14_f64 + x2 * k_cos_c16_f64;
+			poly = k_cos_c12_f64 + x2 * poly;
+			poly = k_cos_c10_f64 + x2 * poly;
+			poly = k_cos_c8_f64 + x2 * poly;
+			poly = k_cos_c6_f64 + x2 * poly;
+			poly = k_cos_c4_f64 + x2 * poly;
+			poly = k_cos_c2_f64 + x2 * poly;
+			return 1.0 + x2 * poly;
+		}
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the sine of the input angle.
+	// Uses a range reduction and a minimax polynomial, see vector_sin(..) for the error bounds.
+	// Angles past [-1.0e8, 1.0e8] use std::sin(..) since the reduction loses accuracy there.
 	//////////////////////////////////////////////////////////////////////////
 	inline double scalar_sin(double angle) RTM_NO_EXCEPT
 	{
-		return std::sin(angle);
+		if (scalar_abs(angle) > rtm_impl::k_sincos_max_reduction_f64)
+			return std::sin(angle);
+
+		double cos_sign;
+		const double x = rtm_impl::sincos_remap(angle, cos_sign);
+		return rtm_impl::sin_poly(x);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the cosine of the input angle.
+	// Uses a range reduction and a minimax polynomial, see vector_cos(..) for the error bounds.
+	// Angles past [-1.0e8, 1.0e8] use std::cos(..) since the reduction loses accuracy there.
 	//////////////////////////////////////////////////////////////////////////
 	inline double scalar_cos(double angle) RTM_NO_EXCEPT
 	{
-		return std::cos(angle);
+		if (scalar_abs(angle) > rtm_impl::k_sincos_max_reduction_f64)
+			return std::cos(angle);
+
+		double cos_sign;
+		const double x = rtm_impl::sincos_remap(angle, cos_sign);
+		return rtm_impl::cos_poly(x) * cos_sign;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Returns both sine and cosine of the input angle.
+	// Uses a range reduction and minimax polynomials, see vector_sincos(..) for the error bounds.
+	// Angles past [-1.0e8, 1.0e8] use std::sin(..) and std::cos(..) since the reduction loses accuracy there.
 	//////////////////////////////////////////////////////////////////////////
 	inline void scalar_sincos(double angle, double& out_sin, double& out_cos) RTM_NO_EXCEPT
 	{
-		out_sin = scalar_sin(angle);
-		out_cos = scalar_cos(angle);
+		if (scalar_abs(angle) > rtm_impl::k_sincos_max_reduction_f64)
+		{
+			out_sin = std::sin(angle);
+			out_cos = std::cos(angle);
+			return;
+		}
+
+		double cos_sign;
+		const double x = rtm_impl::sincos_remap(angle, cos_sign);
+		out_sin = rtm_impl::sin_poly(x);
+		out_cos = rtm_impl::cos_poly(x) * cos_sign;
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Evaluates the arc-sine polynomial over [-0.5, 0.5].
+		//////////////////////////////////////////////////////////////////////////
+		inline double asin_poly(double x) RTM_NO_EXCEPT
+		{
+			const double x2 = x * x;
+			double poly = k_asin_c25_f64 + x2 * k_asin_c27_f64;
+			poly = k_asin_c23_f64 + x2 * poly;
+			poly = k_asin_c21_f64 + x2 * poly;
+			poly = k_asin_c19_f64 + x2 * poly;
+			poly = k_asin_c17_f64 + x2 * poly;
+			poly = k_asin_c15_f64 + x2 * poly;
+			poly = k_asin_c13_f64 + x2 * poly;
+			poly = k_asin_c11_f64 + x2 * poly;
+			poly = k_asin_c9_f64 + x2 * poly;
+			poly = k_asin_c7_f64 + x2 * poly;
+			poly = k_asin_c5_f64 + x2 * poly;
+			poly = k_asin_c3_f64 + x2 * poly;
+			return x + x * x2 * poly;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Evaluates the arc-tangent polynomial over [-tan(PI/8), tan(PI/8)].
+		//////////////////////////////////////////////////////////////////////////
+		inline double atan_poly(double x) RTM_NO_EXCEPT
+		{
+			const double x2 = x * x;
+			double poly = k_atan_c21_f64 + x2 * k_atan_c23_f64;
+			poly = k_atan_c19_f64 + x2 * poly;
+			poly = k_atan_c17_f64 + x2 * poly;
+			poly = k_atan_c15_f64 + x2 * poly;
+			poly = k_atan_c13_f64 + x2 * poly;
+			poly = k_atan_c11_f64 + x2 * poly;
+			poly = k_atan_c9_f64 + x2 * poly;
+			poly = k_atan_c7_f64 + x2 * poly;
+			poly = k_atan_c5_f64 + x2 * poly;
+			poly = k_atan_c3_f64 + x2 * poly;
+			return x + x * x2 * poly;
+		}
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the arc-cosine of the input.
+	// Uses a minimax polynomial, see vector_acos(..) for the error bounds.
 	//////////////////////////////////////////////////////////////////////////
 	inline double scalar_acos(double value) RTM_NO_EXCEPT
 	{
-		return std::acos(value);
+		const double abs_value = scalar_abs(value);
+		if (abs_value <= 0.5)
+			return rtm_impl::k_sincos_half_pi_f64 - rtm_impl::asin_poly(value);
+
+		// acos(x) = 2 * asin(sqrt((1 - x) / 2)) and acos(-x) = PI - acos(x)
+		const double half_angle = rtm_impl::asin_poly(scalar_sqrt((1.0 - abs_value) * 0.5));
+		const double angle = half_angle + half_angle;
+		return value >= 0.0 ? angle : (rtm_impl::k_sincos_pi_f64 - angle);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the arc-tangent of [x/y] using the sign of the arguments to
 	// determine the correct quadrant.
+	// Uses a minimax polynomial, see vector_atan2(..) for the error bounds.
 	//////////////////////////////////////////////////////////////////////////
 	inline double scalar_atan2(double x, double y) RTM_NO_EXCEPT
 	{
-		return std::atan2(x, y);
+		// Reduce into [0, 1] by dividing the smallest magnitude by the largest
+		const double abs_x = scalar_abs(x);
+		const double abs_y = scalar_abs(y);
+		const bool is_x_larger = abs_x > abs_y;
+		const double min_value = is_x_larger ? abs_y : abs_x;
+		const double max_value = is_x_larger ? abs_x : abs_y;
+		if (max_value == 0.0)
+			return 0.0;
+
+		// Reduce into [-tan(PI/8), tan(PI/8)] with atan(t) = PI/4 + atan((t - 1) / (t + 1))
+		double angle;
+		if (min_value > rtm_impl::k_inv_trig_tan_pi_8_f64 * max_value)
+			angle = rtm_impl::k_inv_trig_quarter_pi_f64 + rtm_impl::atan_poly((min_value - max_value) / (min_value + max_value));
+		else
+			angle = rtm_impl::atan_poly(min_value / max_value);
+
+		if (is_x_larger)
+			angle = rtm_impl::k_sincos_half_pi_f64 - angle;
+
+		if (y < 0.0)
+			angle = rtm_impl::k_sincos_pi_f64 - angle;
+
+		return x < 0.0 ? -angle : angle;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
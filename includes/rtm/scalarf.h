@@ -35,6 +35,68 @@ RTM_IMPL_FILE_PRAGMA_PUSH
 
 namespace rtm
 {
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Constants used by the sine and cosine approximations.
+		// The angle is first remapped into [-PI, PI] with a two part Cody-Waite reduction
+		// (2 * PI = hi + lo where hi has few significant bits) and then reflected into [-PI/2, PI/2]
+		// where minimax polynomials (fit with the Remez algorithm over [0, PI/2]) are evaluated:
+		// sin(x) ~= x + x^3 * (c3 + x^2 * (c5 + x^2 * (c7 + x^2 * c9)))
+		// cos(x) ~= 1 + x^2 * (c2 + x^2 * (c4 + x^2 * (c6 + x^2 * (c8 + x^2 * c10))))
+		// The sine polynomial has a max relative error of 6.1e-9 and the cosine polynomial
+		// a max absolute error of 2.4e-10, both below float32 rounding.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr float k_sincos_inv_two_pi_f32 = 0.159154943091895335f;		// 1 / (2 * PI)
+		constexpr float k_sincos_two_pi_hi_f32 = 6.28125f;						// 2 * PI = hi + lo
+		constexpr float k_sincos_two_pi_lo_f32 = 1.93530717958647692e-3f;
+		constexpr float k_sincos_pi_f32 = 3.14159265358979323846f;
+		constexpr float k_sincos_half_pi_f32 = 1.57079632679489661923f;
+		constexpr float k_sincos_max_reduction_f32 = 1.0e4f;		// The reduction loses accuracy past this magnitude
+
+		constexpr float k_sin_c3_f32 = -1.66666595504392694993e-1f;
+		constexpr float k_sin_c5_f32 = 8.33306624637331766481e-3f;
+		constexpr float k_sin_c7_f32 = -1.98096029224694938518e-4f;
+		constexpr float k_sin_c9_f32 = 2.60578068078751184542e-6f;
+
+		constexpr float k_cos_c2_f32 = -4.99999995495575777493e-1f;
+		constexpr float k_cos_c4_f32 = 4.16666407280759307219e-2f;
+		constexpr float k_cos_c6_f32 = -1.38884035084373418274e-3f;
+		constexpr float k_cos_c8_f32 = 2.47618862596871176362e-5f;
+		constexpr float k_cos_c10_f32 = -2.60771055507534506024e-7f;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Constants used by the inverse trigonometric approximations.
+		// Both families evaluate an odd minimax polynomial (fit with the Remez algorithm
+		// for relative error) of the form: f(x) ~= x + x^3 * (c3 + x^2 * (c5 + ...))
+		// asin(x) is fit over [0, 0.5], larger inputs use asin(x) = PI/2 - 2 * asin(sqrt((1 - x) / 2)).
+		// atan(x) is fit over [0, tan(PI/8)], larger inputs use atan(x) = PI/4 + atan((x - 1) / (x + 1))
+		// and atan(x) = PI/2 - atan(1 / x).
+		// With accuracy::high, the asin polynomial has a max relative error of 4.8e-9 and the
+		// atan polynomial 2.1e-8. With accuracy::low, they are 3.8e-5 and 2.2e-5.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr float k_inv_trig_quarter_pi_f32 = 0.785398163397448309616f;
+		constexpr float k_inv_trig_tan_pi_8_f32 = 0.414213562373095048802f;		// tan(PI / 8)
+		constexpr float k_inv_trig_tan_3pi_8_f32 = 2.41421356237309504880f;		// tan(3 * PI / 8)
+
+		constexpr float k_asin_c3_f32 = 1.66667524817684875593e-1f;
+		constexpr float k_asin_c5_f32 = 7.49529765327776736905e-2f;
+		constexpr float k_asin_c7_f32 = 4.54703746444002979143e-2f;
+		constexpr float k_asin_c9_f32 = 2.41795212971519374312e-2f;
+		constexpr float k_asin_c11_f32 = 4.21662971446405548948e-2f;
+
+		constexpr float k_asin_low_c3_f32 = 1.65057759456998409675e-1f;
+		constexpr float k_asin_low_c5_f32 = 9.42986784710240777407e-2f;
+
+		constexpr float k_atan_c3_f32 = -3.33329491384452114566e-1f;
+		constexpr float k_atan_c5_f32 = 1.99777100219692582694e-1f;
+		constexpr float k_atan_c7_f32 = -1.38776787051482525248e-1f;
+		constexpr float k_atan_c9_f32 = 8.05372260535445333440e-2f;
+
+		constexpr float k_atan_low_c3_f32 = -3.31833775058198832131e-1f;
+		constexpr float k_atan_low_c5_f32 = 1.70341777187607623656e-1f;
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Creates a scalar from a floating point value.
 	//////////////////////////////////////////////////////////////////////////
@@ -110,6 +172,31 @@ namespace rtm
 		return std::fabs(input);
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the rounded input using banker's rounding (half to even).
+	// scalar_round_bankers(2.5) = 2.0
+	// scalar_round_bankers(1.5) = 2.0
+	// scalar_round_bankers(1.2) = 1.0
+	// scalar_round_bankers(-2.5) = -2.0
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_round_bankers(float input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE4_INTRINSICS)
+		const __m128 value = _mm_set_ps1(input);
+		return _mm_cvtss_f32(_mm_round_ss(value, value, 0x8));
+#else
+		// Adding and subtracting 2^23 forces the fractional part out of the mantissa and the
+		// default IEEE 754 rounding mode (round half to even) rounds it for us.
+		// Inputs that large have no fractional part and are returned unchanged.
+		constexpr float fractional_limit = 8388608.0f;
+		if (!(scalar_abs(input) < fractional_limit))
+			return input;
+
+		const float offset = input >= 0.0f ? fractional_limit : -fractional_limit;
+		return (input + offset) - offset;
+#endif
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the square root of the input.
 	//////////////////////////////////////////////////////////////////////////
@@ -191,46 +278,165 @@ namespace rtm
 	}
 #endif
 
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Remaps an angle into [-PI/2, PI/2] for the sine and cosine polynomials.
+		// sin(x) = sin(PI - x) while cos(x) = -cos(PI - x), the cosine sign is returned.
+		//////////////////////////////////////////////////////////////////////////
+		inline float sincos_remap(float angle, float& out_cos_sign) RTM_NO_EXCEPT
+		{
+			// Remap our input in the [-PI, PI] range
+			const float quotient = scalar_round_bankers(angle * k_sincos_inv_two_pi_f32);
+			float x = (angle - quotient * k_sincos_two_pi_hi_f32) - quotient * k_sincos_two_pi_lo_f32;
+
+			// Reflect our input in the [-PI/2, PI/2] range
+			out_cos_sign = 1.0f;
+			if (scalar_abs(x) > k_sincos_half_pi_f32)
+			{
+				x = (x >= 0.0f ? k_sincos_pi_f32 : -k_sincos_pi_f32) - x;
+				out_cos_sign = -1.0f;
+			}
+
+			return x;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Evaluates the sine polynomial over [-PI/2, PI/2].
+		//////////////////////////////////////////////////////////////////////////
+		inline float sin_poly(float x) RTM_NO_EXCEPT
+		{
+			const float x2 = x * x;
+			return x + x * x2 * (k_sin_c3_f32 + x2 * (k_sin_c5_f32 + x2 * (k_sin_c7_f32 + x2 * k_sin_c9_f32)));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Evaluates the cosine polynomial over [-PI/2, PI/2].
+		//////////////////////////////////////////////////////////////////////////
+		inline float cos_poly(float x) RTM_NO_EXCEPT
+		{
+			const float x2 = x * x;
+			return 1.0f + x2 * (k_cos_c2_f32 + x2 * (k_cos_c4_f32 + x2 * (k_cos_c6_f32 + x2 * (k_cos_c8_f32 + x2 * k_cos_c10_f32))));
+		}
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the sine of the input angle.
+	// Uses a range reduction and a minimax polynomial, see vector_sin(..) for the error bounds.
+	// Angles past [-1.0e4, 1.0e4] use std::sin(..) since the reduction loses accuracy there.
 	//////////////////////////////////////////////////////////////////////////
 	inline float scalar_sin(float angle) RTM_NO_EXCEPT
 	{
-		return std::sin(angle);
+		if (scalar_abs(angle) > rtm_impl::k_sincos_max_reduction_f32)
+			return std::sin(angle);
+
+		float cos_sign;
+		const float x = rtm_impl::sincos_remap(angle, cos_sign);
+		return rtm_impl::sin_poly(x);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the cosine of the input angle.
+	// Uses a range reduction and a minimax polynomial, see vector_cos(..) for the error bounds.
+	// Angles past [-1.0e4, 1.0e4] use std::cos(..) since the reduction loses accuracy there.
 	//////////////////////////////////////////////////////////////////////////
 	inline float scalar_cos(float angle) RTM_NO_EXCEPT
 	{
-		return std::cos(angle);
+		if (scalar_abs(angle) > rtm_impl::k_sincos_max_reduction_f32)
+			return std::cos(angle);
+
+		float cos_sign;
+		const float x = rtm_impl::sincos_remap(angle, cos_sign);
+		return rtm_impl::cos_poly(x) * cos_sign;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Returns both sine and cosine of the input angle.
+	// Uses a range reduction and minimax polynomials, see vector_sincos(..) for the error bounds.
+	// Angles past [-1.0e4, 1.0e4] use std::sin(..) and std::cos(..) since the reduction loses accuracy there.
 	//////////////////////////////////////////////////////////////////////////
 	inline void scalar_sincos(float angle, float& out_sin, float& out_cos) RTM_NO_EXCEPT
 	{
-		out_sin = scalar_sin(angle);
-		out_cos = scalar_cos(angle);
+		if (scalar_abs(angle) > rtm_impl::k_sincos_max_reduction_f32)
+		{
+			out_sin = std::sin(angle);
+			out_cos = std::cos(angle);
+			return;
+		}
+
+		float cos_sign;
+		const float x = rtm_impl::sincos_remap(angle, cos_sign);
+		out_sin = rtm_impl::sin_poly(x);
+		out_cos = rtm_impl::cos_poly(x) * cos_sign;
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Evaluates the arc-sine polynomial over [-0.5, 0.5].
+		//////////////////////////////////////////////////////////////////////////
+		inline float asin_poly(float x) RTM_NO_EXCEPT
+		{
+			const float x2 = x * x;
+			return x + x * x2 * (k_asin_c3_f32 + x2 * (k_asin_c5_f32 + x2 * (k_asin_c7_f32 + x2 * (k_asin_c9_f32 + x2 * k_asin_c11_f32))));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Evaluates the arc-tangent polynomial over [-tan(PI/8), tan(PI/8)].
+		//////////////////////////////////////////////////////////////////////////
+		inline float atan_poly(float x) RTM_NO_EXCEPT
+		{
+			const float x2 = x * x;
+			return x + x * x2 * (k_atan_c3_f32 + x2 * (k_atan_c5_f32 + x2 * (k_atan_c7_f32 + x2 * k_atan_c9_f32)));
+		}
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the arc-cosine of the input.
+	// Uses a minimax polynomial, see vector_acos(..) for the error bounds.
 	//////////////////////////////////////////////////////////////////////////
 	inline float scalar_acos(float value) RTM_NO_EXCEPT
 	{
-		return std::acos(value);
+		const float abs_value = scalar_abs(value);
+		if (abs_value <= 0.5f)
+			return rtm_impl::k_sincos_half_pi_f32 - rtm_impl::asin_poly(value);
+
+		// acos(x) = 2 * asin(sqrt((1 - x) / 2)) and acos(-x) = PI - acos(x)
+		const float half_angle = rtm_impl::asin_poly(std::sqrt((1.0f - abs_value) * 0.5f));
+		const float angle = half_angle + half_angle;
+		return value >= 0.0f ? angle : (rtm_impl::k_sincos_pi_f32 - angle);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the arc-tangent of [x/y] using the sign of the arguments to
 	// determine the correct quadrant.
+	// Uses a minimax polynomial, see vector_atan2(..) for the error bounds.
 	//////////////////////////////////////////////////////////////////////////
 	inline float scalar_atan2(float x, float y) RTM_NO_EXCEPT
 	{
-		return std::atan2(x, y);
+		// Reduce into [0, 1] by dividing the smallest magnitude by the largest
+		const float abs_x = scalar_abs(x);
+		const float abs_y = scalar_abs(y);
+		const bool is_x_larger = abs_x > abs_y;
+		const float min_value = is_x_larger ? abs_y : abs_x;
+		const float max_value = is_x_larger ? abs_x : abs_y;
+		if (max_value == 0.0f)
+			return 0.0f;
+
+		// Reduce into [-tan(PI/8), tan(PI/8)] with atan(t) = PI/4 + atan((t - 1) / (t + 1))
+		float angle;
+		if (min_value > rtm_impl::k_inv_trig_tan_pi_8_f32 * max_value)
+			angle = rtm_impl::k_inv_trig_quarter_pi_f32 + rtm_impl::atan_poly((min_value - max_value) / (min_value + max_value));
+		else
+			angle = rtm_impl::atan_poly(min_value / max_value);
+
+		if (is_x_larger)
+			angle = rtm_impl::k_sincos_half_pi_f32 - angle;
+
+		if (y < 0.0f)
+			angle = rtm_impl::k_sincos_pi_f32 - angle;
+
+		return x < 0.0f ? -angle : angle;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
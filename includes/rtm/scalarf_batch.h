@@ -0,0 +1,145 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Applies a 4 wide function over 'count' scalars, 4 at a time.
+		// The remainder is padded with zeros in a temporary buffer.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename function_type>
+		inline void scalar_unary_batch(const float* input, float* output, size_t count, function_type function) RTM_NO_EXCEPT
+		{
+			size_t offset = 0;
+			for (; offset + 4 <= count; offset += 4)
+				vector_store(function(vector_load(input + offset)), output + offset);
+
+			if (offset < count)
+			{
+				float input_buffer[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+				float output_buffer[4];
+
+				const size_t num_remaining = count - offset;
+				for (size_t index = 0; index < num_remaining; ++index)
+					input_buffer[index] = input[offset + index];
+
+				vector_store(function(vector_load(&input_buffer[0])), &output_buffer[0]);
+
+				for (size_t index = 0; index < num_remaining; ++index)
+					output[offset + index] = output_buffer[index];
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Applies a 4 wide function over 'count' pairs of scalars, 4 at a time.
+		// The remainder is padded with zeros in a temporary buffer.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename function_type>
+		inline void scalar_binary_batch(const float* input0, const float* input1, float* output, size_t count, function_type function) RTM_NO_EXCEPT
+		{
+			size_t offset = 0;
+			for (; offset + 4 <= count; offset += 4)
+				vector_store(function(vector_load(input0 + offset), vector_load(input1 + offset)), output + offset);
+
+			if (offset < count)
+			{
+				float input0_buffer[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+				float input1_buffer[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+				float output_buffer[4];
+
+				const size_t num_remaining = count - offset;
+				for (size_t index = 0; index < num_remaining; ++index)
+				{
+					input0_buffer[index] = input0[offset + index];
+					input1_buffer[index] = input1[offset + index];
+				}
+
+				vector_store(function(vector_load(&input0_buffer[0]), vector_load(&input1_buffer[0])), &output_buffer[0]);
+
+				for (size_t index = 0; index < num_remaining; ++index)
+					output[offset + index] = output_buffer[index];
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the arc-sine of 'count' scalars: output[i] = asin(input[i])
+	// See vector_asin(vector4f_arg0) for details and error bounds.
+	// The output can safely alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	template<accuracy precision = accuracy::high>
+	inline void scalar_asin_batch(const float* input, float* output, size_t count) RTM_NO_EXCEPT
+	{
+		rtm_impl::scalar_unary_batch(input, output, count, [](vector4f_arg0 value) { return vector_asin<precision>(value); });
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the arc-cosine of 'count' scalars: output[i] = acos(input[i])
+	// See vector_acos(vector4f_arg0) for details and error bounds.
+	// The output can safely alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	template<accuracy precision = accuracy::high>
+	inline void scalar_acos_batch(const float* input, float* output, size_t count) RTM_NO_EXCEPT
+	{
+		rtm_impl::scalar_unary_batch(input, output, count, [](vector4f_arg0 value) { return vector_acos<precision>(value); });
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the arc-tangent of 'count' scalars: output[i] = atan(input[i])
+	// See vector_atan(vector4f_arg0) for details and error bounds.
+	// The output can safely alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	template<accuracy precision = accuracy::high>
+	inline void scalar_atan_batch(const float* input, float* output, size_t count) RTM_NO_EXCEPT
+	{
+		rtm_impl::scalar_unary_batch(input, output, count, [](vector4f_arg0 value) { return vector_atan<precision>(value); });
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the arc-tangent of 'count' pairs of scalars: output[i] = atan2(y[i], x[i])
+	// See vector_atan2(vector4f_arg0, vector4f_arg1) for details and error bounds.
+	// The output can safely alias either input.
+	//////////////////////////////////////////////////////////////////////////
+	template<accuracy precision = accuracy::high>
+	inline void scalar_atan2_batch(const float* y, const float* x, float* output, size_t count) RTM_NO_EXCEPT
+	{
+		rtm_impl::scalar_binary_batch(y, x, output, count, [](vector4f_arg0 y_value, vector4f_arg1 x_value) { return vector_atan2<precision>(y_value, x_value); });
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
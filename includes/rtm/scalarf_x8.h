@@ -0,0 +1,362 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/mask4i.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Combines two 4 wide vectors into an 8 wide scalar, [lo] holds lanes [0, 3] and [hi] holds lanes [4, 7].
+		//////////////////////////////////////////////////////////////////////////
+		inline scalarf_x8 RTM_SIMD_CALL scalar_x8_from_halves(vector4f_arg0 lo, vector4f_arg1 hi) RTM_NO_EXCEPT
+		{
+#if defined(RTM_AVX_INTRINSICS)
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+#else
+			return scalarf_x8{ lo, hi };
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns lanes [0, 3] of an 8 wide scalar.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL scalar_x8_get_lo(const scalarf_x8& input) RTM_NO_EXCEPT
+		{
+#if defined(RTM_AVX_INTRINSICS)
+			return _mm256_castps256_ps128(input);
+#else
+			return input.lo;
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns lanes [4, 7] of an 8 wide scalar.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL scalar_x8_get_hi(const scalarf_x8& input) RTM_NO_EXCEPT
+		{
+#if defined(RTM_AVX_INTRINSICS)
+			return _mm256_extractf128_ps(input, 1);
+#else
+			return input.hi;
+#endif
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Setters, getters, and casts
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates an 8 wide scalar with every lane set to the same value.
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf_x8 RTM_SIMD_CALL scalar_set_x8(float value) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_set1_ps(value);
+#else
+		const vector4f value_v = vector_set(value);
+		return scalarf_x8{ value_v, value_v };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 8 consecutive unaligned values into an 8 wide scalar, one value per lane.
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf_x8 RTM_SIMD_CALL scalar_load_x8(const float* input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_loadu_ps(input);
+#else
+		return scalarf_x8{ vector_load(input), vector_load(input + 4) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes the 8 lanes of an 8 wide scalar to unaligned memory.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL scalar_store_x8(const scalarf_x8& input, float* output) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		_mm256_storeu_ps(output, input);
+#else
+		vector_store(input.lo, output);
+		vector_store(input.hi, output + 4);
+#endif
+	}
+
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Arithmetic
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane addition of the two inputs: lhs + rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf_x8 RTM_SIMD_CALL scalar_add(const scalarf_x8& lhs, const scalarf_x8& rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_add_ps(lhs, rhs);
+#else
+		return scalarf_x8{ vector_add(lhs.lo, rhs.lo), vector_add(lhs.hi, rhs.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane subtraction of the two inputs: lhs - rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf_x8 RTM_SIMD_CALL scalar_sub(const scalarf_x8& lhs, const scalarf_x8& rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_sub_ps(lhs, rhs);
+#else
+		return scalarf_x8{ vector_sub(lhs.lo, rhs.lo), vector_sub(lhs.hi, rhs.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane multiplication of the two inputs: lhs * rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf_x8 RTM_SIMD_CALL scalar_mul(const scalarf_x8& lhs, const scalarf_x8& rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_mul_ps(lhs, rhs);
+#else
+		return scalarf_x8{ vector_mul(lhs.lo, rhs.lo), vector_mul(lhs.hi, rhs.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane division of the two inputs: lhs / rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf_x8 RTM_SIMD_CALL scalar_div(const scalarf_x8& lhs, const scalarf_x8& rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_div_ps(lhs, rhs);
+#else
+		return scalarf_x8{ vector_div(lhs.lo, rhs.lo), vector_div(lhs.hi, rhs.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane maximum of the two inputs: max(lhs, rhs)
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf_x8 RTM_SIMD_CALL scalar_max(const scalarf_x8& lhs, const scalarf_x8& rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_max_ps(lhs, rhs);
+#else
+		return scalarf_x8{ vector_max(lhs.lo, rhs.lo), vector_max(lhs.hi, rhs.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane minimum of the two inputs: min(lhs, rhs)
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf_x8 RTM_SIMD_CALL scalar_min(const scalarf_x8& lhs, const scalarf_x8& rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_min_ps(lhs, rhs);
+#else
+		return scalarf_x8{ vector_min(lhs.lo, rhs.lo), vector_min(lhs.hi, rhs.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane absolute value of the input: abs(input)
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf_x8 RTM_SIMD_CALL scalar_abs(const scalarf_x8& input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), input);
+#else
+		return scalarf_x8{ vector_abs(input.lo), vector_abs(input.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane negation of the input: -input
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf_x8 RTM_SIMD_CALL scalar_neg(const scalarf_x8& input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_xor_ps(input, _mm256_set1_ps(-0.0f));
+#else
+		return scalarf_x8{ vector_neg(input.lo), vector_neg(input.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane reciprocal of the input: 1.0 / input
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf_x8 RTM_SIMD_CALL scalar_reciprocal(const scalarf_x8& input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		// Perform two passes of Newton-Raphson iteration on the hardware estimate
+		__m256 x0 = _mm256_rcp_ps(input);
+
+		// First iteration
+		__m256 x1 = _mm256_sub_ps(_mm256_add_ps(x0, x0), _mm256_mul_ps(input, _mm256_mul_ps(x0, x0)));
+
+		// Second iteration
+		__m256 x2 = _mm256_sub_ps(_mm256_add_ps(x1, x1), _mm256_mul_ps(input, _mm256_mul_ps(x1, x1)));
+		return x2;
+#else
+		return scalarf_x8{ vector_reciprocal(input.lo), vector_reciprocal(input.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane square root of the input: sqrt(input)
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf_x8 RTM_SIMD_CALL scalar_sqrt(const scalarf_x8& input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_sqrt_ps(input);
+#else
+		return scalarf_x8{ vector_sqrt(input.lo), vector_sqrt(input.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane reciprocal square root of the input: 1.0 / sqrt(input)
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf_x8 RTM_SIMD_CALL scalar_sqrt_reciprocal(const scalarf_x8& input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		// Perform two passes of Newton-Raphson iteration on the hardware estimate
+		__m256 half = _mm256_set1_ps(0.5f);
+		__m256 input_half_v = _mm256_mul_ps(input, half);
+		__m256 x0 = _mm256_rsqrt_ps(input);
+
+		// First iteration
+		__m256 x1 = _mm256_mul_ps(x0, x0);
+		x1 = _mm256_sub_ps(half, _mm256_mul_ps(input_half_v, x1));
+		x1 = _mm256_add_ps(_mm256_mul_ps(x0, x1), x0);
+
+		// Second iteration
+		__m256 x2 = _mm256_mul_ps(x1, x1);
+		x2 = _mm256_sub_ps(half, _mm256_mul_ps(input_half_v, x2));
+		x2 = _mm256_add_ps(_mm256_mul_ps(x1, x2), x1);
+
+		return x2;
+#else
+		return scalarf_x8{ vector_sqrt_reciprocal(input.lo), vector_sqrt_reciprocal(input.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane multiplication/addition of the three inputs: s2 + (s0 * s1)
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf_x8 RTM_SIMD_CALL scalar_mul_add(const scalarf_x8& s0, const scalarf_x8& s1, const scalarf_x8& s2) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_add_ps(_mm256_mul_ps(s0, s1), s2);
+#else
+		return scalarf_x8{ vector_mul_add(s0.lo, s1.lo, s2.lo), vector_mul_add(s0.hi, s1.hi, s2.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane negative multiplication/subtraction of the three inputs: -((s0 * s1) - s2)
+	// This is mathematically equivalent to: s2 - (s0 * s1)
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf_x8 RTM_SIMD_CALL scalar_neg_mul_sub(const scalarf_x8& s0, const scalarf_x8& s1, const scalarf_x8& s2) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_sub_ps(s2, _mm256_mul_ps(s0, s1));
+#else
+		return scalarf_x8{ vector_neg_mul_sub(s0.lo, s1.lo, s2.lo), vector_neg_mul_sub(s0.hi, s1.hi, s2.hi) };
+#endif
+	}
+
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Comparisons and masking
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per lane ~0 if less than, otherwise 0: lhs < rhs ? ~0 : 0
+	//////////////////////////////////////////////////////////////////////////
+	inline mask8i RTM_SIMD_CALL scalar_less_than(const scalarf_x8& lhs, const scalarf_x8& rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_cmp_ps(lhs, rhs, _CMP_LT_OQ);
+#else
+		return mask8i{ vector_less_than(lhs.lo, rhs.lo), vector_less_than(lhs.hi, rhs.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per lane ~0 if greater equal, otherwise 0: lhs >= rhs ? ~0 : 0
+	//////////////////////////////////////////////////////////////////////////
+	inline mask8i RTM_SIMD_CALL scalar_greater_equal(const scalarf_x8& lhs, const scalarf_x8& rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_cmp_ps(lhs, rhs, _CMP_GE_OQ);
+#else
+		return mask8i{ vector_greater_equal(lhs.lo, rhs.lo), vector_greater_equal(lhs.hi, rhs.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane selection based on the mask value: mask != 0 ? if_true : if_false
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf_x8 RTM_SIMD_CALL scalar_select(const mask8i& mask, const scalarf_x8& if_true, const scalarf_x8& if_false) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_blendv_ps(if_false, if_true, mask);
+#else
+		return scalarf_x8{ vector_select(mask.lo, if_true.lo, if_false.lo), vector_select(mask.hi, if_true.hi, if_false.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a bit mask where bit N is set if lane N of the mask is true (~0).
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t RTM_SIMD_CALL mask_get_bits(const mask8i& input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return uint32_t(_mm256_movemask_ps(input));
+#elif defined(RTM_SSE2_INTRINSICS)
+		return uint32_t(_mm_movemask_ps(input.lo)) | (uint32_t(_mm_movemask_ps(input.hi)) << 4);
+#else
+		return (mask_get_x(input.lo) & 0x01) | (mask_get_y(input.lo) & 0x02) | (mask_get_z(input.lo) & 0x04) | (mask_get_w(input.lo) & 0x08)
+			| (mask_get_x(input.hi) & 0x10) | (mask_get_y(input.hi) & 0x20) | (mask_get_z(input.hi) & 0x40) | (mask_get_w(input.hi) & 0x80);
+#endif
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,390 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/dualquatf.h"
+#include "rtm/matrix3x4f.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/memory_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// The number of vertices skinned together. The blended transforms of a tile
+		// (48 bytes per matrix, 32 bytes per rotation and translation) remain in the
+		// L1 cache while the position and normal streams are transformed one after the other.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr size_t k_skinning_tile_size = 128;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Blends the palette matrices that influence a vertex: sum(palette[index] * weight)
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_influences>
+		inline matrix3x4f RTM_SIMD_CALL skinning_blend_matrix(const matrix3x4f* palette, const uint16_t* bone_indices, const float* bone_weights) RTM_NO_EXCEPT
+		{
+			const matrix3x4f& bone0 = palette[bone_indices[0]];
+			const float weight0 = bone_weights[0];
+
+			vector4f x_axis = vector_mul(bone0.x_axis, weight0);
+			vector4f y_axis = vector_mul(bone0.y_axis, weight0);
+			vector4f z_axis = vector_mul(bone0.z_axis, weight0);
+			vector4f w_axis = vector_mul(bone0.w_axis, weight0);
+
+			for (uint32_t influence_index = 1; influence_index < num_influences; ++influence_index)
+			{
+				const matrix3x4f& bone = palette[bone_indices[influence_index]];
+				const float weight = bone_weights[influence_index];
+
+				x_axis = vector_mul_add(bone.x_axis, weight, x_axis);
+				y_axis = vector_mul_add(bone.y_axis, weight, y_axis);
+				z_axis = vector_mul_add(bone.z_axis, weight, z_axis);
+				w_axis = vector_mul_add(bone.w_axis, weight, w_axis);
+			}
+
+			return matrix3x4f{ x_axis, y_axis, z_axis, w_axis };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Blends the palette dual quaternions that influence a vertex with the shortest path
+		// relative to the first influence: sum(sign(palette[index]) * palette[index] * weight)
+		// The result is not normalized.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_influences>
+		inline dualquatf RTM_SIMD_CALL skinning_blend_dualquat(const dualquatf* palette, const uint16_t* bone_indices, const float* bone_weights) RTM_NO_EXCEPT
+		{
+			const dualquatf& bone0 = palette[bone_indices[0]];
+			const vector4f pivot = quat_to_vector(bone0.real);
+
+			vector4f real = vector_mul(pivot, bone_weights[0]);
+			vector4f dual = vector_mul(quat_to_vector(bone0.dual), bone_weights[0]);
+
+			for (uint32_t influence_index = 1; influence_index < num_influences; ++influence_index)
+			{
+				const dualquatf& bone = palette[bone_indices[influence_index]];
+				const vector4f bone_real = quat_to_vector(bone.real);
+				const float weight = vector_dot(pivot, bone_real) >= 0.0f ? bone_weights[influence_index] : -bone_weights[influence_index];
+
+				real = vector_mul_add(bone_real, weight, real);
+				dual = vector_mul_add(quat_to_vector(bone.dual), weight, dual);
+			}
+
+			return dualquat_set(vector_to_quat(real), vector_to_quat(dual));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Prefetches the palette entries that influence a vertex. They are reached through
+		// the bone indices which hardware prefetchers cannot predict.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_influences, typename palette_type>
+		inline void skinning_prefetch_palette(const palette_type* palette, const uint16_t* bone_indices) RTM_NO_EXCEPT
+		{
+			for (uint32_t influence_index = 0; influence_index < num_influences; ++influence_index)
+				memory_prefetch_range(palette + bone_indices[influence_index], sizeof(palette_type));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes 4 consecutive 3D vectors with non-temporal stores. Together they span
+		// 48 bytes which are packed into 3 vectors: [x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3]
+		// The output must be 16 bytes aligned.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL skinning_store_stream3_x4(vector4f_arg0 input0, vector4f_arg1 input1, vector4f_arg2 input2, vector4f_arg3 input3, float3f* outputs) RTM_NO_EXCEPT
+		{
+			float* output_floats = &outputs->x;
+			vector_store_stream(vector_mix<mix4::x, mix4::y, mix4::z, mix4::a>(input0, input1), output_floats + 0);
+			vector_store_stream(vector_mix<mix4::y, mix4::z, mix4::a, mix4::b>(input1, input2), output_floats + 4);
+			vector_store_stream(vector_mix<mix4::z, mix4::a, mix4::b, mix4::c>(input2, input3), output_floats + 8);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Skins vertices with linear blend skinning.
+	// Every vertex has 'num_influences' bone indices into the palette and matching weights
+	// stored contiguously: bone_indices[vertex_index * num_influences + influence_index].
+	// Weights are expected to sum to 1.0, unused influences should have a weight of 0.0.
+	// The palette matrices are blended per vertex and used to transform its position and normal.
+	// Transformed normals are normalized.
+	// Vertices are processed in tiles: the blended matrices of a tile are computed first
+	// and then reused from the cache to transform the positions followed by the normals.
+	// The normal streams are optional and can be null.
+	// The outputs can safely alias their respective inputs.
+	// With store_mode::streaming, output streams that are 16 bytes aligned are written 4 vertices
+	// at a time with non-temporal stores and are fenced before returning. This is best suited
+	// for large vertex buffers that are uploaded to the GPU and not read again by the CPU.
+	// The palette entries are prefetched 'prefetch_distance' vertices ahead, a distance of 0
+	// disables software prefetching. Large palettes shared by many meshes benefit the most.
+	//////////////////////////////////////////////////////////////////////////
+	template<uint32_t num_influences>
+	inline void skin_linear_blend(const matrix3x4f* palette, const uint16_t* bone_indices, const float* bone_weights,
+		const float3f* positions, const float3f* normals,
+		float3f* out_positions, float3f* out_normals, size_t num_vertices, store_mode mode = store_mode::cached,
+		size_t prefetch_distance = k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		static_assert(num_influences >= 1 && num_influences <= 8, "Linear blend skinning supports between 1 and 8 influences per vertex");
+		RTM_ASSERT(palette != nullptr && bone_indices != nullptr && bone_weights != nullptr, "Invalid skinning palette or influences");
+		RTM_ASSERT((normals == nullptr) == (out_normals == nullptr), "Input and output normals must both be provided or both be null");
+
+		matrix3x4f blended_matrices[rtm_impl::k_skinning_tile_size];
+
+		// Tiles start on a multiple of 4 vertices, the groups of 4 vertices remain aligned
+		const bool is_streaming = mode == store_mode::streaming;
+		const bool stream_positions = is_streaming && rtm_impl::is_aligned_to(out_positions, 16);
+		const bool stream_normals = is_streaming && out_normals != nullptr && rtm_impl::is_aligned_to(out_normals, 16);
+
+		for (size_t tile_start = 0; tile_start < num_vertices; tile_start += rtm_impl::k_skinning_tile_size)
+		{
+			const size_t num_remaining = num_vertices - tile_start;
+			const size_t tile_size = num_remaining >= rtm_impl::k_skinning_tile_size ? rtm_impl::k_skinning_tile_size : num_remaining;
+
+			const uint16_t* tile_bone_indices = bone_indices + tile_start * num_influences;
+			const float* tile_bone_weights = bone_weights + tile_start * num_influences;
+			for (size_t vertex_index = 0; vertex_index < tile_size; ++vertex_index)
+			{
+				if (prefetch_distance != 0 && tile_start + vertex_index + prefetch_distance < num_vertices)
+					rtm_impl::skinning_prefetch_palette<num_influences>(palette, tile_bone_indices + (vertex_index + prefetch_distance) * num_influences);
+
+				blended_matrices[vertex_index] = rtm_impl::skinning_blend_matrix<num_influences>(palette, tile_bone_indices + vertex_index * num_influences, tile_bone_weights + vertex_index * num_influences);
+			}
+
+			size_t vertex_index = 0;
+			if (stream_positions)
+			{
+				for (; vertex_index + 4 <= tile_size; vertex_index += 4)
+				{
+					const float3f* group_positions = positions + tile_start + vertex_index;
+					const matrix3x4f* group_matrices = blended_matrices + vertex_index;
+					rtm_impl::skinning_store_stream3_x4(
+						matrix_mul_point3(vector_load3(group_positions + 0), group_matrices[0]),
+						matrix_mul_point3(vector_load3(group_positions + 1), group_matrices[1]),
+						matrix_mul_point3(vector_load3(group_positions + 2), group_matrices[2]),
+						matrix_mul_point3(vector_load3(group_positions + 3), group_matrices[3]),
+						out_positions + tile_start + vertex_index);
+				}
+			}
+
+			for (; vertex_index < tile_size; ++vertex_index)
+			{
+				const vector4f position = vector_load3(positions + tile_start + vertex_index);
+				vector_store3(matrix_mul_point3(position, blended_matrices[vertex_index]), out_positions + tile_start + vertex_index);
+			}
+
+			if (normals != nullptr)
+			{
+				vertex_index = 0;
+				if (stream_normals)
+				{
+					for (; vertex_index + 4 <= tile_size; vertex_index += 4)
+					{
+						const float3f* group_normals = normals + tile_start + vertex_index;
+						const matrix3x4f* group_matrices = blended_matrices + vertex_index;
+						const vector4f normal0 = vector_load3(group_normals + 0);
+						const vector4f normal1 = vector_load3(group_normals + 1);
+						const vector4f normal2 = vector_load3(group_normals + 2);
+						const vector4f normal3 = vector_load3(group_normals + 3);
+						rtm_impl::skinning_store_stream3_x4(
+							vector_normalize3(matrix_mul_vector3(normal0, group_matrices[0]), normal0),
+							vector_normalize3(matrix_mul_vector3(normal1, group_matrices[1]), normal1),
+							vector_normalize3(matrix_mul_vector3(normal2, group_matrices[2]), normal2),
+							vector_normalize3(matrix_mul_vector3(normal3, group_matrices[3]), normal3),
+							out_normals + tile_start + vertex_index);
+					}
+				}
+
+				for (; vertex_index < tile_size; ++vertex_index)
+				{
+					const vector4f normal = vector_load3(normals + tile_start + vertex_index);
+					const vector4f skinned_normal = matrix_mul_vector3(normal, blended_matrices[vertex_index]);
+					vector_store3(vector_normalize3(skinned_normal, normal), out_normals + tile_start + vertex_index);
+				}
+			}
+		}
+
+		if (is_streaming)
+			rtm_impl::memory_stream_fence();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Skins vertices with dual quaternion skinning.
+	// Every vertex has 'num_influences' bone indices into the palette and matching weights
+	// stored contiguously: bone_indices[vertex_index * num_influences + influence_index].
+	// Weights are expected to sum to 1.0, unused influences should have a weight of 0.0.
+	// The palette dual quaternions must be normalized, they are blended per vertex with
+	// dual quaternion linear blending (DLB) which preserves rigidity and avoids the
+	// volume loss of linear blend skinning around twisting joints.
+	// Vertices are processed in tiles: the blended rotations and translations of a tile are
+	// computed first and then reused from the cache to transform the positions followed by the normals.
+	// The normal streams are optional and can be null.
+	// The outputs can safely alias their respective inputs.
+	// See skin_linear_blend(..) for details about store_mode::streaming and prefetching.
+	//////////////////////////////////////////////////////////////////////////
+	template<uint32_t num_influences>
+	inline void skin_dual_quat(const dualquatf* palette, const uint16_t* bone_indices, const float* bone_weights,
+		const float3f* positions, const float3f* normals,
+		float3f* out_positions, float3f* out_normals, size_t num_vertices, store_mode mode = store_mode::cached,
+		size_t prefetch_distance = k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		static_assert(num_influences >= 1 && num_influences <= 8, "Dual quaternion skinning supports between 1 and 8 influences per vertex");
+		RTM_ASSERT(palette != nullptr && bone_indices != nullptr && bone_weights != nullptr, "Invalid skinning palette or influences");
+		RTM_ASSERT((normals == nullptr) == (out_normals == nullptr), "Input and output normals must both be provided or both be null");
+
+		quatf blended_rotations[rtm_impl::k_skinning_tile_size];
+		vector4f blended_translations[rtm_impl::k_skinning_tile_size];
+
+		// Tiles start on a multiple of 4 vertices, the groups of 4 vertices remain aligned
+		const bool is_streaming = mode == store_mode::streaming;
+		const bool stream_positions = is_streaming && rtm_impl::is_aligned_to(out_positions, 16);
+		const bool stream_normals = is_streaming && out_normals != nullptr && rtm_impl::is_aligned_to(out_normals, 16);
+
+		for (size_t tile_start = 0; tile_start < num_vertices; tile_start += rtm_impl::k_skinning_tile_size)
+		{
+			const size_t num_remaining = num_vertices - tile_start;
+			const size_t tile_size = num_remaining >= rtm_impl::k_skinning_tile_size ? rtm_impl::k_skinning_tile_size : num_remaining;
+
+			const uint16_t* tile_bone_indices = bone_indices + tile_start * num_influences;
+			const float* tile_bone_weights = bone_weights + tile_start * num_influences;
+			for (size_t vertex_index = 0; vertex_index < tile_size; ++vertex_index)
+			{
+				if (prefetch_distance != 0 && tile_start + vertex_index + prefetch_distance < num_vertices)
+					rtm_impl::skinning_prefetch_palette<num_influences>(palette, tile_bone_indices + (vertex_index + prefetch_distance) * num_influences);
+
+				const dualquatf blended_dq = rtm_impl::skinning_blend_dualquat<num_influences>(palette, tile_bone_indices + vertex_index * num_influences, tile_bone_weights + vertex_index * num_influences);
+				const dualquatf normalized_dq = dualquat_normalize(blended_dq);
+				blended_rotations[vertex_index] = dualquat_get_rotation(normalized_dq);
+				blended_translations[vertex_index] = dualquat_get_translation(normalized_dq);
+			}
+
+			size_t vertex_index = 0;
+			if (stream_positions)
+			{
+				for (; vertex_index + 4 <= tile_size; vertex_index += 4)
+				{
+					const float3f* group_positions = positions + tile_start + vertex_index;
+					const quatf* group_rotations = blended_rotations + vertex_index;
+					const vector4f* group_translations = blended_translations + vertex_index;
+					rtm_impl::skinning_store_stream3_x4(
+						vector_add(quat_mul_vector3(vector_load3(group_positions + 0), group_rotations[0]), group_translations[0]),
+						vector_add(quat_mul_vector3(vector_load3(group_positions + 1), group_rotations[1]), group_translations[1]),
+						vector_add(quat_mul_vector3(vector_load3(group_positions + 2), group_rotations[2]), group_translations[2]),
+						vector_add(quat_mul_vector3(vector_load3(group_positions + 3), group_rotations[3]), group_translations[3]),
+						out_positions + tile_start + vertex_index);
+				}
+			}
+
+			for (; vertex_index < tile_size; ++vertex_index)
+			{
+				const vector4f position = vector_load3(positions + tile_start + vertex_index);
+				const vector4f skinned_position = vector_add(quat_mul_vector3(position, blended_rotations[vertex_index]), blended_translations[vertex_index]);
+				vector_store3(skinned_position, out_positions + tile_start + vertex_index);
+			}
+
+			if (normals != nullptr)
+			{
+				vertex_index = 0;
+				if (stream_normals)
+				{
+					for (; vertex_index + 4 <= tile_size; vertex_index += 4)
+					{
+						const float3f* group_normals = normals + tile_start + vertex_index;
+						const quatf* group_rotations = blended_rotations + vertex_index;
+						rtm_impl::skinning_store_stream3_x4(
+							quat_mul_vector3(vector_load3(group_normals + 0), group_rotations[0]),
+							quat_mul_vector3(vector_load3(group_normals + 1), group_rotations[1]),
+							quat_mul_vector3(vector_load3(group_normals + 2), group_rotations[2]),
+							quat_mul_vector3(vector_load3(group_normals + 3), group_rotations[3]),
+							out_normals + tile_start + vertex_index);
+					}
+				}
+
+				for (; vertex_index < tile_size; ++vertex_index)
+				{
+					const vector4f normal = vector_load3(normals + tile_start + vertex_index);
+					vector_store3(quat_mul_vector3(normal, blended_rotations[vertex_index]), out_normals + tile_start + vertex_index);
+				}
+			}
+		}
+
+		if (is_streaming)
+			rtm_impl::memory_stream_fence();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Skins vertices with linear blend skinning and 4 influences per vertex.
+	// See skin_linear_blend(..) for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline void skin_linear_blend4(const matrix3x4f* palette, const uint16_t* bone_indices, const float* bone_weights,
+		const float3f* positions, const float3f* normals,
+		float3f* out_positions, float3f* out_normals, size_t num_vertices, store_mode mode = store_mode::cached,
+		size_t prefetch_distance = k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		skin_linear_blend<4>(palette, bone_indices, bone_weights, positions, normals, out_positions, out_normals, num_vertices, mode, prefetch_distance);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Skins vertices with linear blend skinning and 8 influences per vertex.
+	// See skin_linear_blend(..) for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline void skin_linear_blend8(const matrix3x4f* palette, const uint16_t* bone_indices, const float* bone_weights,
+		const float3f* positions, const float3f* normals,
+		float3f* out_positions, float3f* out_normals, size_t num_vertices, store_mode mode = store_mode::cached,
+		size_t prefetch_distance = k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		skin_linear_blend<8>(palette, bone_indices, bone_weights, positions, normals, out_positions, out_normals, num_vertices, mode, prefetch_distance);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Skins vertices with dual quaternion skinning and 4 influences per vertex.
+	// See skin_dual_quat(..) for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline void skin_dual_quat4(const dualquatf* palette, const uint16_t* bone_indices, const float* bone_weights,
+		const float3f* positions, const float3f* normals,
+		float3f* out_positions, float3f* out_normals, size_t num_vertices, store_mode mode = store_mode::cached,
+		size_t prefetch_distance = k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		skin_dual_quat<4>(palette, bone_indices, bone_weights, positions, normals, out_positions, out_normals, num_vertices, mode, prefetch_distance);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Skins vertices with dual quaternion skinning and 8 influences per vertex.
+	// See skin_dual_quat(..) for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline void skin_dual_quat8(const dualquatf* palette, const uint16_t* bone_indices, const float* bone_weights,
+		const float3f* positions, const float3f* normals,
+		float3f* out_positions, float3f* out_normals, size_t num_vertices, store_mode mode = store_mode::cached,
+		size_t prefetch_distance = k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		skin_dual_quat<8>(palette, bone_indices, bone_weights, positions, normals, out_positions, out_normals, num_vertices, mode, prefetch_distance);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,345 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "rtm/arena_allocator.h"
+#include "rtm/math.h"
+#include "rtm/matrix3x4f.h"
+#include "rtm/quatf.h"
+#include "rtm/qvvf.h"
+#include "rtm/qvvf_x4.h"
+#include "rtm/qvvf_x8.h"
+#include "rtm/scalarf_x8.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/error.h"
+#include "rtm/impl/memory_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// An array of values stored as a structure of arrays: every float component
+	// (e.g. the rotation [x] of a qvvf) lives in its own contiguous stream.
+	// Every stream starts on a cache line and is padded to a multiple of 16 values,
+	// which is a multiple of every SIMD width. Batch kernels can thus process the
+	// padded size 4 or 8 values at a time without any tail handling.
+	// Padding values are initialized to the identity so they remain well formed.
+	// The memory is owned by the arena the array was allocated from.
+	// Supported value types: qvvf, matrix3x4f
+	//////////////////////////////////////////////////////////////////////////
+	template<typename value_type>
+	struct soa_array
+	{
+		float*		streams;
+		size_t		size;
+		size_t		stride;		// Number of values in each stream, including the padding
+	};
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Describes how a value type is split into component streams.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename value_type>
+		struct soa_traits;
+
+		template<>
+		struct soa_traits<qvvf>
+		{
+			// Rotation [xyzw], translation [xyz], scale [xyz]
+			static constexpr size_t k_num_components = 10;
+
+			static qvvf get_identity() RTM_NO_EXCEPT { return qvv_identity(); }
+
+			static qvvf read(const float* streams, size_t stride, size_t index) RTM_NO_EXCEPT
+			{
+				const quatf rotation = quat_set(streams[index], streams[stride + index], streams[stride * 2 + index], streams[stride * 3 + index]);
+				const vector4f translation = vector_set(streams[stride * 4 + index], streams[stride * 5 + index], streams[stride * 6 + index]);
+				const vector4f scale = vector_set(streams[stride * 7 + index], streams[stride * 8 + index], streams[stride * 9 + index]);
+				return qvv_set(rotation, translation, scale);
+			}
+
+			static void write(qvvf_arg0 value, float* streams, size_t stride, size_t index) RTM_NO_EXCEPT
+			{
+				streams[index] = quat_get_x(value.rotation);
+				streams[stride + index] = quat_get_y(value.rotation);
+				streams[stride * 2 + index] = quat_get_z(value.rotation);
+				streams[stride * 3 + index] = quat_get_w(value.rotation);
+				streams[stride * 4 + index] = vector_get_x(value.translation);
+				streams[stride * 5 + index] = vector_get_y(value.translation);
+				streams[stride * 6 + index] = vector_get_z(value.translation);
+				streams[stride * 7 + index] = vector_get_x(value.scale);
+				streams[stride * 8 + index] = vector_get_y(value.scale);
+				streams[stride * 9 + index] = vector_get_z(value.scale);
+			}
+		};
+
+		template<>
+		struct soa_traits<matrix3x4f>
+		{
+			// The [xyz] components of the 4 axes
+			static constexpr size_t k_num_components = 12;
+
+			static matrix3x4f get_identity() RTM_NO_EXCEPT { return matrix_identity(); }
+
+			static matrix3x4f read(const float* streams, size_t stride, size_t index) RTM_NO_EXCEPT
+			{
+				vector4f axes[4];
+				for (size_t axis_index = 0; axis_index < 4; ++axis_index)
+				{
+					const float* axis_streams = streams + stride * 3 * axis_index;
+					axes[axis_index] = vector_set(axis_streams[index], axis_streams[stride + index], axis_streams[stride * 2 + index], axis_index == 3 ? 1.0f : 0.0f);
+				}
+
+				return matrix_set(axes[0], axes[1], axes[2], axes[3]);
+			}
+
+			static void write(matrix3x4f_arg0 value, float* streams, size_t stride, size_t index) RTM_NO_EXCEPT
+			{
+				const vector4f axes[4] = { value.x_axis, value.y_axis, value.z_axis, value.w_axis };
+				for (size_t axis_index = 0; axis_index < 4; ++axis_index)
+				{
+					float* axis_streams = streams + stride * 3 * axis_index;
+					axis_streams[index] = vector_get_x(axes[axis_index]);
+					axis_streams[stride + index] = vector_get_y(axes[axis_index]);
+					axis_streams[stride * 2 + index] = vector_get_z(axes[axis_index]);
+				}
+			}
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// The streams are padded to a full cache line of floats.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr size_t k_soa_array_padding = k_cache_line_size / sizeof(float);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Allocates an array of the specified size from an arena.
+	// Its values are uninitialized, except for the padding which is set to the identity.
+	// If the arena does not have enough space left, the returned array is empty and its streams are null.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename value_type>
+	inline soa_array<value_type> soa_array_allocate(arena_allocator& arena, size_t size) RTM_NO_EXCEPT
+	{
+		using traits = rtm_impl::soa_traits<value_type>;
+
+		const size_t stride = rtm_impl::align_to(size, rtm_impl::k_soa_array_padding);
+		float* streams = static_cast<float*>(arena_allocate(arena, stride * traits::k_num_components * sizeof(float), rtm_impl::k_cache_line_size));
+		if (streams == nullptr)
+			return soa_array<value_type>{ nullptr, 0, 0 };
+
+		const value_type identity = traits::get_identity();
+		for (size_t index = size; index < stride; ++index)
+			traits::write(identity, streams, stride, index);
+
+		return soa_array<value_type>{ streams, size, stride };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the stream of a component. Each stream holds array.stride floats.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename value_type>
+	inline float* soa_array_get_stream(const soa_array<value_type>& array, size_t component_index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(component_index < rtm_impl::soa_traits<value_type>::k_num_components, "Invalid component index");
+		return array.streams + array.stride * component_index;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the value at the specified index.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename value_type>
+	inline value_type soa_array_get(const soa_array<value_type>& array, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index < array.stride, "Invalid array index");
+		return rtm_impl::soa_traits<value_type>::read(array.streams, array.stride, index);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Sets the value at the specified index.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename value_type>
+	inline void soa_array_set(soa_array<value_type>& array, size_t index, const value_type& value) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index < array.stride, "Invalid array index");
+		rtm_impl::soa_traits<value_type>::write(value, array.streams, array.stride, index);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 4 consecutive QVV transforms starting at the specified index, one transform per lane.
+	// No transpose is required. The padding can be read: index + 4 <= array.stride
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf_x4 RTM_SIMD_CALL qvv_load_x4(const soa_array<qvvf>& array, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index + 4 <= array.stride, "Invalid array index");
+		const float* streams = array.streams + index;
+		const size_t stride = array.stride;
+		const quatf_x4 rotation{ vector_load(streams), vector_load(streams + stride), vector_load(streams + stride * 2), vector_load(streams + stride * 3) };
+		const vector3f_x4 translation{ vector_load(streams + stride * 4), vector_load(streams + stride * 5), vector_load(streams + stride * 6) };
+		const vector3f_x4 scale{ vector_load(streams + stride * 7), vector_load(streams + stride * 8), vector_load(streams + stride * 9) };
+		return qvvf_x4{ rotation, translation, scale };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 8 consecutive QVV transforms starting at the specified index, one transform per lane.
+	// No transpose is required. The padding can be read: index + 8 <= array.stride
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf_x8 RTM_SIMD_CALL qvv_load_x8(const soa_array<qvvf>& array, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index + 8 <= array.stride, "Invalid array index");
+		const float* streams = array.streams + index;
+		const size_t stride = array.stride;
+		const quatf_x8 rotation{ scalar_load_x8(streams), scalar_load_x8(streams + stride), scalar_load_x8(streams + stride * 2), scalar_load_x8(streams + stride * 3) };
+		const vector3f_x8 translation{ scalar_load_x8(streams + stride * 4), scalar_load_x8(streams + stride * 5), scalar_load_x8(streams + stride * 6) };
+		const vector3f_x8 scale{ scalar_load_x8(streams + stride * 7), scalar_load_x8(streams + stride * 8), scalar_load_x8(streams + stride * 9) };
+		return qvvf_x8{ rotation, translation, scale };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes 4 QVV transforms to consecutive indices starting at the specified index.
+	// The padding can be written: index + 4 <= array.stride
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL qvv_store_x4(const qvvf_x4& input, soa_array<qvvf>& array, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index + 4 <= array.stride, "Invalid array index");
+		float* streams = array.streams + index;
+		const size_t stride = array.stride;
+		vector_store(input.rotation.x, streams);
+		vector_store(input.rotation.y, streams + stride);
+		vector_store(input.rotation.z, streams + stride * 2);
+		vector_store(input.rotation.w, streams + stride * 3);
+		vector_store(input.translation.x, streams + stride * 4);
+		vector_store(input.translation.y, streams + stride * 5);
+		vector_store(input.translation.z, streams + stride * 6);
+		vector_store(input.scale.x, streams + stride * 7);
+		vector_store(input.scale.y, streams + stride * 8);
+		vector_store(input.scale.z, streams + stride * 9);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes 8 QVV transforms to consecutive indices starting at the specified index.
+	// The padding can be written: index + 8 <= array.stride
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL qvv_store_x8(const qvvf_x8& input, soa_array<qvvf>& array, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index + 8 <= array.stride, "Invalid array index");
+		float* streams = array.streams + index;
+		const size_t stride = array.stride;
+		scalar_store_x8(input.rotation.x, streams);
+		scalar_store_x8(input.rotation.y, streams + stride);
+		scalar_store_x8(input.rotation.z, streams + stride * 2);
+		scalar_store_x8(input.rotation.w, streams + stride * 3);
+		scalar_store_x8(input.translation.x, streams + stride * 4);
+		scalar_store_x8(input.translation.y, streams + stride * 5);
+		scalar_store_x8(input.translation.z, streams + stride * 6);
+		scalar_store_x8(input.scale.x, streams + stride * 7);
+		scalar_store_x8(input.scale.y, streams + stride * 8);
+		scalar_store_x8(input.scale.z, streams + stride * 9);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 4 consecutive affine matrices starting at the specified index, one matrix per lane.
+	// No transpose is required. The padding can be read: index + 4 <= array.stride
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x4f_x4 RTM_SIMD_CALL matrix_load_x4(const soa_array<matrix3x4f>& array, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index + 4 <= array.stride, "Invalid array index");
+		const float* streams = array.streams + index;
+		const size_t stride = array.stride;
+		const vector3f_x4 x_axis{ vector_load(streams), vector_load(streams + stride), vector_load(streams + stride * 2) };
+		const vector3f_x4 y_axis{ vector_load(streams + stride * 3), vector_load(streams + stride * 4), vector_load(streams + stride * 5) };
+		const vector3f_x4 z_axis{ vector_load(streams + stride * 6), vector_load(streams + stride * 7), vector_load(streams + stride * 8) };
+		const vector3f_x4 w_axis{ vector_load(streams + stride * 9), vector_load(streams + stride * 10), vector_load(streams + stride * 11) };
+		return matrix3x4f_x4{ x_axis, y_axis, z_axis, w_axis };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 8 consecutive affine matrices starting at the specified index, one matrix per lane.
+	// No transpose is required. The padding can be read: index + 8 <= array.stride
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x4f_x8 RTM_SIMD_CALL matrix_load_x8(const soa_array<matrix3x4f>& array, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index + 8 <= array.stride, "Invalid array index");
+		const float* streams = array.streams + index;
+		const size_t stride = array.stride;
+		const vector3f_x8 x_axis{ scalar_load_x8(streams), scalar_load_x8(streams + stride), scalar_load_x8(streams + stride * 2) };
+		const vector3f_x8 y_axis{ scalar_load_x8(streams + stride * 3), scalar_load_x8(streams + stride * 4), scalar_load_x8(streams + stride * 5) };
+		const vector3f_x8 z_axis{ scalar_load_x8(streams + stride * 6), scalar_load_x8(streams + stride * 7), scalar_load_x8(streams + stride * 8) };
+		const vector3f_x8 w_axis{ scalar_load_x8(streams + stride * 9), scalar_load_x8(streams + stride * 10), scalar_load_x8(streams + stride * 11) };
+		return matrix3x4f_x8{ x_axis, y_axis, z_axis, w_axis };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes 4 affine matrices to consecutive indices starting at the specified index.
+	// The padding can be written: index + 4 <= array.stride
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL matrix_store_x4(const matrix3x4f_x4& input, soa_array<matrix3x4f>& array, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index + 4 <= array.stride, "Invalid array index");
+		float* streams = array.streams + index;
+		const size_t stride = array.stride;
+		vector_store(input.x_axis.x, streams);
+		vector_store(input.x_axis.y, streams + stride);
+		vector_store(input.x_axis.z, streams + stride * 2);
+		vector_store(input.y_axis.x, streams + stride * 3);
+		vector_store(input.y_axis.y, streams + stride * 4);
+		vector_store(input.y_axis.z, streams + stride * 5);
+		vector_store(input.z_axis.x, streams + stride * 6);
+		vector_store(input.z_axis.y, streams + stride * 7);
+		vector_store(input.z_axis.z, streams + stride * 8);
+		vector_store(input.w_axis.x, streams + stride * 9);
+		vector_store(input.w_axis.y, streams + stride * 10);
+		vector_store(input.w_axis.z, streams + stride * 11);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes 8 affine matrices to consecutive indices starting at the specified index.
+	// The padding can be written: index + 8 <= array.stride
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL matrix_store_x8(const matrix3x4f_x8& input, soa_array<matrix3x4f>& array, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index + 8 <= array.stride, "Invalid array index");
+		float* streams = array.streams + index;
+		const size_t stride = array.stride;
+		scalar_store_x8(input.x_axis.x, streams);
+		scalar_store_x8(input.x_axis.y, streams + stride);
+		scalar_store_x8(input.x_axis.z, streams + stride * 2);
+		scalar_store_x8(input.y_axis.x, streams + stride * 3);
+		scalar_store_x8(input.y_axis.y, streams + stride * 4);
+		scalar_store_x8(input.y_axis.z, streams + stride * 5);
+		scalar_store_x8(input.z_axis.x, streams + stride * 6);
+		scalar_store_x8(input.z_axis.y, streams + stride * 7);
+		scalar_store_x8(input.z_axis.z, streams + stride * 8);
+		scalar_store_x8(input.w_axis.x, streams + stride * 9);
+		scalar_store_x8(input.w_axis.y, streams + stride * 10);
+		scalar_store_x8(input.w_axis.z, streams + stride * 11);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,353 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "rtm/math.h"
+#include "rtm/quatf.h"
+#include "rtm/quatf_x4.h"
+#include "rtm/qvvf.h"
+#include "rtm/qvvf_x4.h"
+#include "rtm/vector3f_x4.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/error.h"
+#include "rtm/impl/soa_common.h"
+
+#include <cstddef>
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// A view over values that are not contiguous in memory, typically a member of
+	// a larger structure: value[i] lives at (data + stride * i) where the stride is in bytes.
+	// The memory is owned by the caller and batch functions can read and write it in place.
+	// Use strided_span<const value_type> for read only views.
+	// The values are loaded and stored with unaligned instructions, the stride does not
+	// need to be a multiple of the value alignment.
+	// Vectors and quaternions are viewed as float4f since the SIMD types cannot be
+	// used as template arguments (and vector4f and quatf can be the same type).
+	// A float4f view writes 16 bytes per value, 3D vectors stored as 3 floats must
+	// use a float3f view instead or the next member would be overwritten.
+	// Supported value types: qvvf, float4f, float3f
+	//////////////////////////////////////////////////////////////////////////
+	template<typename value_type>
+	struct strided_span
+	{
+		value_type*	data;
+		size_t		stride;		// Number of bytes between consecutive values
+		size_t		size;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a view over 'size' values separated by 'stride' bytes, starting at 'data'.
+	// e.g. strided_span_create(&components[0].transform, sizeof(component), num_components)
+	//////////////////////////////////////////////////////////////////////////
+	template<typename value_type>
+	inline strided_span<value_type> strided_span_create(value_type* data, size_t stride, size_t size) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(data != nullptr || size == 0, "Invalid span data");
+		return strided_span<value_type>{ data, stride, size };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a view over a contiguous array.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename value_type>
+	inline strided_span<value_type> strided_span_create(value_type* data, size_t size) RTM_NO_EXCEPT
+	{
+		return strided_span_create(data, sizeof(value_type), size);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a read only view over the same values.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename value_type>
+	inline strided_span<const value_type> strided_span_to_const(const strided_span<value_type>& span) RTM_NO_EXCEPT
+	{
+		return strided_span<const value_type>{ span.data, span.stride, span.size };
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the address of the value at the specified index as a pointer to its floats.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename value_type>
+		inline const float* strided_span_get_floats(const strided_span<value_type>& span, size_t index) RTM_NO_EXCEPT
+		{
+			return reinterpret_cast<const float*>(reinterpret_cast<uintptr_t>(span.data) + span.stride * index);
+		}
+
+		template<typename value_type>
+		inline float* strided_span_get_mutable_floats(const strided_span<value_type>& span, size_t index) RTM_NO_EXCEPT
+		{
+			return reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(span.data) + span.stride * index);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Asserts that the inputs hold at least as many values as the output.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename input_type, typename output_type>
+		inline void strided_span_check_sizes(const strided_span<input_type>& input, const strided_span<output_type>& output) RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(input.size >= output.size, "Input span is smaller than the output span");
+			(void)input;
+			(void)output;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads the vector at the specified index.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_load(const strided_span<const float4f>& span, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index < span.size, "Invalid span index");
+		return vector_load(rtm_impl::strided_span_get_floats(span, index));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes the vector at the specified index.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_store(vector4f_arg0 input, const strided_span<float4f>& span, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index < span.size, "Invalid span index");
+		vector_store(input, rtm_impl::strided_span_get_mutable_floats(span, index));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads the 3D vector at the specified index and leaves the [w] component undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_load3(const strided_span<const float3f>& span, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index < span.size, "Invalid span index");
+		return vector_load3(rtm_impl::strided_span_get_floats(span, index));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes the [xyz] components of the vector at the specified index.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_store3(vector4f_arg0 input, const strided_span<float3f>& span, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index < span.size, "Invalid span index");
+		vector_store3(input, rtm_impl::strided_span_get_mutable_floats(span, index));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads the quaternion at the specified index.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf RTM_SIMD_CALL quat_load(const strided_span<const float4f>& span, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index < span.size, "Invalid span index");
+		return vector_to_quat(vector_load(rtm_impl::strided_span_get_floats(span, index)));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes the quaternion at the specified index.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL quat_store(quatf_arg0 input, const strided_span<float4f>& span, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index < span.size, "Invalid span index");
+		vector_store(quat_to_vector(input), rtm_impl::strided_span_get_mutable_floats(span, index));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads the QVV transform at the specified index.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf RTM_SIMD_CALL qvv_load(const strided_span<const qvvf>& span, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index < span.size, "Invalid span index");
+		const float* floats = rtm_impl::strided_span_get_floats(span, index);
+		return qvv_set(vector_to_quat(vector_load(floats + 0)), vector_load(floats + 4), vector_load(floats + 8));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes the QVV transform at the specified index.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL qvv_store(qvvf_arg0 input, const strided_span<qvvf>& span, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index < span.size, "Invalid span index");
+		float* floats = rtm_impl::strided_span_get_mutable_floats(span, index);
+		vector_store(quat_to_vector(input.rotation), floats + 0);
+		vector_store(input.translation, floats + 4);
+		vector_store(input.scale, floats + 8);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 4 consecutive 3D vectors of the span starting at the specified index and transposes them, one vector per lane.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x4 RTM_SIMD_CALL vector_load3_x4(const strided_span<const float4f>& span, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index + 4 <= span.size, "Invalid span index");
+		vector3f_x4 result;
+		vector4f w;
+		rtm_impl::transpose_4x4(vector_load(span, index + 0), vector_load(span, index + 1), vector_load(span, index + 2), vector_load(span, index + 3), result.x, result.y, result.z, w);
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transposes the 4 lanes back into 3D vectors and writes them to the span starting at the specified index.
+	// Note: The [w] component of every output vector is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_store3_x4(const vector3f_x4& input, const strided_span<float4f>& span, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index + 4 <= span.size, "Invalid span index");
+		vector4f output0;
+		vector4f output1;
+		vector4f output2;
+		vector4f output3;
+		rtm_impl::transpose_4x4(input.x, input.y, input.z, input.z, output0, output1, output2, output3);
+
+		vector_store(output0, span, index + 0);
+		vector_store(output1, span, index + 1);
+		vector_store(output2, span, index + 2);
+		vector_store(output3, span, index + 3);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 4 consecutive 3D vectors of the span starting at the specified index and transposes them, one vector per lane.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x4 RTM_SIMD_CALL vector_load3_x4(const strided_span<const float3f>& span, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index + 4 <= span.size, "Invalid span index");
+		vector3f_x4 result;
+		vector4f w;
+		rtm_impl::transpose_4x4(vector_load3(span, index + 0), vector_load3(span, index + 1), vector_load3(span, index + 2), vector_load3(span, index + 3), result.x, result.y, result.z, w);
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transposes the 4 lanes back into 3D vectors and writes their [xyz] components to the span starting at the specified index.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_store3_x4(const vector3f_x4& input, const strided_span<float3f>& span, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index + 4 <= span.size, "Invalid span index");
+		vector4f output0;
+		vector4f output1;
+		vector4f output2;
+		vector4f output3;
+		rtm_impl::transpose_4x4(input.x, input.y, input.z, input.z, output0, output1, output2, output3);
+
+		vector_store3(output0, span, index + 0);
+		vector_store3(output1, span, index + 1);
+		vector_store3(output2, span, index + 2);
+		vector_store3(output3, span, index + 3);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 4 consecutive quaternions of the span starting at the specified index and transposes them, one quaternion per lane.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf_x4 RTM_SIMD_CALL quat_load_x4(const strided_span<const float4f>& span, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index + 4 <= span.size, "Invalid span index");
+		const float* floats0 = rtm_impl::strided_span_get_floats(span, index + 0);
+		const float* floats1 = rtm_impl::strided_span_get_floats(span, index + 1);
+		const float* floats2 = rtm_impl::strided_span_get_floats(span, index + 2);
+		const float* floats3 = rtm_impl::strided_span_get_floats(span, index + 3);
+
+		quatf_x4 result;
+		rtm_impl::transpose_4x4(vector_load(floats0), vector_load(floats1), vector_load(floats2), vector_load(floats3), result.x, result.y, result.z, result.w);
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transposes the 4 lanes back into quaternions and writes them to the span starting at the specified index.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL quat_store_x4(const quatf_x4& input, const strided_span<float4f>& span, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index + 4 <= span.size, "Invalid span index");
+		vector4f output0;
+		vector4f output1;
+		vector4f output2;
+		vector4f output3;
+		rtm_impl::transpose_4x4(input.x, input.y, input.z, input.w, output0, output1, output2, output3);
+
+		vector_store(output0, rtm_impl::strided_span_get_mutable_floats(span, index + 0));
+		vector_store(output1, rtm_impl::strided_span_get_mutable_floats(span, index + 1));
+		vector_store(output2, rtm_impl::strided_span_get_mutable_floats(span, index + 2));
+		vector_store(output3, rtm_impl::strided_span_get_mutable_floats(span, index + 3));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 4 consecutive QVV transforms of the span starting at the specified index and transposes them, one transform per lane.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf_x4 RTM_SIMD_CALL qvv_load_x4(const strided_span<const qvvf>& span, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index + 4 <= span.size, "Invalid span index");
+		// A qvvf is 12 floats: rotation [0, 4), translation [4, 8), scale [8, 12)
+		const float* floats0 = rtm_impl::strided_span_get_floats(span, index + 0);
+		const float* floats1 = rtm_impl::strided_span_get_floats(span, index + 1);
+		const float* floats2 = rtm_impl::strided_span_get_floats(span, index + 2);
+		const float* floats3 = rtm_impl::strided_span_get_floats(span, index + 3);
+
+		qvvf_x4 result;
+		vector4f w;
+		rtm_impl::transpose_4x4(vector_load(floats0 + 0), vector_load(floats1 + 0), vector_load(floats2 + 0), vector_load(floats3 + 0),
+			result.rotation.x, result.rotation.y, result.rotation.z, result.rotation.w);
+		rtm_impl::transpose_4x4(vector_load(floats0 + 4), vector_load(floats1 + 4), vector_load(floats2 + 4), vector_load(floats3 + 4),
+			result.translation.x, result.translation.y, result.translation.z, w);
+		rtm_impl::transpose_4x4(vector_load(floats0 + 8), vector_load(floats1 + 8), vector_load(floats2 + 8), vector_load(floats3 + 8),
+			result.scale.x, result.scale.y, result.scale.z, w);
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transposes the 4 lanes back into QVV transforms and writes them to the span starting at the specified index.
+	// Note: The [w] component of every output translation and scale is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL qvv_store_x4(const qvvf_x4& input, const strided_span<qvvf>& span, size_t index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(index + 4 <= span.size, "Invalid span index");
+		float* floats0 = rtm_impl::strided_span_get_mutable_floats(span, index + 0);
+		float* floats1 = rtm_impl::strided_span_get_mutable_floats(span, index + 1);
+		float* floats2 = rtm_impl::strided_span_get_mutable_floats(span, index + 2);
+		float* floats3 = rtm_impl::strided_span_get_mutable_floats(span, index + 3);
+
+		vector4f output0;
+		vector4f output1;
+		vector4f output2;
+		vector4f output3;
+		rtm_impl::transpose_4x4(input.rotation.x, input.rotation.y, input.rotation.z, input.rotation.w, output0, output1, output2, output3);
+		vector_store(output0, floats0 + 0);
+		vector_store(output1, floats1 + 0);
+		vector_store(output2, floats2 + 0);
+		vector_store(output3, floats3 + 0);
+
+		rtm_impl::transpose_4x4(input.translation.x, input.translation.y, input.translation.z, input.translation.z, output0, output1, output2, output3);
+		vector_store(output0, floats0 + 4);
+		vector_store(output1, floats1 + 4);
+		vector_store(output2, floats2 + 4);
+		vector_store(output3, floats3 + 4);
+
+		rtm_impl::transpose_4x4(input.scale.x, input.scale.y, input.scale.z, input.scale.z, output0, output1, output2, output3);
+		vector_store(output0, floats0 + 8);
+		vector_store(output1, floats1 + 8);
+		vector_store(output2, floats2 + 8);
+		vector_store(output3, floats3 + 8);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
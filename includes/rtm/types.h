@@ -29,6 +29,15 @@
 
 #include <cstdint>
 
+//////////////////////////////////////////////////////////////////////////
+// How many elements ahead (bones, vertices) the functions that walk large arrays
+// prefetch the memory they reach through indices, see k_default_prefetch_distance.
+// Define it before including RTM to tune it for a platform, 0 disables software prefetching.
+//////////////////////////////////////////////////////////////////////////
+#if !defined(RTM_DEFAULT_PREFETCH_DISTANCE)
+	#define RTM_DEFAULT_PREFETCH_DISTANCE 8
+#endif
+
 namespace rtm
 {
 #if defined(RTM_SSE2_INTRINSICS)
@@ -42,11 +51,15 @@ namespace rtm
 	// A quaternion (4D complex number) where the imaginary part is the [w] component.
 	// It accurately represents a 3D rotation with no gimbal lock as long as it is kept normalized.
 	//////////////////////////////////////////////////////////////////////////
+#if defined(RTM_AVX_INTRINSICS)
+	using quatd = __m256d;
+#else
 	struct quatd
 	{
 		__m128d xy;
 		__m128d zw;
 	};
+#endif
 
 	//////////////////////////////////////////////////////////////////////////
 	// A 4D vector.
@@ -56,11 +69,15 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// A 4D vector.
 	//////////////////////////////////////////////////////////////////////////
+#if defined(RTM_AVX_INTRINSICS)
+	using vector4d = __m256d;
+#else
 	struct vector4d
 	{
 		__m128d xy;
 		__m128d zw;
 	};
+#endif
 
 	//////////////////////////////////////////////////////////////////////////
 	// A 4x32 bit vector comparison mask: ~0 if true, 0 otherwise.
@@ -70,11 +87,15 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// A 4x64 bit vector comparison mask: ~0 if true, 0 otherwise.
 	//////////////////////////////////////////////////////////////////////////
+#if defined(RTM_AVX_INTRINSICS)
+	using mask4q = __m256d;
+#else
 	struct mask4q
 	{
 		__m128d xy;
 		__m128d zw;
 	};
+#endif
 #elif defined(RTM_NEON_INTRINSICS)
 	//////////////////////////////////////////////////////////////////////////
 	// A quaternion (4D complex number) where the imaginary part is the [w] component.
@@ -86,6 +107,13 @@ namespace rtm
 	// A quaternion (4D complex number) where the imaginary part is the [w] component.
 	// It accurately represents a 3D rotation with no gimbal lock as long as it is kept normalized.
 	//////////////////////////////////////////////////////////////////////////
+#if defined(RTM_NEON64_INTRINSICS)
+	struct quatd
+	{
+		float64x2_t xy;
+		float64x2_t zw;
+	};
+#else
 	struct alignas(16) quatd
 	{
 		double x;
@@ -93,6 +121,7 @@ namespace rtm
 		double z;
 		double w;
 	};
+#endif
 
 	//////////////////////////////////////////////////////////////////////////
 	// A 4D vector.
@@ -102,6 +131,13 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// A 4D vector.
 	//////////////////////////////////////////////////////////////////////////
+#if defined(RTM_NEON64_INTRINSICS)
+	struct vector4d
+	{
+		float64x2_t xy;
+		float64x2_t zw;
+	};
+#else
 	struct alignas(16) vector4d
 	{
 		double x;
@@ -109,6 +145,7 @@ namespace rtm
 		double z;
 		double w;
 	};
+#endif
 
 	//////////////////////////////////////////////////////////////////////////
 	// A 4x32 bit vector comparison mask: ~0 if true, 0 otherwise.
@@ -118,6 +155,13 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// A 4x64 bit vector comparison mask: ~0 if true, 0 otherwise.
 	//////////////////////////////////////////////////////////////////////////
+#if defined(RTM_NEON64_INTRINSICS)
+	struct mask4q
+	{
+		uint64x2_t xy;
+		uint64x2_t zw;
+	};
+#else
 	struct mask4q
 	{
 		uint64_t x;
@@ -125,6 +169,7 @@ namespace rtm
 		uint64_t z;
 		uint64_t w;
 	};
+#endif
 #else
 	//////////////////////////////////////////////////////////////////////////
 	// A quaternion (4D complex number) where the imaginary part is the [w] component.
@@ -279,6 +324,55 @@ namespace rtm
 		vector4d	scale;
 	};
 
+	//////////////////////////////////////////////////////////////////////////
+	// A unit dual quaternion represents a rigid 3D transform: a 3D rotation (real part)
+	// and a 3D translation (encoded in the dual part as 0.5 * translation * rotation).
+	// Unlike a QVV transform, it does not support 3D scale.
+	// Blending dual quaternions preserves rigidity which makes them well suited for skinning.
+	//////////////////////////////////////////////////////////////////////////
+	struct dualquatf
+	{
+		quatf		real;
+		quatf		dual;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A unit dual quaternion represents a rigid 3D transform: a 3D rotation (real part)
+	// and a 3D translation (encoded in the dual part as 0.5 * translation * rotation).
+	// Unlike a QVV transform, it does not support 3D scale.
+	// Blending dual quaternions preserves rigidity which makes them well suited for skinning.
+	//////////////////////////////////////////////////////////////////////////
+	struct dualquatd
+	{
+		quatd		real;
+		quatd		dual;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A plane is represented by its normal [xyz] and its signed distance from the origin [w]
+	// such that every point on the plane satisfies: dot3(normal, point) + distance = 0.0
+	// Points in front of the plane, in the direction of the normal, have a positive distance.
+	//////////////////////////////////////////////////////////////////////////
+	using planef = vector4f;
+
+	//////////////////////////////////////////////////////////////////////////
+	// A view frustum made of 6 planes pointing inwards, in order: left, right, bottom, top, near, far.
+	//////////////////////////////////////////////////////////////////////////
+	struct frustumf
+	{
+		planef		planes[6];
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// An axis aligned bounding box represented by its center and its half extents.
+	// Note: The [w] component of both vectors is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	struct aabbf
+	{
+		vector4f	center;
+		vector4f	extents;
+	};
+
 	//////////////////////////////////////////////////////////////////////////
 	// A generic 3x3 matrix.
 	// Note: The [w] component of every column vector is undefined.
@@ -365,6 +459,130 @@ namespace rtm
 		vector4d	w_axis;
 	};
 
+#if defined(RTM_AVX_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// A wide SIMD scalar type with 8 lanes. Each lane holds an independent value
+	// and it is used as the component type of the 8 wide structure of arrays types below.
+	//////////////////////////////////////////////////////////////////////////
+	using scalarf_x8 = __m256;
+
+	//////////////////////////////////////////////////////////////////////////
+	// A wide SIMD mask with 8 lanes, as returned by scalarf_x8 comparisons.
+	//////////////////////////////////////////////////////////////////////////
+	using mask8i = __m256;
+#else
+	//////////////////////////////////////////////////////////////////////////
+	// A wide SIMD scalar type with 8 lanes. Each lane holds an independent value
+	// and it is used as the component type of the 8 wide structure of arrays types below.
+	// Without AVX, the lanes are split into two 4 wide vectors.
+	//////////////////////////////////////////////////////////////////////////
+	struct scalarf_x8
+	{
+		vector4f	lo;
+		vector4f	hi;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A wide SIMD mask with 8 lanes, as returned by scalarf_x8 comparisons.
+	// Without AVX, the lanes are split into two 4 wide masks.
+	//////////////////////////////////////////////////////////////////////////
+	struct mask8i
+	{
+		mask4i		lo;
+		mask4i		hi;
+	};
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Four 3D vectors stored as a structure of arrays: each member holds
+	// one component of all four vectors, one vector per SIMD lane.
+	//////////////////////////////////////////////////////////////////////////
+	struct vector3f_x4
+	{
+		vector4f	x;
+		vector4f	y;
+		vector4f	z;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Eight 3D vectors stored as a structure of arrays: each member holds
+	// one component of all eight vectors, one vector per SIMD lane.
+	//////////////////////////////////////////////////////////////////////////
+	struct vector3f_x8
+	{
+		scalarf_x8	x;
+		scalarf_x8	y;
+		scalarf_x8	z;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Four quaternions stored as a structure of arrays: each member holds
+	// one component of all four quaternions, one quaternion per SIMD lane.
+	//////////////////////////////////////////////////////////////////////////
+	struct quatf_x4
+	{
+		vector4f	x;
+		vector4f	y;
+		vector4f	z;
+		vector4f	w;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Eight quaternions stored as a structure of arrays: each member holds
+	// one component of all eight quaternions, one quaternion per SIMD lane.
+	//////////////////////////////////////////////////////////////////////////
+	struct quatf_x8
+	{
+		scalarf_x8	x;
+		scalarf_x8	y;
+		scalarf_x8	z;
+		scalarf_x8	w;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Four QVV transforms stored as a structure of arrays, one transform per SIMD lane.
+	//////////////////////////////////////////////////////////////////////////
+	struct qvvf_x4
+	{
+		quatf_x4	rotation;
+		vector3f_x4	translation;
+		vector3f_x4	scale;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Eight QVV transforms stored as a structure of arrays, one transform per SIMD lane.
+	//////////////////////////////////////////////////////////////////////////
+	struct qvvf_x8
+	{
+		quatf_x8	rotation;
+		vector3f_x8	translation;
+		vector3f_x8	scale;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Four affine 3x4 matrices stored as a structure of arrays, one matrix per SIMD lane.
+	// Only the [xyz] components of each axis are stored, the [w] components are implied.
+	//////////////////////////////////////////////////////////////////////////
+	struct matrix3x4f_x4
+	{
+		vector3f_x4	x_axis;
+		vector3f_x4	y_axis;
+		vector3f_x4	z_axis;
+		vector3f_x4	w_axis;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Eight affine 3x4 matrices stored as a structure of arrays, one matrix per SIMD lane.
+	// Only the [xyz] components of each axis are stored, the [w] components are implied.
+	//////////////////////////////////////////////////////////////////////////
+	struct matrix3x4f_x8
+	{
+		vector3f_x8	x_axis;
+		vector3f_x8	y_axis;
+		vector3f_x8	z_axis;
+		vector3f_x8	w_axis;
+	};
+
 	//////////////////////////////////////////////////////////////////////////
 	// Represents a component when mixing/shuffling/permuting vectors.
 	// [xyzw] are used to refer to the first input while [abcd] refer to the second input.
@@ -393,6 +611,42 @@ namespace rtm
 		w = 3,
 	};
 
+	//////////////////////////////////////////////////////////////////////////
+	// Selects the accuracy of the approximated functions that support it.
+	// Each function documents the max error of every level.
+	//////////////////////////////////////////////////////////////////////////
+	enum class accuracy
+	{
+		low,		// Fewer polynomial terms, suitable when speed matters more than the last few digits
+		high,		// Close to full floating point precision
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Selects the clip space depth range of a projection matrix.
+	//////////////////////////////////////////////////////////////////////////
+	enum class clip_depth_range
+	{
+		zero_to_one,			// Direct3D, Metal, and Vulkan convention
+		negative_one_to_one,	// OpenGL convention
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Selects how functions that write large output buffers store their results.
+	//////////////////////////////////////////////////////////////////////////
+	enum class store_mode
+	{
+		cached,			// Regular stores, best when the output is read again soon
+		streaming,		// Non-temporal stores that bypass the cache, best for large outputs the CPU does not read again (e.g. GPU uploads)
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// The default prefetch distance of the functions that accept one, in elements.
+	// Hardware prefetchers follow linear streams but miss the targets of indirect accesses
+	// such as parent transforms and palette entries, these are prefetched in software instead.
+	// Longer distances hide more latency when memory is slow but waste bandwidth on short arrays.
+	//////////////////////////////////////////////////////////////////////////
+	constexpr uint32_t k_default_prefetch_distance = RTM_DEFAULT_PREFETCH_DISTANCE;
+
 	//////////////////////////////////////////////////////////////////////////
 	// An angle class for added type safety.
 	//////////////////////////////////////////////////////////////////////////
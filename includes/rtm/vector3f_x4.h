@@ -0,0 +1,226 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/soa_common.h"
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Setters, getters, and casts
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Replicates a 3D vector into all 4 lanes.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x4 RTM_SIMD_CALL vector_broadcast3_x4(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		return vector3f_x4{ vector_dup_x(input), vector_dup_y(input), vector_dup_z(input) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 4 consecutive 3D vectors and transposes them, one vector per lane.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x4 RTM_SIMD_CALL vector_load3_x4(const vector4f* inputs) RTM_NO_EXCEPT
+	{
+		vector3f_x4 result;
+		vector4f w;
+		rtm_impl::transpose_4x4(inputs[0], inputs[1], inputs[2], inputs[3], result.x, result.y, result.z, w);
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 4 consecutive unaligned 3D vectors and transposes them, one vector per lane.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x4 RTM_SIMD_CALL vector_load3_x4(const float3f* inputs) RTM_NO_EXCEPT
+	{
+		vector3f_x4 result;
+		vector4f w;
+		rtm_impl::transpose_4x4(vector_load3(inputs + 0), vector_load3(inputs + 1), vector_load3(inputs + 2), vector_load3(inputs + 3), result.x, result.y, result.z, w);
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transposes the 4 lanes back into 3D vectors and writes them to consecutive outputs.
+	// Note: The [w] component of every output vector is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_store3_x4(const vector3f_x4& input, vector4f* outputs) RTM_NO_EXCEPT
+	{
+		rtm_impl::transpose_4x4(input.x, input.y, input.z, input.z, outputs[0], outputs[1], outputs[2], outputs[3]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transposes the 4 lanes back into 3D vectors and writes them to consecutive unaligned outputs.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_store3_x4(const vector3f_x4& input, float3f* outputs) RTM_NO_EXCEPT
+	{
+		vector4f output0;
+		vector4f output1;
+		vector4f output2;
+		vector4f output3;
+		rtm_impl::transpose_4x4(input.x, input.y, input.z, input.z, output0, output1, output2, output3);
+
+		vector_store3(output0, outputs + 0);
+		vector_store3(output1, outputs + 1);
+		vector_store3(output2, outputs + 2);
+		vector_store3(output3, outputs + 3);
+	}
+
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Arithmetic
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane addition of the two inputs: lhs + rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x4 RTM_SIMD_CALL vector_add(const vector3f_x4& lhs, const vector3f_x4& rhs) RTM_NO_EXCEPT
+	{
+		return vector3f_x4{ vector_add(lhs.x, rhs.x), vector_add(lhs.y, rhs.y), vector_add(lhs.z, rhs.z) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane subtraction of the two inputs: lhs - rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x4 RTM_SIMD_CALL vector_sub(const vector3f_x4& lhs, const vector3f_x4& rhs) RTM_NO_EXCEPT
+	{
+		return vector3f_x4{ vector_sub(lhs.x, rhs.x), vector_sub(lhs.y, rhs.y), vector_sub(lhs.z, rhs.z) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane and per component multiplication of the two inputs: lhs * rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x4 RTM_SIMD_CALL vector_mul(const vector3f_x4& lhs, const vector3f_x4& rhs) RTM_NO_EXCEPT
+	{
+		return vector3f_x4{ vector_mul(lhs.x, rhs.x), vector_mul(lhs.y, rhs.y), vector_mul(lhs.z, rhs.z) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane multiplication of a vector with a scalar, each lane uses its own scalar: lhs * rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x4 RTM_SIMD_CALL vector_mul(const vector3f_x4& lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
+	{
+		return vector3f_x4{ vector_mul(lhs.x, rhs), vector_mul(lhs.y, rhs), vector_mul(lhs.z, rhs) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane multiplication of a vector with a scalar: lhs * rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x4 RTM_SIMD_CALL vector_mul(const vector3f_x4& lhs, float rhs) RTM_NO_EXCEPT
+	{
+		return vector_mul(lhs, vector_set(rhs));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane negation of the input: -input
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x4 RTM_SIMD_CALL vector_neg(const vector3f_x4& input) RTM_NO_EXCEPT
+	{
+		return vector3f_x4{ vector_neg(input.x), vector_neg(input.y), vector_neg(input.z) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane multiplication/addition of the three inputs: v2 + (v0 * v1)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x4 RTM_SIMD_CALL vector_mul_add(const vector3f_x4& v0, const vector3f_x4& v1, const vector3f_x4& v2) RTM_NO_EXCEPT
+	{
+		return vector3f_x4{ vector_mul_add(v0.x, v1.x, v2.x), vector_mul_add(v0.y, v1.y, v2.y), vector_mul_add(v0.z, v1.z, v2.z) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane 3D cross product: lhs x rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x4 RTM_SIMD_CALL vector_cross3(const vector3f_x4& lhs, const vector3f_x4& rhs) RTM_NO_EXCEPT
+	{
+		// cross(a, b) = (a.yzx * b.zxy) - (a.zxy * b.yzx)
+		const vector4f x = vector_neg_mul_sub(lhs.z, rhs.y, vector_mul(lhs.y, rhs.z));
+		const vector4f y = vector_neg_mul_sub(lhs.x, rhs.z, vector_mul(lhs.z, rhs.x));
+		const vector4f z = vector_neg_mul_sub(lhs.y, rhs.x, vector_mul(lhs.x, rhs.y));
+		return vector3f_x4{ x, y, z };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane 3D dot product: lhs . rhs
+	// Lane N of the result holds the dot product of lane N of the inputs.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_dot3(const vector3f_x4& lhs, const vector3f_x4& rhs) RTM_NO_EXCEPT
+	{
+		return vector_mul_add(lhs.z, rhs.z, vector_mul_add(lhs.y, rhs.y, vector_mul(lhs.x, rhs.x)));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane squared length of the 3D input.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_length_squared3(const vector3f_x4& input) RTM_NO_EXCEPT
+	{
+		return vector_dot3(input, input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane length of the 3D input.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_length3(const vector3f_x4& input) RTM_NO_EXCEPT
+	{
+		return vector_sqrt(vector_length_squared3(input));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane normalization of the 3D input.
+	// Lanes with a squared length below the threshold are set to the matching lane of the fallback.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x4 RTM_SIMD_CALL vector_normalize3(const vector3f_x4& input, const vector3f_x4& fallback, float threshold = 1.0e-8f) RTM_NO_EXCEPT
+	{
+		// Reciprocal is more accurate to normalize with
+		const vector4f len_sq = vector_length_squared3(input);
+		const mask4i is_valid = vector_greater_equal(len_sq, vector_set(threshold));
+		const vector4f inv_len = vector_sqrt_reciprocal(len_sq);
+
+		const vector4f x = vector_select(is_valid, vector_mul(input.x, inv_len), fallback.x);
+		const vector4f y = vector_select(is_valid, vector_mul(input.y, inv_len), fallback.y);
+		const vector4f z = vector_select(is_valid, vector_mul(input.z, inv_len), fallback.z);
+		return vector3f_x4{ x, y, z };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane linear interpolation of the two inputs at the specified alpha.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x4 RTM_SIMD_CALL vector_lerp(const vector3f_x4& start, const vector3f_x4& end, float alpha) RTM_NO_EXCEPT
+	{
+		const vector4f alpha_v = vector_set(alpha);
+		const vector4f x = vector_mul_add(vector_sub(end.x, start.x), alpha_v, start.x);
+		const vector4f y = vector_mul_add(vector_sub(end.y, start.y), alpha_v, start.y);
+		const vector4f z = vector_mul_add(vector_sub(end.z, start.z), alpha_v, start.z);
+		return vector3f_x4{ x, y, z };
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
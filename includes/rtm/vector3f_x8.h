@@ -0,0 +1,240 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/scalarf_x8.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/soa_common.h"
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Setters, getters, and casts
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Replicates a 3D vector into all 8 lanes.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x8 RTM_SIMD_CALL vector_broadcast3_x8(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		return vector3f_x8{ scalar_set_x8(vector_get_x(input)), scalar_set_x8(vector_get_y(input)), scalar_set_x8(vector_get_z(input)) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 8 consecutive 3D vectors and transposes them, one vector per lane.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x8 RTM_SIMD_CALL vector_load3_x8(const vector4f* inputs) RTM_NO_EXCEPT
+	{
+		vector3f_x8 result;
+		scalarf_x8 w;
+		rtm_impl::transpose_4x8(inputs[0], inputs[1], inputs[2], inputs[3], inputs[4], inputs[5], inputs[6], inputs[7], result.x, result.y, result.z, w);
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 8 consecutive unaligned 3D vectors and transposes them, one vector per lane.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x8 RTM_SIMD_CALL vector_load3_x8(const float3f* inputs) RTM_NO_EXCEPT
+	{
+		vector3f_x8 result;
+		scalarf_x8 w;
+		rtm_impl::transpose_4x8(vector_load3(inputs + 0), vector_load3(inputs + 1), vector_load3(inputs + 2), vector_load3(inputs + 3),
+			vector_load3(inputs + 4), vector_load3(inputs + 5), vector_load3(inputs + 6), vector_load3(inputs + 7),
+			result.x, result.y, result.z, w);
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transposes the 8 lanes back into 3D vectors and writes them to consecutive outputs.
+	// Note: The [w] component of every output vector is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_store3_x8(const vector3f_x8& input, vector4f* outputs) RTM_NO_EXCEPT
+	{
+		rtm_impl::transpose_8x4(input.x, input.y, input.z, input.z, outputs[0], outputs[1], outputs[2], outputs[3], outputs[4], outputs[5], outputs[6], outputs[7]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transposes the 8 lanes back into 3D vectors and writes them to consecutive unaligned outputs.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_store3_x8(const vector3f_x8& input, float3f* outputs) RTM_NO_EXCEPT
+	{
+		vector4f tmp[8];
+		vector_store3_x8(input, &tmp[0]);
+
+		for (int index = 0; index < 8; ++index)
+			vector_store3(tmp[index], outputs + index);
+	}
+
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Arithmetic
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane addition of the two inputs: lhs + rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x8 RTM_SIMD_CALL vector_add(const vector3f_x8& lhs, const vector3f_x8& rhs) RTM_NO_EXCEPT
+	{
+		return vector3f_x8{ scalar_add(lhs.x, rhs.x), scalar_add(lhs.y, rhs.y), scalar_add(lhs.z, rhs.z) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane subtraction of the two inputs: lhs - rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x8 RTM_SIMD_CALL vector_sub(const vector3f_x8& lhs, const vector3f_x8& rhs) RTM_NO_EXCEPT
+	{
+		return vector3f_x8{ scalar_sub(lhs.x, rhs.x), scalar_sub(lhs.y, rhs.y), scalar_sub(lhs.z, rhs.z) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane and per component multiplication of the two inputs: lhs * rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x8 RTM_SIMD_CALL vector_mul(const vector3f_x8& lhs, const vector3f_x8& rhs) RTM_NO_EXCEPT
+	{
+		return vector3f_x8{ scalar_mul(lhs.x, rhs.x), scalar_mul(lhs.y, rhs.y), scalar_mul(lhs.z, rhs.z) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane multiplication of a vector with a scalar, each lane uses its own scalar: lhs * rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x8 RTM_SIMD_CALL vector_mul(const vector3f_x8& lhs, const scalarf_x8& rhs) RTM_NO_EXCEPT
+	{
+		return vector3f_x8{ scalar_mul(lhs.x, rhs), scalar_mul(lhs.y, rhs), scalar_mul(lhs.z, rhs) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane multiplication of a vector with a scalar: lhs * rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x8 RTM_SIMD_CALL vector_mul(const vector3f_x8& lhs, float rhs) RTM_NO_EXCEPT
+	{
+		return vector_mul(lhs, scalar_set_x8(rhs));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane negation of the input: -input
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x8 RTM_SIMD_CALL vector_neg(const vector3f_x8& input) RTM_NO_EXCEPT
+	{
+		return vector3f_x8{ scalar_neg(input.x), scalar_neg(input.y), scalar_neg(input.z) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane and per component absolute value of the input: abs(input)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x8 RTM_SIMD_CALL vector_abs(const vector3f_x8& input) RTM_NO_EXCEPT
+	{
+		return vector3f_x8{ scalar_abs(input.x), scalar_abs(input.y), scalar_abs(input.z) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane multiplication/addition of the three inputs: v2 + (v0 * v1)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x8 RTM_SIMD_CALL vector_mul_add(const vector3f_x8& v0, const vector3f_x8& v1, const vector3f_x8& v2) RTM_NO_EXCEPT
+	{
+		return vector3f_x8{ scalar_mul_add(v0.x, v1.x, v2.x), scalar_mul_add(v0.y, v1.y, v2.y), scalar_mul_add(v0.z, v1.z, v2.z) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane multiplication/addition of the three inputs, each lane uses its own scalar: v2 + (v0 * s1)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x8 RTM_SIMD_CALL vector_mul_add(const vector3f_x8& v0, const scalarf_x8& s1, const vector3f_x8& v2) RTM_NO_EXCEPT
+	{
+		return vector3f_x8{ scalar_mul_add(v0.x, s1, v2.x), scalar_mul_add(v0.y, s1, v2.y), scalar_mul_add(v0.z, s1, v2.z) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane 3D cross product: lhs x rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x8 RTM_SIMD_CALL vector_cross3(const vector3f_x8& lhs, const vector3f_x8& rhs) RTM_NO_EXCEPT
+	{
+		// cross(a, b) = (a.yzx * b.zxy) - (a.zxy * b.yzx)
+		const scalarf_x8 x = scalar_neg_mul_sub(lhs.z, rhs.y, scalar_mul(lhs.y, rhs.z));
+		const scalarf_x8 y = scalar_neg_mul_sub(lhs.x, rhs.z, scalar_mul(lhs.z, rhs.x));
+		const scalarf_x8 z = scalar_neg_mul_sub(lhs.y, rhs.x, scalar_mul(lhs.x, rhs.y));
+		return vector3f_x8{ x, y, z };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane 3D dot product: lhs . rhs
+	// Lane N of the result holds the dot product of lane N of the inputs.
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf_x8 RTM_SIMD_CALL vector_dot3(const vector3f_x8& lhs, const vector3f_x8& rhs) RTM_NO_EXCEPT
+	{
+		return scalar_mul_add(lhs.z, rhs.z, scalar_mul_add(lhs.y, rhs.y, scalar_mul(lhs.x, rhs.x)));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane squared length of the 3D input.
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf_x8 RTM_SIMD_CALL vector_length_squared3(const vector3f_x8& input) RTM_NO_EXCEPT
+	{
+		return vector_dot3(input, input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane length of the 3D input.
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf_x8 RTM_SIMD_CALL vector_length3(const vector3f_x8& input) RTM_NO_EXCEPT
+	{
+		return scalar_sqrt(vector_length_squared3(input));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane normalization of the 3D input.
+	// Lanes with a squared length below the threshold are set to the matching lane of the fallback.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x8 RTM_SIMD_CALL vector_normalize3(const vector3f_x8& input, const vector3f_x8& fallback, float threshold = 1.0e-8f) RTM_NO_EXCEPT
+	{
+		// Reciprocal is more accurate to normalize with
+		const scalarf_x8 len_sq = vector_length_squared3(input);
+		const mask8i is_valid = scalar_greater_equal(len_sq, scalar_set_x8(threshold));
+		const scalarf_x8 inv_len = scalar_sqrt_reciprocal(len_sq);
+
+		const scalarf_x8 x = scalar_select(is_valid, scalar_mul(input.x, inv_len), fallback.x);
+		const scalarf_x8 y = scalar_select(is_valid, scalar_mul(input.y, inv_len), fallback.y);
+		const scalarf_x8 z = scalar_select(is_valid, scalar_mul(input.z, inv_len), fallback.z);
+		return vector3f_x8{ x, y, z };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane linear interpolation of the two inputs at the specified alpha.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3f_x8 RTM_SIMD_CALL vector_lerp(const vector3f_x8& start, const vector3f_x8& end, float alpha) RTM_NO_EXCEPT
+	{
+		const scalarf_x8 alpha_v = scalar_set_x8(alpha);
+		const scalarf_x8 x = scalar_mul_add(scalar_sub(end.x, start.x), alpha_v, start.x);
+		const scalarf_x8 y = scalar_mul_add(scalar_sub(end.y, start.y), alpha_v, start.y);
+		const scalarf_x8 z = scalar_mul_add(scalar_sub(end.z, start.z), alpha_v, start.z);
+		return vector3f_x8{ x, y, z };
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -31,6 +31,9 @@
 #include "rtm/impl/memory_utils.h"
 #include "rtm/impl/vector_common.h"
 
+#include <cmath>
+#include <limits>
+
 RTM_IMPL_FILE_PRAGMA_PUSH
 
 namespace rtm
@@ -43,15 +46,21 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Loads an unaligned vector4 from memory.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_load(const double* input) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_load(const double* input) RTM_NO_EXCEPT
 	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_loadu_pd(input);
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ vld1q_f64(input), vld1q_f64(input + 2) };
+#else
 		return vector_set(input[0], input[1], input[2], input[3]);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Loads an unaligned vector1 from memory and leaves the [yzw] components undefined.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_load1(const double* input) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_load1(const double* input) RTM_NO_EXCEPT
 	{
 		return vector_set(input[0]);
 	}
@@ -59,7 +68,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Loads an unaligned vector2 from memory and leaves the [zw] components undefined.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_load2(const double* input) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_load2(const double* input) RTM_NO_EXCEPT
 	{
 		return vector_set(input[0], input[1], 0.0, 0.0);
 	}
@@ -67,7 +76,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Loads an unaligned vector3 from memory and leaves the [w] component undefined.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_load3(const double* input) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_load3(const double* input) RTM_NO_EXCEPT
 	{
 		return vector_set(input[0], input[1], input[2], 0.0);
 	}
@@ -75,7 +84,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Loads an unaligned vector4 from memory.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_load(const float4d* input) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_load(const float4d* input) RTM_NO_EXCEPT
 	{
 		return vector_set(input->x, input->y, input->z, input->w);
 	}
@@ -83,7 +92,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Loads an unaligned vector2 from memory and leaves the [zw] components undefined.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_load2(const float2d* input) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_load2(const float2d* input) RTM_NO_EXCEPT
 	{
 		return vector_set(input->x, input->y, 0.0, 0.0);
 	}
@@ -91,7 +100,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Loads an unaligned vector3 from memory and leaves the [w] component undefined.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_load3(const float3d* input) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_load3(const float3d* input) RTM_NO_EXCEPT
 	{
 		return vector_set(input->x, input->y, input->z, 0.0);
 	}
@@ -99,9 +108,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Casts a quaternion to a vector4.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d quat_to_vector(const quatd& input) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL quat_to_vector(quatd_arg0 input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return input;
+#elif defined(RTM_SSE2_INTRINSICS) || defined(RTM_NEON64_INTRINSICS)
 		return vector4d{ input.xy, input.zw };
 #else
 		return vector4d{ input.x, input.y, input.z, input.w };
@@ -111,10 +122,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Casts a vector4 float32 variant to a float64 variant.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_cast(const vector4f& input) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_cast(vector4f_arg0 input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_cvtps_pd(input);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_cvtps_pd(input), _mm_cvtps_pd(_mm_shuffle_ps(input, input, _MM_SHUFFLE(3, 2, 3, 2))) };
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ vcvt_f64_f32(vget_low_f32(input)), vcvt_high_f64_f32(input) };
 #elif defined(RTM_NEON_INTRINSICS)
 		return vector4d{ double(vgetq_lane_f32(input, 0)), double(vgetq_lane_f32(input, 1)), double(vgetq_lane_f32(input, 2)), double(vgetq_lane_f32(input, 3)) };
 #else
@@ -125,10 +140,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the vector4 [x] component.
 	//////////////////////////////////////////////////////////////////////////
-	inline double vector_get_x(const vector4d& input) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL vector_get_x(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm_cvtsd_f64(_mm256_castpd256_pd128(input));
+#elif defined(RTM_SSE2_INTRINSICS)
 		return _mm_cvtsd_f64(input.xy);
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vgetq_lane_f64(input.xy, 0);
 #else
 		return input.x;
 #endif
@@ -137,10 +156,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the vector4 [y] component.
 	//////////////////////////////////////////////////////////////////////////
-	inline double vector_get_y(const vector4d& input) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL vector_get_y(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm_cvtsd_f64(_mm_permute_pd(_mm256_castpd256_pd128(input), 1));
+#elif defined(RTM_SSE2_INTRINSICS)
 		return _mm_cvtsd_f64(_mm_shuffle_pd(input.xy, input.xy, 1));
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vgetq_lane_f64(input.xy, 1);
 #else
 		return input.y;
 #endif
@@ -149,10 +172,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the vector4 [z] component.
 	//////////////////////////////////////////////////////////////////////////
-	inline double vector_get_z(const vector4d& input) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL vector_get_z(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm_cvtsd_f64(_mm256_extractf128_pd(input, 1));
+#elif defined(RTM_SSE2_INTRINSICS)
 		return _mm_cvtsd_f64(input.zw);
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vgetq_lane_f64(input.zw, 0);
 #else
 		return input.z;
 #endif
@@ -161,10 +188,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the vector4 [w] component.
 	//////////////////////////////////////////////////////////////////////////
-	inline double vector_get_w(const vector4d& input) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL vector_get_w(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm_cvtsd_f64(_mm_permute_pd(_mm256_extractf128_pd(input, 1), 1));
+#elif defined(RTM_SSE2_INTRINSICS)
 		return _mm_cvtsd_f64(_mm_shuffle_pd(input.zw, input.zw, 1));
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vgetq_lane_f64(input.zw, 1);
 #else
 		return input.w;
 #endif
@@ -174,7 +205,7 @@ namespace rtm
 	// Returns the vector4 desired component.
 	//////////////////////////////////////////////////////////////////////////
 	template<mix4 component>
-	inline double vector_get_component(const vector4d& input) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL vector_get_component(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
 		switch (mix4(int(component) % 4))
 		{
@@ -191,7 +222,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the vector4 desired component.
 	//////////////////////////////////////////////////////////////////////////
-	inline double vector_get_component(const vector4d& input, mix4 component) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL vector_get_component(vector4d_arg0 input, mix4 component) RTM_NO_EXCEPT
 	{
 		switch (mix4(int(component) % 4))
 		{
@@ -216,18 +247,25 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Writes a vector4 to unaligned memory.
 	//////////////////////////////////////////////////////////////////////////
-	inline void vector_store(const vector4d& input, double* output) RTM_NO_EXCEPT
+	inline void RTM_SIMD_CALL vector_store(vector4d_arg0 input, double* output) RTM_NO_EXCEPT
 	{
+#if defined(RTM_AVX_INTRINSICS)
+		_mm256_storeu_pd(output, input);
+#elif defined(RTM_NEON64_INTRINSICS)
+		vst1q_f64(output, input.xy);
+		vst1q_f64(output + 2, input.zw);
+#else
 		output[0] = vector_get_x(input);
 		output[1] = vector_get_y(input);
 		output[2] = vector_get_z(input);
 		output[3] = vector_get_w(input);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Writes a vector1 to unaligned memory.
 	//////////////////////////////////////////////////////////////////////////
-	inline void vector_store1(const vector4d& input, double* output) RTM_NO_EXCEPT
+	inline void RTM_SIMD_CALL vector_store1(vector4d_arg0 input, double* output) RTM_NO_EXCEPT
 	{
 		output[0] = vector_get_x(input);
 	}
@@ -235,7 +273,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Writes a vector2 to unaligned memory.
 	//////////////////////////////////////////////////////////////////////////
-	inline void vector_store2(const vector4d& input, double* output) RTM_NO_EXCEPT
+	inline void RTM_SIMD_CALL vector_store2(vector4d_arg0 input, double* output) RTM_NO_EXCEPT
 	{
 		output[0] = vector_get_x(input);
 		output[1] = vector_get_y(input);
@@ -244,7 +282,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Writes a vector3 to unaligned memory.
 	//////////////////////////////////////////////////////////////////////////
-	inline void vector_store3(const vector4d& input, double* output) RTM_NO_EXCEPT
+	inline void RTM_SIMD_CALL vector_store3(vector4d_arg0 input, double* output) RTM_NO_EXCEPT
 	{
 		output[0] = vector_get_x(input);
 		output[1] = vector_get_y(input);
@@ -254,7 +292,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Writes a vector4 to unaligned memory.
 	//////////////////////////////////////////////////////////////////////////
-	inline void vector_store(const vector4d& input, uint8_t* output) RTM_NO_EXCEPT
+	inline void RTM_SIMD_CALL vector_store(vector4d_arg0 input, uint8_t* output) RTM_NO_EXCEPT
 	{
 		std::memcpy(output, &input, sizeof(vector4d));
 	}
@@ -262,7 +300,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Writes a vector1 to unaligned memory.
 	//////////////////////////////////////////////////////////////////////////
-	inline void vector_store1(const vector4d& input, uint8_t* output)
+	inline void RTM_SIMD_CALL vector_store1(vector4d_arg0 input, uint8_t* output)
 	{
 		std::memcpy(output, &input, sizeof(double) * 1);
 	}
@@ -270,7 +308,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Writes a vector2 to unaligned memory.
 	//////////////////////////////////////////////////////////////////////////
-	inline void vector_store2(const vector4d& input, uint8_t* output)
+	inline void RTM_SIMD_CALL vector_store2(vector4d_arg0 input, uint8_t* output)
 	{
 		std::memcpy(output, &input, sizeof(double) * 2);
 	}
@@ -278,7 +316,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Writes a vector3 to unaligned memory.
 	//////////////////////////////////////////////////////////////////////////
-	inline void vector_store3(const vector4d& input, uint8_t* output)
+	inline void RTM_SIMD_CALL vector_store3(vector4d_arg0 input, uint8_t* output)
 	{
 		std::memcpy(output, &input, sizeof(double) * 3);
 	}
@@ -286,7 +324,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Writes a vector4 to unaligned memory.
 	//////////////////////////////////////////////////////////////////////////
-	inline void vector_store(const vector4d& input, float4d* output) RTM_NO_EXCEPT
+	inline void RTM_SIMD_CALL vector_store(vector4d_arg0 input, float4d* output) RTM_NO_EXCEPT
 	{
 		output->x = vector_get_x(input);
 		output->y = vector_get_y(input);
@@ -297,7 +335,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Writes a vector2 to unaligned memory.
 	//////////////////////////////////////////////////////////////////////////
-	inline void vector_store2(const vector4d& input, float2d* output) RTM_NO_EXCEPT
+	inline void RTM_SIMD_CALL vector_store2(vector4d_arg0 input, float2d* output) RTM_NO_EXCEPT
 	{
 		output->x = vector_get_x(input);
 		output->y = vector_get_y(input);
@@ -306,7 +344,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Writes a vector3 to unaligned memory.
 	//////////////////////////////////////////////////////////////////////////
-	inline void vector_store3(const vector4d& input, float3d* output) RTM_NO_EXCEPT
+	inline void RTM_SIMD_CALL vector_store3(vector4d_arg0 input, float3d* output) RTM_NO_EXCEPT
 	{
 		output->x = vector_get_x(input);
 		output->y = vector_get_y(input);
@@ -323,10 +361,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Per component addition of the two inputs: lhs + rhs
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_add(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_add(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_add_pd(lhs, rhs);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_add_pd(lhs.xy, rhs.xy), _mm_add_pd(lhs.zw, rhs.zw) };
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ vaddq_f64(lhs.xy, rhs.xy), vaddq_f64(lhs.zw, rhs.zw) };
 #else
 		return vector_set(lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z, lhs.w + rhs.w);
 #endif
@@ -335,10 +377,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Per component subtraction of the two inputs: lhs - rhs
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_sub(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_sub(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_sub_pd(lhs, rhs);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_sub_pd(lhs.xy, rhs.xy), _mm_sub_pd(lhs.zw, rhs.zw) };
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ vsubq_f64(lhs.xy, rhs.xy), vsubq_f64(lhs.zw, rhs.zw) };
 #else
 		return vector_set(lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z, lhs.w - rhs.w);
 #endif
@@ -347,10 +393,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Per component multiplication of the two inputs: lhs * rhs
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_mul(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_mul(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_mul_pd(lhs, rhs);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_mul_pd(lhs.xy, rhs.xy), _mm_mul_pd(lhs.zw, rhs.zw) };
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ vmulq_f64(lhs.xy, rhs.xy), vmulq_f64(lhs.zw, rhs.zw) };
 #else
 		return vector_set(lhs.x * rhs.x, lhs.y * rhs.y, lhs.z * rhs.z, lhs.w * rhs.w);
 #endif
@@ -359,18 +409,26 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Per component multiplication of the vector by a scalar: lhs * rhs
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_mul(const vector4d& lhs, double rhs) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_mul(vector4d_arg0 lhs, double rhs) RTM_NO_EXCEPT
 	{
+#if defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ vmulq_n_f64(lhs.xy, rhs), vmulq_n_f64(lhs.zw, rhs) };
+#else
 		return vector_mul(lhs, vector_set(rhs));
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Per component division of the two inputs: lhs / rhs
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_div(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_div(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_div_pd(lhs, rhs);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_div_pd(lhs.xy, rhs.xy), _mm_div_pd(lhs.zw, rhs.zw) };
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ vdivq_f64(lhs.xy, rhs.xy), vdivq_f64(lhs.zw, rhs.zw) };
 #else
 		return vector_set(lhs.x / rhs.x, lhs.y / rhs.y, lhs.z / rhs.z, lhs.w / rhs.w);
 #endif
@@ -379,10 +437,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Per component maximum of the two inputs: max(lhs, rhs)
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_max(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_max(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_max_pd(lhs, rhs);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_max_pd(lhs.xy, rhs.xy), _mm_max_pd(lhs.zw, rhs.zw) };
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ vmaxq_f64(lhs.xy, rhs.xy), vmaxq_f64(lhs.zw, rhs.zw) };
 #else
 		return vector_set(scalar_max(lhs.x, rhs.x), scalar_max(lhs.y, rhs.y), scalar_max(lhs.z, rhs.z), scalar_max(lhs.w, rhs.w));
 #endif
@@ -391,10 +453,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Per component minimum of the two inputs: min(lhs, rhs)
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_min(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_min(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_min_pd(lhs, rhs);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_min_pd(lhs.xy, rhs.xy), _mm_min_pd(lhs.zw, rhs.zw) };
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ vminq_f64(lhs.xy, rhs.xy), vminq_f64(lhs.zw, rhs.zw) };
 #else
 		return vector_set(scalar_min(lhs.x, rhs.x), scalar_min(lhs.y, rhs.y), scalar_min(lhs.z, rhs.z), scalar_min(lhs.w, rhs.w));
 #endif
@@ -403,7 +469,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Per component clamping of an input between a minimum and a maximum value: min(max_value, max(min_value, input))
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_clamp(const vector4d& input, const vector4d& min_value, const vector4d& max_value) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_clamp(vector4d_arg0 input, vector4d_arg1 min_value, vector4d_arg2 max_value) RTM_NO_EXCEPT
 	{
 		return vector_min(max_value, vector_max(min_value, input));
 	}
@@ -411,11 +477,15 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Per component absolute of the input: abs(input)
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_abs(const vector4d& input) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_abs(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_max_pd(_mm256_sub_pd(_mm256_setzero_pd(), input), input);
+#elif defined(RTM_SSE2_INTRINSICS)
 		vector4d zero{ _mm_setzero_pd(), _mm_setzero_pd() };
 		return vector_max(vector_sub(zero, input), input);
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ vabsq_f64(input.xy), vabsq_f64(input.zw) };
 #else
 		return vector_set(scalar_abs(input.x), scalar_abs(input.y), scalar_abs(input.z), scalar_abs(input.w));
 #endif
@@ -424,41 +494,94 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Per component negation of the input: -input
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_neg(const vector4d& input) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_neg(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
+#if defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ vnegq_f64(input.xy), vnegq_f64(input.zw) };
+#else
 		return vector_mul(input, -1.0);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Per component reciprocal of the input: 1.0 / input
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_reciprocal(const vector4d& input) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_reciprocal(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
 		return vector_div(vector_set(1.0), input);
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Per component square root of the input: sqrt(input)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d RTM_SIMD_CALL vector_sqrt(vector4d_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_sqrt_pd(input);
+#elif defined(RTM_SSE2_INTRINSICS)
+		return vector4d{ _mm_sqrt_pd(input.xy), _mm_sqrt_pd(input.zw) };
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ vsqrtq_f64(input.xy), vsqrtq_f64(input.zw) };
+#else
+		return vector_set(scalar_sqrt(vector_get_x(input)), scalar_sqrt(vector_get_y(input)), scalar_sqrt(vector_get_z(input)), scalar_sqrt(vector_get_w(input)));
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component reciprocal square root of the input: 1.0 / sqrt(input)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d RTM_SIMD_CALL vector_sqrt_reciprocal(vector4d_arg0 input) RTM_NO_EXCEPT
+	{
+		return vector_div(vector_set(1.0), vector_sqrt(input));
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Per component returns the smallest integer value not less than the input.
 	// vector_ceil([1.8, 1.0, -1.8, -1.0]) = [2.0, 1.0, -1.0, -1.0]
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_ceil(const vector4d& input) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_ceil(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
+#if defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ vrndpq_f64(input.xy), vrndpq_f64(input.zw) };
+#else
 		return vector_set(scalar_ceil(vector_get_x(input)), scalar_ceil(vector_get_y(input)), scalar_ceil(vector_get_z(input)), scalar_ceil(vector_get_w(input)));
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Per component returns the largest integer value not greater than the input.
 	// vector_floor([1.8, 1.0, -1.8, -1.0]) = [1.0, 1.0, -2.0, -1.0]
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_floor(const vector4d& input) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_floor(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
+#if defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ vrndmq_f64(input.xy), vrndmq_f64(input.zw) };
+#else
 		return vector_set(scalar_floor(vector_get_x(input)), scalar_floor(vector_get_y(input)), scalar_floor(vector_get_z(input)), scalar_floor(vector_get_w(input)));
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns the rounded input using banker's rounding (half to even).
+	// vector_round_bankers([2.5, 1.5, 1.2, -2.5]) = [2.0, 2.0, 1.0, -2.0]
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d RTM_SIMD_CALL vector_round_bankers(vector4d_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_round_pd(input, 0x8);
+#elif defined(RTM_SSE4_INTRINSICS)
+		return vector4d{ _mm_round_pd(input.xy, 0x8), _mm_round_pd(input.zw, 0x8) };
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ vrndnq_f64(input.xy), vrndnq_f64(input.zw) };
+#else
+		return vector_set(scalar_round_bankers(vector_get_x(input)), scalar_round_bankers(vector_get_y(input)), scalar_round_bankers(vector_get_z(input)), scalar_round_bankers(vector_get_w(input)));
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// 3D cross product: lhs x rhs
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_cross3(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_cross3(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
 		return vector_set(vector_get_y(lhs) * vector_get_z(rhs) - vector_get_z(lhs) * vector_get_y(rhs),
 						  vector_get_z(lhs) * vector_get_x(rhs) - vector_get_x(lhs) * vector_get_z(rhs),
@@ -468,23 +591,27 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// 4D dot product: lhs . rhs
 	//////////////////////////////////////////////////////////////////////////
-	inline double vector_dot(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL vector_dot(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
+#if defined(RTM_NEON64_INTRINSICS)
+		return vaddvq_f64(vfmaq_f64(vmulq_f64(lhs.xy, rhs.xy), lhs.zw, rhs.zw));
+#else
 		return (vector_get_x(lhs) * vector_get_x(rhs)) + (vector_get_y(lhs) * vector_get_y(rhs)) + (vector_get_z(lhs) * vector_get_z(rhs)) + (vector_get_w(lhs) * vector_get_w(rhs));
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// 4D dot product: lhs . rhs
 	//////////////////////////////////////////////////////////////////////////
-	inline scalard vector_dot_as_scalar(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline scalard RTM_SIMD_CALL vector_dot_as_scalar(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-		return scalar_set((vector_get_x(lhs) * vector_get_x(rhs)) + (vector_get_y(lhs) * vector_get_y(rhs)) + (vector_get_z(lhs) * vector_get_z(rhs)) + (vector_get_w(lhs) * vector_get_w(rhs)));
+		return scalar_set(vector_dot(lhs, rhs));
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// 4D dot product replicated in all components: lhs . rhs
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_dot_as_vector(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_dot_as_vector(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
 		return vector_set(vector_dot(lhs, rhs));
 	}
@@ -492,7 +619,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// 3D dot product: lhs . rhs
 	//////////////////////////////////////////////////////////////////////////
-	inline double vector_dot3(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL vector_dot3(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
 		return (vector_get_x(lhs) * vector_get_x(rhs)) + (vector_get_y(lhs) * vector_get_y(rhs)) + (vector_get_z(lhs) * vector_get_z(rhs));
 	}
@@ -500,7 +627,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the squared length/norm of the vector4.
 	//////////////////////////////////////////////////////////////////////////
-	inline double vector_length_squared(const vector4d& input) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL vector_length_squared(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
 		return vector_dot(input, input);
 	}
@@ -508,7 +635,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the squared length/norm of the vector3.
 	//////////////////////////////////////////////////////////////////////////
-	inline double vector_length_squared3(const vector4d& input) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL vector_length_squared3(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
 		return vector_dot3(input, input);
 	}
@@ -516,7 +643,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the length/norm of the vector4.
 	//////////////////////////////////////////////////////////////////////////
-	inline double vector_length(const vector4d& input) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL vector_length(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
 		return scalar_sqrt(vector_length_squared(input));
 	}
@@ -524,7 +651,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the length/norm of the vector3.
 	//////////////////////////////////////////////////////////////////////////
-	inline double vector_length3(const vector4d& input) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL vector_length3(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
 		return scalar_sqrt(vector_length_squared3(input));
 	}
@@ -532,7 +659,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the reciprocal length/norm of the vector4.
 	//////////////////////////////////////////////////////////////////////////
-	inline double vector_length_reciprocal(const vector4d& input) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL vector_length_reciprocal(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
 		return 1.0 / vector_length(input);
 	}
@@ -540,7 +667,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the reciprocal length/norm of the vector3.
 	//////////////////////////////////////////////////////////////////////////
-	inline double vector_length_reciprocal3(const vector4d& input) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL vector_length_reciprocal3(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
 		return 1.0 / vector_length3(input);
 	}
@@ -548,7 +675,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the distance between two 3D points.
 	//////////////////////////////////////////////////////////////////////////
-	inline double vector_distance3(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline double RTM_SIMD_CALL vector_distance3(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
 		return vector_length3(vector_sub(rhs, lhs));
 	}
@@ -558,7 +685,7 @@ namespace rtm
 	// If the length of the input is below the supplied threshold, the
 	// fall back value is returned instead.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_normalize3(const vector4d& input, const vector4d& fallback, double threshold = 1.0e-8) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_normalize3(vector4d_arg0 input, vector4d_arg1 fallback, double threshold = 1.0e-8) RTM_NO_EXCEPT
 	{
 		// Reciprocal is more accurate to normalize with
 		const double len_sq = vector_length_squared3(input);
@@ -571,7 +698,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns per component the fractional part of the input.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_fraction(const vector4d& input) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_fraction(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
 		return vector_set(scalar_fraction(vector_get_x(input)), scalar_fraction(vector_get_y(input)), scalar_fraction(vector_get_z(input)), scalar_fraction(vector_get_w(input)));
 	}
@@ -579,32 +706,50 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Per component multiplication/addition of the three inputs: v2 + (v0 * v1)
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_mul_add(const vector4d& v0, const vector4d& v1, const vector4d& v2) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_mul_add(vector4d_arg0 v0, vector4d_arg1 v1, vector4d_arg2 v2) RTM_NO_EXCEPT
 	{
+#if defined(RTM_FMA_INTRINSICS)
+		return _mm256_fmadd_pd(v0, v1, v2);
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ vfmaq_f64(v2.xy, v0.xy, v1.xy), vfmaq_f64(v2.zw, v0.zw, v1.zw) };
+#else
 		return vector_add(vector_mul(v0, v1), v2);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Per component multiplication/addition of the three inputs: v2 + (v0 * s1)
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_mul_add(const vector4d& v0, double s1, const vector4d& v2) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_mul_add(vector4d_arg0 v0, double s1, vector4d_arg2 v2) RTM_NO_EXCEPT
 	{
+#if defined(RTM_FMA_INTRINSICS)
+		return _mm256_fmadd_pd(v0, _mm256_set1_pd(s1), v2);
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ vfmaq_n_f64(v2.xy, v0.xy, s1), vfmaq_n_f64(v2.zw, v0.zw, s1) };
+#else
 		return vector_add(vector_mul(v0, s1), v2);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Per component negative multiplication/subtraction of the three inputs: -((v0 * v1) - v2)
 	// This is mathematically equivalent to: v2 - (v0 * v1)
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_neg_mul_sub(const vector4d& v0, const vector4d& v1, const vector4d& v2) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_neg_mul_sub(vector4d_arg0 v0, vector4d_arg1 v1, vector4d_arg2 v2) RTM_NO_EXCEPT
 	{
+#if defined(RTM_FMA_INTRINSICS)
+		return _mm256_fnmadd_pd(v0, v1, v2);
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ vfmsq_f64(v2.xy, v0.xy, v1.xy), vfmsq_f64(v2.zw, v0.zw, v1.zw) };
+#else
 		return vector_sub(v2, vector_mul(v0, v1));
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Per component linear interpolation of the two inputs at the specified alpha.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_lerp(const vector4d& start, const vector4d& end, double alpha) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_lerp(vector4d_arg0 start, vector4d_arg1 end, double alpha) RTM_NO_EXCEPT
 	{
 		return vector_mul_add(vector_sub(end, start), alpha, start);
 	}
@@ -619,12 +764,16 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns per component ~0 if less than, otherwise 0: lhs < rhs ? ~0 : 0
 	//////////////////////////////////////////////////////////////////////////
-	inline mask4q vector_less_than(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline mask4q RTM_SIMD_CALL vector_less_than(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ);
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_lt_pd = _mm_cmplt_pd(lhs.xy, rhs.xy);
 		__m128d zw_lt_pd = _mm_cmplt_pd(lhs.zw, rhs.zw);
 		return mask4q{xy_lt_pd, zw_lt_pd};
+#elif defined(RTM_NEON64_INTRINSICS)
+		return mask4q{ vcltq_f64(lhs.xy, rhs.xy), vcltq_f64(lhs.zw, rhs.zw) };
 #else
 		return mask4q{rtm_impl::get_mask_value(lhs.x < rhs.x), rtm_impl::get_mask_value(lhs.y < rhs.y), rtm_impl::get_mask_value(lhs.z < rhs.z), rtm_impl::get_mask_value(lhs.w < rhs.w)};
 #endif
@@ -633,12 +782,16 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns per component ~0 if less equal, otherwise 0: lhs <= rhs ? ~0 : 0
 	//////////////////////////////////////////////////////////////////////////
-	inline mask4q vector_less_equal(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline mask4q RTM_SIMD_CALL vector_less_equal(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_cmp_pd(lhs, rhs, _CMP_LE_OQ);
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_lt_pd = _mm_cmple_pd(lhs.xy, rhs.xy);
 		__m128d zw_lt_pd = _mm_cmple_pd(lhs.zw, rhs.zw);
 		return mask4q{ xy_lt_pd, zw_lt_pd };
+#elif defined(RTM_NEON64_INTRINSICS)
+		return mask4q{ vcleq_f64(lhs.xy, rhs.xy), vcleq_f64(lhs.zw, rhs.zw) };
 #else
 		return mask4q{ rtm_impl::get_mask_value(lhs.x <= rhs.x), rtm_impl::get_mask_value(lhs.y <= rhs.y), rtm_impl::get_mask_value(lhs.z <= rhs.z), rtm_impl::get_mask_value(lhs.w <= rhs.w) };
 #endif
@@ -647,12 +800,16 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns per component ~0 if greater equal, otherwise 0: lhs >= rhs ? ~0 : 0
 	//////////////////////////////////////////////////////////////////////////
-	inline mask4q vector_greater_equal(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline mask4q RTM_SIMD_CALL vector_greater_equal(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_cmp_pd(lhs, rhs, _CMP_GE_OQ);
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_ge_pd = _mm_cmpge_pd(lhs.xy, rhs.xy);
 		__m128d zw_ge_pd = _mm_cmpge_pd(lhs.zw, rhs.zw);
 		return mask4q{ xy_ge_pd, zw_ge_pd };
+#elif defined(RTM_NEON64_INTRINSICS)
+		return mask4q{ vcgeq_f64(lhs.xy, rhs.xy), vcgeq_f64(lhs.zw, rhs.zw) };
 #else
 		return mask4q{ rtm_impl::get_mask_value(lhs.x >= rhs.x), rtm_impl::get_mask_value(lhs.y >= rhs.y), rtm_impl::get_mask_value(lhs.z >= rhs.z), rtm_impl::get_mask_value(lhs.w >= rhs.w) };
 #endif
@@ -661,12 +818,16 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if all 4 components are less than, otherwise false: all(lhs < rhs)
 	//////////////////////////////////////////////////////////////////////////
-	inline bool vector_all_less_than(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL vector_all_less_than(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ)) == 0xF;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_lt_pd = _mm_cmplt_pd(lhs.xy, rhs.xy);
 		__m128d zw_lt_pd = _mm_cmplt_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_lt_pd) & _mm_movemask_pd(zw_lt_pd)) == 3;
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vminvq_u32(vreinterpretq_u32_u64(vandq_u64(vcltq_f64(lhs.xy, rhs.xy), vcltq_f64(lhs.zw, rhs.zw)))) != 0;
 #else
 		return lhs.x < rhs.x && lhs.y < rhs.y && lhs.z < rhs.z && lhs.w < rhs.w;
 #endif
@@ -675,12 +836,18 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if all 3 components are less than, otherwise false: all(lhs < rhs)
 	//////////////////////////////////////////////////////////////////////////
-	inline bool vector_all_less_than3(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL vector_all_less_than3(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ)) & 0x7) == 0x7;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_lt_pd = _mm_cmplt_pd(lhs.xy, rhs.xy);
 		__m128d zw_lt_pd = _mm_cmplt_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_lt_pd) == 3 && (_mm_movemask_pd(zw_lt_pd) & 1) == 1;
+#elif defined(RTM_NEON64_INTRINSICS)
+		const uint64x2_t xy_mask = vcltq_f64(lhs.xy, rhs.xy);
+		const uint64x2_t zw_mask = vcltq_f64(lhs.zw, rhs.zw);
+		return (vgetq_lane_u64(xy_mask, 0) & vgetq_lane_u64(xy_mask, 1) & vgetq_lane_u64(zw_mask, 0)) != 0;
 #else
 		return lhs.x < rhs.x && lhs.y < rhs.y && lhs.z < rhs.z;
 #endif
@@ -689,12 +856,16 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if any 4 components are less than, otherwise false: any(lhs < rhs)
 	//////////////////////////////////////////////////////////////////////////
-	inline bool vector_any_less_than(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL vector_any_less_than(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ)) != 0;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_lt_pd = _mm_cmplt_pd(lhs.xy, rhs.xy);
 		__m128d zw_lt_pd = _mm_cmplt_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_lt_pd) | _mm_movemask_pd(zw_lt_pd)) != 0;
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vmaxvq_u32(vreinterpretq_u32_u64(vorrq_u64(vcltq_f64(lhs.xy, rhs.xy), vcltq_f64(lhs.zw, rhs.zw)))) != 0;
 #else
 		return lhs.x < rhs.x || lhs.y < rhs.y || lhs.z < rhs.z || lhs.w < rhs.w;
 #endif
@@ -703,12 +874,18 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if any 3 components are less than, otherwise false: any(lhs < rhs)
 	//////////////////////////////////////////////////////////////////////////
-	inline bool vector_any_less_than3(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL vector_any_less_than3(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ)) & 0x7) != 0;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_lt_pd = _mm_cmplt_pd(lhs.xy, rhs.xy);
 		__m128d zw_lt_pd = _mm_cmplt_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_lt_pd) != 0 || (_mm_movemask_pd(zw_lt_pd) & 0x1) != 0;
+#elif defined(RTM_NEON64_INTRINSICS)
+		const uint64x2_t xy_mask = vcltq_f64(lhs.xy, rhs.xy);
+		const uint64x2_t zw_mask = vcltq_f64(lhs.zw, rhs.zw);
+		return (vgetq_lane_u64(xy_mask, 0) | vgetq_lane_u64(xy_mask, 1) | vgetq_lane_u64(zw_mask, 0)) != 0;
 #else
 		return lhs.x < rhs.x || lhs.y < rhs.y || lhs.z < rhs.z;
 #endif
@@ -717,12 +894,16 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if all 4 components are less equal, otherwise false: all(lhs <= rhs)
 	//////////////////////////////////////////////////////////////////////////
-	inline bool vector_all_less_equal(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL vector_all_less_equal(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LE_OQ)) == 0xF;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_le_pd = _mm_cmple_pd(lhs.xy, rhs.xy);
 		__m128d zw_le_pd = _mm_cmple_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_le_pd) & _mm_movemask_pd(zw_le_pd)) == 3;
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vminvq_u32(vreinterpretq_u32_u64(vandq_u64(vcleq_f64(lhs.xy, rhs.xy), vcleq_f64(lhs.zw, rhs.zw)))) != 0;
 #else
 		return lhs.x <= rhs.x && lhs.y <= rhs.y && lhs.z <= rhs.z && lhs.w <= rhs.w;
 #endif
@@ -731,12 +912,18 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if all 3 components are less equal, otherwise false: all(lhs <= rhs)
 	//////////////////////////////////////////////////////////////////////////
-	inline bool vector_all_less_equal3(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL vector_all_less_equal3(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LE_OQ)) & 0x7) == 0x7;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_le_pd = _mm_cmple_pd(lhs.xy, rhs.xy);
 		__m128d zw_le_pd = _mm_cmple_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_le_pd) == 3 && (_mm_movemask_pd(zw_le_pd) & 1) != 0;
+#elif defined(RTM_NEON64_INTRINSICS)
+		const uint64x2_t xy_mask = vcleq_f64(lhs.xy, rhs.xy);
+		const uint64x2_t zw_mask = vcleq_f64(lhs.zw, rhs.zw);
+		return (vgetq_lane_u64(xy_mask, 0) & vgetq_lane_u64(xy_mask, 1) & vgetq_lane_u64(zw_mask, 0)) != 0;
 #else
 		return lhs.x <= rhs.x && lhs.y <= rhs.y && lhs.z <= rhs.z;
 #endif
@@ -745,12 +932,16 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if any 4 components are less equal, otherwise false: any(lhs <= rhs)
 	//////////////////////////////////////////////////////////////////////////
-	inline bool vector_any_less_equal(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL vector_any_less_equal(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LE_OQ)) != 0;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_le_pd = _mm_cmple_pd(lhs.xy, rhs.xy);
 		__m128d zw_le_pd = _mm_cmple_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_le_pd) | _mm_movemask_pd(zw_le_pd)) != 0;
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vmaxvq_u32(vreinterpretq_u32_u64(vorrq_u64(vcleq_f64(lhs.xy, rhs.xy), vcleq_f64(lhs.zw, rhs.zw)))) != 0;
 #else
 		return lhs.x <= rhs.x || lhs.y <= rhs.y || lhs.z <= rhs.z || lhs.w <= rhs.w;
 #endif
@@ -759,12 +950,18 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if any 3 components are less equal, otherwise false: any(lhs <= rhs)
 	//////////////////////////////////////////////////////////////////////////
-	inline bool vector_any_less_equal3(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL vector_any_less_equal3(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LE_OQ)) & 0x7) != 0;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_le_pd = _mm_cmple_pd(lhs.xy, rhs.xy);
 		__m128d zw_le_pd = _mm_cmple_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_le_pd) != 0 || (_mm_movemask_pd(zw_le_pd) & 1) != 0;
+#elif defined(RTM_NEON64_INTRINSICS)
+		const uint64x2_t xy_mask = vcleq_f64(lhs.xy, rhs.xy);
+		const uint64x2_t zw_mask = vcleq_f64(lhs.zw, rhs.zw);
+		return (vgetq_lane_u64(xy_mask, 0) | vgetq_lane_u64(xy_mask, 1) | vgetq_lane_u64(zw_mask, 0)) != 0;
 #else
 		return lhs.x <= rhs.x || lhs.y <= rhs.y || lhs.z <= rhs.z;
 #endif
@@ -773,12 +970,16 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if all 4 components are greater equal, otherwise false: all(lhs >= rhs)
 	//////////////////////////////////////////////////////////////////////////
-	inline bool vector_all_greater_equal(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL vector_all_greater_equal(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_GE_OQ)) == 0xF;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_ge_pd = _mm_cmpge_pd(lhs.xy, rhs.xy);
 		__m128d zw_ge_pd = _mm_cmpge_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_ge_pd) & _mm_movemask_pd(zw_ge_pd)) == 3;
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vminvq_u32(vreinterpretq_u32_u64(vandq_u64(vcgeq_f64(lhs.xy, rhs.xy), vcgeq_f64(lhs.zw, rhs.zw)))) != 0;
 #else
 		return lhs.x >= rhs.x && lhs.y >= rhs.y && lhs.z >= rhs.z && lhs.w >= rhs.w;
 #endif
@@ -787,12 +988,18 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if all 3 components are greater equal, otherwise false: all(lhs >= rhs)
 	//////////////////////////////////////////////////////////////////////////
-	inline bool vector_all_greater_equal3(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL vector_all_greater_equal3(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_GE_OQ)) & 0x7) == 0x7;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_ge_pd = _mm_cmpge_pd(lhs.xy, rhs.xy);
 		__m128d zw_ge_pd = _mm_cmpge_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_ge_pd) == 3 && (_mm_movemask_pd(zw_ge_pd) & 1) != 0;
+#elif defined(RTM_NEON64_INTRINSICS)
+		const uint64x2_t xy_mask = vcgeq_f64(lhs.xy, rhs.xy);
+		const uint64x2_t zw_mask = vcgeq_f64(lhs.zw, rhs.zw);
+		return (vgetq_lane_u64(xy_mask, 0) & vgetq_lane_u64(xy_mask, 1) & vgetq_lane_u64(zw_mask, 0)) != 0;
 #else
 		return lhs.x >= rhs.x && lhs.y >= rhs.y && lhs.z >= rhs.z;
 #endif
@@ -801,12 +1008,16 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if any 4 components are greater equal, otherwise false: any(lhs >= rhs)
 	//////////////////////////////////////////////////////////////////////////
-	inline bool vector_any_greater_equal(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL vector_any_greater_equal(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_GE_OQ)) != 0;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_ge_pd = _mm_cmpge_pd(lhs.xy, rhs.xy);
 		__m128d zw_ge_pd = _mm_cmpge_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_ge_pd) | _mm_movemask_pd(zw_ge_pd)) != 0;
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vmaxvq_u32(vreinterpretq_u32_u64(vorrq_u64(vcgeq_f64(lhs.xy, rhs.xy), vcgeq_f64(lhs.zw, rhs.zw)))) != 0;
 #else
 		return lhs.x >= rhs.x || lhs.y >= rhs.y || lhs.z >= rhs.z || lhs.w >= rhs.w;
 #endif
@@ -815,12 +1026,18 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if any 3 components are greater equal, otherwise false: any(lhs >= rhs)
 	//////////////////////////////////////////////////////////////////////////
-	inline bool vector_any_greater_equal3(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL vector_any_greater_equal3(vector4d_arg0 lhs, vector4d_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_GE_OQ)) & 0x7) != 0;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_ge_pd = _mm_cmpge_pd(lhs.xy, rhs.xy);
 		__m128d zw_ge_pd = _mm_cmpge_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_ge_pd) != 0 || (_mm_movemask_pd(zw_ge_pd) & 1) != 0;
+#elif defined(RTM_NEON64_INTRINSICS)
+		const uint64x2_t xy_mask = vcgeq_f64(lhs.xy, rhs.xy);
+		const uint64x2_t zw_mask = vcgeq_f64(lhs.zw, rhs.zw);
+		return (vgetq_lane_u64(xy_mask, 0) | vgetq_lane_u64(xy_mask, 1) | vgetq_lane_u64(zw_mask, 0)) != 0;
 #else
 		return lhs.x >= rhs.x || lhs.y >= rhs.y || lhs.z >= rhs.z;
 #endif
@@ -829,7 +1046,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if all 4 components are near equal, otherwise false: all(abs(lhs - rhs) < threshold)
 	//////////////////////////////////////////////////////////////////////////
-	inline bool vector_all_near_equal(const vector4d& lhs, const vector4d& rhs, double threshold = 0.00001) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL vector_all_near_equal(vector4d_arg0 lhs, vector4d_arg1 rhs, double threshold = 0.00001) RTM_NO_EXCEPT
 	{
 		return vector_all_less_equal(vector_abs(vector_sub(lhs, rhs)), vector_set(threshold));
 	}
@@ -837,7 +1054,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if all 3 components are near equal, otherwise false: all(abs(lhs - rhs) < threshold)
 	//////////////////////////////////////////////////////////////////////////
-	inline bool vector_all_near_equal3(const vector4d& lhs, const vector4d& rhs, double threshold = 0.00001) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL vector_all_near_equal3(vector4d_arg0 lhs, vector4d_arg1 rhs, double threshold = 0.00001) RTM_NO_EXCEPT
 	{
 		return vector_all_less_equal3(vector_abs(vector_sub(lhs, rhs)), vector_set(threshold));
 	}
@@ -845,7 +1062,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if any 4 components are near equal, otherwise false: any(abs(lhs - rhs) < threshold)
 	//////////////////////////////////////////////////////////////////////////
-	inline bool vector_any_near_equal(const vector4d& lhs, const vector4d& rhs, double threshold = 0.00001) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL vector_any_near_equal(vector4d_arg0 lhs, vector4d_arg1 rhs, double threshold = 0.00001) RTM_NO_EXCEPT
 	{
 		return vector_any_less_equal(vector_abs(vector_sub(lhs, rhs)), vector_set(threshold));
 	}
@@ -853,7 +1070,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if any 3 components are near equal, otherwise false: any(abs(lhs - rhs) < threshold)
 	//////////////////////////////////////////////////////////////////////////
-	inline bool vector_any_near_equal3(const vector4d& lhs, const vector4d& rhs, double threshold = 0.00001) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL vector_any_near_equal3(vector4d_arg0 lhs, vector4d_arg1 rhs, double threshold = 0.00001) RTM_NO_EXCEPT
 	{
 		return vector_any_less_equal3(vector_abs(vector_sub(lhs, rhs)), vector_set(threshold));
 	}
@@ -861,7 +1078,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if all 4 components are finite (not NaN/Inf), otherwise false: all(finite(input))
 	//////////////////////////////////////////////////////////////////////////
-	inline bool vector_is_finite(const vector4d& input) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL vector_is_finite(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
 		return scalar_is_finite(vector_get_x(input)) && scalar_is_finite(vector_get_y(input)) && scalar_is_finite(vector_get_z(input)) && scalar_is_finite(vector_get_w(input));
 	}
@@ -869,7 +1086,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if all 3 components are finite (not NaN/Inf), otherwise false: all(finite(input))
 	//////////////////////////////////////////////////////////////////////////
-	inline bool vector_is_finite3(const vector4d& input) RTM_NO_EXCEPT
+	inline bool RTM_SIMD_CALL vector_is_finite3(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
 		return scalar_is_finite(vector_get_x(input)) && scalar_is_finite(vector_get_y(input)) && scalar_is_finite(vector_get_z(input));
 	}
@@ -884,51 +1101,114 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Per component selection depending on the mask: mask != 0 ? if_true : if_false
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_select(const mask4q& mask, const vector4d& if_true, const vector4d& if_false) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_select(mask4q_arg0 mask, vector4d_arg1 if_true, vector4d_arg2 if_false) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_blendv_pd(if_false, if_true, mask);
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy = _mm_or_pd(_mm_andnot_pd(mask.xy, if_false.xy), _mm_and_pd(if_true.xy, mask.xy));
 		__m128d zw = _mm_or_pd(_mm_andnot_pd(mask.zw, if_false.zw), _mm_and_pd(if_true.zw, mask.zw));
 		return vector4d{ xy, zw };
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ vbslq_f64(mask.xy, if_true.xy, if_false.xy), vbslq_f64(mask.zw, if_true.zw, if_false.zw) };
 #else
 		return vector4d{ rtm_impl::select(mask.x, if_true.x, if_false.x), rtm_impl::select(mask.y, if_true.y, if_false.y), rtm_impl::select(mask.z, if_true.z, if_false.z), rtm_impl::select(mask.w, if_true.w, if_false.w) };
 #endif
 	}
 
+#if defined(RTM_NEON64_INTRINSICS)
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the register half that holds the desired component.
+		//////////////////////////////////////////////////////////////////////////
+		template<mix4 component>
+		inline float64x2_t RTM_SIMD_CALL vector_mix_half(vector4d_arg0 input0, vector4d_arg1 input1) RTM_NO_EXCEPT
+		{
+			if (static_condition<int(component) < 2>::test())
+				return input0.xy;
+			else if (static_condition<int(component) < 4>::test())
+				return input0.zw;
+			else if (static_condition<int(component) < 6>::test())
+				return input1.xy;
+			else
+				return input1.zw;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns a register half made of the two desired components.
+		//////////////////////////////////////////////////////////////////////////
+		template<mix4 comp0, mix4 comp1>
+		inline float64x2_t RTM_SIMD_CALL vector_mix_pair(vector4d_arg0 input0, vector4d_arg1 input1) RTM_NO_EXCEPT
+		{
+			const float64x2_t half0 = vector_mix_half<comp0>(input0, input1);
+			const float64x2_t half1 = vector_mix_half<comp1>(input0, input1);
+
+			if (static_condition<int(comp0) / 2 == int(comp1) / 2>::test())
+			{
+				// Both components live in the same half
+				if (static_condition<int(comp0) % 2 == 0 && int(comp1) % 2 == 1>::test())
+					return half0;
+				else if (static_condition<int(comp0) % 2 == 0 && int(comp1) % 2 == 0>::test())
+					return vdupq_laneq_f64(half0, 0);
+				else if (static_condition<int(comp0) % 2 == 1 && int(comp1) % 2 == 1>::test())
+					return vdupq_laneq_f64(half0, 1);
+				else
+					return vextq_f64(half0, half0, 1);
+			}
+			else
+			{
+				if (static_condition<int(comp0) % 2 == 0 && int(comp1) % 2 == 0>::test())
+					return vzip1q_f64(half0, half1);
+				else if (static_condition<int(comp0) % 2 == 1 && int(comp1) % 2 == 1>::test())
+					return vzip2q_f64(half0, half1);
+				else if (static_condition<int(comp0) % 2 == 1 && int(comp1) % 2 == 0>::test())
+					return vextq_f64(half0, half1, 1);
+				else
+					return vcopyq_laneq_f64(half0, 1, half1, 1);
+			}
+		}
+	}
+#endif
+
 	//////////////////////////////////////////////////////////////////////////
 	// Mixes two inputs and returns the desired components.
 	// [xyzw] indexes into the first input while [abcd] indexes in the second.
 	//////////////////////////////////////////////////////////////////////////
 	template<mix4 comp0, mix4 comp1, mix4 comp2, mix4 comp3>
-	inline vector4d vector_mix(const vector4d& input0, const vector4d& input1) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_mix(vector4d_arg0 input0, vector4d_arg1 input1) RTM_NO_EXCEPT
 	{
+#if defined(RTM_NEON64_INTRINSICS)
+		return vector4d{ rtm_impl::vector_mix_pair<comp0, comp1>(input0, input1), rtm_impl::vector_mix_pair<comp2, comp3>(input0, input1) };
+#else
 		// Slow code path, not yet optimized or not using intrinsics
 		const double x = rtm_impl::is_mix_xyzw(comp0) ? vector_get_component<comp0>(input0) : vector_get_component<comp0>(input1);
 		const double y = rtm_impl::is_mix_xyzw(comp1) ? vector_get_component<comp1>(input0) : vector_get_component<comp1>(input1);
 		const double z = rtm_impl::is_mix_xyzw(comp2) ? vector_get_component<comp2>(input0) : vector_get_component<comp2>(input1);
 		const double w = rtm_impl::is_mix_xyzw(comp3) ? vector_get_component<comp3>(input0) : vector_get_component<comp3>(input1);
 		return vector_set(x, y, z, w);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Replicates the [x] component in all components.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_dup_x(const vector4d& input) RTM_NO_EXCEPT { return vector_mix<mix4::x, mix4::x, mix4::x, mix4::x>(input, input); }
+	inline vector4d RTM_SIMD_CALL vector_dup_x(vector4d_arg0 input) RTM_NO_EXCEPT { return vector_mix<mix4::x, mix4::x, mix4::x, mix4::x>(input, input); }
 
 	//////////////////////////////////////////////////////////////////////////
 	// Replicates the [y] component in all components.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_dup_y(const vector4d& input) RTM_NO_EXCEPT { return vector_mix<mix4::y, mix4::y, mix4::y, mix4::y>(input, input); }
+	inline vector4d RTM_SIMD_CALL vector_dup_y(vector4d_arg0 input) RTM_NO_EXCEPT { return vector_mix<mix4::y, mix4::y, mix4::y, mix4::y>(input, input); }
 
 	//////////////////////////////////////////////////////////////////////////
 	// Replicates the [z] component in all components.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_dup_z(const vector4d& input) RTM_NO_EXCEPT { return vector_mix<mix4::z, mix4::z, mix4::z, mix4::z>(input, input); }
+	inline vector4d RTM_SIMD_CALL vector_dup_z(vector4d_arg0 input) RTM_NO_EXCEPT { return vector_mix<mix4::z, mix4::z, mix4::z, mix4::z>(input, input); }
 
 	//////////////////////////////////////////////////////////////////////////
 	// Replicates the [w] component in all components.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_dup_w(const vector4d& input) RTM_NO_EXCEPT { return vector_mix<mix4::w, mix4::w, mix4::w, mix4::w>(input, input); }
+	inline vector4d RTM_SIMD_CALL vector_dup_w(vector4d_arg0 input) RTM_NO_EXCEPT { return vector_mix<mix4::w, mix4::w, mix4::w, mix4::w>(input, input); }
 
 
 	//////////////////////////////////////////////////////////////////////////
@@ -939,11 +1219,594 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns per component the sign of the input vector: input >= 0.0 ? 1.0 : -1.0
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_sign(const vector4d& input) RTM_NO_EXCEPT
+	inline vector4d RTM_SIMD_CALL vector_sign(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
 		const mask4q mask = vector_greater_equal(input, vector_zero());
 		return vector_select(mask, vector_set(1.0), vector_set(-1.0));
 	}
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Trigonometry
+	//////////////////////////////////////////////////////////////////////////
+
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Per component remaps the input angles into [-PI/2, PI/2] for the sine and cosine polynomials.
+		// sin(x) = sin(PI - x) while cos(x) = -cos(PI - x), the cosine sign is returned.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4d RTM_SIMD_CALL sincos_remap(vector4d_arg0 input, vector4d& out_cos_sign) RTM_NO_EXCEPT
+		{
+			// Remap our input in the [-PI, PI] range
+			const vector4d quotient = vector_round_bankers(vector_mul(input, k_sincos_inv_two_pi_f64));
+			vector4d x = vector_neg_mul_sub(quotient, vector_set(k_sincos_two_pi_hi_f64), input);
+			x = vector_neg_mul_sub(quotient, vector_set(k_sincos_two_pi_lo_f64), x);
+
+			// Reflect our input in the [-PI/2, PI/2] range
+			const vector4d reference = vector_select(vector_less_than(x, vector_zero()), vector_set(-k_sincos_pi_f64), vector_set(k_sincos_pi_f64));
+			const mask4q is_in_range = vector_less_equal(vector_abs(x), vector_set(k_sincos_half_pi_f64));
+			out_cos_sign = vector_select(is_in_range, vector_set(1.0), vector_set(-1.0));
+			return vector_select(is_in_range, x, vector_sub(reference, x));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component evaluates the sine polynomial over [-PI/2, PI/2].
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4d RTM_SIMD_CALL sin_poly(vector4d_arg0 x) RTM_NO_EXCEPT
+		{
+			const vector4d x2 = vector_mul(x, x);
+			vector4d poly = vector_mul_add(vector_set(k_sin_c17_f64), x2, vector_set(k_sin_c15_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_sin_c13_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_sin_c11_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_sin_c9_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_sin_c7_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_sin_c5_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_sin_c3_f64));
+			return vector_mul_add(vector_mul(poly, x2), x, x);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component evaluates the cosine polynomial over [-PI/2, PI/2].
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4d RTM_SIMD_CALL cos_poly(vector4d_arg0 x) RTM_NO_EXCEPT
+		{
+			const vector4d x2 = vector_mul(x, x);
+			vector4d poly = vector_mul_add(vector_set(k_cos_c16_f64), x2, vector_set(k_cos_c14_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_cos_c12_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_cos_c10_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_cos_c8_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_cos_c6_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_cos_c4_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_cos_c2_f64));
+			return vector_mul_add(poly, x2, vector_set(1.0));
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns the sine of the input angles.
+	// The input is reduced into [-PI, PI] and reflected into [-PI/2, PI/2] where a
+	// minimax polynomial is evaluated, see rtm_impl::k_sincos_inv_two_pi_f64 for details.
+	// The max absolute error is 2.3e-16 within [-PI/2, PI/2] and 3.6e-16 within [-100 * PI, 100 * PI].
+	// The reduction loses accuracy past [-1.0e8, 1.0e8]: the error reaches 3.6e-15 within
+	// [-1.0e9, 1.0e9] and 1.0e-6 within [-1.0e10, 1.0e10], scalar_sin(..) handles any angle.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d RTM_SIMD_CALL vector_sin(vector4d_arg0 input) RTM_NO_EXCEPT
+	{
+		vector4d cos_sign;
+		const vector4d x = rtm_impl::sincos_remap(input, cos_sign);
+		return rtm_impl::sin_poly(x);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns the cosine of the input angles.
+	// The input is reduced into [-PI, PI] and reflected into [-PI/2, PI/2] where a
+	// minimax polynomial is evaluated, see rtm_impl::k_sincos_inv_two_pi_f64 for details.
+	// The max absolute error is 2.3e-16 within [-PI/2, PI/2] and 4.5e-16 within [-100 * PI, 100 * PI].
+	// The reduction loses accuracy past [-1.0e8, 1.0e8]: the error reaches 3.6e-15 within
+	// [-1.0e9, 1.0e9] and 1.0e-6 within [-1.0e10, 1.0e10], scalar_cos(..) handles any angle.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d RTM_SIMD_CALL vector_cos(vector4d_arg0 input) RTM_NO_EXCEPT
+	{
+		vector4d cos_sign;
+		const vector4d x = rtm_impl::sincos_remap(input, cos_sign);
+		return vector_mul(rtm_impl::cos_poly(x), cos_sign);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns both the sine and cosine of the input angles.
+	// The range reduction is shared, the error bounds match vector_sin(..) and vector_cos(..).
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_sincos(vector4d_arg0 input, vector4d& out_sin, vector4d& out_cos) RTM_NO_EXCEPT
+	{
+		vector4d cos_sign;
+		const vector4d x = rtm_impl::sincos_remap(input, cos_sign);
+		out_sin = rtm_impl::sin_poly(x);
+		out_cos = vector_mul(rtm_impl::cos_poly(x), cos_sign);
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Per component evaluates the arc-sine polynomial over [-0.5, 0.5].
+		//////////////////////////////////////////////////////////////////////////
+		template<accuracy precision>
+		vector4d RTM_SIMD_CALL asin_poly(vector4d_arg0 x) RTM_NO_EXCEPT;
+
+		template<>
+		inline vector4d RTM_SIMD_CALL asin_poly<accuracy::high>(vector4d_arg0 x) RTM_NO_EXCEPT
+		{
+			const vector4d x2 = vector_mul(x, x);
+			vector4d poly = vector_mul_add(vector_set(k_asin_c27_f64), x2, vector_set(k_asin_c25_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_asin_c23_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_asin_c21_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_asin_c19_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_asin_c17_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_asin_c15_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_asin_c13_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_asin_c11_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_asin_c9_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_asin_c7_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_asin_c5_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_asin_c3_f64));
+			return vector_mul_add(vector_mul(poly, x2), x, x);
+		}
+
+		template<>
+		inline vector4d RTM_SIMD_CALL asin_poly<accuracy::low>(vector4d_arg0 x) RTM_NO_EXCEPT
+		{
+			const vector4d x2 = vector_mul(x, x);
+			vector4d poly = vector_mul_add(vector_set(k_asin_low_c11_f64), x2, vector_set(k_asin_low_c9_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_asin_low_c7_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_asin_low_c5_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_asin_low_c3_f64));
+			return vector_mul_add(vector_mul(poly, x2), x, x);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component evaluates the arc-tangent polynomial over [-tan(PI/8), tan(PI/8)].
+		//////////////////////////////////////////////////////////////////////////
+		template<accuracy precision>
+		vector4d RTM_SIMD_CALL atan_poly(vector4d_arg0 x) RTM_NO_EXCEPT;
+
+		template<>
+		inline vector4d RTM_SIMD_CALL atan_poly<accuracy::high>(vector4d_arg0 x) RTM_NO_EXCEPT
+		{
+			const vector4d x2 = vector_mul(x, x);
+			vector4d poly = vector_mul_add(vector_set(k_atan_c23_f64), x2, vector_set(k_atan_c21_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_atan_c19_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_atan_c17_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_atan_c15_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_atan_c13_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_atan_c11_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_atan_c9_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_atan_c7_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_atan_c5_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_atan_c3_f64));
+			return vector_mul_add(vector_mul(poly, x2), x, x);
+		}
+
+		template<>
+		inline vector4d RTM_SIMD_CALL atan_poly<accuracy::low>(vector4d_arg0 x) RTM_NO_EXCEPT
+		{
+			const vector4d x2 = vector_mul(x, x);
+			vector4d poly = vector_mul_add(vector_set(k_atan_low_c9_f64), x2, vector_set(k_atan_low_c7_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_atan_low_c5_f64));
+			poly = vector_mul_add(poly, x2, vector_set(k_atan_low_c3_f64));
+			return vector_mul_add(vector_mul(poly, x2), x, x);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns the arc-sine of the input.
+	// Inputs within [-0.5, 0.5] evaluate a minimax polynomial directly while larger
+	// inputs use asin(x) = PI/2 - 2 * asin(sqrt((1 - x) / 2)), see rtm_impl::k_asin_c3_f64 for details.
+	// Inputs outside [-1.0, 1.0] return NaN.
+	// The max absolute error is 2.9e-16 with accuracy::high and 5.1e-9 with accuracy::low.
+	//////////////////////////////////////////////////////////////////////////
+	template<accuracy precision = accuracy::high>
+	inline vector4d RTM_SIMD_CALL vector_asin(vector4d_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4d abs_input = vector_abs(input);
+		const mask4q is_small = vector_less_equal(abs_input, vector_set(0.5));
+		const vector4d large_x = vector_sqrt(vector_mul(vector_sub(vector_set(1.0), abs_input), 0.5));
+
+		const vector4d poly = rtm_impl::asin_poly<precision>(vector_select(is_small, abs_input, large_x));
+		const vector4d large_result = vector_neg_mul_sub(poly, vector_set(2.0), vector_set(rtm_impl::k_sincos_half_pi_f64));
+		const vector4d abs_result = vector_select(is_small, poly, large_result);
+		return vector_select(vector_less_than(input, vector_zero()), vector_neg(abs_result), abs_result);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns the arc-cosine of the input.
+	// Inputs within [-0.5, 0.5] use acos(x) = PI/2 - asin(x) while larger inputs use
+	// acos(x) = 2 * asin(sqrt((1 - x) / 2)) and acos(-x) = PI - acos(x), see vector_asin(..).
+	// Inputs outside [-1.0, 1.0] return NaN.
+	// The max absolute error is 5.3e-16 with accuracy::high and 5.1e-9 with accuracy::low.
+	//////////////////////////////////////////////////////////////////////////
+	template<accuracy precision = accuracy::high>
+	inline vector4d RTM_SIMD_CALL vector_acos(vector4d_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4d abs_input = vector_abs(input);
+		const mask4q is_small = vector_less_equal(abs_input, vector_set(0.5));
+		const vector4d large_x = vector_sqrt(vector_mul(vector_sub(vector_set(1.0), abs_input), 0.5));
+
+		const vector4d poly = rtm_impl::asin_poly<precision>(vector_select(is_small, input, large_x));
+		const vector4d small_result = vector_sub(vector_set(rtm_impl::k_sincos_half_pi_f64), poly);
+		const vector4d large_result = vector_add(poly, poly);
+		const vector4d signed_large_result = vector_select(vector_less_than(input, vector_zero()), vector_sub(vector_set(rtm_impl::k_sincos_pi_f64), large_result), large_result);
+		return vector_select(is_small, small_result, signed_large_result);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns the arc-tangent of the input.
+	// The input is reduced into [-tan(PI/8), tan(PI/8)] with atan(x) = PI/4 + atan((x - 1) / (x + 1))
+	// and atan(x) = PI/2 - atan(1 / x) where a minimax polynomial is evaluated, see rtm_impl::k_asin_c3_f64 for details.
+	// The max absolute error is 2.4e-16 with accuracy::high and 8.1e-9 with accuracy::low.
+	//////////////////////////////////////////////////////////////////////////
+	template<accuracy precision = accuracy::high>
+	inline vector4d RTM_SIMD_CALL vector_atan(vector4d_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4d abs_input = vector_abs(input);
+		const mask4q is_large = vector_less_than(vector_set(rtm_impl::k_inv_trig_tan_3pi_8_f64), abs_input);
+		const mask4q is_mid = vector_less_than(vector_set(rtm_impl::k_inv_trig_tan_pi_8_f64), abs_input);
+
+		// A single division handles all three ranges
+		const vector4d one = vector_set(1.0);
+		const vector4d numerator = vector_select(is_large, vector_set(-1.0), vector_select(is_mid, vector_sub(abs_input, one), abs_input));
+		const vector4d denominator = vector_select(is_large, abs_input, vector_select(is_mid, vector_add(abs_input, one), one));
+		const vector4d offset = vector_select(is_large, vector_set(rtm_impl::k_sincos_half_pi_f64), vector_select(is_mid, vector_set(rtm_impl::k_inv_trig_quarter_pi_f64), vector_zero()));
+
+		const vector4d abs_result = vector_add(offset, rtm_impl::atan_poly<precision>(vector_div(numerator, denominator)));
+		return vector_select(vector_less_than(input, vector_zero()), vector_neg(abs_result), abs_result);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns the arc-tangent of [y/x] using the sign of the arguments to
+	// determine the correct quadrant. The argument order matches scalar_atan2(..).
+	// The ratio of the smallest to the largest magnitude is evaluated with the vector_atan(..) polynomial.
+	// The max absolute error is 4.7e-16 with accuracy::high and 8.1e-9 with accuracy::low.
+	// When both inputs are zero, zero is returned. The sign of zero inputs is ignored
+	// and infinite inputs are not supported.
+	//////////////////////////////////////////////////////////////////////////
+	template<accuracy precision = accuracy::high>
+	inline vector4d RTM_SIMD_CALL vector_atan2(vector4d_arg0 y, vector4d_arg1 x) RTM_NO_EXCEPT
+	{
+		const vector4d abs_y = vector_abs(y);
+		const vector4d abs_x = vector_abs(x);
+		const mask4q is_y_larger = vector_less_than(abs_x, abs_y);
+		const vector4d min_value = vector_min(abs_x, abs_y);
+		const vector4d max_value = vector_max(abs_x, abs_y);
+
+		// Reduce into [-tan(PI/8), tan(PI/8)] with atan(t) = PI/4 + atan((t - 1) / (t + 1))
+		const mask4q is_mid = vector_less_than(vector_mul(max_value, rtm_impl::k_inv_trig_tan_pi_8_f64), min_value);
+		const vector4d numerator = vector_select(is_mid, vector_sub(min_value, max_value), min_value);
+		const vector4d denominator = vector_select(is_mid, vector_add(min_value, max_value), max_value);
+		const vector4d ratio = vector_select(vector_less_equal(max_value, vector_zero()), vector_zero(), vector_div(numerator, denominator));
+		const vector4d offset = vector_select(is_mid, vector_set(rtm_impl::k_inv_trig_quarter_pi_f64), vector_zero());
+
+		vector4d result = vector_add(offset, rtm_impl::atan_poly<precision>(ratio));
+		result = vector_select(is_y_larger, vector_sub(vector_set(rtm_impl::k_sincos_half_pi_f64), result), result);
+		result = vector_select(vector_less_than(x, vector_zero()), vector_sub(vector_set(rtm_impl::k_sincos_pi_f64), result), result);
+		return vector_select(vector_less_than(y, vector_zero()), vector_neg(result), result);
+	}
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Exponential and logarithm
+	//////////////////////////////////////////////////////////////////////////
+
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Constants used by the exponential and logarithm approximations.
+		// exp(x) = 2^n * exp(r) where n = floor(x / ln(2)) and r = x - n * ln(2) within [0, ln(2)),
+		// with a two part Cody-Waite reduction (ln(2) = hi + lo where hi has few significant bits).
+		// exp(r) ~= 1 + r + r^2 * (c2 + r * (c3 + ... + r * c11))
+		// log(x) = e * ln(2) + log(m) where m is the mantissa within [sqrt(2)/2, sqrt(2)) and
+		// log(m) = 2 * atanh(s) with s = (m - 1) / (m + 1) within [-0.172, 0.172].
+		// log(m) ~= 2 * s + s^3 * (c3 + s^2 * (c5 + ... + s^2 * c15))
+		// Both polynomials are Remez minimax fits for relative error, the exponential has a
+		// max relative error of 4.0e-18 and the logarithm 6.2e-18, both below float64 rounding.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr double k_exp_ln2_hi_f64 = 6.93147180369123816490e-1;					// ln(2) = hi + lo
+		constexpr double k_exp_ln2_lo_f64 = 1.90821492927058770002e-10;
+		constexpr double k_exp_log2e_f64 = 1.44269504088896340735992468100189214;		// 1 / ln(2)
+		constexpr double k_exp_max_exponent_f64 = 1023.99999999999988631316227838397026;	// Largest double below 1024
+		constexpr double k_exp_min_exponent_f64 = -1022.0;
+
+		constexpr double k_exp_c2_f64 = 4.99999999999973798737e-1;
+		constexpr double k_exp_c3_f64 = 1.66666666667905305488e-1;
+		constexpr double k_exp_c4_f64 = 4.16666666438201827027e-2;
+		constexpr double k_exp_c5_f64 = 8.33333355686322573008e-3;
+		constexpr double k_exp_c6_f64 = 1.38888757622209922313e-3;
+		constexpr double k_exp_c7_f64 = 1.98417606078362838626e-4;
+		constexpr double k_exp_c8_f64 = 2.47896323441893764658e-5;
+		constexpr double k_exp_c9_f64 = 2.77459168443846362657e-6;
+		constexpr double k_exp_c10_f64 = 2.57106796501589646217e-7;
+		constexpr double k_exp_c11_f64 = 3.50684087063438893256e-8;
+
+		constexpr double k_log_sqrt2_f64 = 1.41421356237309504880168872420969808;
+		constexpr double k_log_min_normal_f64 = 2.2250738585072013830902327173324041e-308;	// Smallest normal double
+		constexpr double k_log_denormal_scale_f64 = 4503599627370496.0;						// 2^52
+
+		constexpr double k_log_c3_f64 = 6.66666666666667073748e-1;
+		constexpr double k_log_c5_f64 = 3.99999999999112343385e-1;
+		constexpr double k_log_c7_f64 = 2.85714286206596945750e-1;
+		constexpr double k_log_c9_f64 = 2.22222117800613350180e-1;
+		constexpr double k_log_c11_f64 = 1.81828589720155642251e-1;
+		constexpr double k_log_c13_f64 = 1.53322421061428015854e-1;
+		constexpr double k_log_c15_f64 = 1.46148550230377344272e-1;
+
+#if defined(RTM_SSE2_INTRINSICS)
+		//////////////////////////////////////////////////////////////////////////
+		// Returns 2^n for integral inputs within [-1022, 1023].
+		// Adding 2^52 + 1023 moves the biased exponent into the low mantissa bits
+		// where it is shifted into place.
+		//////////////////////////////////////////////////////////////////////////
+		inline __m128d RTM_SIMD_CALL exp2_integral_sse2(__m128d input) RTM_NO_EXCEPT
+		{
+			const __m128d biased_exponent = _mm_add_pd(input, _mm_set1_pd(4503599627371519.0));		// 2^52 + 1023
+			return _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(biased_exponent), 52));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Splits positive normal inputs into their mantissa within [1.0, 2.0) and their unbiased exponent.
+		// The biased exponent is converted by writing it into the low mantissa bits of 2^52.
+		//////////////////////////////////////////////////////////////////////////
+		inline __m128d RTM_SIMD_CALL split_exponent_sse2(__m128d input, __m128d& out_exponent) RTM_NO_EXCEPT
+		{
+			const __m128i exponent_bits = _mm_srli_epi64(_mm_castpd_si128(input), 52);
+			out_exponent = _mm_sub_pd(_mm_or_pd(_mm_castsi128_pd(exponent_bits), _mm_set1_pd(4503599627370496.0)), _mm_set1_pd(4503599627371519.0));
+
+			const __m128d mantissa_mask = _mm_castsi128_pd(_mm_set_epi32(0x000FFFFF, -1, 0x000FFFFF, -1));
+			return _mm_or_pd(_mm_and_pd(input, mantissa_mask), _mm_set1_pd(1.0));
+		}
+#elif defined(RTM_NEON64_INTRINSICS)
+		//////////////////////////////////////////////////////////////////////////
+		// Returns 2^n for integral inputs within [-1022, 1023].
+		// Adding 2^52 + 1023 moves the biased exponent into the low mantissa bits
+		// where it is shifted into place.
+		//////////////////////////////////////////////////////////////////////////
+		inline float64x2_t RTM_SIMD_CALL exp2_integral_neon64(float64x2_t input) RTM_NO_EXCEPT
+		{
+			const float64x2_t biased_exponent = vaddq_f64(input, vdupq_n_f64(4503599627371519.0));		// 2^52 + 1023
+			return vreinterpretq_f64_u64(vshlq_n_u64(vreinterpretq_u64_f64(biased_exponent), 52));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Splits positive normal inputs into their mantissa within [1.0, 2.0) and their unbiased exponent.
+		// The biased exponent is converted by writing it into the low mantissa bits of 2^52.
+		//////////////////////////////////////////////////////////////////////////
+		inline float64x2_t RTM_SIMD_CALL split_exponent_neon64(float64x2_t input, float64x2_t& out_exponent) RTM_NO_EXCEPT
+		{
+			const uint64x2_t exponent_bits = vshrq_n_u64(vreinterpretq_u64_f64(input), 52);
+			const float64x2_t exponent = vreinterpretq_f64_u64(vorrq_u64(exponent_bits, vreinterpretq_u64_f64(vdupq_n_f64(4503599627370496.0))));
+			out_exponent = vsubq_f64(exponent, vdupq_n_f64(4503599627371519.0));
+
+			const uint64x2_t mantissa_mask = vdupq_n_u64(0x000FFFFFFFFFFFFFULL);
+			return vreinterpretq_f64_u64(vorrq_u64(vandq_u64(vreinterpretq_u64_f64(input), mantissa_mask), vreinterpretq_u64_f64(vdupq_n_f64(1.0))));
+		}
+#endif
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component returns 2^n for integral inputs within [-1022, 1023].
+		// The biased exponent is written directly into the floating point bits.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4d RTM_SIMD_CALL vector_exp2_integral(vector4d_arg0 input) RTM_NO_EXCEPT
+		{
+#if defined(RTM_AVX_INTRINSICS)
+			const __m128d xy = exp2_integral_sse2(_mm256_castpd256_pd128(input));
+			const __m128d zw = exp2_integral_sse2(_mm256_extractf128_pd(input, 1));
+			return _mm256_insertf128_pd(_mm256_castpd128_pd256(xy), zw, 1);
+#elif defined(RTM_SSE2_INTRINSICS)
+			return vector4d{ exp2_integral_sse2(input.xy), exp2_integral_sse2(input.zw) };
+#elif defined(RTM_NEON64_INTRINSICS)
+			return vector4d{ exp2_integral_neon64(input.xy), exp2_integral_neon64(input.zw) };
+#else
+			return vector_set(std::ldexp(1.0, int(input.x)), std::ldexp(1.0, int(input.y)), std::ldexp(1.0, int(input.z)), std::ldexp(1.0, int(input.w)));
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component splits positive normal inputs into their mantissa within [1.0, 2.0)
+		// and their unbiased exponent: input = mantissa * 2^exponent
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4d RTM_SIMD_CALL vector_split_exponent(vector4d_arg0 input, vector4d& out_exponent) RTM_NO_EXCEPT
+		{
+#if defined(RTM_AVX_INTRINSICS)
+			__m128d exponent_xy;
+			__m128d exponent_zw;
+			const __m128d mantissa_xy = split_exponent_sse2(_mm256_castpd256_pd128(input), exponent_xy);
+			const __m128d mantissa_zw = split_exponent_sse2(_mm256_extractf128_pd(input, 1), exponent_zw);
+			out_exponent = _mm256_insertf128_pd(_mm256_castpd128_pd256(exponent_xy), exponent_zw, 1);
+			return _mm256_insertf128_pd(_mm256_castpd128_pd256(mantissa_xy), mantissa_zw, 1);
+#elif defined(RTM_SSE2_INTRINSICS)
+			vector4d mantissa;
+			mantissa.xy = split_exponent_sse2(input.xy, out_exponent.xy);
+			mantissa.zw = split_exponent_sse2(input.zw, out_exponent.zw);
+			return mantissa;
+#elif defined(RTM_NEON64_INTRINSICS)
+			vector4d mantissa;
+			mantissa.xy = split_exponent_neon64(input.xy, out_exponent.xy);
+			mantissa.zw = split_exponent_neon64(input.zw, out_exponent.zw);
+			return mantissa;
+#else
+			int exponent_x;
+			int exponent_y;
+			int exponent_z;
+			int exponent_w;
+			const double mantissa_x = std::frexp(input.x, &exponent_x);
+			const double mantissa_y = std::frexp(input.y, &exponent_y);
+			const double mantissa_z = std::frexp(input.z, &exponent_z);
+			const double mantissa_w = std::frexp(input.w, &exponent_w);
+
+			// frexp returns a mantissa within [0.5, 1.0)
+			out_exponent = vector_set(double(exponent_x - 1), double(exponent_y - 1), double(exponent_z - 1), double(exponent_w - 1));
+			return vector_set(mantissa_x * 2.0, mantissa_y * 2.0, mantissa_z * 2.0, mantissa_w * 2.0);
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component evaluates the exponential polynomial over [0, ln(2)).
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4d RTM_SIMD_CALL exp_poly(vector4d_arg0 r) RTM_NO_EXCEPT
+		{
+			vector4d poly = vector_mul_add(vector_set(k_exp_c11_f64), r, vector_set(k_exp_c10_f64));
+			poly = vector_mul_add(poly, r, vector_set(k_exp_c9_f64));
+			poly = vector_mul_add(poly, r, vector_set(k_exp_c8_f64));
+			poly = vector_mul_add(poly, r, vector_set(k_exp_c7_f64));
+			poly = vector_mul_add(poly, r, vector_set(k_exp_c6_f64));
+			poly = vector_mul_add(poly, r, vector_set(k_exp_c5_f64));
+			poly = vector_mul_add(poly, r, vector_set(k_exp_c4_f64));
+			poly = vector_mul_add(poly, r, vector_set(k_exp_c3_f64));
+			poly = vector_mul_add(poly, r, vector_set(k_exp_c2_f64));
+			return vector_mul_add(vector_mul(poly, r), r, vector_add(r, vector_set(1.0)));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component returns the largest integer value not greater than the input.
+		// Unlike vector_floor(..), this does not fall back to scalar code without SSE4.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4d RTM_SIMD_CALL exp_floor(vector4d_arg0 input) RTM_NO_EXCEPT
+		{
+			const vector4d rounded = vector_round_bankers(input);
+			return vector_select(vector_less_than(input, rounded), vector_sub(rounded, vector_set(1.0)), rounded);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component returns 2^exponent * exp(r) and handles overflow and underflow.
+		// The exponent must be integral and the original exponent determines the range.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4d RTM_SIMD_CALL exp_scale(vector4d_arg0 poly, vector4d_arg1 exponent, vector4d_arg2 unclamped_exponent) RTM_NO_EXCEPT
+		{
+			const vector4d result = vector_mul(poly, vector_exp2_integral(exponent));
+			const vector4d saturated = vector_select(vector_less_than(unclamped_exponent, vector_set(k_exp_min_exponent_f64)), vector_zero(), result);
+			return vector_select(vector_less_than(vector_set(k_exp_max_exponent_f64), unclamped_exponent), vector_set(std::numeric_limits<double>::infinity()), saturated);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component returns log(m) / 2 (the atanh polynomial) and the exponent of the input
+		// with the mantissa remapped into [sqrt(2)/2, sqrt(2)). Denormal inputs are supported.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4d RTM_SIMD_CALL log_mantissa(vector4d_arg0 input, vector4d& out_exponent) RTM_NO_EXCEPT
+		{
+			// Denormals are scaled into the normal range first
+			const mask4q is_denormal = vector_less_than(input, vector_set(k_log_min_normal_f64));
+			const vector4d normal_input = vector_select(is_denormal, vector_mul(input, k_log_denormal_scale_f64), input);
+			const vector4d exponent_offset = vector_select(is_denormal, vector_set(-52.0), vector_zero());
+
+			vector4d exponent;
+			vector4d mantissa = vector_split_exponent(normal_input, exponent);
+
+			const mask4q is_large = vector_less_than(vector_set(k_log_sqrt2_f64), mantissa);
+			mantissa = vector_select(is_large, vector_mul(mantissa, 0.5), mantissa);
+			out_exponent = vector_add(vector_add(exponent, exponent_offset), vector_select(is_large, vector_set(1.0), vector_zero()));
+
+			const vector4d one = vector_set(1.0);
+			const vector4d s = vector_div(vector_sub(mantissa, one), vector_add(mantissa, one));
+			const vector4d s2 = vector_mul(s, s);
+			vector4d poly = vector_mul_add(vector_set(k_log_c15_f64), s2, vector_set(k_log_c13_f64));
+			poly = vector_mul_add(poly, s2, vector_set(k_log_c11_f64));
+			poly = vector_mul_add(poly, s2, vector_set(k_log_c9_f64));
+			poly = vector_mul_add(poly, s2, vector_set(k_log_c7_f64));
+			poly = vector_mul_add(poly, s2, vector_set(k_log_c5_f64));
+			poly = vector_mul_add(poly, s2, vector_set(k_log_c3_f64));
+			return vector_mul_add(vector_mul(poly, s2), s, vector_add(s, s));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component handles the inputs outside the logarithm domain.
+		// log(+inf) = +inf, log(0) = -inf, and log(x < 0) = NaN
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4d RTM_SIMD_CALL log_special_cases(vector4d_arg0 input, vector4d_arg1 result) RTM_NO_EXCEPT
+		{
+			const vector4d infinity = vector_set(std::numeric_limits<double>::infinity());
+			vector4d output = vector_select(vector_greater_equal(input, infinity), infinity, result);
+			output = vector_select(vector_less_equal(input, vector_zero()), vector_neg(infinity), output);
+			return vector_select(vector_less_than(input, vector_zero()), vector_set(std::numeric_limits<double>::quiet_NaN()), output);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns e raised to the power of the input: e^input
+	// The input is reduced into [0, ln(2)) where a minimax polynomial is evaluated and the
+	// result is scaled by a power of two, see rtm_impl::k_exp_ln2_hi_f64 for details.
+	// Results that overflow return +inf and results below the smallest normal double return 0.0.
+	// NaN inputs are not supported.
+	// The max relative error is 2.3e-16.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d RTM_SIMD_CALL vector_exp(vector4d_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4d unclamped_exponent = vector_mul(input, rtm_impl::k_exp_log2e_f64);
+		const vector4d clamped_exponent = vector_clamp(unclamped_exponent, vector_set(rtm_impl::k_exp_min_exponent_f64), vector_set(rtm_impl::k_exp_max_exponent_f64));
+		const vector4d exponent = rtm_impl::exp_floor(clamped_exponent);
+
+		vector4d r = vector_neg_mul_sub(exponent, vector_set(rtm_impl::k_exp_ln2_hi_f64), input);
+		r = vector_neg_mul_sub(exponent, vector_set(rtm_impl::k_exp_ln2_lo_f64), r);
+		return rtm_impl::exp_scale(rtm_impl::exp_poly(r), exponent, unclamped_exponent);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns 2 raised to the power of the input: 2^input
+	// The fractional part is evaluated with the vector_exp(..) polynomial.
+	// Results that overflow return +inf and results below the smallest normal double return 0.0.
+	// NaN inputs are not supported.
+	// The max relative error is 2.3e-16.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d RTM_SIMD_CALL vector_exp2(vector4d_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4d clamped_exponent = vector_clamp(input, vector_set(rtm_impl::k_exp_min_exponent_f64), vector_set(rtm_impl::k_exp_max_exponent_f64));
+		const vector4d exponent = rtm_impl::exp_floor(clamped_exponent);
+
+		const vector4d r = vector_mul(vector_sub(clamped_exponent, exponent), rtm_impl::k_exp_ln2_hi_f64 + rtm_impl::k_exp_ln2_lo_f64);
+		return rtm_impl::exp_scale(rtm_impl::exp_poly(r), exponent, input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns the natural logarithm of the input.
+	// The mantissa is reduced into [sqrt(2)/2, sqrt(2)) where a minimax polynomial is evaluated,
+	// see rtm_impl::k_exp_ln2_hi_f64 for details. Denormal inputs are supported.
+	// log(+inf) = +inf, log(0) = -inf, and log(x < 0) = NaN. NaN inputs are not supported.
+	// The max absolute error is 1.1e-16 within [0.5, 2.0] and the max relative error elsewhere is 2.1e-16.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d RTM_SIMD_CALL vector_log(vector4d_arg0 input) RTM_NO_EXCEPT
+	{
+		vector4d exponent;
+		const vector4d log_mantissa = rtm_impl::log_mantissa(input, exponent);
+
+		// log(x) = e * ln(2) + log(m), the small part of ln(2) is added first to retain precision
+		const vector4d result = vector_mul_add(exponent, vector_set(rtm_impl::k_exp_ln2_hi_f64), vector_mul_add(exponent, vector_set(rtm_impl::k_exp_ln2_lo_f64), log_mantissa));
+		return rtm_impl::log_special_cases(input, result);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns the base 2 logarithm of the input.
+	// The mantissa is evaluated with the vector_log(..) polynomial and the exponent is exact.
+	// log2(+inf) = +inf, log2(0) = -inf, and log2(x < 0) = NaN. NaN inputs are not supported.
+	// The max absolute error is 1.8e-16 within [0.5, 2.0] and the max relative error elsewhere is 1.8e-16.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d RTM_SIMD_CALL vector_log2(vector4d_arg0 input) RTM_NO_EXCEPT
+	{
+		vector4d exponent;
+		const vector4d log_mantissa = rtm_impl::log_mantissa(input, exponent);
+
+		const vector4d result = vector_mul_add(log_mantissa, vector_set(rtm_impl::k_exp_log2e_f64), exponent);
+		return rtm_impl::log_special_cases(input, result);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns the base raised to the power of the exponent: base^exponent
+	// Computed as exp2(exponent * log2(base)), the error grows with the magnitude of the result.
+	// Negative bases return NaN, even with integral exponents, and pow(0, 0) returns NaN.
+	// The max relative error is 9.5e-15 for bases within [0.01, 10.0] and exponents within [-5.0, 5.0].
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d RTM_SIMD_CALL vector_pow(vector4d_arg0 base, vector4d_arg1 exponent) RTM_NO_EXCEPT
+	{
+		return vector_exp2(vector_mul(exponent, vector_log2(base)));
+	}
 }
 
 RTM_IMPL_FILE_PRAGMA_POP
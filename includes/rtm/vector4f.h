@@ -31,6 +31,9 @@
 #include "rtm/impl/memory_utils.h"
 #include "rtm/impl/vector_common.h"
 
+#include <cmath>
+#include <limits>
+
 RTM_IMPL_FILE_PRAGMA_PUSH
 
 namespace rtm
@@ -129,10 +132,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Casts a vector4 float64 variant to a float32 variant.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_cast(const vector4d& input) RTM_NO_EXCEPT
+	inline vector4f RTM_SIMD_CALL vector_cast(vector4d_arg0 input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_cvtpd_ps(input);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return _mm_shuffle_ps(_mm_cvtpd_ps(input.xy), _mm_cvtpd_ps(input.zw), _MM_SHUFFLE(1, 0, 1, 0));
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vcvt_high_f32_f64(vcvt_f32_f64(input.xy), input.zw);
 #else
 		return vector_set(float(input.x), float(input.y), float(input.z), float(input.w));
 #endif
@@ -242,10 +249,16 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline void RTM_SIMD_CALL vector_store(vector4f_arg0 input, float* output) RTM_NO_EXCEPT
 	{
+#if defined(RTM_SSE2_INTRINSICS)
+		_mm_storeu_ps(output, input);
+#elif defined(RTM_NEON_INTRINSICS)
+		vst1q_f32(output, input);
+#else
 		output[0] = vector_get_x(input);
 		output[1] = vector_get_y(input);
 		output[2] = vector_get_z(input);
 		output[3] = vector_get_w(input);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -312,10 +325,16 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline void RTM_SIMD_CALL vector_store(vector4f_arg0 input, float4f* output) RTM_NO_EXCEPT
 	{
+#if defined(RTM_SSE2_INTRINSICS)
+		_mm_storeu_ps(&output->x, input);
+#elif defined(RTM_NEON_INTRINSICS)
+		vst1q_f32(&output->x, input);
+#else
 		output->x = vector_get_x(input);
 		output->y = vector_get_y(input);
 		output->z = vector_get_z(input);
 		output->w = vector_get_w(input);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -337,6 +356,43 @@ namespace rtm
 		output->z = vector_get_z(input);
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Writes a vector4 to 16 bytes aligned memory with a non-temporal store that bypasses the cache.
+	// This avoids evicting useful data when writing large buffers that are not read again
+	// soon by the CPU. Whole cache lines should be written to avoid partial writes to memory.
+	// vector_store_stream_fence() must be called once the buffer is written.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_store_stream(vector4f_arg0 input, float* output) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(rtm_impl::is_aligned_to(output, 16), "Invalid alignment");
+#if defined(RTM_SSE2_INTRINSICS)
+		_mm_stream_ps(output, input);
+#elif defined(RTM_NEON64_INTRINSICS) && (defined(__clang__) || defined(__GNUC__))
+		__asm__ __volatile__("stnp %d[lo], %d[hi], [%[ptr]]" : : [lo] "w" (vget_low_f32(input)), [hi] "w" (vget_high_f32(input)), [ptr] "r" (output) : "memory");
+#else
+		vector_store(input, output);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes a vector4 to 16 bytes aligned memory with a non-temporal store that bypasses the cache.
+	// See vector_store_stream(vector4f_arg0, float*) for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_store_stream(vector4f_arg0 input, vector4f* output) RTM_NO_EXCEPT
+	{
+		vector_store_stream(input, reinterpret_cast<float*>(output));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Orders the non-temporal stores issued before it with the stores that follow.
+	// Must be called once a buffer is written with vector_store_stream(..) before
+	// another thread or the GPU reads it.
+	//////////////////////////////////////////////////////////////////////////
+	inline void vector_store_stream_fence() RTM_NO_EXCEPT
+	{
+		rtm_impl::memory_stream_fence();
+	}
+
 
 
 	//////////////////////////////////////////////////////////////////////////
@@ -514,6 +570,57 @@ namespace rtm
 #endif
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Per component square root of the input: sqrt(input)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_sqrt(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_sqrt_ps(input);
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vsqrtq_f32(input);
+#else
+		return vector_set(scalar_sqrt(vector_get_x(input)), scalar_sqrt(vector_get_y(input)), scalar_sqrt(vector_get_z(input)), scalar_sqrt(vector_get_w(input)));
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component reciprocal square root of the input: 1.0 / sqrt(input)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_sqrt_reciprocal(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		// Perform two passes of Newton-Raphson iteration on the hardware estimate
+		__m128 half = _mm_set_ps1(0.5f);
+		__m128 input_half_v = _mm_mul_ps(input, half);
+		__m128 x0 = _mm_rsqrt_ps(input);
+
+		// First iteration
+		__m128 x1 = _mm_mul_ps(x0, x0);
+		x1 = _mm_sub_ps(half, _mm_mul_ps(input_half_v, x1));
+		x1 = _mm_add_ps(_mm_mul_ps(x0, x1), x0);
+
+		// Second iteration
+		__m128 x2 = _mm_mul_ps(x1, x1);
+		x2 = _mm_sub_ps(half, _mm_mul_ps(input_half_v, x2));
+		x2 = _mm_add_ps(_mm_mul_ps(x1, x2), x1);
+
+		return x2;
+#elif defined(RTM_NEON_INTRINSICS)
+		// Perform two passes of Newton-Raphson iteration on the hardware estimate
+		float32x4_t x0 = vrsqrteq_f32(input);
+
+		// First iteration
+		float32x4_t x1 = vmulq_f32(x0, vrsqrtsq_f32(vmulq_f32(x0, x0), input));
+
+		// Second iteration
+		float32x4_t x2 = vmulq_f32(x1, vrsqrtsq_f32(vmulq_f32(x1, x1), input));
+		return x2;
+#else
+		return vector_div(vector_set(1.0f), vector_sqrt(input));
+#endif
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Per component returns the smallest integer value not less than the input.
 	// vector_ceil([1.8, 1.0, -1.8, -1.0]) = [2.0, 1.0, -1.0, -1.0]
@@ -540,6 +647,36 @@ namespace rtm
 #endif
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns the rounded input using banker's rounding (half to even).
+	// vector_round_bankers([2.5, 1.5, 1.2, -2.5]) = [2.0, 2.0, 1.0, -2.0]
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_round_bankers(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE4_INTRINSICS)
+		return _mm_round_ps(input, 0x8);
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vrndnq_f32(input);
+#elif defined(RTM_SSE2_INTRINSICS)
+		const __m128 sign_mask = _mm_set_ps1(-0.0f);
+		const __m128 sign = _mm_and_ps(input, sign_mask);
+
+		// Adding and subtracting 2^23 forces the fractional part out of the mantissa and the
+		// default IEEE 754 rounding mode (round half to even) rounds it for us.
+		// We use the same sign as the input to handle positive and negative values.
+		const __m128 fractional_limit = _mm_set_ps1(8388608.0f);
+		const __m128 truncating_offset = _mm_or_ps(sign, fractional_limit);
+		const __m128 integer_part = _mm_sub_ps(_mm_add_ps(input, truncating_offset), truncating_offset);
+
+		// Inputs that large have no fractional part and are returned unchanged
+		const __m128 abs_input = _mm_andnot_ps(sign_mask, input);
+		const __m128 is_input_large = _mm_cmpge_ps(abs_input, fractional_limit);
+		return _mm_or_ps(_mm_and_ps(is_input_large, input), _mm_andnot_ps(is_input_large, integer_part));
+#else
+		return vector_set(scalar_round_bankers(vector_get_x(input)), scalar_round_bankers(vector_get_y(input)), scalar_round_bankers(vector_get_z(input)), scalar_round_bankers(vector_get_w(input)));
+#endif
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// 3D cross product: lhs x rhs
 	//////////////////////////////////////////////////////////////////////////
@@ -743,7 +880,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4f RTM_SIMD_CALL vector_mul_add(vector4f_arg0 v0, vector4f_arg1 v1, vector4f_arg2 v2) RTM_NO_EXCEPT
 	{
-#if defined(RTM_NEON_INTRINSICS)
+#if defined(RTM_FMA_INTRINSICS)
+		return _mm_fmadd_ps(v0, v1, v2);
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vfmaq_f32(v2, v0, v1);
+#elif defined(RTM_NEON_INTRINSICS)
 		return vmlaq_f32(v2, v0, v1);
 #else
 		return vector_add(vector_mul(v0, v1), v2);
@@ -755,7 +896,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4f RTM_SIMD_CALL vector_mul_add(vector4f_arg0 v0, float s1, vector4f_arg2 v2) RTM_NO_EXCEPT
 	{
-#if defined(RTM_NEON_INTRINSICS)
+#if defined(RTM_FMA_INTRINSICS)
+		return _mm_fmadd_ps(v0, _mm_set_ps1(s1), v2);
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vfmaq_n_f32(v2, v0, s1);
+#elif defined(RTM_NEON_INTRINSICS)
 		return vmlaq_n_f32(v2, v0, s1);
 #else
 		return vector_add(vector_mul(v0, s1), v2);
@@ -768,7 +913,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4f RTM_SIMD_CALL vector_neg_mul_sub(vector4f_arg0 v0, vector4f_arg1 v1, vector4f_arg2 v2) RTM_NO_EXCEPT
 	{
-#if defined(RTM_NEON_INTRINSICS)
+#if defined(RTM_FMA_INTRINSICS)
+		return _mm_fnmadd_ps(v0, v1, v2);
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vfmsq_f32(v2, v0, v1);
+#elif defined(RTM_NEON_INTRINSICS)
 		return vmlsq_f32(v2, v0, v1);
 #else
 		return vector_sub(v2, vector_mul(v0, v1));
@@ -1188,6 +1337,482 @@ namespace rtm
 		const mask4i mask = vector_greater_equal(input, vector_zero());
 		return vector_select(mask, vector_set(1.0f), vector_set(-1.0f));
 	}
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Trigonometry
+	//////////////////////////////////////////////////////////////////////////
+
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Per component remaps the input angles into [-PI/2, PI/2] for the sine and cosine polynomials.
+		// sin(x) = sin(PI - x) while cos(x) = -cos(PI - x), the cosine sign is returned.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL sincos_remap(vector4f_arg0 input, vector4f& out_cos_sign) RTM_NO_EXCEPT
+		{
+			// Remap our input in the [-PI, PI] range
+			const vector4f quotient = vector_round_bankers(vector_mul(input, k_sincos_inv_two_pi_f32));
+			vector4f x = vector_neg_mul_sub(quotient, vector_set(k_sincos_two_pi_hi_f32), input);
+			x = vector_neg_mul_sub(quotient, vector_set(k_sincos_two_pi_lo_f32), x);
+
+			// Reflect our input in the [-PI/2, PI/2] range
+			const vector4f reference = vector_select(vector_less_than(x, vector_zero()), vector_set(-k_sincos_pi_f32), vector_set(k_sincos_pi_f32));
+			const mask4i is_in_range = vector_less_equal(vector_abs(x), vector_set(k_sincos_half_pi_f32));
+			out_cos_sign = vector_select(is_in_range, vector_set(1.0f), vector_set(-1.0f));
+			return vector_select(is_in_range, x, vector_sub(reference, x));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component evaluates the sine polynomial over [-PI/2, PI/2].
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL sin_poly(vector4f_arg0 x) RTM_NO_EXCEPT
+		{
+			const vector4f x2 = vector_mul(x, x);
+			vector4f poly = vector_mul_add(vector_set(k_sin_c9_f32), x2, vector_set(k_sin_c7_f32));
+			poly = vector_mul_add(poly, x2, vector_set(k_sin_c5_f32));
+			poly = vector_mul_add(poly, x2, vector_set(k_sin_c3_f32));
+			return vector_mul_add(vector_mul(poly, x2), x, x);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component evaluates the cosine polynomial over [-PI/2, PI/2].
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL cos_poly(vector4f_arg0 x) RTM_NO_EXCEPT
+		{
+			const vector4f x2 = vector_mul(x, x);
+			vector4f poly = vector_mul_add(vector_set(k_cos_c10_f32), x2, vector_set(k_cos_c8_f32));
+			poly = vector_mul_add(poly, x2, vector_set(k_cos_c6_f32));
+			poly = vector_mul_add(poly, x2, vector_set(k_cos_c4_f32));
+			poly = vector_mul_add(poly, x2, vector_set(k_cos_c2_f32));
+			return vector_mul_add(poly, x2, vector_set(1.0f));
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns the sine of the input angles.
+	// The input is reduced into [-PI, PI] and reflected into [-PI/2, PI/2] where a
+	// minimax polynomial is evaluated, see rtm_impl::k_sincos_inv_two_pi_f32 for details.
+	// The max absolute error is 1.1e-7 within [-PI/2, PI/2] and 2.1e-7 within [-100 * PI, 100 * PI].
+	// The reduction loses accuracy past [-1.0e4, 1.0e4]: the error reaches 1.3e-6 within
+	// [-1.0e5, 1.0e5] and the result is meaningless past 1.0e6, scalar_sin(..) handles any angle.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_sin(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		vector4f cos_sign;
+		const vector4f x = rtm_impl::sincos_remap(input, cos_sign);
+		return rtm_impl::sin_poly(x);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns the cosine of the input angles.
+	// The input is reduced into [-PI, PI] and reflected into [-PI/2, PI/2] where a
+	// minimax polynomial is evaluated, see rtm_impl::k_sincos_inv_two_pi_f32 for details.
+	// The max absolute error is 1.2e-7 within [-PI/2, PI/2] and 2.6e-7 within [-100 * PI, 100 * PI].
+	// The reduction loses accuracy past [-1.0e4, 1.0e4]: the error reaches 1.3e-6 within
+	// [-1.0e5, 1.0e5] and the result is meaningless past 1.0e6, scalar_cos(..) handles any angle.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_cos(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		vector4f cos_sign;
+		const vector4f x = rtm_impl::sincos_remap(input, cos_sign);
+		return vector_mul(rtm_impl::cos_poly(x), cos_sign);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns both the sine and cosine of the input angles.
+	// The range reduction is shared, the error bounds match vector_sin(..) and vector_cos(..).
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_sincos(vector4f_arg0 input, vector4f& out_sin, vector4f& out_cos) RTM_NO_EXCEPT
+	{
+		vector4f cos_sign;
+		const vector4f x = rtm_impl::sincos_remap(input, cos_sign);
+		out_sin = rtm_impl::sin_poly(x);
+		out_cos = vector_mul(rtm_impl::cos_poly(x), cos_sign);
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Per component evaluates the arc-sine polynomial over [-0.5, 0.5].
+		//////////////////////////////////////////////////////////////////////////
+		template<accuracy precision>
+		vector4f RTM_SIMD_CALL asin_poly(vector4f_arg0 x) RTM_NO_EXCEPT;
+
+		template<>
+		inline vector4f RTM_SIMD_CALL asin_poly<accuracy::high>(vector4f_arg0 x) RTM_NO_EXCEPT
+		{
+			const vector4f x2 = vector_mul(x, x);
+			vector4f poly = vector_mul_add(vector_set(k_asin_c11_f32), x2, vector_set(k_asin_c9_f32));
+			poly = vector_mul_add(poly, x2, vector_set(k_asin_c7_f32));
+			poly = vector_mul_add(poly, x2, vector_set(k_asin_c5_f32));
+			poly = vector_mul_add(poly, x2, vector_set(k_asin_c3_f32));
+			return vector_mul_add(vector_mul(poly, x2), x, x);
+		}
+
+		template<>
+		inline vector4f RTM_SIMD_CALL asin_poly<accuracy::low>(vector4f_arg0 x) RTM_NO_EXCEPT
+		{
+			const vector4f x2 = vector_mul(x, x);
+			const vector4f poly = vector_mul_add(vector_set(k_asin_low_c5_f32), x2, vector_set(k_asin_low_c3_f32));
+			return vector_mul_add(vector_mul(poly, x2), x, x);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component evaluates the arc-tangent polynomial over [-tan(PI/8), tan(PI/8)].
+		//////////////////////////////////////////////////////////////////////////
+		template<accuracy precision>
+		vector4f RTM_SIMD_CALL atan_poly(vector4f_arg0 x) RTM_NO_EXCEPT;
+
+		template<>
+		inline vector4f RTM_SIMD_CALL atan_poly<accuracy::high>(vector4f_arg0 x) RTM_NO_EXCEPT
+		{
+			const vector4f x2 = vector_mul(x, x);
+			vector4f poly = vector_mul_add(vector_set(k_atan_c9_f32), x2, vector_set(k_atan_c7_f32));
+			poly = vector_mul_add(poly, x2, vector_set(k_atan_c5_f32));
+			poly = vector_mul_add(poly, x2, vector_set(k_atan_c3_f32));
+			return vector_mul_add(vector_mul(poly, x2), x, x);
+		}
+
+		template<>
+		inline vector4f RTM_SIMD_CALL atan_poly<accuracy::low>(vector4f_arg0 x) RTM_NO_EXCEPT
+		{
+			const vector4f x2 = vector_mul(x, x);
+			const vector4f poly = vector_mul_add(vector_set(k_atan_low_c5_f32), x2, vector_set(k_atan_low_c3_f32));
+			return vector_mul_add(vector_mul(poly, x2), x, x);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns the arc-sine of the input.
+	// Inputs within [-0.5, 0.5] evaluate a minimax polynomial directly while larger
+	// inputs use asin(x) = PI/2 - 2 * asin(sqrt((1 - x) / 2)), see rtm_impl::k_asin_c3_f32 for details.
+	// Inputs outside [-1.0, 1.0] return NaN.
+	// The max absolute error is 1.7e-7 with accuracy::high and 4.0e-5 with accuracy::low.
+	//////////////////////////////////////////////////////////////////////////
+	template<accuracy precision = accuracy::high>
+	inline vector4f RTM_SIMD_CALL vector_asin(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4f abs_input = vector_abs(input);
+		const mask4i is_small = vector_less_equal(abs_input, vector_set(0.5f));
+		const vector4f large_x = vector_sqrt(vector_mul(vector_sub(vector_set(1.0f), abs_input), 0.5f));
+
+		const vector4f poly = rtm_impl::asin_poly<precision>(vector_select(is_small, abs_input, large_x));
+		const vector4f large_result = vector_neg_mul_sub(poly, vector_set(2.0f), vector_set(rtm_impl::k_sincos_half_pi_f32));
+		const vector4f abs_result = vector_select(is_small, poly, large_result);
+		return vector_select(vector_less_than(input, vector_zero()), vector_neg(abs_result), abs_result);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns the arc-cosine of the input.
+	// Inputs within [-0.5, 0.5] use acos(x) = PI/2 - asin(x) while larger inputs use
+	// acos(x) = 2 * asin(sqrt((1 - x) / 2)) and acos(-x) = PI - acos(x), see vector_asin(..).
+	// Inputs outside [-1.0, 1.0] return NaN.
+	// The max absolute error is 3.1e-7 with accuracy::high and 4.0e-5 with accuracy::low.
+	//////////////////////////////////////////////////////////////////////////
+	template<accuracy precision = accuracy::high>
+	inline vector4f RTM_SIMD_CALL vector_acos(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4f abs_input = vector_abs(input);
+		const mask4i is_small = vector_less_equal(abs_input, vector_set(0.5f));
+		const vector4f large_x = vector_sqrt(vector_mul(vector_sub(vector_set(1.0f), abs_input), 0.5f));
+
+		const vector4f poly = rtm_impl::asin_poly<precision>(vector_select(is_small, input, large_x));
+		const vector4f small_result = vector_sub(vector_set(rtm_impl::k_sincos_half_pi_f32), poly);
+		const vector4f large_result = vector_add(poly, poly);
+		const vector4f signed_large_result = vector_select(vector_less_than(input, vector_zero()), vector_sub(vector_set(rtm_impl::k_sincos_pi_f32), large_result), large_result);
+		return vector_select(is_small, small_result, signed_large_result);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns the arc-tangent of the input.
+	// The input is reduced into [-tan(PI/8), tan(PI/8)] with atan(x) = PI/4 + atan((x - 1) / (x + 1))
+	// and atan(x) = PI/2 - atan(1 / x) where a minimax polynomial is evaluated, see rtm_impl::k_asin_c3_f32 for details.
+	// The max absolute error is 1.4e-7 with accuracy::high and 8.9e-6 with accuracy::low.
+	//////////////////////////////////////////////////////////////////////////
+	template<accuracy precision = accuracy::high>
+	inline vector4f RTM_SIMD_CALL vector_atan(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4f abs_input = vector_abs(input);
+		const mask4i is_large = vector_less_than(vector_set(rtm_impl::k_inv_trig_tan_3pi_8_f32), abs_input);
+		const mask4i is_mid = vector_less_than(vector_set(rtm_impl::k_inv_trig_tan_pi_8_f32), abs_input);
+
+		// A single division handles all three ranges
+		const vector4f one = vector_set(1.0f);
+		const vector4f numerator = vector_select(is_large, vector_set(-1.0f), vector_select(is_mid, vector_sub(abs_input, one), abs_input));
+		const vector4f denominator = vector_select(is_large, abs_input, vector_select(is_mid, vector_add(abs_input, one), one));
+		const vector4f offset = vector_select(is_large, vector_set(rtm_impl::k_sincos_half_pi_f32), vector_select(is_mid, vector_set(rtm_impl::k_inv_trig_quarter_pi_f32), vector_zero()));
+
+		const vector4f abs_result = vector_add(offset, rtm_impl::atan_poly<precision>(vector_div(numerator, denominator)));
+		return vector_select(vector_less_than(input, vector_zero()), vector_neg(abs_result), abs_result);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns the arc-tangent of [y/x] using the sign of the arguments to
+	// determine the correct quadrant. The argument order matches scalar_atan2(..).
+	// The ratio of the smallest to the largest magnitude is evaluated with the vector_atan(..) polynomial.
+	// The max absolute error is 2.7e-7 with accuracy::high and 9.1e-6 with accuracy::low.
+	// When both inputs are zero, zero is returned. The sign of zero inputs is ignored
+	// and infinite inputs are not supported.
+	//////////////////////////////////////////////////////////////////////////
+	template<accuracy precision = accuracy::high>
+	inline vector4f RTM_SIMD_CALL vector_atan2(vector4f_arg0 y, vector4f_arg1 x) RTM_NO_EXCEPT
+	{
+		const vector4f abs_y = vector_abs(y);
+		const vector4f abs_x = vector_abs(x);
+		const mask4i is_y_larger = vector_less_than(abs_x, abs_y);
+		const vector4f min_value = vector_min(abs_x, abs_y);
+		const vector4f max_value = vector_max(abs_x, abs_y);
+
+		// Reduce into [-tan(PI/8), tan(PI/8)] with atan(t) = PI/4 + atan((t - 1) / (t + 1))
+		const mask4i is_mid = vector_less_than(vector_mul(max_value, rtm_impl::k_inv_trig_tan_pi_8_f32), min_value);
+		const vector4f numerator = vector_select(is_mid, vector_sub(min_value, max_value), min_value);
+		const vector4f denominator = vector_select(is_mid, vector_add(min_value, max_value), max_value);
+		const vector4f ratio = vector_select(vector_less_equal(max_value, vector_zero()), vector_zero(), vector_div(numerator, denominator));
+		const vector4f offset = vector_select(is_mid, vector_set(rtm_impl::k_inv_trig_quarter_pi_f32), vector_zero());
+
+		vector4f result = vector_add(offset, rtm_impl::atan_poly<precision>(ratio));
+		result = vector_select(is_y_larger, vector_sub(vector_set(rtm_impl::k_sincos_half_pi_f32), result), result);
+		result = vector_select(vector_less_than(x, vector_zero()), vector_sub(vector_set(rtm_impl::k_sincos_pi_f32), result), result);
+		return vector_select(vector_less_than(y, vector_zero()), vector_neg(result), result);
+	}
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Exponential and logarithm
+	//////////////////////////////////////////////////////////////////////////
+
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Constants used by the exponential and logarithm approximations.
+		// exp(x) = 2^n * exp(r) where n = floor(x / ln(2)) and r = x - n * ln(2) within [0, ln(2)),
+		// with a two part Cody-Waite reduction (ln(2) = hi + lo where hi has few significant bits).
+		// exp(r) ~= 1 + r + r^2 * (c2 + r * (c3 + r * (c4 + r * (c5 + r * c6))))
+		// log(x) = e * ln(2) + log(m) where m is the mantissa within [sqrt(2)/2, sqrt(2)) and
+		// log(m) = 2 * atanh(s) with s = (m - 1) / (m + 1) within [-0.172, 0.172].
+		// log(m) ~= 2 * s + s^3 * (c3 + s^2 * (c5 + s^2 * c7))
+		// Both polynomials are Remez minimax fits for relative error, the exponential has a
+		// max relative error of 2.9e-9 and the logarithm 8.0e-10, both below float32 rounding.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr float k_exp_ln2_hi_f32 = 0.693145751953125f;						// ln(2) = hi + lo
+		constexpr float k_exp_ln2_lo_f32 = 1.42860682030941723212e-6f;
+		constexpr float k_exp_log2e_f32 = 1.44269504088896340736f;					// 1 / ln(2)
+		constexpr float k_exp_max_exponent_f32 = 127.999992370605469f;				// Largest float below 128
+		constexpr float k_exp_min_exponent_f32 = -126.0f;
+
+		constexpr float k_exp_c2_f32 = 5.00002285129559131960e-1f;
+		constexpr float k_exp_c3_f32 = 1.66631914007341008777e-1f;
+		constexpr float k_exp_c4_f32 = 4.18549815597675373136e-2f;
+		constexpr float k_exp_c5_f32 = 7.86842808730611395496e-3f;
+		constexpr float k_exp_c6_f32 = 1.91248600606836079152e-3f;
+
+		constexpr float k_log_sqrt2_f32 = 1.41421356237309504880f;
+		constexpr float k_log_min_normal_f32 = 1.17549435082228750797e-38f;		// Smallest normal float
+		constexpr float k_log_denormal_scale_f32 = 8388608.0f;						// 2^23
+
+		constexpr float k_log_c3_f32 = 6.66667760855336744008e-1f;
+		constexpr float k_log_c5_f32 = 3.99775740107179644589e-1f;
+		constexpr float k_log_c7_f32 = 2.98709373707986447499e-1f;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component returns 2^n for integral inputs within [-126, 127].
+		// The biased exponent is written directly into the floating point bits.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL vector_exp2_integral(vector4f_arg0 input) RTM_NO_EXCEPT
+		{
+#if defined(RTM_SSE2_INTRINSICS)
+			const __m128i biased_exponent = _mm_cvtps_epi32(_mm_add_ps(input, _mm_set_ps1(127.0f)));
+			return _mm_castsi128_ps(_mm_slli_epi32(biased_exponent, 23));
+#elif defined(RTM_NEON_INTRINSICS)
+			const int32x4_t biased_exponent = vcvtq_s32_f32(vaddq_f32(input, vdupq_n_f32(127.0f)));
+			return vreinterpretq_f32_s32(vshlq_n_s32(biased_exponent, 23));
+#else
+			return vector_set(std::ldexp(1.0f, int(input.x)), std::ldexp(1.0f, int(input.y)), std::ldexp(1.0f, int(input.z)), std::ldexp(1.0f, int(input.w)));
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component splits positive normal inputs into their mantissa within [1.0, 2.0)
+		// and their unbiased exponent: input = mantissa * 2^exponent
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL vector_split_exponent(vector4f_arg0 input, vector4f& out_exponent) RTM_NO_EXCEPT
+		{
+#if defined(RTM_SSE2_INTRINSICS)
+			const __m128i bits = _mm_castps_si128(input);
+			out_exponent = _mm_sub_ps(_mm_cvtepi32_ps(_mm_srli_epi32(bits, 23)), _mm_set_ps1(127.0f));
+			return _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000)));
+#elif defined(RTM_NEON_INTRINSICS)
+			const uint32x4_t bits = vreinterpretq_u32_f32(input);
+			out_exponent = vsubq_f32(vcvtq_f32_u32(vshrq_n_u32(bits, 23)), vdupq_n_f32(127.0f));
+			return vreinterpretq_f32_u32(vorrq_u32(vandq_u32(bits, vdupq_n_u32(0x007FFFFF)), vdupq_n_u32(0x3F800000)));
+#else
+			int exponent_x;
+			int exponent_y;
+			int exponent_z;
+			int exponent_w;
+			const float mantissa_x = std::frexp(input.x, &exponent_x);
+			const float mantissa_y = std::frexp(input.y, &exponent_y);
+			const float mantissa_z = std::frexp(input.z, &exponent_z);
+			const float mantissa_w = std::frexp(input.w, &exponent_w);
+
+			// frexp returns a mantissa within [0.5, 1.0)
+			out_exponent = vector_set(float(exponent_x - 1), float(exponent_y - 1), float(exponent_z - 1), float(exponent_w - 1));
+			return vector_set(mantissa_x * 2.0f, mantissa_y * 2.0f, mantissa_z * 2.0f, mantissa_w * 2.0f);
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component evaluates the exponential polynomial over [0, ln(2)).
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL exp_poly(vector4f_arg0 r) RTM_NO_EXCEPT
+		{
+			vector4f poly = vector_mul_add(vector_set(k_exp_c6_f32), r, vector_set(k_exp_c5_f32));
+			poly = vector_mul_add(poly, r, vector_set(k_exp_c4_f32));
+			poly = vector_mul_add(poly, r, vector_set(k_exp_c3_f32));
+			poly = vector_mul_add(poly, r, vector_set(k_exp_c2_f32));
+			return vector_mul_add(vector_mul(poly, r), r, vector_add(r, vector_set(1.0f)));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component returns the largest integer value not greater than the input.
+		// Unlike vector_floor(..), this does not fall back to scalar code without SSE4.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL exp_floor(vector4f_arg0 input) RTM_NO_EXCEPT
+		{
+			const vector4f rounded = vector_round_bankers(input);
+			return vector_select(vector_less_than(input, rounded), vector_sub(rounded, vector_set(1.0f)), rounded);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component returns 2^exponent * exp(r) and handles overflow and underflow.
+		// The exponent must be integral and the original exponent determines the range.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL exp_scale(vector4f_arg0 poly, vector4f_arg1 exponent, vector4f_arg2 unclamped_exponent) RTM_NO_EXCEPT
+		{
+			const vector4f result = vector_mul(poly, vector_exp2_integral(exponent));
+			const vector4f saturated = vector_select(vector_less_than(unclamped_exponent, vector_set(k_exp_min_exponent_f32)), vector_zero(), result);
+			return vector_select(vector_less_than(vector_set(k_exp_max_exponent_f32), unclamped_exponent), vector_set(std::numeric_limits<float>::infinity()), saturated);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component returns log(m) / 2 (the atanh polynomial) and the exponent of the input
+		// with the mantissa remapped into [sqrt(2)/2, sqrt(2)). Denormal inputs are supported.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL log_mantissa(vector4f_arg0 input, vector4f& out_exponent) RTM_NO_EXCEPT
+		{
+			// Denormals are scaled into the normal range first
+			const mask4i is_denormal = vector_less_than(input, vector_set(k_log_min_normal_f32));
+			const vector4f normal_input = vector_select(is_denormal, vector_mul(input, k_log_denormal_scale_f32), input);
+			const vector4f exponent_offset = vector_select(is_denormal, vector_set(-23.0f), vector_zero());
+
+			vector4f exponent;
+			vector4f mantissa = vector_split_exponent(normal_input, exponent);
+
+			const mask4i is_large = vector_less_than(vector_set(k_log_sqrt2_f32), mantissa);
+			mantissa = vector_select(is_large, vector_mul(mantissa, 0.5f), mantissa);
+			out_exponent = vector_add(vector_add(exponent, exponent_offset), vector_select(is_large, vector_set(1.0f), vector_zero()));
+
+			const vector4f one = vector_set(1.0f);
+			const vector4f s = vector_div(vector_sub(mantissa, one), vector_add(mantissa, one));
+			const vector4f s2 = vector_mul(s, s);
+			vector4f poly = vector_mul_add(vector_set(k_log_c7_f32), s2, vector_set(k_log_c5_f32));
+			poly = vector_mul_add(poly, s2, vector_set(k_log_c3_f32));
+			return vector_mul_add(vector_mul(poly, s2), s, vector_add(s, s));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component handles the inputs outside the logarithm domain.
+		// log(+inf) = +inf, log(0) = -inf, and log(x < 0) = NaN
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL log_special_cases(vector4f_arg0 input, vector4f_arg1 result) RTM_NO_EXCEPT
+		{
+			const vector4f infinity = vector_set(std::numeric_limits<float>::infinity());
+			vector4f output = vector_select(vector_greater_equal(input, infinity), infinity, result);
+			output = vector_select(vector_less_equal(input, vector_zero()), vector_neg(infinity), output);
+			return vector_select(vector_less_than(input, vector_zero()), vector_set(std::numeric_limits<float>::quiet_NaN()), output);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns e raised to the power of the input: e^input
+	// The input is reduced into [0, ln(2)) where a minimax polynomial is evaluated and the
+	// result is scaled by a power of two, see rtm_impl::k_exp_ln2_hi_f32 for details.
+	// Results that overflow return +inf and results below the smallest normal float return 0.0.
+	// NaN inputs are not supported.
+	// The max relative error is 1.2e-7.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_exp(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4f unclamped_exponent = vector_mul(input, rtm_impl::k_exp_log2e_f32);
+		const vector4f clamped_exponent = vector_clamp(unclamped_exponent, vector_set(rtm_impl::k_exp_min_exponent_f32), vector_set(rtm_impl::k_exp_max_exponent_f32));
+		const vector4f exponent = rtm_impl::exp_floor(clamped_exponent);
+
+		vector4f r = vector_neg_mul_sub(exponent, vector_set(rtm_impl::k_exp_ln2_hi_f32), input);
+		r = vector_neg_mul_sub(exponent, vector_set(rtm_impl::k_exp_ln2_lo_f32), r);
+		return rtm_impl::exp_scale(rtm_impl::exp_poly(r), exponent, unclamped_exponent);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns 2 raised to the power of the input: 2^input
+	// The fractional part is evaluated with the vector_exp(..) polynomial.
+	// Results that overflow return +inf and results below the smallest normal float return 0.0.
+	// NaN inputs are not supported.
+	// The max relative error is 1.2e-7.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_exp2(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4f clamped_exponent = vector_clamp(input, vector_set(rtm_impl::k_exp_min_exponent_f32), vector_set(rtm_impl::k_exp_max_exponent_f32));
+		const vector4f exponent = rtm_impl::exp_floor(clamped_exponent);
+
+		const vector4f r = vector_mul(vector_sub(clamped_exponent, exponent), rtm_impl::k_exp_ln2_hi_f32 + rtm_impl::k_exp_ln2_lo_f32);
+		return rtm_impl::exp_scale(rtm_impl::exp_poly(r), exponent, input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns the natural logarithm of the input.
+	// The mantissa is reduced into [sqrt(2)/2, sqrt(2)) where a minimax polynomial is evaluated,
+	// see rtm_impl::k_exp_ln2_hi_f32 for details. Denormal inputs are supported.
+	// log(+inf) = +inf, log(0) = -inf, and log(x < 0) = NaN. NaN inputs are not supported.
+	// The max absolute error is 5.1e-8 within [0.5, 2.0] and the max relative error elsewhere is 1.1e-7.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_log(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		vector4f exponent;
+		const vector4f log_mantissa = rtm_impl::log_mantissa(input, exponent);
+
+		// log(x) = e * ln(2) + log(m), the small part of ln(2) is added first to retain precision
+		const vector4f result = vector_mul_add(exponent, vector_set(rtm_impl::k_exp_ln2_hi_f32), vector_mul_add(exponent, vector_set(rtm_impl::k_exp_ln2_lo_f32), log_mantissa));
+		return rtm_impl::log_special_cases(input, result);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns the base 2 logarithm of the input.
+	// The mantissa is evaluated with the vector_log(..) polynomial and the exponent is exact.
+	// log2(+inf) = +inf, log2(0) = -inf, and log2(x < 0) = NaN. NaN inputs are not supported.
+	// The max absolute error is 1.1e-7 within [0.5, 2.0] and the max relative error elsewhere is 9.4e-8.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_log2(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		vector4f exponent;
+		const vector4f log_mantissa = rtm_impl::log_mantissa(input, exponent);
+
+		const vector4f result = vector_mul_add(log_mantissa, vector_set(rtm_impl::k_exp_log2e_f32), exponent);
+		return rtm_impl::log_special_cases(input, result);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component returns the base raised to the power of the exponent: base^exponent
+	// Computed as exp2(exponent * log2(base)), the error grows with the magnitude of the result.
+	// Negative bases return NaN, even with integral exponents, and pow(0, 0) returns NaN.
+	// The max relative error is 2.1e-7 when |exponent * log2(base)| < 1.0 and 5.2e-6 when it is below 100.0.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_pow(vector4f_arg0 base, vector4f_arg1 exponent) RTM_NO_EXCEPT
+	{
+		return vector_exp2(vector_mul(exponent, vector_log2(base)));
+	}
 }
 
 RTM_IMPL_FILE_PRAGMA_POP
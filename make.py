@@ -1,4 +1,6 @@
 import argparse
+import copy
+import json
 import os
 import platform
 import shutil
@@ -12,6 +14,7 @@ def parse_argv():
 	actions.add_argument('-build', action='store_true')
 	actions.add_argument('-clean', action='store_true')
 	actions.add_argument('-unit_test', action='store_true')
+	actions.add_argument('-bench', action='store_true', help='Build and run the benchmarks for every instruction set and compare them')
 
 	target = parser.add_argument_group(title='Target')
 	target.add_argument('-compiler', choices=['vs2015', 'vs2017', 'android', 'clang4', 'clang5', 'clang6', 'gcc5', 'gcc6', 'gcc7', 'gcc8', 'osx', 'ios'], help='Defaults to the host system\'s default compiler')
@@ -20,12 +23,19 @@ def parse_argv():
 
 	misc = parser.add_argument_group(title='Miscellaneous')
 	misc.add_argument('-avx', dest='use_avx', action='store_true', help='Compile using AVX instructions on Windows, OS X, and Linux')
+	misc.add_argument('-avx2', dest='use_avx2', action='store_true', help='Compile using AVX2 and FMA instructions on Windows, OS X, and Linux')
+	misc.add_argument('-fma', dest='use_fma', action='store_true', help='Compile using FMA instructions on Windows, OS X, and Linux, implies AVX')
+	misc.add_argument('-avx512', dest='use_avx512', action='store_true', help='Compile using AVX-512 instructions on Windows, OS X, and Linux')
 	misc.add_argument('-nosimd', dest='use_simd', action='store_false', help='Compile without SIMD instructions')
+	misc.add_argument('-nosse4', dest='use_sse4', action='store_false', help='Compile using SSE2 instructions only on OS X and Linux')
 	misc.add_argument('-num_threads', help='No. to use while compiling and regressing')
 	misc.add_argument('-tests_matching', help='Only run tests whose names match this regex')
+	misc.add_argument('-bench_matching', help='Only run benchmarks whose names match this regex')
+	misc.add_argument('-bench_baseline', help='Baseline file to compare the benchmark results against, it is created if it does not exist')
+	misc.add_argument('-bench_threshold', type=float, help='Slowdown in percent above which a benchmark is a regression, defaults to the baseline value or 10')
 	misc.add_argument('-help', action='help', help='Display this usage information')
 
-	parser.set_defaults(build=False, clean=False, unit_test=False, compiler=None, config='Release', cpu='x64', use_avx=False, use_simd=True, num_threads=4, tests_matching='')
+	parser.set_defaults(build=False, clean=False, unit_test=False, bench=False, compiler=None, config='Release', cpu='x64', use_avx=False, use_avx2=False, use_fma=False, use_avx512=False, use_simd=True, use_sse4=True, num_threads=4, tests_matching='', bench_matching='', bench_baseline=None, bench_threshold=None, build_bench=False)
 
 	args = parser.parse_args()
 
@@ -34,6 +44,22 @@ def parse_argv():
 		print('SIMD is explicitly disabled, AVX will not be used')
 		args.use_avx = False
 
+	if args.use_avx2 and not args.use_simd:
+		print('SIMD is explicitly disabled, AVX2 will not be used')
+		args.use_avx2 = False
+
+	if args.use_fma and not args.use_simd:
+		print('SIMD is explicitly disabled, FMA will not be used')
+		args.use_fma = False
+
+	if args.use_avx512 and not args.use_simd:
+		print('SIMD is explicitly disabled, AVX-512 will not be used')
+		args.use_avx512 = False
+
+	# The baseline is relative to where the script is run from, not the build directory
+	if args.bench_baseline:
+		args.bench_baseline = os.path.abspath(args.bench_baseline)
+
 	if args.compiler == 'android':
 		args.cpu = 'armv7-a'
 
@@ -41,7 +67,7 @@ def parse_argv():
 			print('Android is only supported on Windows')
 			sys.exit(1)
 
-		if args.use_avx:
+		if args.use_avx or args.use_avx2 or args.use_fma or args.use_avx512:
 			print('AVX is not supported on Android')
 			sys.exit(1)
 
@@ -49,6 +75,10 @@ def parse_argv():
 			print('Unit tests cannot run from the command line on Android')
 			sys.exit(1)
 
+		if args.bench:
+			print('Benchmarks cannot run from the command line on Android')
+			sys.exit(1)
+
 	if args.compiler == 'ios':
 		args.cpu = 'arm64'
 
@@ -56,7 +86,7 @@ def parse_argv():
 			print('iOS is only supported on OS X')
 			sys.exit(1)
 
-		if args.use_avx:
+		if args.use_avx or args.use_avx2 or args.use_fma or args.use_avx512:
 			print('AVX is not supported on iOS')
 			sys.exit(1)
 
@@ -64,6 +94,10 @@ def parse_argv():
 			print('Unit tests cannot run from the command line on iOS')
 			sys.exit(1)
 
+		if args.bench:
+			print('Benchmarks cannot run from the command line on iOS')
+			sys.exit(1)
+
 	if args.cpu == 'arm64':
 		if not args.compiler in ['vs2017', 'ios']:
 			print('ARM64 is only supported with VS2017 and iOS')
@@ -173,10 +207,29 @@ def do_generate_solution(cmake_exe, build_dir, cmake_script_dir, args):
 		print('Enabling AVX usage')
 		extra_switches.append('-DUSE_AVX_INSTRUCTIONS:BOOL=true')
 
+	if args.use_avx2:
+		print('Enabling AVX2 usage')
+		extra_switches.append('-DUSE_AVX2_INSTRUCTIONS:BOOL=true')
+
+	if args.use_fma:
+		print('Enabling FMA usage')
+		extra_switches.append('-DUSE_FMA_INSTRUCTIONS:BOOL=true')
+
+	if args.use_avx512:
+		print('Enabling AVX-512 usage')
+		extra_switches.append('-DUSE_AVX512_INSTRUCTIONS:BOOL=true')
+
 	if not args.use_simd:
 		print('Disabling SIMD instruction usage')
 		extra_switches.append('-DUSE_SIMD_INSTRUCTIONS:BOOL=false')
 
+	if not args.use_sse4:
+		print('Disabling SSE4 instruction usage')
+		extra_switches.append('-DUSE_SSE4_INSTRUCTIONS:BOOL=false')
+
+	if args.build_bench:
+		extra_switches.append('-DBUILD_BENCHMARK_EXE:BOOL=true')
+
 	if not platform.system() == 'Windows' and not platform.system() == 'Darwin':
 		extra_switches.append('-DCMAKE_BUILD_TYPE={}'.format(config.upper()))
 
@@ -186,7 +239,7 @@ def do_generate_solution(cmake_exe, build_dir, cmake_script_dir, args):
 
 	# Generate IDE solution
 	print('Generating build files ...')
-	cmake_cmd = '"{}" .. -DCMAKE_INSTALL_PREFIX="{}" {}'.format(cmake_exe, build_dir, ' '.join(extra_switches))
+	cmake_cmd = '"{}" "{}" -DCMAKE_INSTALL_PREFIX="{}" {}'.format(cmake_exe, os.path.dirname(cmake_script_dir), build_dir, ' '.join(extra_switches))
 	cmake_generator = get_generator(compiler, cpu)
 	if cmake_generator == None:
 		print('Using default generator')
@@ -241,6 +294,167 @@ def do_tests(ctest_exe, args):
 	if result != 0:
 		sys.exit(result)
 
+def get_bench_variants(args):
+	if args.cpu in ['x86', 'x64'] and platform.system() == 'Windows':
+		# MSVC only uses SSE4 with AVX, its default build is the SSE2 build
+		return [
+			('scalar', { 'use_simd': False }),
+			('sse2', {}),
+			('avx', { 'use_avx': True }),
+		]
+	elif args.cpu in ['x86', 'x64']:
+		return [
+			('scalar', { 'use_simd': False }),
+			('sse2', { 'use_sse4': False }),
+			('sse4', {}),
+			('avx', { 'use_avx': True }),
+		]
+	else:
+		return [
+			('scalar', { 'use_simd': False }),
+			('simd', {}),
+		]
+
+def get_bench_exe(bench_build_dir, config):
+	exe_dir = os.path.join(bench_build_dir, 'tools', 'bench', 'main_generic')
+	if platform.system() == 'Windows':
+		return os.path.join(exe_dir, config, 'rtm_benchmarks.exe')
+	elif platform.system() == 'Darwin':
+		return os.path.join(exe_dir, config, 'rtm_benchmarks')
+	else:
+		return os.path.join(exe_dir, 'rtm_benchmarks')
+
+def parse_bench_results(results_filename):
+	# Latency benchmarks report the time per call, throughput benchmarks report the number of calls per second
+	to_ns = { 'ns': 1.0, 'us': 1000.0, 'ms': 1000000.0, 's': 1000000000.0 }
+	results = {}
+
+	with open(results_filename, 'r') as results_file:
+		for entry in json.load(results_file)['benchmarks']:
+			if entry.get('run_type', 'iteration') != 'iteration':
+				continue
+
+			if 'items_per_second' in entry:
+				ns_per_op = 1000000000.0 / entry['items_per_second']
+			else:
+				ns_per_op = entry['real_time'] * to_ns[entry['time_unit']]
+
+			results[entry['name']] = ns_per_op
+
+	return results
+
+def print_bench_table(variant_names, variant_results):
+	bench_names = []
+	for variant_name in variant_names:
+		for bench_name in variant_results[variant_name]:
+			if not bench_name in bench_names:
+				bench_names.append(bench_name)
+
+	reference_name = variant_names[0]
+	name_width = max([len(name) for name in bench_names] + [len('Benchmark')])
+
+	header = 'Benchmark'.ljust(name_width)
+	for variant_name in variant_names:
+		header += ' | {:>10} | {:>8}'.format(variant_name + ' ns', 'speedup')
+	print(header)
+	print('-' * len(header))
+
+	for bench_name in bench_names:
+		line = bench_name.ljust(name_width)
+		reference_ns = variant_results[reference_name].get(bench_name)
+		for variant_name in variant_names:
+			ns_per_op = variant_results[variant_name].get(bench_name)
+			if ns_per_op == None:
+				line += ' | {:>10} | {:>8}'.format('-', '-')
+			elif reference_ns == None or ns_per_op == 0.0:
+				line += ' | {:>10.3f} | {:>8}'.format(ns_per_op, '-')
+			else:
+				line += ' | {:>10.3f} | {:>7.2f}x'.format(ns_per_op, reference_ns / ns_per_op)
+		print(line)
+
+def compare_bench_baseline(baseline_filename, variant_results, args):
+	if not os.path.exists(baseline_filename):
+		threshold = args.bench_threshold if args.bench_threshold != None else 10.0
+		print('Writing benchmark baseline to: {}'.format(baseline_filename))
+		with open(baseline_filename, 'w') as baseline_file:
+			json.dump({ 'threshold': threshold, 'results': variant_results }, baseline_file, indent=4, sort_keys=True)
+		return True
+
+	with open(baseline_filename, 'r') as baseline_file:
+		baseline = json.load(baseline_file)
+
+	threshold = args.bench_threshold if args.bench_threshold != None else baseline['threshold']
+	print('Comparing against benchmark baseline: {} (threshold {}%)'.format(baseline_filename, threshold))
+
+	num_regressions = 0
+	for variant_name, results in sorted(variant_results.items()):
+		baseline_results = baseline['results'].get(variant_name, {})
+		for bench_name, ns_per_op in sorted(results.items()):
+			baseline_ns = baseline_results.get(bench_name)
+			if baseline_ns == None or baseline_ns == 0.0:
+				continue
+
+			slowdown = (ns_per_op / baseline_ns - 1.0) * 100.0
+			if slowdown > threshold:
+				print('Regression [{}] {}: {:.3f} ns -> {:.3f} ns (+{:.1f}%)'.format(variant_name, bench_name, baseline_ns, ns_per_op, slowdown))
+				num_regressions += 1
+
+	if num_regressions == 0:
+		print('No regression found')
+
+	return num_regressions == 0
+
+def do_bench(cmake_exe, build_dir, cmake_script_dir, args):
+	config = args.config
+
+	variant_names = []
+	variant_results = {}
+	for variant_name, variant_options in get_bench_variants(args):
+		print('Benchmarking {} ...'.format(variant_name))
+
+		variant_args = copy.copy(args)
+		variant_args.build_bench = True
+		for option_name, option_value in variant_options.items():
+			setattr(variant_args, option_name, option_value)
+
+		bench_build_dir = os.path.join(build_dir, 'bench_{}'.format(variant_name))
+		if not os.path.exists(bench_build_dir):
+			os.makedirs(bench_build_dir)
+
+		os.chdir(bench_build_dir)
+		do_generate_solution(cmake_exe, bench_build_dir, cmake_script_dir, variant_args)
+
+		cmake_cmd = '"{}" --build . --config {} --target rtm_benchmarks'.format(cmake_exe, config)
+		result = subprocess.call(cmake_cmd, shell=True)
+		if result != 0:
+			sys.exit(result)
+
+		results_filename = os.path.join(bench_build_dir, 'bench_results.json')
+		bench_cmd = '"{}" --benchmark_out="{}" --benchmark_out_format=json'.format(get_bench_exe(bench_build_dir, config), results_filename)
+		if args.bench_matching:
+			bench_cmd += ' --benchmark_filter="{}"'.format(args.bench_matching)
+
+		result = subprocess.call(bench_cmd, shell=True)
+		if result != 0:
+			# The host might not support this instruction set, skip it
+			print('Failed to run the {} benchmarks, skipping them'.format(variant_name))
+			continue
+
+		variant_names.append(variant_name)
+		variant_results[variant_name] = parse_bench_results(results_filename)
+
+	os.chdir(build_dir)
+
+	if len(variant_names) == 0:
+		print('No benchmark results')
+		sys.exit(1)
+
+	print_bench_table(variant_names, variant_results)
+
+	if args.bench_baseline:
+		if not compare_bench_baseline(args.bench_baseline, variant_results, args):
+			sys.exit(1)
+
 if __name__ == "__main__":
 	args = parse_argv()
 
@@ -281,4 +495,7 @@ if __name__ == "__main__":
 	if args.unit_test:
 		do_tests(ctest_exe, args)
 
+	if args.bench:
+		do_bench(cmake_exe, build_dir, cmake_script_dir, args)
+
 	sys.exit(0)
@@ -0,0 +1,210 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "test_transforms_impl.h"
+
+#include <rtm/aabbf.h>
+#include <rtm/aabbf_batch.h>
+#include <rtm/frustumf.h>
+#include <rtm/matrix3x4f.h>
+#include <rtm/quatf.h>
+#include <rtm/qvvf.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+
+#include <vector>
+
+using namespace rtm;
+
+// Reference implementation: transforms the 8 corners and bounds them
+static aabbf aabb_transform_corners(const aabbf& input, matrix3x4f_arg0 transform)
+{
+	vector4f min = vector_set(1.0e30f);
+	vector4f max = vector_set(-1.0e30f);
+	for (int corner_index = 0; corner_index < 8; ++corner_index)
+	{
+		const vector4f sign = vector_set((corner_index & 1) ? 1.0f : -1.0f, (corner_index & 2) ? 1.0f : -1.0f, (corner_index & 4) ? 1.0f : -1.0f);
+		const vector4f corner = matrix_mul_point3(vector_mul_add(input.extents, sign, input.center), transform);
+		min = vector_min(min, corner);
+		max = vector_max(max, corner);
+	}
+
+	return aabb_from_min_max(min, max);
+}
+
+static qvvf make_test_qvv(size_t index)
+{
+	// Non uniform and negative scale
+	const vector4f scale = vector_set(0.5f + float(index % 3), (index % 4) == 3 ? -1.5f : 1.25f, 2.0f - float(index % 2) * 0.75f);
+	return qvv_set(get_test_rotation(index), get_test_translation(index), scale);
+}
+
+static aabbf make_test_aabb(size_t index)
+{
+	const float offset = float(index);
+	return aabb_set(vector_set(-3.0f + offset * 0.5f, 2.0f - offset * 0.25f, offset * 0.125f), vector_set(0.5f + float(index % 5), 1.0f + float(index % 3) * 0.5f, 0.25f + float(index % 7)));
+}
+
+TEST_CASE("aabbf math", "[math][aabb]")
+{
+	const float threshold = 1.0e-4f;
+
+	{
+		const aabbf box = aabb_from_min_max(vector_set(-1.0f, 2.0f, 3.0f), vector_set(3.0f, 4.0f, 9.0f));
+		CHECK(vector_all_near_equal3(box.center, vector_set(1.0f, 3.0f, 6.0f), threshold));
+		CHECK(vector_all_near_equal3(box.extents, vector_set(2.0f, 1.0f, 3.0f), threshold));
+		CHECK(vector_all_near_equal3(aabb_get_min(box), vector_set(-1.0f, 2.0f, 3.0f), threshold));
+		CHECK(vector_all_near_equal3(aabb_get_max(box), vector_set(3.0f, 4.0f, 9.0f), threshold));
+
+		CHECK(aabb_contains_point3(box, vector_set(0.0f, 3.0f, 6.0f)));
+		CHECK(aabb_contains_point3(box, vector_set(3.0f, 4.0f, 9.0f)));
+		CHECK_FALSE(aabb_contains_point3(box, vector_set(3.5f, 3.0f, 6.0f)));
+		CHECK_FALSE(aabb_contains_point3(box, vector_set(0.0f, 3.0f, 2.5f)));
+	}
+
+	for (size_t index = 0; index < 16; ++index)
+	{
+		const aabbf box = make_test_aabb(index);
+		const qvvf transform_qvv = make_test_qvv(index);
+		const matrix3x4f transform_mtx = matrix_from_qvv(transform_qvv);
+
+		// The Arvo transform is exact, it matches the bounds of the transformed corners
+		const aabbf reference = aabb_transform_corners(box, transform_mtx);
+
+		const aabbf result_mtx = aabb_transform(box, transform_mtx);
+		CHECK(vector_all_near_equal3(result_mtx.center, reference.center, threshold));
+		CHECK(vector_all_near_equal3(result_mtx.extents, reference.extents, threshold));
+
+		const aabbf result_qvv = aabb_transform(box, transform_qvv);
+		CHECK(vector_all_near_equal3(result_qvv.center, reference.center, threshold));
+		CHECK(vector_all_near_equal3(result_qvv.extents, reference.extents, threshold));
+	}
+}
+
+TEST_CASE("aabbf batch math", "[math][aabb][batch]")
+{
+	const float threshold = 1.0e-4f;
+
+	// Covers several blocks of boxes, full groups of 8 and a partial one
+	const size_t num_boxes = 150;
+
+	std::vector<aabbf> boxes;
+	std::vector<matrix3x4f> transforms_mtx;
+	qvvf* transforms_qvv = new qvvf[num_boxes];
+	for (size_t index = 0; index < num_boxes; ++index)
+	{
+		boxes.push_back(make_test_aabb(index));
+		transforms_qvv[index] = make_test_qvv(index);
+		transforms_mtx.push_back(matrix_from_qvv(transforms_qvv[index]));
+	}
+
+	for (size_t count : { size_t(0), size_t(5), size_t(8), size_t(21), num_boxes })
+	{
+		std::vector<aabbf> results_mtx(num_boxes, aabbf{ vector_zero(), vector_zero() });
+		std::vector<aabbf> results_qvv(num_boxes, aabbf{ vector_zero(), vector_zero() });
+		aabb_transform_batch(boxes.data(), transforms_mtx.data(), results_mtx.data(), count);
+		aabb_transform_batch(boxes.data(), transforms_qvv, results_qvv.data(), count);
+
+		for (size_t index = 0; index < num_boxes; ++index)
+		{
+			if (index < count)
+			{
+				const aabbf reference = aabb_transform(boxes[index], transforms_mtx[index]);
+				CHECK(vector_all_near_equal3(results_mtx[index].center, reference.center, threshold));
+				CHECK(vector_all_near_equal3(results_mtx[index].extents, reference.extents, threshold));
+				CHECK(vector_all_near_equal3(results_qvv[index].center, reference.center, threshold));
+				CHECK(vector_all_near_equal3(results_qvv[index].extents, reference.extents, threshold));
+			}
+			else
+			{
+				// Entries past the count are left untouched
+				CHECK(vector_all_near_equal3(results_mtx[index].center, vector_zero(), 0.0f));
+				CHECK(vector_all_near_equal3(results_qvv[index].extents, vector_zero(), 0.0f));
+			}
+		}
+	}
+
+	{
+		// In place
+		std::vector<aabbf> results(boxes);
+		aabb_transform_batch(results.data(), transforms_mtx.data(), results.data(), num_boxes);
+		for (size_t index = 0; index < num_boxes; ++index)
+		{
+			const aabbf reference = aabb_transform(boxes[index], transforms_mtx[index]);
+			CHECK(vector_all_near_equal3(results[index].center, reference.center, threshold));
+			CHECK(vector_all_near_equal3(results[index].extents, reference.extents, threshold));
+		}
+	}
+
+	{
+		// Structure of arrays, in place for the QVV transforms
+		std::vector<float> components[6];
+		for (const aabbf& box : boxes)
+		{
+			components[0].push_back(vector_get_x(box.center));
+			components[1].push_back(vector_get_y(box.center));
+			components[2].push_back(vector_get_z(box.center));
+			components[3].push_back(vector_get_x(box.extents));
+			components[4].push_back(vector_get_y(box.extents));
+			components[5].push_back(vector_get_z(box.extents));
+		}
+
+		for (size_t count : { size_t(0), size_t(5), size_t(8), size_t(21), num_boxes })
+		{
+			std::vector<float> results_mtx[6];
+			std::vector<float> results_qvv[6];
+			for (size_t component_index = 0; component_index < 6; ++component_index)
+			{
+				results_mtx[component_index].assign(num_boxes, 0.0f);
+				results_qvv[component_index] = components[component_index];
+			}
+
+			aabb_transform_batch(components[0].data(), components[1].data(), components[2].data(),
+				components[3].data(), components[4].data(), components[5].data(), transforms_mtx.data(),
+				results_mtx[0].data(), results_mtx[1].data(), results_mtx[2].data(),
+				results_mtx[3].data(), results_mtx[4].data(), results_mtx[5].data(), count);
+			aabb_transform_batch(results_qvv[0].data(), results_qvv[1].data(), results_qvv[2].data(),
+				results_qvv[3].data(), results_qvv[4].data(), results_qvv[5].data(), transforms_qvv,
+				results_qvv[0].data(), results_qvv[1].data(), results_qvv[2].data(),
+				results_qvv[3].data(), results_qvv[4].data(), results_qvv[5].data(), count);
+
+			for (size_t index = 0; index < num_boxes; ++index)
+			{
+				const aabbf reference = index < count ? aabb_transform(boxes[index], transforms_mtx[index]) : aabbf{ vector_zero(), vector_zero() };
+				const vector4f result_mtx_center = vector_set(results_mtx[0][index], results_mtx[1][index], results_mtx[2][index]);
+				const vector4f result_mtx_extents = vector_set(results_mtx[3][index], results_mtx[4][index], results_mtx[5][index]);
+				CHECK(vector_all_near_equal3(result_mtx_center, reference.center, threshold));
+				CHECK(vector_all_near_equal3(result_mtx_extents, reference.extents, threshold));
+
+				// Entries past the count are left untouched
+				const aabbf reference_qvv = index < count ? reference : boxes[index];
+				const vector4f result_qvv_center = vector_set(results_qvv[0][index], results_qvv[1][index], results_qvv[2][index]);
+				const vector4f result_qvv_extents = vector_set(results_qvv[3][index], results_qvv[4][index], results_qvv[5][index]);
+				CHECK(vector_all_near_equal3(result_qvv_center, reference_qvv.center, threshold));
+				CHECK(vector_all_near_equal3(result_qvv_extents, reference_qvv.extents, threshold));
+			}
+		}
+	}
+
+	delete[] transforms_qvv;
+}
@@ -0,0 +1,414 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "test_transforms_impl.h"
+
+#include <rtm/matrix3x3f_batch.h>
+#include <rtm/matrix3x4f_batch.h>
+#include <rtm/matrix4x4f_batch.h>
+#include <rtm/quatd_batch.h>
+#include <rtm/quatf_batch.h>
+#include <rtm/qvvf_batch.h>
+#include <rtm/scalarf_batch.h>
+
+using namespace rtm;
+
+// Large enough to cover a few full 16 wide blocks as well as a partial one
+static constexpr size_t k_num_batch_entries = 37;
+
+TEST_CASE("quatf batch math", "[math][quat][batch]")
+{
+	const float threshold = 1.0e-4f;
+
+	qvvf lhs[k_num_batch_entries];
+	qvvf rhs[k_num_batch_entries];
+	vector4f points[k_num_batch_entries];
+	get_test_transforms(&lhs[0], &rhs[0], &points[0], k_num_batch_entries);
+
+	quatf lhs_rotations[k_num_batch_entries];
+	quatf rhs_rotations[k_num_batch_entries];
+	for (size_t index = 0; index < k_num_batch_entries; ++index)
+	{
+		lhs_rotations[index] = lhs[index].rotation;
+		rhs_rotations[index] = rhs[index].rotation;
+	}
+
+	for (size_t count = 0; count <= k_num_batch_entries; ++count)
+	{
+		// Entries past the count must not be written
+		const quatf sentinel_quat = quat_set(5.0f, 6.0f, 7.0f, 8.0f);
+		const vector4f sentinel_vector = vector_set(5.0f, 6.0f, 7.0f, 8.0f);
+
+		quatf results[k_num_batch_entries];
+		vector4f rotated_points[k_num_batch_entries];
+		for (size_t index = 0; index < k_num_batch_entries; ++index)
+		{
+			results[index] = sentinel_quat;
+			rotated_points[index] = sentinel_vector;
+		}
+
+		quat_mul_batch(&lhs_rotations[0], &rhs_rotations[0], &results[0], count);
+		quat_mul_vector3_batch(&points[0], &rhs_rotations[0], &rotated_points[0], count);
+
+		for (size_t index = 0; index < count; ++index)
+		{
+			REQUIRE(quat_near_equal(results[index], quat_mul(lhs_rotations[index], rhs_rotations[index]), threshold));
+			REQUIRE(vector_all_near_equal3(rotated_points[index], quat_mul_vector3(points[index], rhs_rotations[index]), threshold));
+		}
+
+		for (size_t index = count; index < k_num_batch_entries; ++index)
+		{
+			REQUIRE(quat_near_equal(results[index], sentinel_quat, 0.0f));
+			REQUIRE(vector_all_near_equal(rotated_points[index], sentinel_vector, 0.0f));
+		}
+	}
+
+	{
+		// In place
+		quatf results[k_num_batch_entries];
+		for (size_t index = 0; index < k_num_batch_entries; ++index)
+			results[index] = lhs_rotations[index];
+
+		quat_mul_batch(&results[0], &rhs_rotations[0], &results[0], k_num_batch_entries);
+
+		for (size_t index = 0; index < k_num_batch_entries; ++index)
+			REQUIRE(quat_near_equal(results[index], quat_mul(lhs_rotations[index], rhs_rotations[index]), threshold));
+	}
+
+	{
+		// Interpolation, the end tangents are the start rotations of the next entry
+		const float alpha = 0.3f;
+
+		quatf slerp_results[k_num_batch_entries];
+		quatf slerp_fast_results[k_num_batch_entries];
+		quatf squad_results[k_num_batch_entries];
+		quat_slerp_batch(&lhs_rotations[0], &rhs_rotations[0], alpha, &slerp_results[0], k_num_batch_entries);
+		quat_slerp_fast_batch(&lhs_rotations[0], &rhs_rotations[0], alpha, &slerp_fast_results[0], k_num_batch_entries);
+		quat_squad_batch(&lhs_rotations[0], &lhs_rotations[1], &rhs_rotations[1], &rhs_rotations[0], alpha, &squad_results[0], k_num_batch_entries - 1);
+
+		for (size_t index = 0; index < k_num_batch_entries; ++index)
+		{
+			REQUIRE(quat_near_equal(slerp_results[index], quat_slerp(lhs_rotations[index], rhs_rotations[index], alpha), threshold));
+			REQUIRE(quat_near_equal(slerp_fast_results[index], quat_slerp_fast(lhs_rotations[index], rhs_rotations[index], alpha), threshold));
+		}
+
+		for (size_t index = 0; index + 1 < k_num_batch_entries; ++index)
+			REQUIRE(quat_near_equal(squad_results[index], quat_squad(lhs_rotations[index], lhs_rotations[index + 1], rhs_rotations[index + 1], rhs_rotations[index], alpha), threshold));
+
+		// In place
+		for (size_t index = 0; index < k_num_batch_entries; ++index)
+			slerp_fast_results[index] = lhs_rotations[index];
+
+		quat_slerp_fast_batch(&slerp_fast_results[0], &rhs_rotations[0], alpha, &slerp_fast_results[0], k_num_batch_entries);
+
+		for (size_t index = 0; index < k_num_batch_entries; ++index)
+			REQUIRE(quat_near_equal(slerp_fast_results[index], quat_slerp_fast(lhs_rotations[index], rhs_rotations[index], alpha), threshold));
+	}
+
+	{
+		quatd lhs_rotations_d[k_num_batch_entries];
+		quatd rhs_rotations_d[k_num_batch_entries];
+		for (size_t index = 0; index < k_num_batch_entries; ++index)
+		{
+			lhs_rotations_d[index] = quat_normalize(quat_cast(lhs_rotations[index]));
+			rhs_rotations_d[index] = quat_normalize(quat_cast(rhs_rotations[index]));
+		}
+
+		quatd slerp_results[k_num_batch_entries];
+		quatd slerp_fast_results[k_num_batch_entries];
+		quatd squad_results[k_num_batch_entries];
+		quat_slerp_batch(&lhs_rotations_d[0], &rhs_rotations_d[0], 0.3, &slerp_results[0], k_num_batch_entries);
+		quat_slerp_fast_batch(&lhs_rotations_d[0], &rhs_rotations_d[0], 0.3, &slerp_fast_results[0], k_num_batch_entries);
+		quat_squad_batch(&lhs_rotations_d[0], &lhs_rotations_d[0], &rhs_rotations_d[0], &rhs_rotations_d[0], 0.3, &squad_results[0], k_num_batch_entries);
+
+		for (size_t index = 0; index < k_num_batch_entries; ++index)
+		{
+			REQUIRE(quat_near_equal(slerp_results[index], quat_slerp(lhs_rotations_d[index], rhs_rotations_d[index], 0.3), 1.0e-9));
+			REQUIRE(quat_near_equal(slerp_fast_results[index], slerp_results[index], 1.0e-6));
+
+			// With tangents equal to the keys, squad reduces to slerp
+			REQUIRE(quat_near_equal(squad_results[index], slerp_results[index], 1.0e-9));
+		}
+	}
+}
+
+static void test_qvv_mul_batch(const qvvf* lhs, const qvvf* rhs, const float threshold)
+{
+	for (size_t count = 0; count <= k_num_batch_entries; ++count)
+	{
+		qvvf results[k_num_batch_entries];
+		qvvf results_no_scale[k_num_batch_entries];
+		for (size_t index = 0; index < k_num_batch_entries; ++index)
+		{
+			results[index] = qvv_identity();
+			results_no_scale[index] = qvv_identity();
+		}
+
+		qvv_mul_batch(lhs, rhs, &results[0], count);
+		qvv_mul_no_scale_batch(lhs, rhs, &results_no_scale[0], count);
+
+		for (size_t index = 0; index < count; ++index)
+		{
+			const qvvf expected = qvv_mul(lhs[index], rhs[index]);
+			REQUIRE(quat_near_equal(results[index].rotation, expected.rotation, threshold));
+			REQUIRE(vector_all_near_equal3(results[index].translation, expected.translation, threshold));
+			REQUIRE(vector_all_near_equal3(results[index].scale, expected.scale, threshold));
+
+			const qvvf expected_no_scale = qvv_mul_no_scale(lhs[index], rhs[index]);
+			REQUIRE(quat_near_equal(results_no_scale[index].rotation, expected_no_scale.rotation, threshold));
+			REQUIRE(vector_all_near_equal3(results_no_scale[index].translation, expected_no_scale.translation, threshold));
+			REQUIRE(vector_all_near_equal3(results_no_scale[index].scale, expected_no_scale.scale, threshold));
+		}
+
+		const qvvf identity = qvv_identity();
+		for (size_t index = count; index < k_num_batch_entries; ++index)
+		{
+			REQUIRE(quat_near_equal(results[index].rotation, identity.rotation, 0.0f));
+			REQUIRE(vector_all_near_equal3(results[index].translation, identity.translation, 0.0f));
+			REQUIRE(vector_all_near_equal3(results[index].scale, identity.scale, 0.0f));
+			REQUIRE(quat_near_equal(results_no_scale[index].rotation, identity.rotation, 0.0f));
+			REQUIRE(vector_all_near_equal3(results_no_scale[index].translation, identity.translation, 0.0f));
+		}
+	}
+
+	{
+		// In place
+		qvvf results[k_num_batch_entries];
+		for (size_t index = 0; index < k_num_batch_entries; ++index)
+			results[index] = lhs[index];
+
+		qvv_mul_batch(&results[0], rhs, &results[0], k_num_batch_entries);
+
+		for (size_t index = 0; index < k_num_batch_entries; ++index)
+		{
+			const qvvf expected = qvv_mul(lhs[index], rhs[index]);
+			REQUIRE(quat_near_equal(results[index].rotation, expected.rotation, threshold));
+			REQUIRE(vector_all_near_equal3(results[index].translation, expected.translation, threshold));
+			REQUIRE(vector_all_near_equal3(results[index].scale, expected.scale, threshold));
+		}
+	}
+}
+
+TEST_CASE("qvvf batch math", "[math][qvv][batch]")
+{
+	const float threshold = 1.0e-4f;
+
+	qvvf lhs[k_num_batch_entries];
+	qvvf rhs[k_num_batch_entries];
+	vector4f points[k_num_batch_entries];
+	get_test_transforms(&lhs[0], &rhs[0], &points[0], k_num_batch_entries);
+
+	test_qvv_mul_batch(&lhs[0], &rhs[0], threshold);
+
+	// Negative scale in a few entries falls back to the scalar code path
+	rhs[3].scale = vector_set(-1.0f, 1.0f, 1.0f);
+	lhs[20].scale = vector_set(1.0f, 1.0f, -2.0f);
+	test_qvv_mul_batch(&lhs[0], &rhs[0], threshold);
+}
+
+TEST_CASE("matrix3x4f batch math", "[math][matrix3x4][batch]")
+{
+	const float threshold = 1.0e-4f;
+
+	qvvf lhs[k_num_batch_entries];
+	qvvf rhs[k_num_batch_entries];
+	vector4f points[k_num_batch_entries];
+	get_test_transforms(&lhs[0], &rhs[0], &points[0], k_num_batch_entries);
+
+	const matrix3x4f mtx = matrix_from_qvv(lhs[5]);
+
+	for (size_t count = 0; count <= k_num_batch_entries; ++count)
+	{
+		const vector4f sentinel_vector = vector_set(5.0f, 6.0f, 7.0f, 8.0f);
+
+		vector4f results[k_num_batch_entries];
+		for (size_t index = 0; index < k_num_batch_entries; ++index)
+			results[index] = sentinel_vector;
+
+		matrix_mul_point3_batch(&points[0], mtx, &results[0], count);
+
+		for (size_t index = 0; index < count; ++index)
+			REQUIRE(vector_all_near_equal3(results[index], matrix_mul_point3(points[index], mtx), threshold));
+
+		for (size_t index = count; index < k_num_batch_entries; ++index)
+			REQUIRE(vector_all_near_equal(results[index], sentinel_vector, 0.0f));
+	}
+}
+
+TEST_CASE("matrix batch inverse", "[math][matrix][batch]")
+{
+	const float threshold = 1.0e-3f;
+
+	qvvf lhs[k_num_batch_entries];
+	qvvf rhs[k_num_batch_entries];
+	vector4f points[k_num_batch_entries];
+	get_test_transforms(&lhs[0], &rhs[0], &points[0], k_num_batch_entries);
+
+	matrix3x3f inputs3x3[k_num_batch_entries];
+	matrix3x4f inputs3x4[k_num_batch_entries];
+	matrix3x4f rigid_inputs3x4[k_num_batch_entries];
+	matrix4x4f inputs4x4[k_num_batch_entries];
+	for (size_t index = 0; index < k_num_batch_entries; ++index)
+	{
+		inputs3x4[index] = matrix_from_qvv(lhs[index]);
+		rigid_inputs3x4[index] = matrix_from_qvv(rhs[index].rotation, rhs[index].translation, vector_set(1.0f));
+		inputs3x3[index] = matrix_set(inputs3x4[index].x_axis, inputs3x4[index].y_axis, inputs3x4[index].z_axis);
+
+		// A projective last column to exercise the full 4x4 inverse
+		const float offset = float(index % 8) * 0.125f;
+		inputs4x4[index] = matrix_set(vector_set(vector_get_x(inputs3x4[index].x_axis), vector_get_y(inputs3x4[index].x_axis), vector_get_z(inputs3x4[index].x_axis), offset),
+			vector_set(vector_get_x(inputs3x4[index].y_axis), vector_get_y(inputs3x4[index].y_axis), vector_get_z(inputs3x4[index].y_axis), -offset),
+			vector_set(vector_get_x(inputs3x4[index].z_axis), vector_get_y(inputs3x4[index].z_axis), vector_get_z(inputs3x4[index].z_axis), 0.25f),
+			vector_set(vector_get_x(inputs3x4[index].w_axis), vector_get_y(inputs3x4[index].w_axis), vector_get_z(inputs3x4[index].w_axis), 1.0f + offset));
+	}
+
+	const vector4f sentinel_vector = vector_set(5.0f, 6.0f, 7.0f, 8.0f);
+	const matrix3x3f sentinel3x3 = matrix_set(sentinel_vector, sentinel_vector, sentinel_vector);
+	const matrix3x4f sentinel3x4 = matrix_set(sentinel_vector, sentinel_vector, sentinel_vector, sentinel_vector);
+	const matrix4x4f sentinel4x4 = matrix_set(sentinel_vector, sentinel_vector, sentinel_vector, sentinel_vector);
+
+	for (size_t count = 0; count <= k_num_batch_entries; ++count)
+	{
+		matrix3x3f results3x3[k_num_batch_entries];
+		matrix3x4f results3x4[k_num_batch_entries];
+		matrix3x4f rigid_results3x4[k_num_batch_entries];
+		matrix4x4f results4x4[k_num_batch_entries];
+		for (size_t index = 0; index < k_num_batch_entries; ++index)
+		{
+			results3x3[index] = sentinel3x3;
+			results3x4[index] = sentinel3x4;
+			rigid_results3x4[index] = sentinel3x4;
+			results4x4[index] = sentinel4x4;
+		}
+
+		matrix_inverse_batch(&inputs3x3[0], &results3x3[0], count);
+		matrix_inverse_batch(&inputs3x4[0], &results3x4[0], count);
+		matrix_inverse_rigid_batch(&rigid_inputs3x4[0], &rigid_results3x4[0], count);
+		matrix_inverse_batch(&inputs4x4[0], &results4x4[0], count);
+
+		for (size_t index = 0; index < count; ++index)
+		{
+			const matrix3x3f expected3x3 = matrix_inverse(inputs3x3[index]);
+			REQUIRE(vector_all_near_equal3(results3x3[index].x_axis, expected3x3.x_axis, threshold));
+			REQUIRE(vector_all_near_equal3(results3x3[index].y_axis, expected3x3.y_axis, threshold));
+			REQUIRE(vector_all_near_equal3(results3x3[index].z_axis, expected3x3.z_axis, threshold));
+
+			const matrix3x4f expected3x4 = matrix_inverse(inputs3x4[index]);
+			REQUIRE(vector_all_near_equal3(results3x4[index].x_axis, expected3x4.x_axis, threshold));
+			REQUIRE(vector_all_near_equal3(results3x4[index].y_axis, expected3x4.y_axis, threshold));
+			REQUIRE(vector_all_near_equal3(results3x4[index].z_axis, expected3x4.z_axis, threshold));
+			REQUIRE(vector_all_near_equal3(results3x4[index].w_axis, expected3x4.w_axis, threshold));
+
+			const matrix3x4f rigid_expected3x4 = matrix_inverse(rigid_inputs3x4[index]);
+			REQUIRE(vector_all_near_equal3(rigid_results3x4[index].x_axis, rigid_expected3x4.x_axis, threshold));
+			REQUIRE(vector_all_near_equal3(rigid_results3x4[index].y_axis, rigid_expected3x4.y_axis, threshold));
+			REQUIRE(vector_all_near_equal3(rigid_results3x4[index].z_axis, rigid_expected3x4.z_axis, threshold));
+			REQUIRE(vector_all_near_equal3(rigid_results3x4[index].w_axis, rigid_expected3x4.w_axis, threshold));
+
+			const matrix4x4f expected4x4 = matrix_inverse(inputs4x4[index]);
+			REQUIRE(vector_all_near_equal(results4x4[index].x_axis, expected4x4.x_axis, threshold));
+			REQUIRE(vector_all_near_equal(results4x4[index].y_axis, expected4x4.y_axis, threshold));
+			REQUIRE(vector_all_near_equal(results4x4[index].z_axis, expected4x4.z_axis, threshold));
+			REQUIRE(vector_all_near_equal(results4x4[index].w_axis, expected4x4.w_axis, threshold));
+		}
+
+		for (size_t index = count; index < k_num_batch_entries; ++index)
+		{
+			REQUIRE(vector_all_near_equal(results3x3[index].x_axis, sentinel_vector, 0.0f));
+			REQUIRE(vector_all_near_equal(results3x4[index].w_axis, sentinel_vector, 0.0f));
+			REQUIRE(vector_all_near_equal(rigid_results3x4[index].w_axis, sentinel_vector, 0.0f));
+			REQUIRE(vector_all_near_equal(results4x4[index].w_axis, sentinel_vector, 0.0f));
+		}
+	}
+
+	// The output can alias the input
+	matrix4x4f aliased4x4[k_num_batch_entries];
+	for (size_t index = 0; index < k_num_batch_entries; ++index)
+		aliased4x4[index] = inputs4x4[index];
+
+	matrix_inverse_batch(&aliased4x4[0], &aliased4x4[0], k_num_batch_entries);
+
+	for (size_t index = 0; index < k_num_batch_entries; ++index)
+	{
+		// matrix_mul(..) assumes affine matrices, multiply each row to recover the identity
+		REQUIRE(vector_all_near_equal(matrix_mul_vector(aliased4x4[index].x_axis, inputs4x4[index]), vector_set(1.0f, 0.0f, 0.0f, 0.0f), threshold));
+		REQUIRE(vector_all_near_equal(matrix_mul_vector(aliased4x4[index].y_axis, inputs4x4[index]), vector_set(0.0f, 1.0f, 0.0f, 0.0f), threshold));
+		REQUIRE(vector_all_near_equal(matrix_mul_vector(aliased4x4[index].z_axis, inputs4x4[index]), vector_set(0.0f, 0.0f, 1.0f, 0.0f), threshold));
+		REQUIRE(vector_all_near_equal(matrix_mul_vector(aliased4x4[index].w_axis, inputs4x4[index]), vector_set(0.0f, 0.0f, 0.0f, 1.0f), threshold));
+	}
+}
+
+TEST_CASE("scalarf batch math", "[math][scalar][batch]")
+{
+	float values[k_num_batch_entries];
+	float tangents[k_num_batch_entries];
+	for (size_t index = 0; index < k_num_batch_entries; ++index)
+	{
+		values[index] = -1.0f + 2.0f * float(index) / float(k_num_batch_entries - 1);
+		tangents[index] = (float(index) - 18.0f) * 1.75f;
+	}
+
+	for (size_t count = 0; count <= k_num_batch_entries; ++count)
+	{
+		const float sentinel_value = 123.0f;
+
+		float asin_results[k_num_batch_entries];
+		float acos_results[k_num_batch_entries];
+		float atan_results[k_num_batch_entries];
+		float atan2_results[k_num_batch_entries];
+		float low_acos_results[k_num_batch_entries];
+		for (size_t index = 0; index < k_num_batch_entries; ++index)
+		{
+			asin_results[index] = sentinel_value;
+			acos_results[index] = sentinel_value;
+			atan_results[index] = sentinel_value;
+			atan2_results[index] = sentinel_value;
+			low_acos_results[index] = sentinel_value;
+		}
+
+		scalar_asin_batch(&values[0], &asin_results[0], count);
+		scalar_acos_batch(&values[0], &acos_results[0], count);
+		scalar_atan_batch(&tangents[0], &atan_results[0], count);
+		scalar_atan2_batch(&values[0], &tangents[0], &atan2_results[0], count);
+		scalar_acos_batch<accuracy::low>(&values[0], &low_acos_results[0], count);
+
+		for (size_t index = 0; index < count; ++index)
+		{
+			REQUIRE(asin_results[index] == vector_get_x(vector_asin(vector_set(values[index]))));
+			REQUIRE(acos_results[index] == vector_get_x(vector_acos(vector_set(values[index]))));
+			REQUIRE(atan_results[index] == vector_get_x(vector_atan(vector_set(tangents[index]))));
+			REQUIRE(atan2_results[index] == vector_get_x(vector_atan2(vector_set(values[index]), vector_set(tangents[index]))));
+			REQUIRE(scalar_near_equal(low_acos_results[index], scalar_acos(values[index]), 1.0e-4f));
+		}
+
+		for (size_t index = count; index < k_num_batch_entries; ++index)
+		{
+			REQUIRE(asin_results[index] == sentinel_value);
+			REQUIRE(acos_results[index] == sentinel_value);
+			REQUIRE(atan_results[index] == sentinel_value);
+			REQUIRE(atan2_results[index] == sentinel_value);
+			REQUIRE(low_acos_results[index] == sentinel_value);
+		}
+	}
+}
@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "test_transforms_impl.h"
+
+#include <rtm/cpu_dispatch.h>
+
+using namespace rtm;
+
+// Large enough to cover a few full 16 wide blocks as well as a partial one
+static constexpr size_t k_num_dispatch_entries = 37;
+
+static void test_dispatched_batch_functions(const float threshold)
+{
+	qvvf lhs[k_num_dispatch_entries];
+	qvvf rhs[k_num_dispatch_entries];
+	vector4f points[k_num_dispatch_entries];
+	get_test_transforms(&lhs[0], &rhs[0], &points[0], k_num_dispatch_entries);
+
+	quatf rhs_rotations[k_num_dispatch_entries];
+	for (size_t index = 0; index < k_num_dispatch_entries; ++index)
+		rhs_rotations[index] = rhs[index].rotation;
+
+	// Negative scale in a few entries falls back to the scalar code path
+	rhs[3].scale = vector_set(-1.0f, 1.0f, 1.0f);
+	lhs[20].scale = vector_set(1.0f, 1.0f, -2.0f);
+
+	quatf lhs_rotations[k_num_dispatch_entries];
+	for (size_t index = 0; index < k_num_dispatch_entries; ++index)
+		lhs_rotations[index] = lhs[index].rotation;
+
+	const matrix3x4f mtx = matrix_from_qvv(lhs[5]);
+
+	for (size_t count = 0; count <= k_num_dispatch_entries; ++count)
+	{
+		// Entries past the count must not be written
+		const quatf sentinel_quat = quat_set(5.0f, 6.0f, 7.0f, 8.0f);
+		const vector4f sentinel_vector = vector_set(5.0f, 6.0f, 7.0f, 8.0f);
+
+		quatf rotations[k_num_dispatch_entries];
+		vector4f rotated_points[k_num_dispatch_entries];
+		vector4f transformed_points[k_num_dispatch_entries];
+		qvvf transforms[k_num_dispatch_entries];
+		for (size_t index = 0; index < k_num_dispatch_entries; ++index)
+		{
+			rotations[index] = sentinel_quat;
+			rotated_points[index] = sentinel_vector;
+			transformed_points[index] = sentinel_vector;
+			transforms[index] = qvv_identity();
+		}
+
+		dispatch::quat_mul_batch(&lhs_rotations[0], &rhs_rotations[0], &rotations[0], count);
+		dispatch::quat_mul_vector3_batch(&points[0], &rhs_rotations[0], &rotated_points[0], count);
+		dispatch::matrix_mul_point3_batch(&points[0], mtx, &transformed_points[0], count);
+		dispatch::qvv_mul_batch(&lhs[0], &rhs[0], &transforms[0], count);
+
+		for (size_t index = 0; index < count; ++index)
+		{
+			REQUIRE(quat_near_equal(rotations[index], quat_mul(lhs_rotations[index], rhs_rotations[index]), threshold));
+			REQUIRE(vector_all_near_equal3(rotated_points[index], quat_mul_vector3(points[index], rhs_rotations[index]), threshold));
+			REQUIRE(vector_all_near_equal3(transformed_points[index], matrix_mul_point3(points[index], mtx), threshold));
+
+			const qvvf expected = qvv_mul(lhs[index], rhs[index]);
+			REQUIRE(quat_near_equal(transforms[index].rotation, expected.rotation, threshold));
+			REQUIRE(vector_all_near_equal3(transforms[index].translation, expected.translation, threshold));
+			REQUIRE(vector_all_near_equal3(transforms[index].scale, expected.scale, threshold));
+		}
+
+		const qvvf identity = qvv_identity();
+		for (size_t index = count; index < k_num_dispatch_entries; ++index)
+		{
+			REQUIRE(quat_near_equal(rotations[index], sentinel_quat, 0.0f));
+			REQUIRE(vector_all_near_equal(rotated_points[index], sentinel_vector, 0.0f));
+			REQUIRE(vector_all_near_equal(transformed_points[index], sentinel_vector, 0.0f));
+			REQUIRE(quat_near_equal(transforms[index].rotation, identity.rotation, 0.0f));
+			REQUIRE(vector_all_near_equal3(transforms[index].translation, identity.translation, 0.0f));
+		}
+	}
+
+	{
+		// In place
+		qvvf transforms[k_num_dispatch_entries];
+		vector4f transformed_points[k_num_dispatch_entries];
+		for (size_t index = 0; index < k_num_dispatch_entries; ++index)
+		{
+			transforms[index] = lhs[index];
+			transformed_points[index] = points[index];
+		}
+
+		dispatch::qvv_mul_batch(&transforms[0], &rhs[0], &transforms[0], k_num_dispatch_entries);
+		dispatch::matrix_mul_point3_batch(&transformed_points[0], mtx, &transformed_points[0], k_num_dispatch_entries);
+
+		for (size_t index = 0; index < k_num_dispatch_entries; ++index)
+		{
+			const qvvf expected = qvv_mul(lhs[index], rhs[index]);
+			REQUIRE(quat_near_equal(transforms[index].rotation, expected.rotation, threshold));
+			REQUIRE(vector_all_near_equal3(transforms[index].translation, expected.translation, threshold));
+			REQUIRE(vector_all_near_equal3(transforms[index].scale, expected.scale, threshold));
+			REQUIRE(vector_all_near_equal3(transformed_points[index], matrix_mul_point3(points[index], mtx), threshold));
+		}
+	}
+}
+
+TEST_CASE("cpu dispatch", "[math][batch][dispatch]")
+{
+	const float threshold = 1.0e-4f;
+
+	const cpu_isa cpu_best_isa = get_cpu_isa();
+	REQUIRE(dispatch::get_dispatch_isa() == cpu_best_isa);
+
+#if defined(RTM_CPU_DISPATCH)
+	REQUIRE(cpu_best_isa != cpu_isa::generic);
+#else
+	REQUIRE(cpu_best_isa == cpu_isa::generic);
+#endif
+
+	const cpu_isa isas[] = { cpu_isa::generic, cpu_isa::sse2, cpu_isa::avx2, cpu_isa::avx512 };
+	for (const cpu_isa isa : isas)
+	{
+		// Instruction sets the CPU doesn't support fall back to the best one it supports
+		dispatch::set_dispatch_isa(isa);
+
+		const cpu_isa dispatch_isa = dispatch::get_dispatch_isa();
+		REQUIRE(uint32_t(dispatch_isa) <= uint32_t(cpu_best_isa));
+		if (isa != cpu_isa::generic && uint32_t(isa) <= uint32_t(cpu_best_isa))
+			REQUIRE(dispatch_isa == isa);
+
+		test_dispatched_batch_functions(threshold);
+	}
+
+	dispatch::set_dispatch_isa(cpu_best_isa);
+	REQUIRE(dispatch::get_dispatch_isa() == cpu_best_isa);
+}
@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/dualquatf.h>
+#include <rtm/dualquatd.h>
+#include <rtm/qvvf.h>
+#include <rtm/qvvd.h>
+
+using namespace rtm;
+
+template<typename DualQuatType, typename TransformType, typename FloatType>
+static void test_dualquat_impl(const DualQuatType& identity, const FloatType threshold)
+{
+	using QuatType = decltype(TransformType::rotation);
+	using Vector4Type = decltype(TransformType::translation);
+
+	const TransformType qvv_identity_value = qvv_identity();
+	const Vector4Type zero = vector_zero();
+	const Vector4Type x_axis = vector_set(FloatType(1.0), FloatType(0.0), FloatType(0.0));
+	const Vector4Type y_axis = vector_set(FloatType(0.0), FloatType(1.0), FloatType(0.0));
+
+	{
+		REQUIRE(quat_near_equal(identity.real, quat_identity(), threshold));
+		REQUIRE(quat_near_equal(identity.dual, quat_set(FloatType(0.0), FloatType(0.0), FloatType(0.0), FloatType(0.0)), threshold));
+		REQUIRE(dualquat_near_equal(dualquat_from_qvv(qvv_identity_value), identity, threshold));
+		REQUIRE(dualquat_is_normalized(identity));
+		REQUIRE(vector_all_near_equal3(dualquat_mul_point3(x_axis, identity), x_axis, threshold));
+	}
+
+	{
+		const QuatType rotation = quat_from_euler(degrees(FloatType(12.0)), degrees(FloatType(-37.0)), degrees(FloatType(124.0)));
+		const Vector4Type translation = vector_set(FloatType(1.5), FloatType(-2.25), FloatType(0.75));
+		const DualQuatType dq = dualquat_from_rotation_translation(rotation, translation);
+		const TransformType qvv = qvv_set(rotation, translation, vector_set(FloatType(1.0)));
+
+		REQUIRE(dualquat_is_normalized(dq));
+		REQUIRE(quat_near_equal(dualquat_get_rotation(dq), rotation, threshold));
+		REQUIRE(vector_all_near_equal3(dualquat_get_translation(dq), translation, threshold));
+		REQUIRE(dualquat_near_equal(dualquat_from_qvv(qvv), dq, threshold));
+
+		// Matrices do not retain the sign of the rotation, compare the transformed points instead
+		const DualQuatType dq_from_matrix = dualquat_from_matrix(matrix_from_qvv(qvv));
+		REQUIRE(dualquat_is_normalized(dq_from_matrix));
+		REQUIRE(vector_all_near_equal3(dualquat_mul_point3(x_axis, dq_from_matrix), dualquat_mul_point3(x_axis, dq), threshold));
+		REQUIRE(vector_all_near_equal3(dualquat_mul_point3(y_axis, dq_from_matrix), dualquat_mul_point3(y_axis, dq), threshold));
+
+		// Scale is ignored
+		REQUIRE(dualquat_near_equal(dualquat_from_qvv(qvv_set(rotation, translation, vector_set(FloatType(2.5)))), dq, threshold));
+		REQUIRE(vector_all_near_equal3(dualquat_mul_point3(y_axis, dualquat_from_matrix(matrix_from_qvv(rotation, translation, vector_set(FloatType(2.5))))), dualquat_mul_point3(y_axis, dq), threshold));
+
+		const TransformType qvv_from_dq = qvv_from_dualquat(dq);
+		REQUIRE(quat_near_equal(qvv_from_dq.rotation, rotation, threshold));
+		REQUIRE(vector_all_near_equal3(qvv_from_dq.translation, translation, threshold));
+		REQUIRE(vector_all_near_equal3(qvv_from_dq.scale, vector_set(FloatType(1.0)), threshold));
+		REQUIRE(vector_all_near_equal3(matrix_from_dualquat(dq).w_axis, translation, threshold));
+
+		REQUIRE(vector_all_near_equal3(dualquat_mul_point3(x_axis, dq), qvv_mul_point3(x_axis, qvv), threshold));
+		REQUIRE(vector_all_near_equal3(dualquat_mul_point3(y_axis, dq), qvv_mul_point3(y_axis, qvv), threshold));
+		REQUIRE(vector_all_near_equal3(dualquat_mul_vector3(y_axis, dq), quat_mul_vector3(y_axis, rotation), threshold));
+
+		const DualQuatType dq_inv = dualquat_inverse(dq);
+		REQUIRE(dualquat_near_equal(dualquat_mul(dq, dq_inv), identity, threshold));
+		REQUIRE(vector_all_near_equal3(dualquat_mul_point3(dualquat_mul_point3(y_axis, dq), dq_inv), y_axis, threshold));
+
+		const QuatType rotation_b = quat_from_euler(degrees(FloatType(-80.0)), degrees(FloatType(15.0)), degrees(FloatType(45.0)));
+		const Vector4Type translation_b = vector_set(FloatType(-0.5), FloatType(3.0), FloatType(1.25));
+		const DualQuatType dq_b = dualquat_from_rotation_translation(rotation_b, translation_b);
+		const TransformType qvv_b = qvv_set(rotation_b, translation_b, vector_set(FloatType(1.0)));
+
+		const DualQuatType dq_ab = dualquat_mul(dq, dq_b);
+		const TransformType qvv_ab = qvv_mul(qvv, qvv_b);
+		REQUIRE(dualquat_is_normalized(dq_ab));
+		REQUIRE(dualquat_near_equal(dq_ab, dualquat_from_qvv(qvv_ab), threshold));
+		REQUIRE(vector_all_near_equal3(dualquat_mul_point3(x_axis, dq_ab), dualquat_mul_point3(dualquat_mul_point3(x_axis, dq), dq_b), threshold));
+
+		// Normalization
+		const DualQuatType scaled_dq = dualquat_set(quat_set(quat_get_x(dq.real) * FloatType(2.0), quat_get_y(dq.real) * FloatType(2.0), quat_get_z(dq.real) * FloatType(2.0), quat_get_w(dq.real) * FloatType(2.0)), quat_set(quat_get_x(dq.dual) * FloatType(2.0) + FloatType(0.1), quat_get_y(dq.dual) * FloatType(2.0), quat_get_z(dq.dual) * FloatType(2.0), quat_get_w(dq.dual) * FloatType(2.0)));
+		REQUIRE(!dualquat_is_normalized(scaled_dq));
+		REQUIRE(dualquat_is_normalized(dualquat_normalize(scaled_dq)));
+		REQUIRE(quat_near_equal(dualquat_normalize(scaled_dq).real, dq.real, threshold));
+
+		// Linear blending
+		REQUIRE(dualquat_near_equal(dualquat_lerp(dq, dq_b, FloatType(0.0)), dq, threshold));
+		REQUIRE(dualquat_near_equal(dualquat_lerp(dq, dq_b, FloatType(1.0)), dq_b, threshold));
+		REQUIRE(dualquat_is_normalized(dualquat_lerp(dq, dq_b, FloatType(0.35))));
+
+		// The shortest path is taken, the antipodal dual quaternion represents the same transform
+		const DualQuatType neg_dq_b = dualquat_set(quat_neg(dq_b.real), quat_neg(dq_b.dual));
+		REQUIRE(dualquat_near_equal(dualquat_lerp(dq, neg_dq_b, FloatType(0.35)), dualquat_lerp(dq, dq_b, FloatType(0.35)), threshold));
+
+		const DualQuatType inputs[3] = { dq, neg_dq_b, identity };
+		const FloatType weights[3] = { FloatType(0.5), FloatType(0.3), FloatType(0.2) };
+		const DualQuatType blended = dualquat_blend(inputs, weights, 3);
+		REQUIRE(dualquat_is_normalized(blended));
+		REQUIRE(dualquat_near_equal(dualquat_blend(inputs, weights, 1), dq, threshold));
+
+		const DualQuatType two_inputs[2] = { dq, dq_b };
+		const FloatType two_weights[2] = { FloatType(0.65), FloatType(0.35) };
+		REQUIRE(dualquat_near_equal(dualquat_blend(two_inputs, two_weights, 2), dualquat_lerp(dq, dq_b, FloatType(0.35)), threshold));
+
+		// Screw linear interpolation
+		REQUIRE(dualquat_near_equal(dualquat_sclerp(dq, dq_b, FloatType(0.0)), dq, threshold));
+		REQUIRE(dualquat_near_equal(dualquat_sclerp(dq, dq_b, FloatType(1.0)), dq_b, threshold));
+		REQUIRE(dualquat_near_equal(dualquat_sclerp(dq, neg_dq_b, FloatType(1.0)), dq_b, threshold));
+		REQUIRE(dualquat_is_normalized(dualquat_sclerp(dq, dq_b, FloatType(0.35))));
+
+		// The rotation part matches a spherical interpolation: half way, the relative rotation is split in two equal halves
+		const DualQuatType half_way = dualquat_sclerp(dq, dq_b, FloatType(0.5));
+		const DualQuatType first_half = dualquat_mul(dualquat_inverse(dq), half_way);
+		const DualQuatType second_half = dualquat_mul(dualquat_inverse(half_way), dq_b);
+		REQUIRE(dualquat_near_equal(first_half, second_half, threshold));
+	}
+
+	{
+		// A rotation of 90 degrees around the Z axis centered on [1, 0, 0]: a point on the axis does not move
+		const QuatType rotation_around_z = quat_from_euler(degrees(FloatType(0.0)), degrees(FloatType(90.0)), degrees(FloatType(0.0)));
+		const DualQuatType start = identity;
+		const DualQuatType end = dualquat_from_rotation_translation(rotation_around_z, vector_sub(x_axis, quat_mul_vector3(x_axis, rotation_around_z)));
+		REQUIRE(vector_all_near_equal3(dualquat_mul_point3(x_axis, end), x_axis, threshold));
+
+		for (int32_t step = 0; step <= 4; ++step)
+		{
+			const FloatType alpha = FloatType(step) * FloatType(0.25);
+			const DualQuatType interpolated = dualquat_sclerp(start, end, alpha);
+			REQUIRE(vector_all_near_equal3(dualquat_mul_point3(x_axis, interpolated), x_axis, threshold));
+
+			// The origin travels on an arc of radius 1 around the pivot
+			const Vector4Type origin = dualquat_mul_point3(zero, interpolated);
+			REQUIRE(scalar_near_equal(vector_length3(vector_sub(origin, x_axis)), FloatType(1.0), threshold));
+		}
+
+		// Pure translations interpolate linearly
+		const DualQuatType translated = dualquat_from_rotation_translation(quat_identity(), vector_set(FloatType(4.0), FloatType(-2.0), FloatType(1.0)));
+		REQUIRE(vector_all_near_equal3(dualquat_get_translation(dualquat_sclerp(identity, translated, FloatType(0.25))), vector_set(FloatType(1.0), FloatType(-0.5), FloatType(0.25)), threshold));
+	}
+}
+
+TEST_CASE("dualquatf math", "[math][dualquat]")
+{
+	test_dualquat_impl<dualquatf, qvvf, float>(dualquat_identity(), 1.0e-4f);
+
+	{
+		const quatf rotation = quat_from_euler(degrees(12.0f), degrees(-37.0f), degrees(124.0f));
+		const dualquatd dq = dualquat_from_rotation_translation(quat_cast(rotation), vector_set(1.5, -2.25, 0.75));
+		REQUIRE(dualquat_near_equal(dualquat_cast(dq), dualquat_from_rotation_translation(rotation, vector_set(1.5f, -2.25f, 0.75f)), 1.0e-5f));
+	}
+}
+
+TEST_CASE("dualquatd math", "[math][dualquat]")
+{
+	test_dualquat_impl<dualquatd, qvvd, double>(dualquat_identity(), 1.0e-8);
+
+	{
+		const quatd rotation = quat_from_euler(degrees(12.0), degrees(-37.0), degrees(124.0));
+		const dualquatf dq = dualquat_from_rotation_translation(quat_cast(rotation), vector_set(1.5f, -2.25f, 0.75f));
+		REQUIRE(dualquat_near_equal(dualquat_cast(dq), dualquat_from_rotation_translation(rotation, vector_set(1.5, -2.25, 0.75)), 1.0e-5));
+	}
+}
@@ -0,0 +1,213 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch.hpp>
+
+#include <rtm/aabbf.h>
+#include <rtm/frustumf.h>
+#include <rtm/planef.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace rtm;
+
+// Left handed perspective projection looking down +Z, for row vectors: clip = point * projection
+static matrix4x4f make_perspective(float x_scale, float y_scale, float near_distance, float far_distance, clip_depth_range depth_range)
+{
+	const float range = far_distance - near_distance;
+	const float z_scale = depth_range == clip_depth_range::zero_to_one ? (far_distance / range) : ((far_distance + near_distance) / range);
+	const float z_offset = depth_range == clip_depth_range::zero_to_one ? (-near_distance * far_distance / range) : (-2.0f * near_distance * far_distance / range);
+
+	return matrix4x4f{ vector_set(x_scale, 0.0f, 0.0f, 0.0f), vector_set(0.0f, y_scale, 0.0f, 0.0f), vector_set(0.0f, 0.0f, z_scale, 1.0f), vector_set(0.0f, 0.0f, z_offset, 0.0f) };
+}
+
+// Smallest signed distance between the object and the frustum planes, used to skip ambiguous objects
+static float frustum_margin(const frustumf& frustum, vector4f_arg0 center, vector4f_arg1 extents, float radius)
+{
+	float margin = 1.0e30f;
+	for (const planef& plane : frustum.planes)
+	{
+		const float distance = plane_signed_distance(plane, center) + vector_dot3(vector_abs(plane), extents) + radius;
+		margin = scalar_min(margin, distance);
+	}
+
+	return margin;
+}
+
+TEST_CASE("planef math", "[math][plane]")
+{
+	const vector4f normal = vector_normalize3(vector_set(1.0f, 2.0f, -0.5f), vector_zero());
+	const vector4f point = vector_set(3.0f, -1.0f, 2.5f);
+	const planef plane = plane_from_point_normal(point, normal);
+
+	CHECK(scalar_near_equal(plane_get_distance(plane), -vector_dot3(normal, point), 1.0e-5f));
+	CHECK(vector_all_near_equal3(plane_get_normal(plane), normal, 1.0e-6f));
+	CHECK(scalar_near_equal(plane_signed_distance(plane, point), 0.0f, 1.0e-5f));
+	CHECK(scalar_near_equal(plane_signed_distance(plane, vector_add(point, vector_mul(normal, 2.0f))), 2.0f, 1.0e-5f));
+	CHECK(scalar_near_equal(plane_signed_distance(plane, vector_sub(point, vector_mul(normal, 0.5f))), -0.5f, 1.0e-5f));
+
+	const planef scaled_plane = plane_set(vector_mul(normal, 4.0f), plane_get_distance(plane) * 4.0f);
+	CHECK(vector_all_near_equal(plane_normalize(scaled_plane), plane, 1.0e-5f));
+}
+
+TEST_CASE("frustumf culling", "[math][frustum]")
+{
+	const float near_distance = 0.5f;
+	const float far_distance = 100.0f;
+
+	for (clip_depth_range depth_range : { clip_depth_range::zero_to_one, clip_depth_range::negative_one_to_one })
+	{
+		const frustumf frustum = frustum_from_view_projection(make_perspective(1.0f, 1.5f, near_distance, far_distance, depth_range), depth_range);
+
+		// Near and far planes face each other along Z
+		CHECK(scalar_near_equal(plane_signed_distance(frustum.planes[4], vector_set(0.0f, 0.0f, near_distance)), 0.0f, 1.0e-4f));
+		CHECK(scalar_near_equal(plane_signed_distance(frustum.planes[5], vector_set(0.0f, 0.0f, far_distance)), 0.0f, 1.0e-3f));
+		CHECK(scalar_near_equal(vector_get_z(frustum.planes[4]), 1.0f, 1.0e-5f));
+		CHECK(scalar_near_equal(vector_get_z(frustum.planes[5]), -1.0f, 1.0e-5f));
+
+		// With a 1.0 X scale, the left and right planes are at 45 degrees
+		CHECK(scalar_near_equal(plane_signed_distance(frustum.planes[0], vector_set(-10.0f, 0.0f, 10.0f)), 0.0f, 1.0e-4f));
+		CHECK(scalar_near_equal(plane_signed_distance(frustum.planes[1], vector_set(10.0f, 0.0f, 10.0f)), 0.0f, 1.0e-4f));
+
+		CHECK(frustum_intersects_sphere(frustum, vector_set(0.0f, 0.0f, 10.0f), 1.0f));
+		CHECK(frustum_intersects_sphere(frustum, vector_set(0.0f, 0.0f, 0.0f), 1.0f));
+		CHECK(frustum_intersects_sphere(frustum, vector_set(-10.5f, 0.0f, 10.0f), 1.0f));
+		CHECK_FALSE(frustum_intersects_sphere(frustum, vector_set(0.0f, 0.0f, -5.0f), 1.0f));
+		CHECK_FALSE(frustum_intersects_sphere(frustum, vector_set(0.0f, 0.0f, 102.0f), 1.0f));
+		CHECK_FALSE(frustum_intersects_sphere(frustum, vector_set(-12.0f, 0.0f, 10.0f), 1.0f));
+
+		CHECK(frustum_intersects_aabb(frustum, vector_set(0.0f, 0.0f, 10.0f), vector_set(1.0f, 2.0f, 3.0f)));
+		CHECK(frustum_intersects_aabb(frustum, vector_set(0.0f, 20.0f, 10.0f), vector_set(1.0f, 14.0f, 1.0f)));
+		CHECK_FALSE(frustum_intersects_aabb(frustum, vector_set(0.0f, 20.0f, 10.0f), vector_set(1.0f, 12.0f, 1.0f)));
+		CHECK_FALSE(frustum_intersects_aabb(frustum, vector_set(0.0f, 0.0f, -5.0f), vector_set(1.0f, 1.0f, 1.0f)));
+		CHECK(frustum_intersects_aabb(frustum, aabb_from_min_max(vector_set(-1.0f, -1.0f, -1.0f), vector_set(1.0f, 1.0f, 1.0f))));
+
+		// Covers full groups of 8 and 32 followed by partial ones
+		const size_t max_num_objects = 75;
+		std::vector<float> centers_x;
+		std::vector<float> centers_y;
+		std::vector<float> centers_z;
+		std::vector<float> extents_x;
+		std::vector<float> extents_y;
+		std::vector<float> extents_z;
+		std::vector<float> radii;
+		for (size_t object_index = 0; object_index < max_num_objects; ++object_index)
+		{
+			const float offset = float(object_index);
+			centers_x.push_back(-40.0f + float((object_index * 37) % 80));
+			centers_y.push_back(-30.0f + float((object_index * 53) % 60) * 1.25f);
+			centers_z.push_back(-10.0f + float((object_index * 29) % 120));
+			extents_x.push_back(0.5f + float(object_index % 7));
+			extents_y.push_back(0.25f + float(object_index % 5) * 1.5f);
+			extents_z.push_back(1.0f + float(object_index % 3));
+			radii.push_back(0.5f + scalar_abs(scalar_sin(offset)) * 6.0f);
+		}
+
+		for (size_t count = 0; count <= max_num_objects; ++count)
+		{
+			const size_t num_words = (count + 31) / 32;
+			std::vector<uint32_t> sphere_visibility(num_words + 1, 0xFFFFFFFFU);
+			std::vector<uint32_t> aabb_visibility(num_words + 1, 0xFFFFFFFFU);
+
+			frustum_cull_spheres(frustum, centers_x.data(), centers_y.data(), centers_z.data(), radii.data(), count, sphere_visibility.data());
+			frustum_cull_aabbs(frustum, centers_x.data(), centers_y.data(), centers_z.data(), extents_x.data(), extents_y.data(), extents_z.data(), count, aabb_visibility.data());
+
+			// Only the required words are written
+			CHECK(sphere_visibility[num_words] == 0xFFFFFFFFU);
+			CHECK(aabb_visibility[num_words] == 0xFFFFFFFFU);
+
+			for (size_t object_index = 0; object_index < num_words * 32; ++object_index)
+			{
+				const bool is_sphere_visible = (sphere_visibility[object_index / 32] & (1U << (object_index % 32))) != 0;
+				const bool is_aabb_visible = (aabb_visibility[object_index / 32] & (1U << (object_index % 32))) != 0;
+
+				if (object_index >= count)
+				{
+					// Unused trailing bits are cleared
+					CHECK_FALSE(is_sphere_visible);
+					CHECK_FALSE(is_aabb_visible);
+					continue;
+				}
+
+				const vector4f center = vector_set(centers_x[object_index], centers_y[object_index], centers_z[object_index]);
+				const vector4f extents = vector_set(extents_x[object_index], extents_y[object_index], extents_z[object_index]);
+				const float radius = radii[object_index];
+
+				if (scalar_abs(frustum_margin(frustum, center, vector_zero(), radius)) > 1.0e-3f)
+					CHECK(is_sphere_visible == frustum_intersects_sphere(frustum, center, radius));
+
+				if (scalar_abs(frustum_margin(frustum, center, extents, 0.0f)) > 1.0e-3f)
+					CHECK(is_aabb_visible == frustum_intersects_aabb(frustum, center, extents));
+			}
+		}
+	}
+}
+
+TEST_CASE("frustumf infinite projections", "[math][frustum]")
+{
+	const float near_distance = 0.5f;
+
+	// Infinite far plane: z' = z - near, w' = z
+	const matrix4x4f infinite_projection = { vector_set(1.0f, 0.0f, 0.0f, 0.0f), vector_set(0.0f, 1.5f, 0.0f, 0.0f), vector_set(0.0f, 0.0f, 1.0f, 1.0f), vector_set(0.0f, 0.0f, -near_distance, 0.0f) };
+
+	// Reverse-Z with an infinite far plane: z' = near, w' = z
+	const matrix4x4f reverse_z_projection = { vector_set(1.0f, 0.0f, 0.0f, 0.0f), vector_set(0.0f, 1.5f, 0.0f, 0.0f), vector_set(0.0f, 0.0f, 0.0f, 1.0f), vector_set(0.0f, 0.0f, near_distance, 0.0f) };
+
+	for (const matrix4x4f& projection : { infinite_projection, reverse_z_projection })
+	{
+		const frustumf frustum = frustum_from_view_projection(projection, clip_depth_range::zero_to_one);
+
+		for (const planef& plane : frustum.planes)
+			CHECK(vector_is_finite(plane));
+
+		CHECK(frustum_intersects_sphere(frustum, vector_set(0.0f, 0.0f, 5.0f), 1.0f));
+		CHECK(frustum_intersects_sphere(frustum, vector_set(0.0f, 0.0f, 1.0e6f), 1.0f));
+		CHECK_FALSE(frustum_intersects_sphere(frustum, vector_set(0.0f, 0.0f, -5.0f), 1.0f));
+		CHECK_FALSE(frustum_intersects_sphere(frustum, vector_set(-20.0f, 0.0f, 10.0f), 1.0f));
+
+		// The scalar and batch functions agree
+		const float centers_x[4] = { 0.0f, 0.0f, 0.0f, -20.0f };
+		const float centers_y[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		const float centers_z[4] = { 5.0f, 1.0e6f, -5.0f, 10.0f };
+		const float extents[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+		uint32_t sphere_visibility = 0;
+		uint32_t aabb_visibility = 0;
+		frustum_cull_spheres(frustum, centers_x, centers_y, centers_z, extents, 4, &sphere_visibility);
+		frustum_cull_aabbs(frustum, centers_x, centers_y, centers_z, extents, extents, extents, 4, &aabb_visibility);
+
+		for (size_t object_index = 0; object_index < 4; ++object_index)
+		{
+			const vector4f center = vector_set(centers_x[object_index], centers_y[object_index], centers_z[object_index]);
+			const bool is_sphere_visible = (sphere_visibility & (1U << object_index)) != 0;
+			const bool is_aabb_visible = (aabb_visibility & (1U << object_index)) != 0;
+			CHECK(is_sphere_visible == frustum_intersects_sphere(frustum, center, extents[object_index]));
+			CHECK(is_aabb_visible == frustum_intersects_aabb(frustum, center, vector_set(extents[object_index])));
+		}
+
+		CHECK(sphere_visibility == 0x3);
+		CHECK(aabb_visibility == 0x3);
+	}
+}
@@ -158,6 +158,10 @@ static void test_affine_matrix_impl(const FloatType threshold)
 		REQUIRE(vector_all_near_equal3(result, vector_set(FloatType(1.0), FloatType(1.0), FloatType(0.0)), threshold));
 		result = matrix_mul_point3(y_axis, mtx_b);
 		REQUIRE(vector_all_near_equal3(result, vector_set(FloatType(0.0), FloatType(1.0), FloatType(-1.0)), threshold));
+		result = matrix_mul_vector3(x_axis, mtx_b);
+		REQUIRE(vector_all_near_equal3(result, vector_set(FloatType(1.0), FloatType(0.0), FloatType(0.0)), threshold));
+		result = matrix_mul_vector3(y_axis, mtx_b);
+		REQUIRE(vector_all_near_equal3(result, vector_set(FloatType(0.0), FloatType(0.0), FloatType(-1.0)), threshold));
 
 		Matrix3x4Type mtx_ab = matrix_mul(mtx_a, mtx_b);
 		Matrix3x4Type mtx_ba = matrix_mul(mtx_b, mtx_a);
@@ -25,6 +25,7 @@
 
 #include <catch.hpp>
 
+#include <rtm/arena_allocator.h>
 #include <rtm/impl/memory_utils.h>
 
 #include <cstdint>
@@ -117,6 +118,39 @@ TEST_CASE("raw memory support", "[core][memory]")
 	REQUIRE(unaligned_read<uint32_t>(&unaligned_value_buffer[1]) == value32);
 }
 
+TEST_CASE("arena allocator", "[core][memory]")
+{
+	// Offset the buffer to make sure the arena aligns the allocations itself
+	alignas(64) uint8_t buffer[1024 + 1];
+	arena_allocator arena = arena_create(&buffer[1], 1024);
+	CHECK(arena_get_used_size(arena) == 0);
+
+	void* allocation0 = arena_allocate(arena, 3);
+	CHECK(allocation0 == &buffer[64]);
+	CHECK(arena_get_used_size(arena) == 63 + 3);
+
+	void* allocation1 = arena_allocate(arena, 4, 4);
+	CHECK(allocation1 == &buffer[68]);
+	CHECK(is_aligned_to(allocation1, 4));
+
+	float* floats = arena_allocate_array<float>(arena, 16);
+	CHECK(static_cast<void*>(floats) == &buffer[128]);
+	CHECK(arena_get_used_size(arena) == 127 + 16 * sizeof(float));
+
+	// Not enough space left, the arena is left untouched
+	const size_t used_size = arena_get_used_size(arena);
+	CHECK(arena_allocate(arena, 1024) == nullptr);
+	CHECK(arena_get_used_size(arena) == used_size);
+
+	// The last byte can be allocated
+	CHECK(arena_allocate(arena, 1024 - used_size, 1) == &buffer[1 + used_size]);
+	CHECK(arena_allocate(arena, 1, 1) == nullptr);
+
+	arena_reset(arena);
+	CHECK(arena_get_used_size(arena) == 0);
+	CHECK(arena_allocate(arena, 3) == allocation0);
+}
+
 enum class UnsignedEnum : uint32_t
 {
 	ZERO = 0,
@@ -0,0 +1,217 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/matrix3x4f.h>
+#include <rtm/parallel.h>
+#include <rtm/qvvf.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace rtm;
+
+// Large enough to span several chunks of every batch function, not a multiple of any chunk size
+static constexpr size_t k_num_parallel_entries = 3001;
+
+namespace
+{
+	// A job system hook that records how many chunks it ran
+	struct counting_executor
+	{
+		size_t num_runs;
+		size_t num_chunks;
+	};
+
+	void counting_executor_run(void* context, parallel_task_function task, void* task_data, size_t num_chunks)
+	{
+		counting_executor* executor = static_cast<counting_executor*>(context);
+		executor->num_runs++;
+		executor->num_chunks += num_chunks;
+
+		// Run the chunks backwards, the order is unspecified
+		for (size_t chunk_index = num_chunks; chunk_index != 0; --chunk_index)
+			task(task_data, chunk_index - 1);
+	}
+}
+
+static void test_parallel_for_coverage(const parallel_executor& executor, size_t count, size_t chunk_size)
+{
+	std::unique_ptr<std::atomic<uint32_t>[]> counters(new std::atomic<uint32_t>[count + 1]);
+	for (size_t index = 0; index <= count; ++index)
+		counters[index].store(0, std::memory_order_relaxed);
+
+	parallel_for(executor, count, chunk_size, [&counters](size_t begin, size_t end)
+		{
+			for (size_t index = begin; index < end; ++index)
+				counters[index].fetch_add(1, std::memory_order_relaxed);
+		});
+
+	for (size_t index = 0; index < count; ++index)
+		REQUIRE(counters[index].load(std::memory_order_relaxed) == 1);
+
+	REQUIRE(counters[count].load(std::memory_order_relaxed) == 0);
+}
+
+static void test_parallel_batch(const parallel_executor& executor, size_t output_offset)
+{
+	const float threshold = 1.0e-4f;
+	const size_t count = k_num_parallel_entries;
+
+	std::vector<qvvf> lhs(count);
+	std::vector<qvvf> rhs(count);
+	vector4f* points = new vector4f[count];
+	std::vector<matrix3x4f> matrices(count);
+	for (size_t index = 0; index < count; ++index)
+	{
+		const float offset = float(index % 97);
+		const quatf rotation = quat_from_euler(degrees(10.0f + offset * 7.0f), degrees(-15.0f + offset * 3.0f), degrees(20.0f - offset * 5.0f));
+		const vector4f translation = vector_set(0.5f + offset * 0.1f, -0.25f, 0.125f * offset);
+		// A few transforms have negative scale, the chunks that contain them use the scalar code path
+		const float scale_x = (index % 499) == 7 ? -1.0f : 1.0f;
+		lhs[index] = qvv_set(rotation, translation, vector_set(scale_x, 1.0f + float(index % 3) * 0.05f, 1.0f));
+		rhs[index] = qvv_set(quat_conjugate(rotation), vector_set(-0.5f, offset * 0.01f, 1.0f), vector_set(1.0f));
+		points[index] = vector_set(offset, 1.0f - offset, 2.0f);
+		matrices[index] = matrix_from_qvv(lhs[index]);
+	}
+
+	// The output offset changes the cache line alignment of the chunks
+	std::vector<qvvf> qvv_results(count + output_offset);
+	std::vector<qvvf> qvv_no_scale_results(count + output_offset);
+	vector4f* point_results = new vector4f[count + output_offset];
+	std::vector<matrix3x4f> inverse_results(count + output_offset);
+	std::vector<matrix3x4f> inverse_rigid_results(count + output_offset);
+
+	qvv_mul_batch(executor, lhs.data(), rhs.data(), qvv_results.data() + output_offset, count);
+	qvv_mul_no_scale_batch(executor, lhs.data(), rhs.data(), qvv_no_scale_results.data() + output_offset, count);
+	matrix_mul_point3_batch(executor, points, matrices[1], point_results + output_offset, count);
+	matrix_inverse_batch(executor, matrices.data(), inverse_results.data() + output_offset, count);
+	matrix_inverse_rigid_batch(executor, matrices.data(), inverse_rigid_results.data() + output_offset, count);
+
+	for (size_t index = 0; index < count; ++index)
+	{
+		const qvvf expected = qvv_mul(lhs[index], rhs[index]);
+		const qvvf& result = qvv_results[output_offset + index];
+		REQUIRE(quat_near_equal(result.rotation, expected.rotation, threshold));
+		REQUIRE(vector_all_near_equal3(result.translation, expected.translation, threshold));
+		REQUIRE(vector_all_near_equal3(result.scale, expected.scale, threshold));
+
+		const qvvf expected_no_scale = qvv_mul_no_scale(lhs[index], rhs[index]);
+		const qvvf& result_no_scale = qvv_no_scale_results[output_offset + index];
+		REQUIRE(quat_near_equal(result_no_scale.rotation, expected_no_scale.rotation, threshold));
+		REQUIRE(vector_all_near_equal3(result_no_scale.translation, expected_no_scale.translation, threshold));
+
+		REQUIRE(vector_all_near_equal3(point_results[output_offset + index], matrix_mul_point3(points[index], matrices[1]), threshold));
+
+		const matrix3x4f expected_inverse = matrix_inverse(matrices[index]);
+		const matrix3x4f& inverse = inverse_results[output_offset + index];
+		REQUIRE(vector_all_near_equal3(inverse.x_axis, expected_inverse.x_axis, threshold));
+		REQUIRE(vector_all_near_equal3(inverse.y_axis, expected_inverse.y_axis, threshold));
+		REQUIRE(vector_all_near_equal3(inverse.z_axis, expected_inverse.z_axis, threshold));
+		REQUIRE(vector_all_near_equal3(inverse.w_axis, expected_inverse.w_axis, threshold));
+
+		// Only the rotations without scale are rigid
+		if (index % 3 == 0 && (index % 499) != 7)
+		{
+			const matrix3x4f& inverse_rigid = inverse_rigid_results[output_offset + index];
+			REQUIRE(vector_all_near_equal3(inverse_rigid.x_axis, expected_inverse.x_axis, threshold));
+			REQUIRE(vector_all_near_equal3(inverse_rigid.w_axis, expected_inverse.w_axis, threshold));
+		}
+	}
+
+	delete[] points;
+	delete[] point_results;
+}
+
+TEST_CASE("parallel for", "[core][parallel]")
+{
+	{
+		const parallel_executor executor = parallel_executor_serial();
+		test_parallel_for_coverage(executor, 0, 16);
+		test_parallel_for_coverage(executor, 5, 16);
+		test_parallel_for_coverage(executor, 1000, 16);
+	}
+
+	{
+		thread_pool pool(4);
+		CHECK(pool.get_num_threads() == 4);
+
+		const parallel_executor executor = pool.get_executor();
+		test_parallel_for_coverage(executor, 0, 16);
+		test_parallel_for_coverage(executor, 16, 16);
+		test_parallel_for_coverage(executor, 17, 16);
+		test_parallel_for_coverage(executor, 100000, 7);
+
+		// The pool can be reused
+		for (size_t iteration = 0; iteration < 20; ++iteration)
+			test_parallel_for_coverage(executor, 1000 + iteration, 32);
+
+		// Nested workloads run serially on the thread that executes their parent chunk
+		std::atomic<uint32_t> num_nested_entries(0);
+		parallel_for(executor, 64, 4, [&executor, &num_nested_entries](size_t begin, size_t end)
+			{
+				parallel_for(executor, (end - begin) * 10, 3, [&num_nested_entries](size_t nested_begin, size_t nested_end)
+					{
+						num_nested_entries.fetch_add(uint32_t(nested_end - nested_begin), std::memory_order_relaxed);
+					});
+			});
+		CHECK(num_nested_entries.load() == 640);
+	}
+
+	{
+		// A single thread runs everything on the caller
+		thread_pool pool(1);
+		CHECK(pool.get_num_threads() == 1);
+		test_parallel_for_coverage(pool.get_executor(), 1000, 16);
+	}
+
+	{
+		counting_executor context = { 0, 0 };
+		const parallel_executor executor = { counting_executor_run, &context };
+		test_parallel_for_coverage(executor, 1000, 16);
+		CHECK(context.num_runs == 1);
+		CHECK(context.num_chunks == 63);
+
+		// A single chunk does not go through the executor
+		test_parallel_for_coverage(executor, 16, 16);
+		CHECK(context.num_runs == 1);
+	}
+}
+
+TEST_CASE("parallel batch math", "[math][parallel][batch]")
+{
+	thread_pool pool(4);
+	test_parallel_batch(pool.get_executor(), 0);
+	test_parallel_batch(pool.get_executor(), 1);
+
+	counting_executor context = { 0, 0 };
+	const parallel_executor executor = { counting_executor_run, &context };
+	test_parallel_batch(executor, 3);
+	CHECK(context.num_runs == 5);
+
+	test_parallel_batch(parallel_executor_serial(), 0);
+}
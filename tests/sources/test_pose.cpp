@@ -0,0 +1,276 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch.hpp>
+
+#include <rtm/pose.h>
+#include <rtm/matrix3x4f.h>
+#include <rtm/quatf.h>
+#include <rtm/qvvf.h>
+
+#include <vector>
+
+using namespace rtm;
+
+// Not a multiple of 4 to cover the remainder
+static constexpr size_t k_num_pose_bones = 47;
+
+// Compares the matrices to be robust to quaternion sign flips and negative scale decompositions
+static void check_pose_transform_near_equal(const qvvf& object, const qvvf& expected, float threshold)
+{
+	const matrix3x4f expected_mtx = matrix_from_qvv(expected);
+	const matrix3x4f object_mtx = matrix_from_qvv(object);
+	CHECK(vector_all_near_equal3(object_mtx.x_axis, expected_mtx.x_axis, threshold));
+	CHECK(vector_all_near_equal3(object_mtx.y_axis, expected_mtx.y_axis, threshold));
+	CHECK(vector_all_near_equal3(object_mtx.z_axis, expected_mtx.z_axis, threshold));
+	CHECK(vector_all_near_equal3(object_mtx.w_axis, expected_mtx.w_axis, threshold));
+}
+
+static void test_pose_local_to_object(const std::vector<uint16_t>& parent_indices, bool with_negative_scale)
+{
+	const float threshold = 1.0e-4f;
+	const size_t num_bones = parent_indices.size();
+
+	qvvf* local_transforms = new qvvf[num_bones];
+	qvvf* expected_transforms = new qvvf[num_bones];
+	qvvf* object_transforms = new qvvf[num_bones];
+	std::vector<matrix3x4f> palette(num_bones);
+
+	for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+	{
+		const float offset = float(bone_index);
+		const quatf rotation = quat_from_euler(degrees(10.0f + offset * 7.0f), degrees(-15.0f + offset * 3.0f), degrees(20.0f - offset * 5.0f));
+		const vector4f translation = vector_set(0.5f + offset * 0.1f, -0.25f, 0.125f * offset);
+		const float scale_x = with_negative_scale && (bone_index % 11) == 5 ? -1.0f : 1.0f;
+		const vector4f scale = vector_set(scale_x, 1.0f + float(bone_index % 3) * 0.05f, 1.0f);
+		local_transforms[bone_index] = qvv_set(rotation, translation, scale);
+	}
+
+	// Reference: one bone at a time
+	for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+	{
+		const uint16_t parent_index = parent_indices[bone_index];
+		expected_transforms[bone_index] = parent_index == k_invalid_bone_index ? local_transforms[bone_index] : qvv_mul(local_transforms[bone_index], expected_transforms[parent_index]);
+	}
+
+	pose_local_to_object(local_transforms, parent_indices.data(), object_transforms, palette.data(), num_bones);
+
+	for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+	{
+		check_pose_transform_near_equal(object_transforms[bone_index], expected_transforms[bone_index], threshold);
+
+		const matrix3x4f object_mtx = matrix_from_qvv(object_transforms[bone_index]);
+		CHECK(vector_all_near_equal3(palette[bone_index].x_axis, object_mtx.x_axis, threshold));
+		CHECK(vector_all_near_equal3(palette[bone_index].y_axis, object_mtx.y_axis, threshold));
+		CHECK(vector_all_near_equal3(palette[bone_index].z_axis, object_mtx.z_axis, threshold));
+		CHECK(vector_all_near_equal3(palette[bone_index].w_axis, object_mtx.w_axis, threshold));
+	}
+
+	// Palette written with streaming stores
+	std::vector<matrix3x4f> stream_palette(num_bones);
+	pose_local_to_object(local_transforms, parent_indices.data(), object_transforms, stream_palette.data(), num_bones, store_mode::streaming);
+
+	for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+	{
+		CHECK(vector_all_near_equal(stream_palette[bone_index].x_axis, palette[bone_index].x_axis, 0.0f));
+		CHECK(vector_all_near_equal(stream_palette[bone_index].y_axis, palette[bone_index].y_axis, 0.0f));
+		CHECK(vector_all_near_equal(stream_palette[bone_index].z_axis, palette[bone_index].z_axis, 0.0f));
+		CHECK(vector_all_near_equal(stream_palette[bone_index].w_axis, palette[bone_index].w_axis, 0.0f));
+	}
+
+	// Prefetching does not change the results, including distances past the last bone
+	const size_t prefetch_distances[] = { 0, 1, 5, 1000 };
+	for (size_t prefetch_distance : prefetch_distances)
+	{
+		qvvf* prefetch_transforms = new qvvf[num_bones];
+		pose_local_to_object(local_transforms, parent_indices.data(), prefetch_transforms, nullptr, num_bones, store_mode::cached, prefetch_distance);
+
+		for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+		{
+			CHECK(vector_all_near_equal(quat_to_vector(prefetch_transforms[bone_index].rotation), quat_to_vector(object_transforms[bone_index].rotation), 0.0f));
+			CHECK(vector_all_near_equal3(prefetch_transforms[bone_index].translation, object_transforms[bone_index].translation, 0.0f));
+			CHECK(vector_all_near_equal3(prefetch_transforms[bone_index].scale, object_transforms[bone_index].scale, 0.0f));
+		}
+
+		delete[] prefetch_transforms;
+	}
+
+	// In place without a palette
+	pose_local_to_object(local_transforms, parent_indices.data(), local_transforms, nullptr, num_bones);
+
+	for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+	{
+		const matrix3x4f expected_mtx = matrix_from_qvv(object_transforms[bone_index]);
+		const matrix3x4f object_mtx = matrix_from_qvv(local_transforms[bone_index]);
+		CHECK(vector_all_near_equal3(object_mtx.x_axis, expected_mtx.x_axis, threshold));
+		CHECK(vector_all_near_equal3(object_mtx.w_axis, expected_mtx.w_axis, threshold));
+	}
+
+	delete[] local_transforms;
+	delete[] expected_transforms;
+	delete[] object_transforms;
+}
+
+static void test_pose_local_to_object_lockstep(const std::vector<uint16_t>& parent_indices, bool with_negative_scale)
+{
+	// Object space translations grow along the chains and the SIMD code paths round differently
+	const float threshold = 1.0e-3f;
+	const size_t num_bones = parent_indices.size();
+	const size_t num_instances = 8;
+
+	// One pose per instance, stored one after the other
+	qvvf* local_transforms = new qvvf[num_bones * num_instances];
+	qvvf* expected_transforms = new qvvf[num_bones * num_instances];
+
+	for (size_t instance_index = 0; instance_index < num_instances; ++instance_index)
+	{
+		for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+		{
+			const float offset = float(bone_index) + float(instance_index) * 0.5f;
+			const quatf rotation = quat_from_euler(degrees(10.0f + offset * 7.0f), degrees(-15.0f + offset * 3.0f), degrees(20.0f - offset * 5.0f));
+			const vector4f translation = vector_set(0.5f + offset * 0.1f, -0.25f, 0.125f * offset);
+			// Only a single instance has negative scale
+			const float scale_x = with_negative_scale && instance_index == 3 && (bone_index % 11) == 5 ? -1.0f : 1.0f;
+			const vector4f scale = vector_set(scale_x, 1.0f + float(bone_index % 3) * 0.05f, 1.0f);
+			local_transforms[instance_index * num_bones + bone_index] = qvv_set(rotation, translation, scale);
+		}
+
+		pose_local_to_object(local_transforms + instance_index * num_bones, parent_indices.data(), expected_transforms + instance_index * num_bones, nullptr, num_bones);
+	}
+
+	// The wide types can be over-aligned which operator new does not honor before C++17
+	REQUIRE(num_bones <= k_num_pose_bones);
+
+	{
+		qvvf_x4 local_transforms_x4[k_num_pose_bones];
+		qvvf_x4 object_transforms_x4[k_num_pose_bones];
+
+		for (size_t group_index = 0; group_index < num_instances; group_index += 4)
+		{
+			for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+			{
+				qvvf bone_transforms[4];
+				for (size_t lane_index = 0; lane_index < 4; ++lane_index)
+					bone_transforms[lane_index] = local_transforms[(group_index + lane_index) * num_bones + bone_index];
+				local_transforms_x4[bone_index] = qvv_load_x4(&bone_transforms[0]);
+			}
+
+			pose_local_to_object(local_transforms_x4, parent_indices.data(), object_transforms_x4, num_bones);
+
+			for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+			{
+				qvvf bone_transforms[4];
+				qvv_store_x4(object_transforms_x4[bone_index], &bone_transforms[0]);
+				for (size_t lane_index = 0; lane_index < 4; ++lane_index)
+					check_pose_transform_near_equal(bone_transforms[lane_index], expected_transforms[(group_index + lane_index) * num_bones + bone_index], threshold);
+			}
+		}
+	}
+
+	{
+		qvvf_x8 local_transforms_x8[k_num_pose_bones];
+
+		for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+		{
+			qvvf bone_transforms[8];
+			for (size_t lane_index = 0; lane_index < 8; ++lane_index)
+				bone_transforms[lane_index] = local_transforms[lane_index * num_bones + bone_index];
+			local_transforms_x8[bone_index] = qvv_load_x8(&bone_transforms[0]);
+		}
+
+		// In place
+		pose_local_to_object(local_transforms_x8, parent_indices.data(), local_transforms_x8, num_bones);
+
+		for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+		{
+			qvvf bone_transforms[8];
+			qvv_store_x8(local_transforms_x8[bone_index], &bone_transforms[0]);
+			for (size_t lane_index = 0; lane_index < 8; ++lane_index)
+				check_pose_transform_near_equal(bone_transforms[lane_index], expected_transforms[lane_index * num_bones + bone_index], threshold);
+		}
+	}
+
+	delete[] local_transforms;
+	delete[] expected_transforms;
+}
+
+TEST_CASE("pose local to object", "[math][qvv][pose]")
+{
+	// A single long chain, every bone depends on the previous one
+	std::vector<uint16_t> chain_parent_indices;
+	for (size_t bone_index = 0; bone_index < k_num_pose_bones; ++bone_index)
+		chain_parent_indices.push_back(bone_index == 0 ? k_invalid_bone_index : uint16_t(bone_index - 1));
+
+	// A tree sorted breadth first where every bone has 4 children, siblings are contiguous
+	std::vector<uint16_t> wide_parent_indices;
+	for (size_t bone_index = 0; bone_index < k_num_pose_bones; ++bone_index)
+		wide_parent_indices.push_back(bone_index == 0 ? k_invalid_bone_index : uint16_t((bone_index - 1) / 4));
+
+	// A mix of both with multiple roots
+	std::vector<uint16_t> mixed_parent_indices;
+	for (size_t bone_index = 0; bone_index < k_num_pose_bones; ++bone_index)
+	{
+		if (bone_index == 0 || bone_index == 20)
+			mixed_parent_indices.push_back(k_invalid_bone_index);
+		else if (bone_index < 10)
+			mixed_parent_indices.push_back(uint16_t(bone_index - 1));
+		else
+			mixed_parent_indices.push_back(uint16_t(bone_index % 9));
+	}
+
+	for (bool with_negative_scale : { false, true })
+	{
+		test_pose_local_to_object(chain_parent_indices, with_negative_scale);
+		test_pose_local_to_object(wide_parent_indices, with_negative_scale);
+		test_pose_local_to_object(mixed_parent_indices, with_negative_scale);
+
+		test_pose_local_to_object_lockstep(chain_parent_indices, with_negative_scale);
+		test_pose_local_to_object_lockstep(mixed_parent_indices, with_negative_scale);
+	}
+}
+
+TEST_CASE("pose local to object large poses", "[math][qvv][pose]")
+{
+	// Past 65535 bones, the invalid parent index of roots is lower than the bone index
+	const size_t num_bones = 65536 + 8;
+	std::vector<uint16_t> parent_indices(num_bones, k_invalid_bone_index);
+	for (size_t bone_index = num_bones - 4; bone_index < num_bones; ++bone_index)
+		parent_indices[bone_index] = uint16_t(bone_index % 4);
+
+	std::vector<qvvf> local_transforms(num_bones);
+	for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+	{
+		const float offset = float(bone_index % 13);
+		local_transforms[bone_index] = qvv_set(quat_from_euler(degrees(offset * 7.0f), degrees(-offset * 3.0f), degrees(20.0f)), vector_set(offset, 1.0f, -2.0f), vector_set(1.0f));
+	}
+
+	std::vector<qvvf> object_transforms(num_bones);
+	pose_local_to_object(local_transforms.data(), parent_indices.data(), object_transforms.data(), nullptr, num_bones);
+
+	for (size_t bone_index = num_bones - 8; bone_index < num_bones; ++bone_index)
+	{
+		const uint16_t parent_index = parent_indices[bone_index];
+		const qvvf expected = parent_index == k_invalid_bone_index ? local_transforms[bone_index] : qvv_mul(local_transforms[bone_index], local_transforms[parent_index]);
+		check_pose_transform_near_equal(object_transforms[bone_index], expected, 1.0e-4f);
+	}
+}
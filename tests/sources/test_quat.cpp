@@ -272,6 +272,89 @@ static void test_quat_impl(const FloatType threshold)
 		REQUIRE(scalar_near_equal(quat_get_w(quat_lerp(quat0, quat1, FloatType(0.33))), quat_get_w(scalar_result), threshold));
 	}
 
+	{
+		const Vector4Type axis = vector_normalize3(vector_set(FloatType(0.3), FloatType(-0.5), FloatType(0.8)), zero);
+		const QuatType quat0 = quat_from_axis_angle(axis, radians(FloatType(0.2)));
+		const QuatType quat1 = quat_from_axis_angle(axis, radians(FloatType(2.7)));
+
+		// The angle is interpolated linearly along the same axis
+		const QuatType expected = quat_from_axis_angle(axis, radians(FloatType(0.2 + 2.5 * 0.3)));
+		REQUIRE(quat_near_equal(quat_slerp(quat0, quat1, FloatType(0.3)), expected, threshold));
+		REQUIRE(quat_near_equal(quat_slerp(quat0, quat_neg(quat1), FloatType(0.3)), expected, threshold));
+		REQUIRE(quat_near_equal(quat_slerp(quat0, quat1, FloatType(0.0)), quat0, threshold));
+		REQUIRE(quat_near_equal(quat_slerp(quat0, quat1, FloatType(1.0)), quat1, threshold));
+		REQUIRE(quat_near_equal(quat_slerp(quat0, quat0, FloatType(0.6)), quat0, threshold));
+
+		REQUIRE(quat_near_equal(quat_slerp_fast(quat0, quat1, FloatType(0.3)), expected, threshold));
+		REQUIRE(quat_near_equal(quat_slerp_fast(quat0, quat_neg(quat1), FloatType(0.3)), expected, threshold));
+		REQUIRE(quat_near_equal(quat_slerp_fast(quat0, quat1, FloatType(0.0)), quat0, threshold));
+		REQUIRE(quat_near_equal(quat_slerp_fast(quat0, quat1, FloatType(1.0)), quat1, threshold));
+		REQUIRE(quat_near_equal(quat_slerp_fast(quat0, quat0, FloatType(0.6)), quat0, threshold));
+
+		const QuatType quat2 = quat_from_euler(degrees(FloatType(30.0)), degrees(FloatType(-45.0)), degrees(FloatType(90.0)));
+		const QuatType quat3 = quat_from_euler(degrees(FloatType(45.0)), degrees(FloatType(60.0)), degrees(FloatType(120.0)));
+		for (int step = 0; step <= 10; ++step)
+		{
+			const FloatType alpha = FloatType(step) * FloatType(0.1);
+			REQUIRE(quat_near_equal(quat_slerp_fast(quat2, quat3, alpha), quat_slerp(quat2, quat3, alpha), threshold));
+			REQUIRE(quat_is_normalized(quat_slerp(quat2, quat3, alpha), threshold));
+		}
+	}
+
+	{
+		// Evenly spaced keys around the same axis have tangents equal to the keys and squad reduces to slerp
+		const Vector4Type axis = vector_normalize3(vector_set(FloatType(-0.6), FloatType(0.2), FloatType(0.4)), zero);
+		const QuatType quat0 = quat_from_axis_angle(axis, radians(FloatType(0.0)));
+		const QuatType quat1 = quat_from_axis_angle(axis, radians(FloatType(0.5)));
+		const QuatType quat2 = quat_from_axis_angle(axis, radians(FloatType(1.0)));
+		const QuatType quat3 = quat_from_axis_angle(axis, radians(FloatType(1.5)));
+
+		QuatType start_tangent;
+		QuatType end_tangent;
+		QuatType end;
+		quat_squad_setup(quat0, quat1, quat2, quat3, start_tangent, end_tangent, end);
+		REQUIRE(quat_near_equal(start_tangent, quat1, threshold));
+		REQUIRE(quat_near_equal(end_tangent, quat2, threshold));
+		REQUIRE(quat_near_equal(end, quat2, threshold));
+		REQUIRE(quat_near_equal(quat_squad(quat1, start_tangent, end_tangent, end, FloatType(0.4)), quat_slerp(quat1, quat2, FloatType(0.4)), threshold));
+
+		// The end key is moved in the same hemisphere as the start key
+		quat_squad_setup(quat0, quat1, quat_neg(quat2), quat3, start_tangent, end_tangent, end);
+		REQUIRE(quat_near_equal(end, quat2, threshold));
+
+		// The curve goes through the keys
+		const QuatType quat4 = quat_from_euler(degrees(FloatType(30.0)), degrees(FloatType(-45.0)), degrees(FloatType(90.0)));
+		const QuatType quat5 = quat_from_euler(degrees(FloatType(45.0)), degrees(FloatType(60.0)), degrees(FloatType(120.0)));
+		quat_squad_setup(quat0, quat4, quat5, quat3, start_tangent, end_tangent, end);
+		REQUIRE(quat_near_equal(quat_squad(quat4, start_tangent, end_tangent, end, FloatType(0.0)), quat4, threshold));
+		REQUIRE(quat_near_equal(quat_squad(quat4, start_tangent, end_tangent, end, FloatType(1.0)), end, threshold));
+		REQUIRE(quat_is_normalized(quat_squad(quat4, start_tangent, end_tangent, end, FloatType(0.7)), threshold));
+	}
+
+	{
+		// The key rotation moves from the tangent's hemisphere into the opposite one near alpha = 0.6,
+		// the curve must stay continuous when it crosses over
+		const QuatType start = quat_identity();
+		const QuatType end = quat_from_axis_angle(vector_set(FloatType(0.0), FloatType(0.0), FloatType(1.0)), degrees(FloatType(90.0)));
+		const QuatType tangent = quat_normalize(quat_set(FloatType(0.742), FloatType(0.0), FloatType(-0.6), FloatType(0.3)));
+		REQUIRE(vector_dot(quat_to_vector(start), quat_to_vector(tangent)) > FloatType(0.0));
+		REQUIRE(vector_dot(quat_to_vector(end), quat_to_vector(tangent)) < FloatType(0.0));
+
+		QuatType prev_result = quat_squad(start, tangent, tangent, end, FloatType(0.0));
+		REQUIRE(quat_near_equal(prev_result, start, threshold));
+		for (int step = 1; step <= 100; ++step)
+		{
+			const QuatType result = quat_squad(start, tangent, tangent, end, FloatType(step) * FloatType(0.01));
+			REQUIRE(quat_is_normalized(result, threshold));
+
+			// Consecutive samples are at most a few degrees apart
+			REQUIRE(scalar_abs(vector_dot(quat_to_vector(prev_result), quat_to_vector(result))) > FloatType(0.999));
+			prev_result = result;
+		}
+
+		REQUIRE(quat_near_equal(prev_result, end, threshold));
+	}
+
 	{
 		QuatType quat0 = quat_from_euler(degrees(FloatType(30.0)), degrees(FloatType(-45.0)), degrees(FloatType(90.0)));
 		QuatType quat1 = quat_neg(quat0);
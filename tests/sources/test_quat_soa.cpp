@@ -0,0 +1,143 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "test_transforms_impl.h"
+
+#include <rtm/quatf_x4.h>
+#include <rtm/quatf_x8.h>
+
+using namespace rtm;
+
+static void get_test_quats(quatf* lhs, quatf* rhs, vector4f* vectors, int num_quats)
+{
+	for (int index = 0; index < num_quats; ++index)
+	{
+		lhs[index] = get_test_rotation(size_t(index));
+		rhs[index] = get_test_rhs_rotation(size_t(index));
+		vectors[index] = get_test_translation(size_t(index));
+	}
+
+	// Make sure the shortest path bias is exercised when interpolating
+	rhs[2] = quat_neg(lhs[2]);
+}
+
+TEST_CASE("quatf_x4 math", "[math][quat][soa]")
+{
+	const float threshold = 1.0e-4f;
+
+	quatf lhs[4];
+	quatf rhs[4];
+	vector4f vectors[4];
+	get_test_quats(&lhs[0], &rhs[0], &vectors[0], 4);
+
+	const quatf_x4 lhs_x4 = quat_load_x4(&lhs[0]);
+	const quatf_x4 rhs_x4 = quat_load_x4(&rhs[0]);
+	const vector3f_x4 vectors_x4 = vector_load3_x4(&vectors[0]);
+
+	quatf result[4];
+	quat_store_x4(lhs_x4, &result[0]);
+	for (int index = 0; index < 4; ++index)
+		REQUIRE(quat_near_equal(result[index], lhs[index], 0.0f));
+
+	quat_store_x4(quat_broadcast_x4(lhs[3]), &result[0]);
+	for (int index = 0; index < 4; ++index)
+		REQUIRE(quat_near_equal(result[index], lhs[3], 0.0f));
+
+	quatf conjugate[4];
+	quatf mul[4];
+	quatf normalized[4];
+	quatf lerp[4];
+	quatf slerp_fast[4];
+	vector4f rotated[4];
+	quat_store_x4(quat_conjugate(lhs_x4), &conjugate[0]);
+	quat_store_x4(quat_mul(lhs_x4, rhs_x4), &mul[0]);
+	quat_store_x4(quat_normalize(quatf_x4{ vector_mul(lhs_x4.x, 2.0f), vector_mul(lhs_x4.y, 2.0f), vector_mul(lhs_x4.z, 2.0f), vector_mul(lhs_x4.w, 2.0f) }), &normalized[0]);
+	quat_store_x4(quat_lerp(lhs_x4, rhs_x4, 0.33f), &lerp[0]);
+	quat_store_x4(quat_slerp_fast(lhs_x4, rhs_x4, 0.33f), &slerp_fast[0]);
+	vector_store3_x4(quat_mul_vector3(vectors_x4, lhs_x4), &rotated[0]);
+
+	float dot[4];
+	vector_store(quat_dot(lhs_x4, rhs_x4), &dot[0]);
+
+	for (int index = 0; index < 4; ++index)
+	{
+		REQUIRE(quat_near_equal(conjugate[index], quat_conjugate(lhs[index]), threshold));
+		REQUIRE(quat_near_equal(mul[index], quat_mul(lhs[index], rhs[index]), threshold));
+		REQUIRE(quat_near_equal(normalized[index], lhs[index], threshold));
+		REQUIRE(quat_near_equal(lerp[index], quat_lerp(lhs[index], rhs[index], 0.33f), threshold));
+		REQUIRE(quat_near_equal(slerp_fast[index], quat_slerp_fast(lhs[index], rhs[index], 0.33f), threshold));
+		REQUIRE(vector_all_near_equal3(rotated[index], quat_mul_vector3(vectors[index], lhs[index]), threshold));
+		REQUIRE(scalar_near_equal(dot[index], vector_dot(quat_to_vector(lhs[index]), quat_to_vector(rhs[index])), threshold));
+	}
+}
+
+TEST_CASE("quatf_x8 math", "[math][quat][soa]")
+{
+	const float threshold = 1.0e-4f;
+
+	quatf lhs[8];
+	quatf rhs[8];
+	vector4f vectors[8];
+	get_test_quats(&lhs[0], &rhs[0], &vectors[0], 8);
+
+	const quatf_x8 lhs_x8 = quat_load_x8(&lhs[0]);
+	const quatf_x8 rhs_x8 = quat_load_x8(&rhs[0]);
+	const vector3f_x8 vectors_x8 = vector_load3_x8(&vectors[0]);
+
+	quatf result[8];
+	quat_store_x8(lhs_x8, &result[0]);
+	for (int index = 0; index < 8; ++index)
+		REQUIRE(quat_near_equal(result[index], lhs[index], 0.0f));
+
+	quat_store_x8(quat_broadcast_x8(lhs[3]), &result[0]);
+	for (int index = 0; index < 8; ++index)
+		REQUIRE(quat_near_equal(result[index], lhs[3], 0.0f));
+
+	const scalarf_x8 two = scalar_set_x8(2.0f);
+
+	quatf conjugate[8];
+	quatf mul[8];
+	quatf normalized[8];
+	quatf lerp[8];
+	vector4f rotated[8];
+	quat_store_x8(quat_conjugate(lhs_x8), &conjugate[0]);
+	quat_store_x8(quat_mul(lhs_x8, rhs_x8), &mul[0]);
+	quat_store_x8(quat_normalize(quatf_x8{ scalar_mul(lhs_x8.x, two), scalar_mul(lhs_x8.y, two), scalar_mul(lhs_x8.z, two), scalar_mul(lhs_x8.w, two) }), &normalized[0]);
+	quat_store_x8(quat_lerp(lhs_x8, rhs_x8, 0.33f), &lerp[0]);
+	vector_store3_x8(quat_mul_vector3(vectors_x8, lhs_x8), &rotated[0]);
+
+	float dot[8];
+	scalar_store_x8(quat_dot(lhs_x8, rhs_x8), &dot[0]);
+
+	for (int index = 0; index < 8; ++index)
+	{
+		REQUIRE(quat_near_equal(conjugate[index], quat_conjugate(lhs[index]), threshold));
+		REQUIRE(quat_near_equal(mul[index], quat_mul(lhs[index], rhs[index]), threshold));
+		REQUIRE(quat_near_equal(normalized[index], lhs[index], threshold));
+		REQUIRE(quat_near_equal(lerp[index], quat_lerp(lhs[index], rhs[index], 0.33f), threshold));
+		REQUIRE(vector_all_near_equal3(rotated[index], quat_mul_vector3(vectors[index], lhs[index]), threshold));
+		REQUIRE(scalar_near_equal(dot[index], vector_dot(quat_to_vector(lhs[index]), quat_to_vector(rhs[index])), threshold));
+	}
+}
@@ -0,0 +1,180 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "test_transforms_impl.h"
+
+#include <rtm/qvvf_x4.h>
+#include <rtm/qvvf_x8.h>
+
+using namespace rtm;
+
+static void test_qvv_x4_mul(const qvvf* lhs, const qvvf* rhs, const float threshold)
+{
+	qvvf result[4];
+	qvv_store_x4(qvv_mul(qvv_load_x4(lhs), qvv_load_x4(rhs)), &result[0]);
+
+	for (int index = 0; index < 4; ++index)
+	{
+		const qvvf expected = qvv_mul(lhs[index], rhs[index]);
+		REQUIRE(quat_near_equal(result[index].rotation, expected.rotation, threshold));
+		REQUIRE(vector_all_near_equal3(result[index].translation, expected.translation, threshold));
+		REQUIRE(vector_all_near_equal3(result[index].scale, expected.scale, threshold));
+	}
+}
+
+static void test_qvv_x8_mul(const qvvf* lhs, const qvvf* rhs, const float threshold)
+{
+	qvvf result[8];
+	qvv_store_x8(qvv_mul(qvv_load_x8(lhs), qvv_load_x8(rhs)), &result[0]);
+
+	for (int index = 0; index < 8; ++index)
+	{
+		const qvvf expected = qvv_mul(lhs[index], rhs[index]);
+		REQUIRE(quat_near_equal(result[index].rotation, expected.rotation, threshold));
+		REQUIRE(vector_all_near_equal3(result[index].translation, expected.translation, threshold));
+		REQUIRE(vector_all_near_equal3(result[index].scale, expected.scale, threshold));
+	}
+}
+
+TEST_CASE("qvvf_x4 math", "[math][qvv][soa]")
+{
+	const float threshold = 1.0e-4f;
+
+	qvvf lhs[4];
+	qvvf rhs[4];
+	vector4f points[4];
+	get_test_transforms(&lhs[0], &rhs[0], &points[0], 4);
+
+	const qvvf_x4 lhs_x4 = qvv_load_x4(&lhs[0]);
+	const qvvf_x4 rhs_x4 = qvv_load_x4(&rhs[0]);
+	const vector3f_x4 points_x4 = vector_load3_x4(&points[0]);
+
+	{
+		qvvf result[4];
+		qvv_store_x4(lhs_x4, &result[0]);
+		for (int index = 0; index < 4; ++index)
+		{
+			REQUIRE(quat_near_equal(result[index].rotation, lhs[index].rotation, 0.0f));
+			REQUIRE(vector_all_near_equal3(result[index].translation, lhs[index].translation, 0.0f));
+			REQUIRE(vector_all_near_equal3(result[index].scale, lhs[index].scale, 0.0f));
+		}
+	}
+
+	test_qvv_x4_mul(&lhs[0], &rhs[0], threshold);
+
+	{
+		qvvf result[4];
+		qvv_store_x4(qvv_mul_no_scale(lhs_x4, rhs_x4), &result[0]);
+		for (int index = 0; index < 4; ++index)
+		{
+			const qvvf expected = qvv_mul_no_scale(lhs[index], rhs[index]);
+			REQUIRE(quat_near_equal(result[index].rotation, expected.rotation, threshold));
+			REQUIRE(vector_all_near_equal3(result[index].translation, expected.translation, threshold));
+			REQUIRE(vector_all_near_equal3(result[index].scale, expected.scale, threshold));
+		}
+	}
+
+	{
+		vector4f result[4];
+		vector4f result_no_scale[4];
+		vector_store3_x4(qvv_mul_point3(points_x4, lhs_x4), &result[0]);
+		vector_store3_x4(qvv_mul_point3_no_scale(points_x4, lhs_x4), &result_no_scale[0]);
+		for (int index = 0; index < 4; ++index)
+		{
+			REQUIRE(vector_all_near_equal3(result[index], qvv_mul_point3(points[index], lhs[index]), threshold));
+			REQUIRE(vector_all_near_equal3(result_no_scale[index], qvv_mul_point3_no_scale(points[index], lhs[index]), threshold));
+		}
+	}
+
+	{
+		// Negative scale in a single lane falls back to the scalar code path
+		rhs[1].scale = vector_set(-1.0f, 1.0f, 1.0f);
+		test_qvv_x4_mul(&lhs[0], &rhs[0], threshold);
+	}
+}
+
+TEST_CASE("qvvf_x8 math", "[math][qvv][soa]")
+{
+	const float threshold = 1.0e-4f;
+
+	qvvf lhs[8];
+	qvvf rhs[8];
+	vector4f points[8];
+	get_test_transforms(&lhs[0], &rhs[0], &points[0], 8);
+
+	const qvvf_x8 lhs_x8 = qvv_load_x8(&lhs[0]);
+	const qvvf_x8 rhs_x8 = qvv_load_x8(&rhs[0]);
+	const vector3f_x8 points_x8 = vector_load3_x8(&points[0]);
+
+	{
+		qvvf result[8];
+		qvv_store_x8(lhs_x8, &result[0]);
+		for (int index = 0; index < 8; ++index)
+		{
+			REQUIRE(quat_near_equal(result[index].rotation, lhs[index].rotation, 0.0f));
+			REQUIRE(vector_all_near_equal3(result[index].translation, lhs[index].translation, 0.0f));
+			REQUIRE(vector_all_near_equal3(result[index].scale, lhs[index].scale, 0.0f));
+		}
+	}
+
+	test_qvv_x8_mul(&lhs[0], &rhs[0], threshold);
+
+	{
+		qvvf result[8];
+		qvv_store_x8(qvv_mul_no_scale(lhs_x8, rhs_x8), &result[0]);
+		for (int index = 0; index < 8; ++index)
+		{
+			const qvvf expected = qvv_mul_no_scale(lhs[index], rhs[index]);
+			REQUIRE(quat_near_equal(result[index].rotation, expected.rotation, threshold));
+			REQUIRE(vector_all_near_equal3(result[index].translation, expected.translation, threshold));
+			REQUIRE(vector_all_near_equal3(result[index].scale, expected.scale, threshold));
+		}
+	}
+
+	{
+		vector4f result[8];
+		vector4f result_no_scale[8];
+		vector_store3_x8(qvv_mul_point3(points_x8, lhs_x8), &result[0]);
+		vector_store3_x8(qvv_mul_point3_no_scale(points_x8, lhs_x8), &result_no_scale[0]);
+		for (int index = 0; index < 8; ++index)
+		{
+			REQUIRE(vector_all_near_equal3(result[index], qvv_mul_point3(points[index], lhs[index]), threshold));
+			REQUIRE(vector_all_near_equal3(result_no_scale[index], qvv_mul_point3_no_scale(points[index], lhs[index]), threshold));
+		}
+	}
+
+	{
+		qvvf result[8];
+		qvv_store_x8(qvv_normalize(lhs_x8), &result[0]);
+		for (int index = 0; index < 8; ++index)
+			REQUIRE(quat_near_equal(result[index].rotation, quat_normalize(lhs[index].rotation), threshold));
+	}
+
+	{
+		// Negative scale in a single lane of the upper half falls back to the scalar code path
+		rhs[6].scale = vector_set(-1.0f, 1.0f, 1.0f);
+		test_qvv_x8_mul(&lhs[0], &rhs[0], threshold);
+	}
+}
@@ -55,6 +55,15 @@ static void test_scalar_impl(const FloatType threshold)
 	REQUIRE(scalar_ceil(FloatType(-2.5)) == FloatType(-2.0));
 	REQUIRE(scalar_ceil(FloatType(-3.0)) == FloatType(-3.0));
 
+	REQUIRE(scalar_round_bankers(FloatType(0.0)) == FloatType(0.0));
+	REQUIRE(scalar_round_bankers(FloatType(0.5)) == FloatType(0.0));
+	REQUIRE(scalar_round_bankers(FloatType(1.2)) == FloatType(1.0));
+	REQUIRE(scalar_round_bankers(FloatType(1.5)) == FloatType(2.0));
+	REQUIRE(scalar_round_bankers(FloatType(2.5)) == FloatType(2.0));
+	REQUIRE(scalar_round_bankers(FloatType(-1.5)) == FloatType(-2.0));
+	REQUIRE(scalar_round_bankers(FloatType(-2.5)) == FloatType(-2.0));
+	REQUIRE(scalar_round_bankers(FloatType(-3.7)) == FloatType(-4.0));
+
 	REQUIRE(scalar_clamp(FloatType(0.5), FloatType(0.0), FloatType(1.0)) == FloatType(0.5));
 	REQUIRE(scalar_clamp(FloatType(-0.5), FloatType(0.0), FloatType(1.0)) == FloatType(0.0));
 	REQUIRE(scalar_clamp(FloatType(1.5), FloatType(0.0), FloatType(1.0)) == FloatType(1.0));
@@ -86,7 +95,8 @@ static void test_scalar_impl(const FloatType threshold)
 	REQUIRE(scalar_near_equal(scalar_cast(scalar_reciprocal(scalar_set(FloatType(-0.5)))), FloatType(1.0 / -0.5), threshold));
 	REQUIRE(scalar_near_equal(scalar_cast(scalar_reciprocal(scalar_set(FloatType(-32.5)))), FloatType(1.0 / -32.5), threshold));
 
-	const FloatType angles[] = { FloatType(0.0), k_pi, -k_pi, k_pi_2, -k_pi_2, FloatType(0.5), FloatType(32.5), FloatType(-0.5), FloatType(-32.5) };
+	// Large angles are past the range reduction and use the standard library
+	const FloatType angles[] = { FloatType(0.0), k_pi, -k_pi, k_pi_2, -k_pi_2, FloatType(0.5), FloatType(32.5), FloatType(-0.5), FloatType(-32.5), FloatType(1.0e6), FloatType(-3.0e7), FloatType(1.0e12) };
 
 	for (const FloatType angle : angles)
 	{
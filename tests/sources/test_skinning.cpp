@@ -0,0 +1,269 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "test_transforms_impl.h"
+
+#include <rtm/skinning.h>
+#include <rtm/dualquatf.h>
+#include <rtm/qvvf.h>
+#include <rtm/scalarf.h>
+
+#include <vector>
+
+using namespace rtm;
+
+// Larger than a skinning tile to cover a full tile followed by a partial one
+static constexpr size_t k_num_skinned_vertices = 300;
+static constexpr uint32_t k_num_palette_bones = 11;
+
+template<uint32_t num_influences>
+static void test_skin_linear_blend()
+{
+	std::vector<matrix3x4f> palette;
+	for (uint32_t bone_index = 0; bone_index < k_num_palette_bones; ++bone_index)
+	{
+		const quatf rotation = get_test_rotation(bone_index);
+		const vector4f translation = get_test_translation(bone_index);
+		palette.push_back(matrix_from_qvv(qvv_set(rotation, translation, vector_set(1.0f))));
+	}
+
+	std::vector<uint16_t> bone_indices;
+	std::vector<float> bone_weights;
+	std::vector<float3f> positions;
+	std::vector<float3f> normals;
+	for (size_t vertex_index = 0; vertex_index < k_num_skinned_vertices; ++vertex_index)
+	{
+		float weight_sum = 0.0f;
+		for (uint32_t influence_index = 0; influence_index < num_influences; ++influence_index)
+		{
+			bone_indices.push_back(uint16_t((vertex_index * 3 + influence_index * 5) % k_num_palette_bones));
+
+			const float weight = 1.0f + float((vertex_index + influence_index * 7) % 5);
+			bone_weights.push_back(weight);
+			weight_sum += weight;
+		}
+
+		for (uint32_t influence_index = 0; influence_index < num_influences; ++influence_index)
+			bone_weights[vertex_index * num_influences + influence_index] /= weight_sum;
+
+		const float offset = float(vertex_index % 16);
+		positions.push_back(float3f{ 0.5f * offset, -1.25f + offset * 0.25f, 2.0f - offset * 0.125f });
+
+		const vector4f normal = vector_normalize3(vector_set(1.0f - offset, 0.5f + offset, 0.25f * offset), vector_zero());
+		float3f normal3;
+		vector_store3(normal, &normal3);
+		normals.push_back(normal3);
+	}
+
+	const float threshold = 1.0e-4f;
+
+	std::vector<float3f> out_positions(k_num_skinned_vertices);
+	std::vector<float3f> out_normals(k_num_skinned_vertices);
+	skin_linear_blend<num_influences>(palette.data(), bone_indices.data(), bone_weights.data(), positions.data(), normals.data(), out_positions.data(), out_normals.data(), k_num_skinned_vertices);
+
+	for (size_t vertex_index = 0; vertex_index < k_num_skinned_vertices; ++vertex_index)
+	{
+		vector4f ref_position = vector_zero();
+		vector4f ref_normal = vector_zero();
+		for (uint32_t influence_index = 0; influence_index < num_influences; ++influence_index)
+		{
+			const matrix3x4f& bone = palette[bone_indices[vertex_index * num_influences + influence_index]];
+			const float weight = bone_weights[vertex_index * num_influences + influence_index];
+
+			const vector4f position = matrix_mul_point3(vector_load3(&positions[vertex_index]), bone);
+			const vector4f normal = matrix_mul_vector3(vector_load3(&normals[vertex_index]), bone);
+			ref_position = vector_add(ref_position, vector_mul(position, weight));
+			ref_normal = vector_add(ref_normal, vector_mul(normal, weight));
+		}
+
+		ref_normal = vector_normalize3(ref_normal, vector_zero());
+
+		CHECK(vector_all_near_equal3(vector_load3(&out_positions[vertex_index]), ref_position, threshold));
+		CHECK(vector_all_near_equal3(vector_load3(&out_normals[vertex_index]), ref_normal, threshold));
+	}
+
+	// Skinning in place without normals
+	std::vector<float3f> in_place_positions = positions;
+	skin_linear_blend<num_influences>(palette.data(), bone_indices.data(), bone_weights.data(), in_place_positions.data(), nullptr, in_place_positions.data(), nullptr, k_num_skinned_vertices);
+
+	for (size_t vertex_index = 0; vertex_index < k_num_skinned_vertices; ++vertex_index)
+		CHECK(vector_all_near_equal3(vector_load3(&in_place_positions[vertex_index]), vector_load3(&out_positions[vertex_index]), threshold));
+
+	// Prefetching does not change the results, including distances past the last vertex
+	const size_t prefetch_distances[] = { 0, 3, 1000 };
+	for (size_t prefetch_distance : prefetch_distances)
+	{
+		std::vector<float3f> prefetch_positions(k_num_skinned_vertices);
+		std::vector<float3f> prefetch_normals(k_num_skinned_vertices);
+		skin_linear_blend<num_influences>(palette.data(), bone_indices.data(), bone_weights.data(), positions.data(), normals.data(), prefetch_positions.data(), prefetch_normals.data(), k_num_skinned_vertices, store_mode::cached, prefetch_distance);
+
+		for (size_t vertex_index = 0; vertex_index < k_num_skinned_vertices; ++vertex_index)
+		{
+			CHECK(vector_all_near_equal3(vector_load3(&prefetch_positions[vertex_index]), vector_load3(&out_positions[vertex_index]), 0.0f));
+			CHECK(vector_all_near_equal3(vector_load3(&prefetch_normals[vertex_index]), vector_load3(&out_normals[vertex_index]), 0.0f));
+		}
+	}
+
+	// Streaming stores into 16 bytes aligned outputs, and into unaligned outputs which fall back to regular stores
+	alignas(16) float3f stream_buffer[k_num_skinned_vertices * 2 + 1];
+	float3f* stream_positions = &stream_buffer[0];
+	float3f* stream_normals = &stream_buffer[k_num_skinned_vertices + 1];
+	skin_linear_blend<num_influences>(palette.data(), bone_indices.data(), bone_weights.data(), positions.data(), normals.data(), stream_positions, stream_normals, k_num_skinned_vertices, store_mode::streaming);
+
+	for (size_t vertex_index = 0; vertex_index < k_num_skinned_vertices; ++vertex_index)
+	{
+		CHECK(vector_all_near_equal3(vector_load3(&stream_positions[vertex_index]), vector_load3(&out_positions[vertex_index]), threshold));
+		CHECK(vector_all_near_equal3(vector_load3(&stream_normals[vertex_index]), vector_load3(&out_normals[vertex_index]), threshold));
+	}
+}
+
+template<uint32_t num_influences>
+static void test_skin_dual_quat()
+{
+	std::vector<dualquatf> palette;
+	for (uint32_t bone_index = 0; bone_index < k_num_palette_bones; ++bone_index)
+	{
+		const quatf rotation = get_test_rotation(bone_index);
+		const vector4f translation = get_test_translation(bone_index);
+		const dualquatf bone = dualquat_from_rotation_translation(rotation, translation);
+
+		// Half the palette lives on the other side of the hypersphere, the skinning must take the shortest path
+		palette.push_back((bone_index % 2) == 0 ? bone : dualquat_set(quat_neg(bone.real), quat_neg(bone.dual)));
+	}
+
+	std::vector<uint16_t> bone_indices;
+	std::vector<float> bone_weights;
+	std::vector<float3f> positions;
+	std::vector<float3f> normals;
+	for (size_t vertex_index = 0; vertex_index < k_num_skinned_vertices; ++vertex_index)
+	{
+		float weight_sum = 0.0f;
+		for (uint32_t influence_index = 0; influence_index < num_influences; ++influence_index)
+		{
+			bone_indices.push_back(uint16_t((vertex_index * 3 + influence_index * 5) % k_num_palette_bones));
+
+			const float weight = 1.0f + float((vertex_index + influence_index * 7) % 5);
+			bone_weights.push_back(weight);
+			weight_sum += weight;
+		}
+
+		for (uint32_t influence_index = 0; influence_index < num_influences; ++influence_index)
+			bone_weights[vertex_index * num_influences + influence_index] /= weight_sum;
+
+		const float offset = float(vertex_index % 16);
+		positions.push_back(float3f{ 0.5f * offset, -1.25f + offset * 0.25f, 2.0f - offset * 0.125f });
+
+		const vector4f normal = vector_normalize3(vector_set(1.0f - offset, 0.5f + offset, 0.25f * offset), vector_zero());
+		float3f normal3;
+		vector_store3(normal, &normal3);
+		normals.push_back(normal3);
+	}
+
+	const float threshold = 1.0e-4f;
+
+	std::vector<float3f> out_positions(k_num_skinned_vertices);
+	std::vector<float3f> out_normals(k_num_skinned_vertices);
+	skin_dual_quat<num_influences>(palette.data(), bone_indices.data(), bone_weights.data(), positions.data(), normals.data(), out_positions.data(), out_normals.data(), k_num_skinned_vertices);
+
+	for (size_t vertex_index = 0; vertex_index < k_num_skinned_vertices; ++vertex_index)
+	{
+		dualquatf influences[num_influences];
+		for (uint32_t influence_index = 0; influence_index < num_influences; ++influence_index)
+			influences[influence_index] = palette[bone_indices[vertex_index * num_influences + influence_index]];
+
+		const dualquatf ref_dq = dualquat_blend(influences, &bone_weights[vertex_index * num_influences], num_influences);
+		const vector4f ref_position = dualquat_mul_point3(vector_load3(&positions[vertex_index]), ref_dq);
+		const vector4f ref_normal = dualquat_mul_vector3(vector_load3(&normals[vertex_index]), ref_dq);
+
+		CHECK(vector_all_near_equal3(vector_load3(&out_positions[vertex_index]), ref_position, threshold));
+		CHECK(vector_all_near_equal3(vector_load3(&out_normals[vertex_index]), ref_normal, threshold));
+	}
+
+	// Skinning in place without normals
+	std::vector<float3f> in_place_positions = positions;
+	skin_dual_quat<num_influences>(palette.data(), bone_indices.data(), bone_weights.data(), in_place_positions.data(), nullptr, in_place_positions.data(), nullptr, k_num_skinned_vertices);
+
+	for (size_t vertex_index = 0; vertex_index < k_num_skinned_vertices; ++vertex_index)
+		CHECK(vector_all_near_equal3(vector_load3(&in_place_positions[vertex_index]), vector_load3(&out_positions[vertex_index]), threshold));
+
+	// Streaming stores into 16 bytes aligned outputs, and into unaligned outputs which fall back to regular stores
+	alignas(16) float3f stream_buffer[k_num_skinned_vertices * 2 + 1];
+	float3f* stream_positions = &stream_buffer[0];
+	float3f* stream_normals = &stream_buffer[k_num_skinned_vertices + 1];
+	skin_dual_quat<num_influences>(palette.data(), bone_indices.data(), bone_weights.data(), positions.data(), normals.data(), stream_positions, stream_normals, k_num_skinned_vertices, store_mode::streaming);
+
+	for (size_t vertex_index = 0; vertex_index < k_num_skinned_vertices; ++vertex_index)
+	{
+		CHECK(vector_all_near_equal3(vector_load3(&stream_positions[vertex_index]), vector_load3(&out_positions[vertex_index]), threshold));
+		CHECK(vector_all_near_equal3(vector_load3(&stream_normals[vertex_index]), vector_load3(&out_normals[vertex_index]), threshold));
+	}
+}
+
+TEST_CASE("skinning linear blend", "[math][skinning]")
+{
+	test_skin_linear_blend<1>();
+	test_skin_linear_blend<4>();
+	test_skin_linear_blend<8>();
+
+	{
+		// A vertex fully weighted to a single bone matches the bone transform
+		const matrix3x4f palette[2] = { matrix_identity(), matrix_from_translation(vector_set(1.0f, 2.0f, 3.0f)) };
+		const uint16_t bone_indices[4] = { 1, 0, 0, 0 };
+		const float bone_weights[4] = { 1.0f, 0.0f, 0.0f, 0.0f };
+		const float3f position = { 1.0f, 1.0f, 1.0f };
+		const float3f normal = { 0.0f, 1.0f, 0.0f };
+		float3f out_position;
+		float3f out_normal;
+		skin_linear_blend4(palette, bone_indices, bone_weights, &position, &normal, &out_position, &out_normal, 1);
+
+		CHECK(vector_all_near_equal3(vector_load3(&out_position), vector_set(2.0f, 3.0f, 4.0f), 1.0e-6f));
+		CHECK(vector_all_near_equal3(vector_load3(&out_normal), vector_set(0.0f, 1.0f, 0.0f), 1.0e-6f));
+	}
+}
+
+TEST_CASE("skinning dual quaternion", "[math][skinning]")
+{
+	test_skin_dual_quat<1>();
+	test_skin_dual_quat<4>();
+	test_skin_dual_quat<8>();
+
+	{
+		// Two bones rotating in opposite directions around the X axis: linear blend skinning collapses
+		// the vertex towards the axis while dual quaternion skinning preserves its distance to the axis
+		const quatf twist = quat_from_euler(degrees(0.0f), degrees(0.0f), degrees(80.0f));
+		const matrix3x4f matrix_palette[2] = { matrix_from_quat(twist), matrix_from_quat(quat_conjugate(twist)) };
+		const dualquatf dq_palette[2] = { dualquat_from_matrix(matrix_palette[0]), dualquat_from_matrix(matrix_palette[1]) };
+		const uint16_t bone_indices[4] = { 0, 1, 0, 0 };
+		const float bone_weights[4] = { 0.5f, 0.5f, 0.0f, 0.0f };
+		const float3f position = { 0.0f, 1.0f, 0.0f };
+		float3f lbs_position;
+		float3f dqs_position;
+		skin_linear_blend4(matrix_palette, bone_indices, bone_weights, &position, nullptr, &lbs_position, nullptr, 1);
+		skin_dual_quat4(dq_palette, bone_indices, bone_weights, &position, nullptr, &dqs_position, nullptr, 1);
+
+		CHECK(vector_length3(vector_load3(&lbs_position)) < 0.9f);
+		CHECK(scalar_near_equal(vector_length3(vector_load3(&dqs_position)), 1.0f, 1.0e-5f));
+	}
+}
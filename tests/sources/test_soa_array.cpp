@@ -0,0 +1,177 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "test_transforms_impl.h"
+
+#include <rtm/arena_allocator.h>
+#include <rtm/matrix3x4f.h>
+#include <rtm/quatf.h>
+#include <rtm/qvvf.h>
+#include <rtm/soa_array.h>
+#include <rtm/impl/memory_utils.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace rtm;
+
+TEST_CASE("soa_array", "[core][memory][soa]")
+{
+	std::vector<uint8_t> buffer(16 * 1024);
+	arena_allocator arena = arena_create(buffer.data(), buffer.size());
+
+	// Not a multiple of any SIMD width to cover the padding
+	const size_t num_transforms = 21;
+
+	{
+		soa_array<qvvf> transforms = soa_array_allocate<qvvf>(arena, num_transforms);
+		REQUIRE(transforms.streams != nullptr);
+		CHECK(transforms.size == num_transforms);
+		CHECK(transforms.stride == 32);
+
+		for (size_t component_index = 0; component_index < 10; ++component_index)
+			CHECK(rtm_impl::is_aligned_to(soa_array_get_stream(transforms, component_index), rtm_impl::k_cache_line_size));
+
+		for (size_t index = 0; index < num_transforms; ++index)
+			soa_array_set(transforms, index, get_test_transform(index));
+
+		for (size_t index = 0; index < num_transforms; ++index)
+			check_qvv_near_equal(soa_array_get(transforms, index), get_test_transform(index), 0.0f);
+
+		// The padding is the identity
+		for (size_t index = num_transforms; index < transforms.stride; ++index)
+			check_qvv_near_equal(soa_array_get(transforms, index), qvvf(qvv_identity()), 0.0f);
+
+		// Wide loads and stores, padding included
+		for (size_t index = 0; index < transforms.stride; index += 4)
+		{
+			qvvf expected[4];
+			for (size_t lane_index = 0; lane_index < 4; ++lane_index)
+				expected[lane_index] = soa_array_get(transforms, index + lane_index);
+
+			qvvf result[4];
+			qvv_store_x4(qvv_load_x4(transforms, index), &result[0]);
+			for (size_t lane_index = 0; lane_index < 4; ++lane_index)
+				check_qvv_near_equal(result[lane_index], expected[lane_index], 0.0f);
+		}
+
+		for (size_t index = 0; index < transforms.stride; index += 8)
+		{
+			qvvf expected[8];
+			for (size_t lane_index = 0; lane_index < 8; ++lane_index)
+				expected[lane_index] = soa_array_get(transforms, index + lane_index);
+
+			qvvf result[8];
+			qvv_store_x8(qvv_load_x8(transforms, index), &result[0]);
+			for (size_t lane_index = 0; lane_index < 8; ++lane_index)
+				check_qvv_near_equal(result[lane_index], expected[lane_index], 0.0f);
+		}
+
+		soa_array<qvvf> copies = soa_array_allocate<qvvf>(arena, num_transforms);
+		REQUIRE(copies.streams != nullptr);
+		for (size_t index = 0; index < 8; index += 4)
+			qvv_store_x4(qvv_load_x4(transforms, index), copies, index);
+		for (size_t index = 8; index < copies.stride; index += 8)
+			qvv_store_x8(qvv_load_x8(transforms, index), copies, index);
+		for (size_t index = 0; index < copies.stride; ++index)
+			check_qvv_near_equal(soa_array_get(copies, index), soa_array_get(transforms, index), 0.0f);
+	}
+
+	{
+		soa_array<matrix3x4f> matrices = soa_array_allocate<matrix3x4f>(arena, num_transforms);
+		REQUIRE(matrices.streams != nullptr);
+
+		for (size_t index = 0; index < num_transforms; ++index)
+			soa_array_set(matrices, index, matrix_from_qvv(get_test_transform(index)));
+
+		for (size_t index = 0; index < num_transforms; ++index)
+		{
+			const matrix3x4f expected = matrix_from_qvv(get_test_transform(index));
+			const matrix3x4f result = soa_array_get(matrices, index);
+			CHECK(vector_all_near_equal3(result.x_axis, expected.x_axis, 0.0f));
+			CHECK(vector_all_near_equal3(result.y_axis, expected.y_axis, 0.0f));
+			CHECK(vector_all_near_equal3(result.z_axis, expected.z_axis, 0.0f));
+			CHECK(vector_all_near_equal3(result.w_axis, expected.w_axis, 0.0f));
+		}
+
+		const matrix3x4f padding = soa_array_get(matrices, num_transforms);
+		CHECK(vector_all_near_equal(padding.x_axis, vector_set(1.0f, 0.0f, 0.0f, 0.0f), 0.0f));
+		CHECK(vector_all_near_equal(padding.w_axis, vector_set(0.0f, 0.0f, 0.0f, 1.0f), 0.0f));
+
+		// Wide loads, one matrix per lane
+		for (size_t index = 0; index < matrices.stride; index += 4)
+		{
+			const matrix3x4f_x4 result = matrix_load_x4(matrices, index);
+			float x_axis_y[4];
+			float w_axis_z[4];
+			vector_store(result.x_axis.y, &x_axis_y[0]);
+			vector_store(result.w_axis.z, &w_axis_z[0]);
+			for (size_t lane_index = 0; lane_index < 4; ++lane_index)
+			{
+				const matrix3x4f expected = soa_array_get(matrices, index + lane_index);
+				CHECK(x_axis_y[lane_index] == vector_get_y(expected.x_axis));
+				CHECK(w_axis_z[lane_index] == vector_get_z(expected.w_axis));
+			}
+		}
+
+		for (size_t index = 0; index < matrices.stride; index += 8)
+		{
+			const matrix3x4f_x8 result = matrix_load_x8(matrices, index);
+			float y_axis_x[8];
+			float z_axis_z[8];
+			scalar_store_x8(result.y_axis.x, &y_axis_x[0]);
+			scalar_store_x8(result.z_axis.z, &z_axis_z[0]);
+			for (size_t lane_index = 0; lane_index < 8; ++lane_index)
+			{
+				const matrix3x4f expected = soa_array_get(matrices, index + lane_index);
+				CHECK(y_axis_x[lane_index] == vector_get_x(expected.y_axis));
+				CHECK(z_axis_z[lane_index] == vector_get_z(expected.z_axis));
+			}
+		}
+
+		// Wide stores, padding included
+		soa_array<matrix3x4f> copies = soa_array_allocate<matrix3x4f>(arena, num_transforms);
+		REQUIRE(copies.streams != nullptr);
+		for (size_t index = 0; index < 8; index += 4)
+			matrix_store_x4(matrix_load_x4(matrices, index), copies, index);
+		for (size_t index = 8; index < copies.stride; index += 8)
+			matrix_store_x8(matrix_load_x8(matrices, index), copies, index);
+		for (size_t index = 0; index < copies.stride; ++index)
+		{
+			const matrix3x4f expected = soa_array_get(matrices, index);
+			const matrix3x4f result = soa_array_get(copies, index);
+			CHECK(vector_all_near_equal(result.x_axis, expected.x_axis, 0.0f));
+			CHECK(vector_all_near_equal(result.y_axis, expected.y_axis, 0.0f));
+			CHECK(vector_all_near_equal(result.z_axis, expected.z_axis, 0.0f));
+			CHECK(vector_all_near_equal(result.w_axis, expected.w_axis, 0.0f));
+		}
+	}
+
+	{
+		// Not enough space left
+		arena_allocator small_arena = arena_create(buffer.data(), 64);
+		const soa_array<qvvf> transforms = soa_array_allocate<qvvf>(small_arena, num_transforms);
+		CHECK(transforms.streams == nullptr);
+		CHECK(transforms.size == 0);
+	}
+}
@@ -0,0 +1,252 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "test_transforms_impl.h"
+
+#include <catch.hpp>
+
+#include <rtm/matrix3x4f.h>
+#include <rtm/matrix3x4f_batch.h>
+#include <rtm/quatf.h>
+#include <rtm/quatf_batch.h>
+#include <rtm/qvvf.h>
+#include <rtm/qvvf_batch.h>
+#include <rtm/strided_span.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+// Large enough to cover a few full 4 wide blocks as well as a partial one
+static constexpr size_t k_num_span_entries = 11;
+
+namespace
+{
+	// A typical engine component, the transform is one member among others
+	struct transform_component
+	{
+		uint32_t	id;
+		qvvf		local_transform;
+		qvvf		object_transform;
+		vector4f	point;
+	};
+
+	// Packed floats, the stride is not a multiple of the SIMD alignment
+	struct packed_component
+	{
+		float		weight;
+		float		transform[12];
+	};
+
+	// A 3D position stored as 3 floats directly followed by another member
+	struct particle_component
+	{
+		float3f		position;
+		float		mass;
+	};
+}
+
+TEST_CASE("strided_span", "[core][memory][span]")
+{
+	transform_component components[k_num_span_entries];
+	for (size_t index = 0; index < k_num_span_entries; ++index)
+	{
+		components[index].id = uint32_t(index);
+		components[index].local_transform = get_test_transform(index);
+		components[index].object_transform = qvv_identity();
+		components[index].point = vector_set(0.25f * float(index), 1.75f, -3.0f);
+	}
+
+	const strided_span<qvvf> local_transforms = strided_span_create(&components[0].local_transform, sizeof(transform_component), k_num_span_entries);
+	CHECK(local_transforms.size == k_num_span_entries);
+	CHECK(local_transforms.stride == sizeof(transform_component));
+
+	const strided_span<const qvvf> const_local_transforms = strided_span_to_const(local_transforms);
+	for (size_t index = 0; index < k_num_span_entries; ++index)
+		check_qvv_near_equal(qvv_load(const_local_transforms, index), components[index].local_transform, 0.0f);
+
+	for (size_t index = 0; index + 4 <= k_num_span_entries; index += 4)
+	{
+		qvvf results[4];
+		qvv_store_x4(qvv_load_x4(const_local_transforms, index), &results[0]);
+		for (size_t lane_index = 0; lane_index < 4; ++lane_index)
+			check_qvv_near_equal(results[lane_index], components[index + lane_index].local_transform, 0.0f);
+
+		quatf rotations[4];
+		quat_store_x4(quat_load_x4(strided_span_create(reinterpret_cast<const float4f*>(&components[index].local_transform.rotation), sizeof(transform_component), 4), 0), &rotations[0]);
+		for (size_t lane_index = 0; lane_index < 4; ++lane_index)
+			CHECK(quat_near_equal(rotations[lane_index], components[index + lane_index].local_transform.rotation, 0.0f));
+	}
+
+	// Writes leave the other members untouched
+	const strided_span<qvvf> object_transforms = strided_span_create(&components[0].object_transform, sizeof(transform_component), k_num_span_entries);
+	qvv_store_x4(qvv_load_x4(const_local_transforms, 4), object_transforms, 4);
+	qvv_store(qvv_load(const_local_transforms, 0), object_transforms, 0);
+	for (size_t index = 0; index < k_num_span_entries; ++index)
+	{
+		CHECK(components[index].id == uint32_t(index));
+		check_qvv_near_equal(components[index].local_transform, get_test_transform(index), 0.0f);
+		if (index == 0 || (index >= 4 && index < 8))
+			check_qvv_near_equal(components[index].object_transform, components[index].local_transform, 0.0f);
+		else
+			check_qvv_near_equal(components[index].object_transform, qvv_identity(), 0.0f);
+	}
+
+	{
+		// A contiguous array is a span with a stride equal to the value size
+		float4f values[k_num_span_entries];
+		const strided_span<float4f> span = strided_span_create(&values[0], k_num_span_entries);
+		CHECK(span.stride == sizeof(float4f));
+
+		for (size_t index = 0; index < k_num_span_entries; ++index)
+			vector_store(components[index].point, span, index);
+
+		for (size_t index = 0; index < k_num_span_entries; ++index)
+			CHECK(vector_all_near_equal(vector_load(strided_span_to_const(span), index), components[index].point, 0.0f));
+	}
+}
+
+TEST_CASE("strided_span batch math", "[math][batch][span]")
+{
+	const float threshold = 1.0e-4f;
+
+	for (int32_t negative_scale = 0; negative_scale < 2; ++negative_scale)
+	{
+		transform_component components[k_num_span_entries];
+		packed_component packed_components[k_num_span_entries];
+		for (size_t index = 0; index < k_num_span_entries; ++index)
+		{
+			components[index].id = uint32_t(index);
+			components[index].local_transform = get_test_transform(index);
+			components[index].object_transform = get_test_transform(k_num_span_entries - index - 1);
+			if (negative_scale != 0 && index == 5)
+				components[index].local_transform.scale = vector_mul(components[index].local_transform.scale, vector_set(-1.0f, 1.0f, 1.0f));
+
+			components[index].point = vector_set(0.25f * float(index), 1.75f, -3.0f);
+
+			packed_components[index].weight = float(index);
+			for (size_t component_index = 0; component_index < 12; ++component_index)
+				packed_components[index].transform[component_index] = 0.0f;
+		}
+
+		const strided_span<const qvvf> lhs = strided_span_create<const qvvf>(&components[0].local_transform, sizeof(transform_component), k_num_span_entries);
+		const strided_span<const qvvf> rhs = strided_span_create<const qvvf>(&components[0].object_transform, sizeof(transform_component), k_num_span_entries);
+		const strided_span<qvvf> packed_output = strided_span_create(reinterpret_cast<qvvf*>(&packed_components[0].transform[0]), sizeof(packed_component), k_num_span_entries);
+
+		qvv_mul_batch(lhs, rhs, packed_output);
+		for (size_t index = 0; index < k_num_span_entries; ++index)
+		{
+			const qvvf expected = qvv_mul(components[index].local_transform, components[index].object_transform);
+			check_qvv_near_equal(qvv_load(strided_span_to_const(packed_output), index), expected, threshold);
+			CHECK(packed_components[index].weight == float(index));
+		}
+
+		qvv_mul_no_scale_batch(lhs, rhs, packed_output);
+		for (size_t index = 0; index < k_num_span_entries; ++index)
+		{
+			const qvvf expected = qvv_mul_no_scale(components[index].local_transform, components[index].object_transform);
+			const qvvf result = qvv_load(strided_span_to_const(packed_output), index);
+			CHECK(quat_near_equal(result.rotation, expected.rotation, threshold));
+			CHECK(vector_all_near_equal3(result.translation, expected.translation, threshold));
+		}
+
+		// In place
+		const strided_span<qvvf> object_transforms = strided_span_create(&components[0].object_transform, sizeof(transform_component), k_num_span_entries - 1);
+		qvv_mul_batch(lhs, strided_span_to_const(object_transforms), object_transforms);
+		for (size_t index = 0; index < k_num_span_entries; ++index)
+		{
+			const qvvf rhs_transform = get_test_transform(k_num_span_entries - index - 1);
+			const qvvf expected = index < k_num_span_entries - 1 ? qvv_mul(components[index].local_transform, rhs_transform) : rhs_transform;
+			check_qvv_near_equal(components[index].object_transform, expected, threshold);
+			CHECK(components[index].id == uint32_t(index));
+		}
+	}
+
+	{
+		transform_component components[k_num_span_entries];
+		vector4f results[k_num_span_entries];
+		for (size_t index = 0; index < k_num_span_entries; ++index)
+		{
+			components[index].id = uint32_t(index);
+			components[index].local_transform = get_test_transform(index);
+			components[index].object_transform = get_test_transform(index + 3);
+			components[index].point = vector_set(0.25f * float(index), 1.75f, -3.0f);
+		}
+
+		const strided_span<const float4f> points = strided_span_create(reinterpret_cast<const float4f*>(&components[0].point), sizeof(transform_component), k_num_span_entries);
+		const strided_span<const float4f> lhs_rotations = strided_span_create(reinterpret_cast<const float4f*>(&components[0].local_transform.rotation), sizeof(transform_component), k_num_span_entries);
+		const strided_span<const float4f> rhs_rotations = strided_span_create(reinterpret_cast<const float4f*>(&components[0].object_transform.rotation), sizeof(transform_component), k_num_span_entries);
+		const strided_span<float4f> output = strided_span_create(reinterpret_cast<float4f*>(&results[0]), k_num_span_entries);
+
+		quat_mul_vector3_batch(points, rhs_rotations, output);
+		for (size_t index = 0; index < k_num_span_entries; ++index)
+			CHECK(vector_all_near_equal3(results[index], quat_mul_vector3(components[index].point, components[index].object_transform.rotation), threshold));
+
+		const matrix3x4f mtx = matrix_from_qvv(components[2].local_transform);
+		matrix_mul_point3_batch(points, mtx, output);
+		for (size_t index = 0; index < k_num_span_entries; ++index)
+			CHECK(vector_all_near_equal3(results[index], matrix_mul_point3(components[index].point, mtx), threshold));
+
+		quatf rotations[k_num_span_entries];
+		quat_mul_batch(lhs_rotations, rhs_rotations, strided_span_create(reinterpret_cast<float4f*>(&rotations[0]), k_num_span_entries));
+		for (size_t index = 0; index < k_num_span_entries; ++index)
+			CHECK(quat_near_equal(rotations[index], quat_mul(components[index].local_transform.rotation, components[index].object_transform.rotation), threshold));
+	}
+
+	{
+		// 3D vectors stored as 3 floats, the member that follows must not be written
+		particle_component particles[k_num_span_entries];
+		qvvf transforms[k_num_span_entries];
+		for (size_t index = 0; index < k_num_span_entries; ++index)
+		{
+			particles[index].position = float3f{ 0.25f * float(index), 1.75f, -3.0f };
+			particles[index].mass = 2.0f + float(index);
+			transforms[index] = get_test_transform(index);
+		}
+
+		const strided_span<float3f> positions = strided_span_create(&particles[0].position, sizeof(particle_component), k_num_span_entries);
+		const strided_span<const float4f> rotations = strided_span_create(reinterpret_cast<const float4f*>(&transforms[0].rotation), sizeof(qvvf), k_num_span_entries);
+
+		vector4f expected[k_num_span_entries];
+		for (size_t index = 0; index < k_num_span_entries; ++index)
+			expected[index] = quat_mul_vector3(vector_load3(&particles[index].position), transforms[index].rotation);
+
+		quat_mul_vector3_batch(strided_span_to_const(positions), rotations, positions);
+		for (size_t index = 0; index < k_num_span_entries; ++index)
+		{
+			CHECK(vector_all_near_equal3(vector_load3(strided_span_to_const(positions), index), expected[index], threshold));
+			CHECK(particles[index].mass == 2.0f + float(index));
+		}
+
+		const matrix3x4f mtx = matrix_from_qvv(transforms[2]);
+		for (size_t index = 0; index < k_num_span_entries; ++index)
+			expected[index] = matrix_mul_point3(vector_load3(&particles[index].position), mtx);
+
+		matrix_mul_point3_batch(strided_span_to_const(positions), mtx, positions);
+		for (size_t index = 0; index < k_num_span_entries; ++index)
+		{
+			CHECK(vector_all_near_equal3(vector_load3(&particles[index].position), expected[index], threshold));
+			CHECK(particles[index].mass == 2.0f + float(index));
+		}
+	}
+}
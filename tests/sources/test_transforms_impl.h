@@ -0,0 +1,95 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Animation Compression Library contributors
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/quatf.h>
+#include <rtm/qvvf.h>
+#include <rtm/vector4f.h>
+
+#include <cstddef>
+
+using namespace rtm;
+
+//////////////////////////////////////////////////////////////////////////
+// Shared transforms for the batch, SoA, and memory layout tests.
+// The rotations differ for every index while the translations and scales repeat
+// every 8 entries, their magnitude is kept small to retain a tight error threshold.
+//////////////////////////////////////////////////////////////////////////
+
+inline quatf get_test_rotation(size_t index)
+{
+	const float offset = float(index);
+	return quat_from_euler(degrees(10.0f + offset * 17.0f), degrees(-35.0f + offset * 11.0f), degrees(120.0f - offset * 23.0f));
+}
+
+inline quatf get_test_rhs_rotation(size_t index)
+{
+	const float offset = float(index);
+	return quat_from_euler(degrees(-80.0f + offset * 31.0f), degrees(5.0f * offset), degrees(45.0f + offset * 7.0f));
+}
+
+inline vector4f get_test_translation(size_t index)
+{
+	const float offset = float(index % 8);
+	return vector_set(1.5f + offset, -2.25f * offset, 0.75f - offset);
+}
+
+inline qvvf get_test_transform(size_t index)
+{
+	const float offset = float(index % 8);
+	return qvv_set(get_test_rotation(index), get_test_translation(index), vector_set(1.0f + offset * 0.125f, 0.8f, 1.2f));
+}
+
+inline qvvf get_test_rhs_transform(size_t index)
+{
+	const float offset = float(index % 8);
+	return qvv_set(get_test_rhs_rotation(index), vector_set(-0.5f * offset, 3.0f + offset, 1.25f), vector_set(0.9f, 1.1f + offset * 0.25f, 2.0f));
+}
+
+inline vector4f get_test_point(size_t index)
+{
+	const float offset = float(index % 8);
+	return vector_set(0.25f - offset, 1.75f, -3.0f + offset);
+}
+
+inline void get_test_transforms(qvvf* lhs, qvvf* rhs, vector4f* points, size_t count)
+{
+	for (size_t index = 0; index < count; ++index)
+	{
+		lhs[index] = get_test_transform(index);
+		rhs[index] = get_test_rhs_transform(index);
+		points[index] = get_test_point(index);
+	}
+}
+
+inline void check_qvv_near_equal(const qvvf& lhs, const qvvf& rhs, float threshold)
+{
+	CHECK(quat_near_equal(lhs.rotation, rhs.rotation, threshold));
+	CHECK(vector_all_near_equal3(lhs.translation, rhs.translation, threshold));
+	CHECK(vector_all_near_equal3(lhs.scale, rhs.scale, threshold));
+}
@@ -0,0 +1,202 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/vector3f_x4.h>
+#include <rtm/vector3f_x8.h>
+
+using namespace rtm;
+
+static void get_test_vectors(vector4f* lhs, vector4f* rhs, int num_vectors)
+{
+	for (int index = 0; index < num_vectors; ++index)
+	{
+		const float offset = float(index);
+		lhs[index] = vector_set(1.5f + offset, -2.25f * offset, 0.75f - offset, 0.0f);
+		rhs[index] = vector_set(-0.5f * offset, 3.0f + offset, 1.25f + offset * offset, 0.0f);
+	}
+
+	// Make sure the fallback is exercised
+	lhs[1] = vector_zero();
+}
+
+TEST_CASE("vector3f_x4 math", "[math][vector3][soa]")
+{
+	const float threshold = 1.0e-4f;
+
+	vector4f lhs[4];
+	vector4f rhs[4];
+	get_test_vectors(&lhs[0], &rhs[0], 4);
+
+	const vector3f_x4 lhs_x4 = vector_load3_x4(&lhs[0]);
+	const vector3f_x4 rhs_x4 = vector_load3_x4(&rhs[0]);
+	const vector3f_x4 fallback_x4 = vector_broadcast3_x4(vector_set(0.0f, 0.0f, 1.0f));
+
+	{
+		vector4f result[4];
+		vector_store3_x4(lhs_x4, &result[0]);
+		for (int index = 0; index < 4; ++index)
+			REQUIRE(vector_all_near_equal3(result[index], lhs[index], 0.0f));
+
+		float3f lhs_flt[4];
+		float3f result_flt[4];
+		for (int index = 0; index < 4; ++index)
+			vector_store3(lhs[index], &lhs_flt[index]);
+		vector_store3_x4(vector_load3_x4(&lhs_flt[0]), &result_flt[0]);
+		for (int index = 0; index < 4; ++index)
+			REQUIRE(vector_all_near_equal3(vector_load3(&result_flt[index]), lhs[index], 0.0f));
+	}
+
+	vector4f add[4];
+	vector4f sub[4];
+	vector4f mul[4];
+	vector4f mul_scalar[4];
+	vector4f neg[4];
+	vector4f mul_add[4];
+	vector4f cross[4];
+	vector4f normalized[4];
+	vector4f lerp[4];
+	vector_store3_x4(vector_add(lhs_x4, rhs_x4), &add[0]);
+	vector_store3_x4(vector_sub(lhs_x4, rhs_x4), &sub[0]);
+	vector_store3_x4(vector_mul(lhs_x4, rhs_x4), &mul[0]);
+	vector_store3_x4(vector_mul(lhs_x4, 2.5f), &mul_scalar[0]);
+	vector_store3_x4(vector_neg(lhs_x4), &neg[0]);
+	vector_store3_x4(vector_mul_add(lhs_x4, rhs_x4, lhs_x4), &mul_add[0]);
+	vector_store3_x4(vector_cross3(lhs_x4, rhs_x4), &cross[0]);
+	vector_store3_x4(vector_normalize3(lhs_x4, fallback_x4), &normalized[0]);
+	vector_store3_x4(vector_lerp(lhs_x4, rhs_x4, 0.33f), &lerp[0]);
+
+	float dot[4];
+	float length_sq[4];
+	float length[4];
+	vector_store(vector_dot3(lhs_x4, rhs_x4), &dot[0]);
+	vector_store(vector_length_squared3(lhs_x4), &length_sq[0]);
+	vector_store(vector_length3(lhs_x4), &length[0]);
+
+	for (int index = 0; index < 4; ++index)
+	{
+		REQUIRE(vector_all_near_equal3(add[index], vector_add(lhs[index], rhs[index]), threshold));
+		REQUIRE(vector_all_near_equal3(sub[index], vector_sub(lhs[index], rhs[index]), threshold));
+		REQUIRE(vector_all_near_equal3(mul[index], vector_mul(lhs[index], rhs[index]), threshold));
+		REQUIRE(vector_all_near_equal3(mul_scalar[index], vector_mul(lhs[index], 2.5f), threshold));
+		REQUIRE(vector_all_near_equal3(neg[index], vector_neg(lhs[index]), threshold));
+		REQUIRE(vector_all_near_equal3(mul_add[index], vector_mul_add(lhs[index], rhs[index], lhs[index]), threshold));
+		REQUIRE(vector_all_near_equal3(cross[index], vector_cross3(lhs[index], rhs[index]), threshold));
+		REQUIRE(vector_all_near_equal3(normalized[index], vector_normalize3(lhs[index], vector_set(0.0f, 0.0f, 1.0f)), threshold));
+		REQUIRE(vector_all_near_equal3(lerp[index], vector_lerp(lhs[index], rhs[index], 0.33f), threshold));
+		REQUIRE(scalar_near_equal(dot[index], vector_dot3(lhs[index], rhs[index]), threshold));
+		REQUIRE(scalar_near_equal(length_sq[index], vector_length_squared3(lhs[index]), threshold));
+		REQUIRE(scalar_near_equal(length[index], vector_length3(lhs[index]), threshold));
+	}
+}
+
+TEST_CASE("vector3f_x8 math", "[math][vector3][soa]")
+{
+	const float threshold = 1.0e-4f;
+
+	vector4f lhs[8];
+	vector4f rhs[8];
+	get_test_vectors(&lhs[0], &rhs[0], 8);
+
+	const vector3f_x8 lhs_x8 = vector_load3_x8(&lhs[0]);
+	const vector3f_x8 rhs_x8 = vector_load3_x8(&rhs[0]);
+	const vector3f_x8 fallback_x8 = vector_broadcast3_x8(vector_set(0.0f, 0.0f, 1.0f));
+
+	{
+		vector4f result[8];
+		vector_store3_x8(lhs_x8, &result[0]);
+		for (int index = 0; index < 8; ++index)
+			REQUIRE(vector_all_near_equal3(result[index], lhs[index], 0.0f));
+
+		float3f lhs_flt[8];
+		float3f result_flt[8];
+		for (int index = 0; index < 8; ++index)
+			vector_store3(lhs[index], &lhs_flt[index]);
+		vector_store3_x8(vector_load3_x8(&lhs_flt[0]), &result_flt[0]);
+		for (int index = 0; index < 8; ++index)
+			REQUIRE(vector_all_near_equal3(vector_load3(&result_flt[index]), lhs[index], 0.0f));
+	}
+
+	vector4f add[8];
+	vector4f sub[8];
+	vector4f mul[8];
+	vector4f mul_scalar[8];
+	vector4f neg[8];
+	vector4f mul_add[8];
+	vector4f cross[8];
+	vector4f normalized[8];
+	vector4f lerp[8];
+	vector_store3_x8(vector_add(lhs_x8, rhs_x8), &add[0]);
+	vector_store3_x8(vector_sub(lhs_x8, rhs_x8), &sub[0]);
+	vector_store3_x8(vector_mul(lhs_x8, rhs_x8), &mul[0]);
+	vector_store3_x8(vector_mul(lhs_x8, 2.5f), &mul_scalar[0]);
+	vector_store3_x8(vector_neg(lhs_x8), &neg[0]);
+	vector_store3_x8(vector_mul_add(lhs_x8, rhs_x8, lhs_x8), &mul_add[0]);
+	vector_store3_x8(vector_cross3(lhs_x8, rhs_x8), &cross[0]);
+	vector_store3_x8(vector_normalize3(lhs_x8, fallback_x8), &normalized[0]);
+	vector_store3_x8(vector_lerp(lhs_x8, rhs_x8, 0.33f), &lerp[0]);
+
+	float dot[8];
+	float length_sq[8];
+	float length[8];
+	scalar_store_x8(vector_dot3(lhs_x8, rhs_x8), &dot[0]);
+	scalar_store_x8(vector_length_squared3(lhs_x8), &length_sq[0]);
+	scalar_store_x8(vector_length3(lhs_x8), &length[0]);
+
+	for (int index = 0; index < 8; ++index)
+	{
+		REQUIRE(vector_all_near_equal3(add[index], vector_add(lhs[index], rhs[index]), threshold));
+		REQUIRE(vector_all_near_equal3(sub[index], vector_sub(lhs[index], rhs[index]), threshold));
+		REQUIRE(vector_all_near_equal3(mul[index], vector_mul(lhs[index], rhs[index]), threshold));
+		REQUIRE(vector_all_near_equal3(mul_scalar[index], vector_mul(lhs[index], 2.5f), threshold));
+		REQUIRE(vector_all_near_equal3(neg[index], vector_neg(lhs[index]), threshold));
+		REQUIRE(vector_all_near_equal3(mul_add[index], vector_mul_add(lhs[index], rhs[index], lhs[index]), threshold));
+		REQUIRE(vector_all_near_equal3(cross[index], vector_cross3(lhs[index], rhs[index]), threshold));
+		REQUIRE(vector_all_near_equal3(normalized[index], vector_normalize3(lhs[index], vector_set(0.0f, 0.0f, 1.0f)), threshold));
+		REQUIRE(vector_all_near_equal3(lerp[index], vector_lerp(lhs[index], rhs[index], 0.33f), threshold));
+		REQUIRE(scalar_near_equal(dot[index], vector_dot3(lhs[index], rhs[index]), threshold));
+		REQUIRE(scalar_near_equal(length_sq[index], vector_length_squared3(lhs[index]), threshold));
+		REQUIRE(scalar_near_equal(length[index], vector_length3(lhs[index]), threshold));
+	}
+
+	{
+		float values[8] = { 1.0f, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f, 49.0f, 64.0f };
+		float sqrt_values[8];
+		float sqrt_reciprocal_values[8];
+		float reciprocal_values[8];
+		const scalarf_x8 values_x8 = scalar_load_x8(&values[0]);
+		scalar_store_x8(scalar_sqrt(values_x8), &sqrt_values[0]);
+		scalar_store_x8(scalar_sqrt_reciprocal(values_x8), &sqrt_reciprocal_values[0]);
+		scalar_store_x8(scalar_reciprocal(values_x8), &reciprocal_values[0]);
+
+		for (int index = 0; index < 8; ++index)
+		{
+			REQUIRE(scalar_near_equal(sqrt_values[index], scalar_sqrt(values[index]), threshold));
+			REQUIRE(scalar_near_equal(sqrt_reciprocal_values[index], scalar_sqrt_reciprocal(values[index]), threshold));
+			REQUIRE(scalar_near_equal(reciprocal_values[index], scalar_reciprocal(values[index]), threshold));
+		}
+	}
+}
@@ -37,6 +37,7 @@
 #include <rtm/mask4i.h>
 #include <rtm/mask4q.h>
 
+#include <cmath>
 #include <cstring>
 #include <limits>
 
@@ -347,6 +348,16 @@ void test_vector4_impl(const FloatType threshold)
 	REQUIRE(scalar_near_equal(vector_get_z(vector_reciprocal(test_value0)), scalar_reciprocal(test_value0_flt[2]), threshold));
 	REQUIRE(scalar_near_equal(vector_get_w(vector_reciprocal(test_value0)), scalar_reciprocal(test_value0_flt[3]), threshold));
 
+	REQUIRE(scalar_near_equal(vector_get_x(vector_sqrt(vector_abs(test_value0))), scalar_sqrt(scalar_abs(test_value0_flt[0])), threshold));
+	REQUIRE(scalar_near_equal(vector_get_y(vector_sqrt(vector_abs(test_value0))), scalar_sqrt(scalar_abs(test_value0_flt[1])), threshold));
+	REQUIRE(scalar_near_equal(vector_get_z(vector_sqrt(vector_abs(test_value0))), scalar_sqrt(scalar_abs(test_value0_flt[2])), threshold));
+	REQUIRE(scalar_near_equal(vector_get_w(vector_sqrt(vector_abs(test_value0))), scalar_sqrt(scalar_abs(test_value0_flt[3])), threshold));
+
+	REQUIRE(scalar_near_equal(vector_get_x(vector_sqrt_reciprocal(vector_abs(test_value0))), scalar_sqrt_reciprocal(scalar_abs(test_value0_flt[0])), threshold));
+	REQUIRE(scalar_near_equal(vector_get_y(vector_sqrt_reciprocal(vector_abs(test_value0))), scalar_sqrt_reciprocal(scalar_abs(test_value0_flt[1])), threshold));
+	REQUIRE(scalar_near_equal(vector_get_z(vector_sqrt_reciprocal(vector_abs(test_value0))), scalar_sqrt_reciprocal(scalar_abs(test_value0_flt[2])), threshold));
+	REQUIRE(scalar_near_equal(vector_get_w(vector_sqrt_reciprocal(vector_abs(test_value0))), scalar_sqrt_reciprocal(scalar_abs(test_value0_flt[3])), threshold));
+
 	REQUIRE(scalar_near_equal(vector_get_x(vector_floor(test_value0)), scalar_floor(test_value0_flt[0]), threshold));
 	REQUIRE(scalar_near_equal(vector_get_y(vector_floor(test_value0)), scalar_floor(test_value0_flt[1]), threshold));
 	REQUIRE(scalar_near_equal(vector_get_z(vector_floor(test_value0)), scalar_floor(test_value0_flt[2]), threshold));
@@ -357,6 +368,118 @@ void test_vector4_impl(const FloatType threshold)
 	REQUIRE(scalar_near_equal(vector_get_z(vector_ceil(test_value0)), scalar_ceil(test_value0_flt[2]), threshold));
 	REQUIRE(scalar_near_equal(vector_get_w(vector_ceil(test_value0)), scalar_ceil(test_value0_flt[3]), threshold));
 
+	{
+		const Vector4Type round_input = vector_set(FloatType(2.5), FloatType(-1.5), FloatType(1.2), FloatType(-3.7));
+		REQUIRE(vector_get_x(vector_round_bankers(round_input)) == FloatType(2.0));
+		REQUIRE(vector_get_y(vector_round_bankers(round_input)) == FloatType(-2.0));
+		REQUIRE(vector_get_z(vector_round_bankers(round_input)) == FloatType(1.0));
+		REQUIRE(vector_get_w(vector_round_bankers(round_input)) == FloatType(-4.0));
+	}
+
+	{
+		const FloatType trig_threshold = FloatType(1.0e-6);
+		const FloatType angles[] = { FloatType(0.0), k_pi, -k_pi, k_pi_2, -k_pi_2, FloatType(0.5), FloatType(32.5), FloatType(-0.5), FloatType(-32.5), FloatType(100.0), FloatType(-250.0), FloatType(1.0e-4) };
+		const size_t num_angles = sizeof(angles) / sizeof(angles[0]);
+
+		for (size_t angle_index = 0; angle_index + 4 <= num_angles; angle_index += 4)
+		{
+			const Vector4Type angle = vector_set(angles[angle_index + 0], angles[angle_index + 1], angles[angle_index + 2], angles[angle_index + 3]);
+			const Vector4Type sin_result = vector_sin(angle);
+			const Vector4Type cos_result = vector_cos(angle);
+
+			Vector4Type sincos_sin;
+			Vector4Type sincos_cos;
+			vector_sincos(angle, sincos_sin, sincos_cos);
+
+			for (uint32_t component_index = 0; component_index < 4; ++component_index)
+			{
+				const mix4 component = mix4(component_index);
+				const FloatType angle_value = angles[angle_index + component_index];
+				REQUIRE(scalar_near_equal(vector_get_component(sin_result, component), FloatType(std::sin(angle_value)), trig_threshold));
+				REQUIRE(scalar_near_equal(vector_get_component(cos_result, component), FloatType(std::cos(angle_value)), trig_threshold));
+				REQUIRE(vector_get_component(sincos_sin, component) == vector_get_component(sin_result, component));
+				REQUIRE(vector_get_component(sincos_cos, component) == vector_get_component(cos_result, component));
+			}
+		}
+	}
+
+	{
+		const FloatType high_threshold = FloatType(1.0e-6);
+		const FloatType low_threshold = FloatType(1.0e-4);
+		const FloatType values[] = { FloatType(-1.0), FloatType(-0.75), FloatType(-0.5), FloatType(-0.25), FloatType(0.0), FloatType(0.25), FloatType(0.5), FloatType(0.75), FloatType(1.0), FloatType(0.999), FloatType(-0.001), FloatType(0.3) };
+		const FloatType tangents[] = { FloatType(-1000.0), FloatType(-2.5), FloatType(-1.0), FloatType(-0.3), FloatType(0.0), FloatType(0.3), FloatType(0.5), FloatType(1.0), FloatType(2.0), FloatType(2.5), FloatType(30.0), FloatType(1.0e6) };
+		const size_t num_values = sizeof(values) / sizeof(values[0]);
+
+		for (size_t value_index = 0; value_index + 4 <= num_values; value_index += 4)
+		{
+			const Vector4Type value = vector_set(values[value_index + 0], values[value_index + 1], values[value_index + 2], values[value_index + 3]);
+			const Vector4Type tangent = vector_set(tangents[value_index + 0], tangents[value_index + 1], tangents[value_index + 2], tangents[value_index + 3]);
+
+			for (uint32_t component_index = 0; component_index < 4; ++component_index)
+			{
+				const mix4 component = mix4(component_index);
+				const FloatType ref_value = values[value_index + component_index];
+				const FloatType ref_tangent = tangents[value_index + component_index];
+
+				REQUIRE(scalar_near_equal(vector_get_component(vector_asin(value), component), FloatType(std::asin(ref_value)), high_threshold));
+				REQUIRE(scalar_near_equal(vector_get_component(vector_acos(value), component), FloatType(std::acos(ref_value)), high_threshold));
+				REQUIRE(scalar_near_equal(vector_get_component(vector_atan(tangent), component), FloatType(std::atan(ref_tangent)), high_threshold));
+				REQUIRE(scalar_near_equal(vector_get_component(vector_atan2(value, tangent), component), FloatType(std::atan2(ref_value, ref_tangent)), high_threshold));
+				REQUIRE(scalar_near_equal(vector_get_component(vector_atan2(tangent, value), component), FloatType(std::atan2(ref_tangent, ref_value)), high_threshold));
+
+				REQUIRE(scalar_near_equal(vector_get_component(vector_asin<accuracy::low>(value), component), FloatType(std::asin(ref_value)), low_threshold));
+				REQUIRE(scalar_near_equal(vector_get_component(vector_acos<accuracy::low>(value), component), FloatType(std::acos(ref_value)), low_threshold));
+				REQUIRE(scalar_near_equal(vector_get_component(vector_atan<accuracy::low>(tangent), component), FloatType(std::atan(ref_tangent)), low_threshold));
+				REQUIRE(scalar_near_equal(vector_get_component(vector_atan2<accuracy::low>(value, tangent), component), FloatType(std::atan2(ref_value, ref_tangent)), low_threshold));
+			}
+		}
+
+		REQUIRE(vector_get_x(vector_atan2(zero, zero)) == FloatType(0.0));
+	}
+
+	{
+		const FloatType relative_threshold = FloatType(1.0e-6);
+		const FloatType exponents[] = { FloatType(-80.0), FloatType(-10.5), FloatType(-1.0), FloatType(-0.3), FloatType(0.0), FloatType(0.25), FloatType(0.6931), FloatType(1.0), FloatType(2.5), FloatType(7.125), FloatType(30.0), FloatType(80.0) };
+		const FloatType values[] = { FloatType(1.0e-30), FloatType(0.001), FloatType(0.1), FloatType(0.5), FloatType(0.75), FloatType(1.0), FloatType(1.5), FloatType(2.0), FloatType(3.14159), FloatType(10.0), FloatType(1234.5), FloatType(1.0e30) };
+		const size_t num_values = sizeof(values) / sizeof(values[0]);
+
+		for (size_t value_index = 0; value_index + 4 <= num_values; value_index += 4)
+		{
+			const Vector4Type exponent = vector_set(exponents[value_index + 0], exponents[value_index + 1], exponents[value_index + 2], exponents[value_index + 3]);
+			const Vector4Type value = vector_set(values[value_index + 0], values[value_index + 1], values[value_index + 2], values[value_index + 3]);
+			const Vector4Type small_exponent = vector_mul(exponent, FloatType(0.01));
+
+			for (uint32_t component_index = 0; component_index < 4; ++component_index)
+			{
+				const mix4 component = mix4(component_index);
+				const FloatType ref_exponent = exponents[value_index + component_index];
+				const FloatType ref_value = values[value_index + component_index];
+
+				const FloatType ref_exp = FloatType(std::exp(ref_exponent));
+				const FloatType ref_exp2 = FloatType(std::exp2(ref_exponent));
+				const FloatType ref_log = FloatType(std::log(ref_value));
+				const FloatType ref_log2 = FloatType(std::log2(ref_value));
+				const FloatType ref_pow = FloatType(std::pow(ref_value, ref_exponent * FloatType(0.01)));
+
+				REQUIRE(scalar_near_equal(vector_get_component(vector_exp(exponent), component), ref_exp, scalar_abs(ref_exp) * relative_threshold));
+				REQUIRE(scalar_near_equal(vector_get_component(vector_exp2(exponent), component), ref_exp2, scalar_abs(ref_exp2) * relative_threshold));
+				REQUIRE(scalar_near_equal(vector_get_component(vector_log(value), component), ref_log, scalar_max(scalar_abs(ref_log), FloatType(1.0)) * relative_threshold));
+				REQUIRE(scalar_near_equal(vector_get_component(vector_log2(value), component), ref_log2, scalar_max(scalar_abs(ref_log2), FloatType(1.0)) * relative_threshold));
+				REQUIRE(scalar_near_equal(vector_get_component(vector_pow(value, small_exponent), component), ref_pow, scalar_abs(ref_pow) * FloatType(1.0e-5)));
+			}
+		}
+
+		const FloatType infinity = std::numeric_limits<FloatType>::infinity();
+		REQUIRE(vector_get_x(vector_exp(vector_set(FloatType(1000.0)))) == infinity);
+		REQUIRE(vector_get_x(vector_exp(vector_set(FloatType(-1000.0)))) == FloatType(0.0));
+		REQUIRE(vector_get_x(vector_exp2(zero)) == FloatType(1.0));
+		REQUIRE(vector_get_x(vector_log(vector_set(FloatType(1.0)))) == FloatType(0.0));
+		REQUIRE(vector_get_x(vector_log(zero)) == -infinity);
+		REQUIRE(vector_get_x(vector_log(vector_set(infinity))) == infinity);
+		REQUIRE(std::isnan(vector_get_x(vector_log(vector_set(FloatType(-1.0))))));
+		REQUIRE(vector_get_x(vector_log2(vector_set(FloatType(8.0)))) == FloatType(3.0));
+	}
+
 	const Vector4Type scalar_cross3_result = scalar_cross3<Vector4Type>(test_value0, test_value1);
 	const Vector4Type vector_cross3_result = vector_cross3(test_value0, test_value1);
 	REQUIRE(scalar_near_equal(vector_get_x(vector_cross3_result), vector_get_x(scalar_cross3_result), threshold));
@@ -25,6 +25,8 @@
 
 #include "test_vector4_impl.h"
 
+#include <rtm/matrix3x4f.h>
+
 TEST_CASE("vector4f math", "[math][vector4]")
 {
 #if defined(RTM_NO_INTRINSICS)
@@ -42,3 +44,27 @@ TEST_CASE("vector4f math", "[math][vector4]")
 	REQUIRE(scalar_near_equal(vector_get_z(dst), 0.68123521, 1.0e-6));
 	REQUIRE(scalar_near_equal(vector_get_w(dst), -5.9182, 1.0e-6));
 }
+
+TEST_CASE("vector4f streaming stores", "[math][vector4]")
+{
+	alignas(64) float buffer[16];
+	const vector4f value0 = vector_set(-2.65f, 2.996113f, 0.68123521f, -5.9182f);
+	const vector4f value1 = vector_set(1.0f, 2.0f, 3.0f, 4.0f);
+
+	vector_store_stream(value0, &buffer[0]);
+	vector_store_stream(value1, &buffer[4]);
+	quat_store_stream(quat_set(0.0f, 0.0f, 0.0f, 1.0f), &buffer[8]);
+	vector_store_stream(value0, reinterpret_cast<vector4f*>(&buffer[12]));
+	vector_store_stream_fence();
+
+	CHECK(vector_all_near_equal(vector_load(&buffer[0]), value0, 0.0f));
+	CHECK(vector_all_near_equal(vector_load(&buffer[4]), value1, 0.0f));
+	CHECK(quat_near_equal(quat_unaligned_load(&buffer[8]), quat_identity(), 0.0f));
+	CHECK(vector_all_near_equal(vector_load(&buffer[12]), value0, 0.0f));
+
+	matrix3x4f matrix;
+	matrix_store_stream(matrix3x4f{ value0, value1, value0, value1 }, &matrix);
+	vector_store_stream_fence();
+	CHECK(vector_all_near_equal(matrix.x_axis, value0, 0.0f));
+	CHECK(vector_all_near_equal(matrix.w_axis, value1, 0.0f));
+}
@@ -0,0 +1,75 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../sources/bench_common.h"
+
+#include <rtm/matrix3x3f.h>
+#include <rtm/matrix3x4f.h>
+#include <rtm/matrix4x4f.h>
+
+float rtm_bench::g_zero = 0.0f;
+float rtm_bench::g_negative_zero = -0.0f;
+
+const rtm_bench::input_sets& rtm_bench::get_input_sets()
+{
+	using namespace rtm;
+
+	static input_sets s_sets;
+	static bool s_is_initialized = false;
+
+	if (!s_is_initialized)
+	{
+		random_generator generator;
+		for (size_t index = 0; index < k_num_inputs; ++index)
+		{
+			s_sets.vectors[index] = generator.next_vector(-2.0f, 2.0f);
+			s_sets.positive_vectors[index] = generator.next_vector(0.1f, 10.0f);
+			s_sets.unit_vectors[index] = generator.next_vector(-1.0f, 1.0f);
+			s_sets.quats[index] = generator.next_quat();
+			s_sets.qvvs[index] = generator.next_qvv();
+			s_sets.matrices3x3[index] = matrix_from_quat(generator.next_quat());
+			s_sets.matrices3x4[index] = matrix_from_qvv(generator.next_qvv());
+
+			const matrix3x4f transform = matrix_from_qvv(generator.next_qvv());
+			s_sets.matrices4x4[index] = matrix_set(transform.x_axis, transform.y_axis, transform.z_axis, vector_mix<mix4::x, mix4::y, mix4::z, mix4::d>(transform.w_axis, vector_set(1.0f)));
+
+			s_sets.angles[index] = radians(generator.next(-3.0f, 3.0f));
+			s_sets.scalars[index] = generator.next(0.0f, 1.0f);
+		}
+
+		s_is_initialized = true;
+	}
+
+	return s_sets;
+}
+
+int main(int argc, char** argv)
+{
+	benchmark::Initialize(&argc, argv);
+	if (benchmark::ReportUnrecognizedArguments(argc, argv))
+		return 1;
+
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+	return 0;
+}
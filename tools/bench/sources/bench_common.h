@@ -0,0 +1,211 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <rtm/matrix3x3f.h>
+#include <rtm/matrix3x4f.h>
+#include <rtm/matrix4x4f.h>
+#include <rtm/quatf.h>
+#include <rtm/qvvf.h>
+#include <rtm/vector4f.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace rtm_bench
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Number of independent inputs processed per iteration by the throughput benchmarks.
+	// Every input set fits in the L1 cache.
+	//////////////////////////////////////////////////////////////////////////
+	constexpr size_t k_num_inputs = 256;
+
+	//////////////////////////////////////////////////////////////////////////
+	// Hides a value from the optimizer to prevent constant folding.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename Type>
+	inline Type opaque(Type value)
+	{
+		benchmark::DoNotOptimize(value);
+		return value;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Zero values the optimizer doesn't know about, see the depend_on_*(..) functions.
+	//////////////////////////////////////////////////////////////////////////
+	extern float g_zero;
+	extern float g_negative_zero;
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the input unchanged but dependent on another value. The latency benchmarks of
+	// functions that do not return their input type use these to form a dependency chain.
+	// The latency reported for those functions includes 2 to 3 extra instructions.
+	//////////////////////////////////////////////////////////////////////////
+	inline rtm::vector4f depend_on_float(rtm::vector4f_arg0 input, float value)
+	{
+		return rtm::vector_add(input, rtm::vector_set(value * g_zero));
+	}
+
+	inline rtm::vector4f depend_on_bool(rtm::vector4f_arg0 input, bool value)
+	{
+		return rtm::vector_add(input, rtm::vector_set(value ? g_zero : g_negative_zero));
+	}
+
+	inline rtm::vector4f depend_on_mask(rtm::vector4f_arg0 input, rtm::mask4i_arg0 value)
+	{
+		return rtm::vector_add(input, rtm::vector_select(value, rtm::vector_set(g_zero), rtm::vector_set(g_negative_zero)));
+	}
+
+	inline rtm::quatf depend_on_float_quat(rtm::quatf_arg0 input, float value)
+	{
+		return rtm::vector_to_quat(rtm::vector_add(rtm::quat_to_vector(input), rtm::vector_set(value * g_zero)));
+	}
+
+	inline rtm::quatf depend_on_bool_quat(rtm::quatf_arg0 input, bool value)
+	{
+		return rtm::vector_to_quat(rtm::vector_add(rtm::quat_to_vector(input), rtm::vector_set(value ? g_zero : g_negative_zero)));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Measures the latency of 'func': every call consumes the value produced by the previous one.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename InputType, typename FuncType, typename NextType>
+	inline void run_latency(benchmark::State& state, InputType value, FuncType func, NextType next)
+	{
+		for (auto _ : state)
+			value = next(value, func(value));
+
+		benchmark::DoNotOptimize(value);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Measures the throughput of 'func' over k_num_inputs independent inputs.
+	// Each input counts as one item, the reciprocal of the item rate is the cost per call.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename InputType, typename FuncType>
+	inline void run_throughput(benchmark::State& state, const InputType* inputs, FuncType func)
+	{
+		using ResultType = decltype(func(inputs[0]));
+
+		ResultType results[k_num_inputs];
+		for (auto _ : state)
+		{
+			for (size_t index = 0; index < k_num_inputs; ++index)
+				results[index] = func(inputs[index]);
+
+			benchmark::DoNotOptimize(results);
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(k_num_inputs));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Registers the latency and throughput benchmarks of a function.
+	// 'func' is called with one input and the latency is measured along its first argument.
+	// 'next' builds the next latency input from the current input and the result.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename InputType, typename FuncType, typename NextType>
+	inline void add(const char* name, const InputType* inputs, FuncType func, NextType next)
+	{
+		benchmark::RegisterBenchmark((std::string(name) + "/latency").c_str(),
+			[=](benchmark::State& state) { run_latency(state, inputs[0], func, next); });
+
+		benchmark::RegisterBenchmark((std::string(name) + "/throughput").c_str(),
+			[=](benchmark::State& state) { run_throughput(state, inputs, func); });
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Registers the latency and throughput benchmarks of a function that returns its input type.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename InputType, typename FuncType>
+	inline void add(const char* name, const InputType* inputs, FuncType func)
+	{
+		add(name, inputs, func, [](const InputType&, const InputType& result) { return result; });
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Deterministic pseudo-random values within [min_value, max_value).
+	//////////////////////////////////////////////////////////////////////////
+	struct random_generator
+	{
+		uint32_t state = 0x12345678;
+
+		float next(float min_value, float max_value)
+		{
+			// Xorshift32
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			return min_value + (max_value - min_value) * (float(state >> 8) * (1.0f / 16777216.0f));
+		}
+
+		rtm::vector4f next_vector(float min_value, float max_value)
+		{
+			const float x = next(min_value, max_value);
+			const float y = next(min_value, max_value);
+			const float z = next(min_value, max_value);
+			const float w = next(min_value, max_value);
+			return rtm::vector_set(x, y, z, w);
+		}
+
+		rtm::quatf next_quat()
+		{
+			const float pitch = next(-3.0f, 3.0f);
+			const float yaw = next(-3.0f, 3.0f);
+			const float roll = next(-3.0f, 3.0f);
+			return rtm::quat_from_euler(rtm::radians(pitch), rtm::radians(yaw), rtm::radians(roll));
+		}
+
+		rtm::qvvf next_qvv()
+		{
+			const rtm::quatf rotation = next_quat();
+			const rtm::vector4f translation = next_vector(-10.0f, 10.0f);
+			const rtm::vector4f scale = next_vector(0.5f, 2.0f);
+			return rtm::qvv_set(rotation, translation, scale);
+		}
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Input sets shared by all benchmarks, they are built once before the benchmarks run.
+	//////////////////////////////////////////////////////////////////////////
+	struct input_sets
+	{
+		rtm::vector4f vectors[k_num_inputs];				// Within [-2.0, 2.0)
+		rtm::vector4f positive_vectors[k_num_inputs];		// Within [0.1, 10.0)
+		rtm::vector4f unit_vectors[k_num_inputs];			// Within [-1.0, 1.0)
+		rtm::quatf quats[k_num_inputs];
+		rtm::qvvf qvvs[k_num_inputs];
+		rtm::matrix3x3f matrices3x3[k_num_inputs];
+		rtm::matrix3x4f matrices3x4[k_num_inputs];
+		rtm::matrix4x4f matrices4x4[k_num_inputs];
+		rtm::anglef angles[k_num_inputs];
+		float scalars[k_num_inputs];						// Within [0.0, 1.0)
+	};
+
+	const input_sets& get_input_sets();
+}
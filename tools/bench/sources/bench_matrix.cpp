@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "bench_common.h"
+
+#include <rtm/matrix3x3f.h>
+#include <rtm/matrix3x4f.h>
+#include <rtm/matrix4x4f.h>
+#include <rtm/qvvf.h>
+
+using namespace rtm;
+using namespace rtm_bench;
+
+static int register_matrix_benchmarks()
+{
+	const input_sets& sets = get_input_sets();
+	const vector4f* vectors = &sets.vectors[0];
+	const quatf* quats = &sets.quats[0];
+	const qvvf* qvvs = &sets.qvvs[0];
+	const matrix3x3f* matrices3x3 = &sets.matrices3x3[0];
+	const matrix3x4f* matrices3x4 = &sets.matrices3x4[0];
+	const matrix4x4f* matrices4x4 = &sets.matrices4x4[0];
+
+	// Rotations keep the latency chains stable
+	const quatf rotation = opaque(quat_from_euler(radians(0.3f), radians(-1.2f), radians(2.1f)));
+	const matrix3x3f other3x3 = opaque(matrix3x3f(matrix_from_quat(rotation)));
+	const matrix3x4f other3x4 = opaque(matrix3x4f(matrix_from_quat(rotation)));
+	const matrix4x4f other4x4 = opaque(matrix4x4f(matrix_set(other3x4.x_axis, other3x4.y_axis, other3x4.z_axis, vector_set(0.0f, 0.0f, 0.0f, 1.0f))));
+	const vector4f scale = opaque(vector_set(1.0f, 1.5f, 0.5f));
+
+	//////////////////////////////////////////////////////////////////////////
+	// Common
+
+	add("matrix_set/3x3", vectors, [=](const vector4f& input) { return matrix_set(input, other3x3.y_axis, other3x3.z_axis); }, [](const vector4f&, const matrix3x3f& result) { return result.x_axis; });
+	add("matrix_set/4x4", vectors, [=](const vector4f& input) { return matrix4x4f(matrix_set(input, other4x4.y_axis, other4x4.z_axis, other4x4.w_axis)); }, [](const vector4f&, const matrix4x4f& result) { return result.x_axis; });
+	add("matrix_identity/3x4", matrices3x4, [](const matrix3x4f& input) { return matrix_mul(input, matrix3x4f(matrix_identity())); });
+	add("matrix_from_quat/3x3", quats, [](const quatf& input) { return matrix3x3f(matrix_from_quat(input)); }, [](const quatf&, const matrix3x3f& result) { return quat_from_matrix(result); });
+	add("matrix_from_quat/3x4", quats, [](const quatf& input) { return matrix3x4f(matrix_from_quat(input)); }, [](const quatf&, const matrix3x4f& result) { return quat_from_matrix(result); });
+	add("matrix_from_scale/3x4", vectors, [](const vector4f& input) { return matrix3x4f(matrix_from_scale(input)); }, [](const vector4f&, const matrix3x4f& result) { return result.x_axis; });
+
+	//////////////////////////////////////////////////////////////////////////
+	// matrix3x3f
+
+	add("matrix_get_axis/3x3", matrices3x3, [](const matrix3x3f& input) { return matrix_get_axis(input, axis4::y); }, [](const matrix3x3f& input, const vector4f& result) { return matrix_set(result, input.x_axis, input.z_axis); });
+	add("quat_from_matrix/3x3", matrices3x3, [](const matrix3x3f& input) { return quat_from_matrix(input); }, [](const matrix3x3f&, const quatf& result) { return matrix3x3f(matrix_from_quat(result)); });
+	add("matrix_mul/3x3", matrices3x3, [=](const matrix3x3f& input) { return matrix_mul(input, other3x3); });
+	add("matrix_mul_vector3/3x3", vectors, [=](const vector4f& input) { return matrix_mul_vector3(input, other3x3); });
+	add("matrix_transpose/3x3", matrices3x3, [](const matrix3x3f& input) { return matrix_transpose(input); });
+	add("matrix_inverse/3x3", matrices3x3, [](const matrix3x3f& input) { return matrix_inverse(input); });
+	add("matrix_remove_scale/3x3", matrices3x3, [](const matrix3x3f& input) { return matrix_remove_scale(input); });
+
+	//////////////////////////////////////////////////////////////////////////
+	// matrix3x4f
+
+	add("matrix_from_translation", vectors, [](const vector4f& input) { return matrix_from_translation(input); }, [](const vector4f&, const matrix3x4f& result) { return result.w_axis; });
+	add("matrix_from_qvv", quats, [=](const quatf& input) { return matrix_from_qvv(input, scale, scale); }, [](const quatf&, const matrix3x4f& result) { return quat_from_matrix(matrix_remove_scale(result)); });
+	add("matrix_from_qvv/qvvf", qvvs, [](const qvvf& input) { return matrix_from_qvv(input); }, [](const qvvf& input, const matrix3x4f& result) { return qvv_set(input.rotation, result.w_axis, input.scale); });
+	add("matrix_get_axis/3x4", matrices3x4, [](const matrix3x4f& input) { return matrix_get_axis(input, axis4::w); }, [](const matrix3x4f& input, const vector4f& result) { return matrix_set(input.x_axis, input.y_axis, input.z_axis, result); });
+	add("quat_from_matrix/3x4", matrices3x4, [](const matrix3x4f& input) { return quat_from_matrix(input); }, [](const matrix3x4f&, const quatf& result) { return matrix3x4f(matrix_from_quat(result)); });
+	add("matrix_mul/3x4", matrices3x4, [=](const matrix3x4f& input) { return matrix_mul(input, other3x4); });
+	add("matrix_mul_point3/3x4", vectors, [=](const vector4f& input) { return matrix_mul_point3(input, other3x4); });
+	add("matrix_mul_vector3/3x4", vectors, [=](const vector4f& input) { return matrix_mul_vector3(input, other3x4); });
+	add("matrix_transpose/3x4", matrices3x4, [](const matrix3x4f& input) { return matrix_transpose(input); }, [](const matrix3x4f& input, const matrix3x3f& result) { return matrix_set(result.x_axis, result.y_axis, result.z_axis, input.w_axis); });
+	add("matrix_inverse/3x4", matrices3x4, [](const matrix3x4f& input) { return matrix_inverse(input); });
+	add("matrix_remove_scale/3x4", matrices3x4, [](const matrix3x4f& input) { return matrix_remove_scale(input); });
+
+	//////////////////////////////////////////////////////////////////////////
+	// matrix4x4f
+
+	add("matrix_get_axis/4x4", matrices4x4, [](const matrix4x4f& input) { return matrix_get_axis(input, axis4::w); }, [](const matrix4x4f& input, const vector4f& result) { return matrix4x4f(matrix_set(input.x_axis, input.y_axis, input.z_axis, result)); });
+	add("matrix_mul/4x4", matrices4x4, [=](const matrix4x4f& input) { return matrix_mul(input, other4x4); });
+	add("matrix_mul_vector/4x4", vectors, [=](const vector4f& input) { return matrix_mul_vector(input, other4x4); });
+	add("matrix_transpose/4x4", matrices4x4, [](const matrix4x4f& input) { return matrix_transpose(input); });
+	add("matrix_inverse/4x4", matrices4x4, [](const matrix4x4f& input) { return matrix_inverse(input); });
+
+	return 0;
+}
+
+static const int s_matrix_benchmarks = register_matrix_benchmarks();
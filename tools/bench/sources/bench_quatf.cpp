@@ -0,0 +1,113 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "bench_common.h"
+
+#include <rtm/quatf.h>
+#include <rtm/qvvf.h>
+
+using namespace rtm;
+using namespace rtm_bench;
+
+static int register_quatf_benchmarks()
+{
+	const input_sets& sets = get_input_sets();
+	const vector4f* vectors = &sets.vectors[0];
+	const quatf* quats = &sets.quats[0];
+	const anglef* angles = &sets.angles[0];
+
+	const quatf other = opaque(quat_from_euler(radians(0.3f), radians(-1.2f), radians(2.1f)));
+	const quatf tangent0 = opaque(quat_from_euler(radians(0.4f), radians(-1.0f), radians(2.0f)));
+	const quatf tangent1 = opaque(quat_from_euler(radians(0.5f), radians(-0.9f), radians(1.9f)));
+	const vector4f axis = opaque(vector_set(0.0f, 0.6f, 0.8f));
+	const float alpha = opaque(0.33f);
+	const float threshold = opaque(0.00001f);
+
+	auto next_float = [](const quatf& input, float result) { return depend_on_float_quat(input, result); };
+	auto next_bool = [](const quatf& input, bool result) { return depend_on_bool_quat(input, result); };
+
+	//////////////////////////////////////////////////////////////////////////
+	// Setters, getters, and casts
+
+	add("quat_unaligned_load", quats, [](const quatf& input) { return quat_unaligned_load(reinterpret_cast<const float*>(&input)); });
+	add("vector_to_quat", vectors, [](const vector4f& input) { return quat_to_vector(vector_to_quat(input)); });
+	add("quat_cast", quats, [](const quatf& input) { return quat_cast(quat_cast(input)); });
+	add("quat_get_x", quats, [](const quatf& input) { return quat_get_x(input); }, next_float);
+	add("quat_get_y", quats, [](const quatf& input) { return quat_get_y(input); }, next_float);
+	add("quat_get_z", quats, [](const quatf& input) { return quat_get_z(input); }, next_float);
+	add("quat_get_w", quats, [](const quatf& input) { return quat_get_w(input); }, next_float);
+	add("quat_unaligned_write", quats, [](const quatf& input) { float4f output; quat_unaligned_write(input, &output.x); return output; }, [](const quatf&, const float4f& result) { return vector_to_quat(vector_load(&result)); });
+	add("quat_set", angles, [](const anglef& input) { return quat_set(input.as_radians(), 0.2f, 0.3f, 0.9f); }, [](const anglef&, const quatf& result) { return radians(quat_get_x(result)); });
+	add("quat_identity", quats, [](const quatf& input) { return quat_mul(input, quatf(quat_identity())); });
+
+	//////////////////////////////////////////////////////////////////////////
+	// Arithmetic
+
+	add("quat_conjugate", quats, [](const quatf& input) { return quat_conjugate(input); });
+	add("quat_mul", quats, [=](const quatf& input) { return quat_mul(input, other); });
+	add("quat_mul_vector3", vectors, [=](const vector4f& input) { return quat_mul_vector3(input, other); });
+	add("quat_length_squared", quats, [](const quatf& input) { return quat_length_squared(input); }, next_float);
+	add("quat_length", quats, [](const quatf& input) { return quat_length(input); }, next_float);
+	add("quat_length_reciprocal", quats, [](const quatf& input) { return quat_length_reciprocal(input); }, next_float);
+	add("quat_normalize", quats, [](const quatf& input) { return quat_normalize(input); });
+	add("quat_lerp", quats, [=](const quatf& input) { return quat_lerp(input, other, alpha); });
+	add("quat_neg", quats, [](const quatf& input) { return quat_neg(input); });
+	add("quat_slerp", quats, [=](const quatf& input) { return quat_slerp(input, other, alpha); });
+	add("quat_slerp_fast", quats, [=](const quatf& input) { return quat_slerp_fast(input, other, alpha); });
+	add("quat_squad", quats, [=](const quatf& input) { return quat_squad(input, tangent0, tangent1, other, alpha); });
+	add("quat_squad_setup", quats, [=](const quatf& input)
+	{
+		quatf start_tangent;
+		quatf end_tangent;
+		quatf end;
+		quat_squad_setup(other, input, tangent0, tangent1, start_tangent, end_tangent, end);
+		return quat_mul(start_tangent, end_tangent);
+	});
+
+	//////////////////////////////////////////////////////////////////////////
+	// Conversion to/from axis/angle/euler
+
+	add("quat_to_axis_angle", quats, [](const quatf& input)
+	{
+		vector4f axis_result;
+		anglef angle_result;
+		quat_to_axis_angle(input, axis_result, angle_result);
+		return vector_mul(axis_result, angle_result.as_radians());
+	}, [](const quatf& input, const vector4f& result) { return depend_on_float_quat(input, vector_get_x(result)); });
+	add("quat_get_axis", quats, [](const quatf& input) { return quat_get_axis(input); }, [](const quatf& input, const vector4f& result) { return depend_on_float_quat(input, vector_get_x(result)); });
+	add("quat_get_angle", quats, [](const quatf& input) { return quat_get_angle(input).as_radians(); }, next_float);
+	add("quat_from_axis_angle", angles, [=](const anglef& input) { return quat_from_axis_angle(axis, input); }, [](const anglef&, const quatf& result) { return radians(quat_get_w(result)); });
+	add("quat_from_euler", angles, [](const anglef& input) { return quat_from_euler(input, input, input); }, [](const anglef&, const quatf& result) { return radians(quat_get_w(result)); });
+
+	//////////////////////////////////////////////////////////////////////////
+	// Comparisons and masking
+
+	add("quat_is_finite", quats, [](const quatf& input) { return quat_is_finite(input); }, next_bool);
+	add("quat_is_normalized", quats, [=](const quatf& input) { return quat_is_normalized(input, threshold); }, next_bool);
+	add("quat_near_equal", quats, [=](const quatf& input) { return quat_near_equal(input, other, threshold); }, next_bool);
+	add("quat_near_identity", quats, [](const quatf& input) { return quat_near_identity(input); }, next_bool);
+
+	return 0;
+}
+
+static const int s_quatf_benchmarks = register_quatf_benchmarks();
@@ -0,0 +1,56 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "bench_common.h"
+
+#include <rtm/qvvf.h>
+
+using namespace rtm;
+using namespace rtm_bench;
+
+static int register_qvvf_benchmarks()
+{
+	const input_sets& sets = get_input_sets();
+	const vector4f* vectors = &sets.vectors[0];
+	const quatf* quats = &sets.quats[0];
+	const qvvf* qvvs = &sets.qvvs[0];
+
+	// Unit scale keeps the latency chains stable
+	const qvvf other = opaque(qvv_set(quat_from_euler(radians(0.3f), radians(-1.2f), radians(2.1f)), vector_set(0.1f, -0.2f, 0.3f), vector_set(1.0f)));
+	const vector4f translation = opaque(vector_set(1.0f, 2.0f, 3.0f));
+	const vector4f scale = opaque(vector_set(1.0f, 1.5f, 0.5f));
+
+	add("qvv_set", quats, [=](const quatf& input) { return qvv_set(input, translation, scale); }, [](const quatf&, const qvvf& result) { return result.rotation; });
+	add("qvv_identity", qvvs, [](const qvvf& input) { return qvv_mul(input, qvvf(qvv_identity())); });
+	add("qvv_mul", qvvs, [=](const qvvf& input) { return qvv_mul(input, other); });
+	add("qvv_mul_no_scale", qvvs, [=](const qvvf& input) { return qvv_mul_no_scale(input, other); });
+	add("qvv_mul_point3", vectors, [=](const vector4f& input) { return qvv_mul_point3(input, other); });
+	add("qvv_mul_point3_no_scale", vectors, [=](const vector4f& input) { return qvv_mul_point3_no_scale(input, other); });
+	add("qvv_inverse", qvvs, [](const qvvf& input) { return qvv_inverse(input); });
+	add("qvv_inverse_no_scale", qvvs, [](const qvvf& input) { return qvv_inverse_no_scale(input); });
+	add("qvv_normalize", qvvs, [](const qvvf& input) { return qvv_normalize(input); });
+
+	return 0;
+}
+
+static const int s_qvvf_benchmarks = register_qvvf_benchmarks();
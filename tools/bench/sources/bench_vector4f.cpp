@@ -0,0 +1,183 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "bench_common.h"
+
+#include <rtm/vector4d.h>
+#include <rtm/vector4f.h>
+
+using namespace rtm;
+using namespace rtm_bench;
+
+static int register_vector4f_benchmarks()
+{
+	const input_sets& sets = get_input_sets();
+	const vector4f* vectors = &sets.vectors[0];
+	const vector4f* positive_vectors = &sets.positive_vectors[0];
+	const vector4f* unit_vectors = &sets.unit_vectors[0];
+	const quatf* quats = &sets.quats[0];
+
+	// Second operands are hidden from the optimizer and chosen to keep the latency chains stable
+	const vector4f zero = opaque(vector_zero());
+	const vector4f one = opaque(vector_set(1.0f));
+	const vector4f other = opaque(vector_set(0.5f, -1.25f, 2.0f, 0.75f));
+	const vector4f min_value = opaque(vector_set(-1.0f));
+	const vector4f max_value = opaque(vector_set(1.0f));
+	const float scalar_one = opaque(1.0f);
+	const float alpha = opaque(0.33f);
+	const float threshold = opaque(0.00001f);
+
+	auto next_float = [](const vector4f& input, float result) { return depend_on_float(input, result); };
+	auto next_bool = [](const vector4f& input, bool result) { return depend_on_bool(input, result); };
+	auto next_mask = [](const vector4f& input, const mask4i& result) { return depend_on_mask(input, result); };
+
+	//////////////////////////////////////////////////////////////////////////
+	// Setters, getters, and casts
+
+	add("vector_load", vectors, [](const vector4f& input) { return vector_load(vector_to_pointer(input)); });
+	add("vector_load1", vectors, [](const vector4f& input) { return vector_load1(vector_to_pointer(input)); });
+	add("vector_load2", vectors, [](const vector4f& input) { return vector_load2(vector_to_pointer(input)); });
+	add("vector_load3", vectors, [](const vector4f& input) { return vector_load3(vector_to_pointer(input)); });
+	add("vector_load/float4f", vectors, [](const vector4f& input) { return vector_load(reinterpret_cast<const float4f*>(vector_to_pointer(input))); });
+	add("vector_load2/float2f", vectors, [](const vector4f& input) { return vector_load2(reinterpret_cast<const float2f*>(vector_to_pointer(input))); });
+	add("vector_load3/float3f", vectors, [](const vector4f& input) { return vector_load3(reinterpret_cast<const float3f*>(vector_to_pointer(input))); });
+	add("quat_to_vector", quats, [](const quatf& input) { return quat_to_vector(input); }, [](const quatf&, const vector4f& result) { return vector_to_quat(result); });
+	add("vector_cast", vectors, [](const vector4f& input) { return vector_cast(vector_cast(input)); });
+	add("vector_get_x", vectors, [](const vector4f& input) { return vector_get_x(input); }, next_float);
+	add("vector_get_y", vectors, [](const vector4f& input) { return vector_get_y(input); }, next_float);
+	add("vector_get_z", vectors, [](const vector4f& input) { return vector_get_z(input); }, next_float);
+	add("vector_get_w", vectors, [](const vector4f& input) { return vector_get_w(input); }, next_float);
+	add("vector_get_component<z>", vectors, [](const vector4f& input) { return vector_get_component<mix4::z>(input); }, next_float);
+	add("vector_get_component", vectors, [](const vector4f& input) { return vector_get_component(input, mix4::z); }, next_float);
+
+	add("vector_store", vectors, [](const vector4f& input) { float4f output; vector_store(input, &output.x); return output; }, [](const vector4f&, const float4f& result) { return vector_load(&result); });
+	add("vector_store1", vectors, [](const vector4f& input) { float4f output = { 0.0f, 0.0f, 0.0f, 0.0f }; vector_store1(input, &output.x); return output; }, [](const vector4f&, const float4f& result) { return vector_load(&result); });
+	add("vector_store2", vectors, [](const vector4f& input) { float4f output = { 0.0f, 0.0f, 0.0f, 0.0f }; vector_store2(input, &output.x); return output; }, [](const vector4f&, const float4f& result) { return vector_load(&result); });
+	add("vector_store3", vectors, [](const vector4f& input) { float4f output = { 0.0f, 0.0f, 0.0f, 0.0f }; vector_store3(input, &output.x); return output; }, [](const vector4f&, const float4f& result) { return vector_load(&result); });
+	add("vector_store/uint8_t", vectors, [](const vector4f& input) { float4f output; vector_store(input, reinterpret_cast<uint8_t*>(&output)); return output; }, [](const vector4f&, const float4f& result) { return vector_load(&result); });
+	add("vector_store1/uint8_t", vectors, [](const vector4f& input) { float4f output = { 0.0f, 0.0f, 0.0f, 0.0f }; vector_store1(input, reinterpret_cast<uint8_t*>(&output)); return output; }, [](const vector4f&, const float4f& result) { return vector_load(&result); });
+	add("vector_store2/uint8_t", vectors, [](const vector4f& input) { float4f output = { 0.0f, 0.0f, 0.0f, 0.0f }; vector_store2(input, reinterpret_cast<uint8_t*>(&output)); return output; }, [](const vector4f&, const float4f& result) { return vector_load(&result); });
+	add("vector_store3/uint8_t", vectors, [](const vector4f& input) { float4f output = { 0.0f, 0.0f, 0.0f, 0.0f }; vector_store3(input, reinterpret_cast<uint8_t*>(&output)); return output; }, [](const vector4f&, const float4f& result) { return vector_load(&result); });
+	add("vector_store/float4f", vectors, [](const vector4f& input) { float4f output; vector_store(input, &output); return output; }, [](const vector4f&, const float4f& result) { return vector_load(&result); });
+	add("vector_store2/float2f", vectors, [](const vector4f& input) { float2f output; vector_store2(input, &output); return output; }, [](const vector4f&, const float2f& result) { return vector_load2(&result); });
+	add("vector_store3/float3f", vectors, [](const vector4f& input) { float3f output; vector_store3(input, &output); return output; }, [](const vector4f&, const float3f& result) { return vector_load3(&result); });
+
+	//////////////////////////////////////////////////////////////////////////
+	// Arithmetic
+
+	add("vector_add", vectors, [=](const vector4f& input) { return vector_add(input, zero); });
+	add("vector_sub", vectors, [=](const vector4f& input) { return vector_sub(input, zero); });
+	add("vector_mul", vectors, [=](const vector4f& input) { return vector_mul(input, one); });
+	add("vector_mul/scalar", vectors, [=](const vector4f& input) { return vector_mul(input, scalar_one); });
+	add("vector_div", vectors, [=](const vector4f& input) { return vector_div(input, one); });
+	add("vector_max", vectors, [=](const vector4f& input) { return vector_max(input, other); });
+	add("vector_min", vectors, [=](const vector4f& input) { return vector_min(input, other); });
+	add("vector_clamp", vectors, [=](const vector4f& input) { return vector_clamp(input, min_value, max_value); });
+	add("vector_abs", vectors, [](const vector4f& input) { return vector_abs(input); });
+	add("vector_neg", vectors, [](const vector4f& input) { return vector_neg(input); });
+	add("vector_reciprocal", positive_vectors, [](const vector4f& input) { return vector_reciprocal(input); });
+	add("vector_sqrt", positive_vectors, [](const vector4f& input) { return vector_sqrt(input); });
+	add("vector_sqrt_reciprocal", positive_vectors, [](const vector4f& input) { return vector_sqrt_reciprocal(input); });
+	add("vector_ceil", vectors, [](const vector4f& input) { return vector_ceil(input); });
+	add("vector_floor", vectors, [](const vector4f& input) { return vector_floor(input); });
+	add("vector_round_bankers", vectors, [](const vector4f& input) { return vector_round_bankers(input); });
+	add("vector_cross3", vectors, [=](const vector4f& input) { return vector_cross3(input, other); });
+	add("vector_dot", vectors, [=](const vector4f& input) { return vector_dot(input, other); }, next_float);
+	add("vector_dot_as_scalar", vectors, [=](const vector4f& input) { return scalar_cast(vector_dot_as_scalar(input, other)); }, next_float);
+	add("vector_dot_as_vector", vectors, [=](const vector4f& input) { return vector_dot_as_vector(input, other); });
+	add("vector_dot3", vectors, [=](const vector4f& input) { return vector_dot3(input, other); }, next_float);
+	add("vector_length_squared", vectors, [](const vector4f& input) { return vector_length_squared(input); }, next_float);
+	add("vector_length_squared3", vectors, [](const vector4f& input) { return vector_length_squared3(input); }, next_float);
+	add("vector_length", vectors, [](const vector4f& input) { return vector_length(input); }, next_float);
+	add("vector_length3", vectors, [](const vector4f& input) { return vector_length3(input); }, next_float);
+	add("vector_length_reciprocal", positive_vectors, [](const vector4f& input) { return vector_length_reciprocal(input); }, next_float);
+	add("vector_length_reciprocal3", positive_vectors, [](const vector4f& input) { return vector_length_reciprocal3(input); }, next_float);
+	add("vector_distance3", vectors, [=](const vector4f& input) { return vector_distance3(input, other); }, next_float);
+	add("vector_normalize3", positive_vectors, [=](const vector4f& input) { return vector_normalize3(input, zero); });
+	add("vector_fraction", vectors, [](const vector4f& input) { return vector_fraction(input); });
+	add("vector_mul_add", vectors, [=](const vector4f& input) { return vector_mul_add(input, one, zero); });
+	add("vector_mul_add/scalar", vectors, [=](const vector4f& input) { return vector_mul_add(input, scalar_one, zero); });
+	add("vector_neg_mul_sub", vectors, [=](const vector4f& input) { return vector_neg_mul_sub(input, one, zero); });
+	add("vector_lerp", vectors, [=](const vector4f& input) { return vector_lerp(input, other, alpha); });
+
+	//////////////////////////////////////////////////////////////////////////
+	// Comparisons and masking
+
+	add("vector_less_than", vectors, [=](const vector4f& input) { return vector_less_than(input, other); }, next_mask);
+	add("vector_less_equal", vectors, [=](const vector4f& input) { return vector_less_equal(input, other); }, next_mask);
+	add("vector_greater_equal", vectors, [=](const vector4f& input) { return vector_greater_equal(input, other); }, next_mask);
+	add("vector_all_less_than", vectors, [=](const vector4f& input) { return vector_all_less_than(input, other); }, next_bool);
+	add("vector_all_less_than3", vectors, [=](const vector4f& input) { return vector_all_less_than3(input, other); }, next_bool);
+	add("vector_any_less_than", vectors, [=](const vector4f& input) { return vector_any_less_than(input, other); }, next_bool);
+	add("vector_any_less_than3", vectors, [=](const vector4f& input) { return vector_any_less_than3(input, other); }, next_bool);
+	add("vector_all_less_equal", vectors, [=](const vector4f& input) { return vector_all_less_equal(input, other); }, next_bool);
+	add("vector_all_less_equal3", vectors, [=](const vector4f& input) { return vector_all_less_equal3(input, other); }, next_bool);
+	add("vector_any_less_equal", vectors, [=](const vector4f& input) { return vector_any_less_equal(input, other); }, next_bool);
+	add("vector_any_less_equal3", vectors, [=](const vector4f& input) { return vector_any_less_equal3(input, other); }, next_bool);
+	add("vector_all_greater_equal", vectors, [=](const vector4f& input) { return vector_all_greater_equal(input, other); }, next_bool);
+	add("vector_all_greater_equal3", vectors, [=](const vector4f& input) { return vector_all_greater_equal3(input, other); }, next_bool);
+	add("vector_any_greater_equal", vectors, [=](const vector4f& input) { return vector_any_greater_equal(input, other); }, next_bool);
+	add("vector_any_greater_equal3", vectors, [=](const vector4f& input) { return vector_any_greater_equal3(input, other); }, next_bool);
+	add("vector_all_near_equal", vectors, [=](const vector4f& input) { return vector_all_near_equal(input, other, threshold); }, next_bool);
+	add("vector_all_near_equal3", vectors, [=](const vector4f& input) { return vector_all_near_equal3(input, other, threshold); }, next_bool);
+	add("vector_any_near_equal", vectors, [=](const vector4f& input) { return vector_any_near_equal(input, other, threshold); }, next_bool);
+	add("vector_any_near_equal3", vectors, [=](const vector4f& input) { return vector_any_near_equal3(input, other, threshold); }, next_bool);
+	add("vector_is_finite", vectors, [](const vector4f& input) { return vector_is_finite(input); }, next_bool);
+	add("vector_is_finite3", vectors, [](const vector4f& input) { return vector_is_finite3(input); }, next_bool);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Swizzling, permutations, and selection
+
+	add("vector_select", vectors, [=](const vector4f& input) { return vector_select(vector_less_than(other, zero), input, other); });
+	add("vector_mix<x,b,z,d>", vectors, [=](const vector4f& input) { return vector_mix<mix4::x, mix4::b, mix4::z, mix4::d>(input, other); });
+	add("vector_mix<y,a,w,c>", vectors, [=](const vector4f& input) { return vector_mix<mix4::y, mix4::a, mix4::w, mix4::c>(input, other); });
+	add("vector_dup_x", vectors, [](const vector4f& input) { return vector_dup_x(input); });
+	add("vector_dup_y", vectors, [](const vector4f& input) { return vector_dup_y(input); });
+	add("vector_dup_z", vectors, [](const vector4f& input) { return vector_dup_z(input); });
+	add("vector_dup_w", vectors, [](const vector4f& input) { return vector_dup_w(input); });
+
+	//////////////////////////////////////////////////////////////////////////
+	// Miscellaneous
+
+	add("vector_sign", vectors, [](const vector4f& input) { return vector_sign(input); });
+	add("vector_sin", vectors, [](const vector4f& input) { return vector_sin(input); });
+	add("vector_cos", vectors, [](const vector4f& input) { return vector_cos(input); });
+	add("vector_sincos", vectors, [](const vector4f& input) { vector4f sin; vector4f cos; vector_sincos(input, sin, cos); return vector_add(sin, cos); });
+	add("vector_asin", unit_vectors, [](const vector4f& input) { return vector_asin(input); });
+	add("vector_asin<low>", unit_vectors, [](const vector4f& input) { return vector_asin<accuracy::low>(input); });
+	add("vector_acos", unit_vectors, [](const vector4f& input) { return vector_acos(input); }, [=](const vector4f&, const vector4f& result) { return vector_mul(result, 0.3f); });
+	add("vector_acos<low>", unit_vectors, [](const vector4f& input) { return vector_acos<accuracy::low>(input); }, [=](const vector4f&, const vector4f& result) { return vector_mul(result, 0.3f); });
+	add("vector_atan", vectors, [](const vector4f& input) { return vector_atan(input); });
+	add("vector_atan<low>", vectors, [](const vector4f& input) { return vector_atan<accuracy::low>(input); });
+	add("vector_atan2", vectors, [=](const vector4f& input) { return vector_atan2(input, other); });
+	add("vector_atan2<low>", vectors, [=](const vector4f& input) { return vector_atan2<accuracy::low>(input, other); });
+	add("vector_exp", vectors, [](const vector4f& input) { return vector_exp(input); }, [](const vector4f& input, const vector4f& result) { return depend_on_float(input, vector_get_x(result)); });
+	add("vector_exp2", vectors, [](const vector4f& input) { return vector_exp2(input); }, [](const vector4f& input, const vector4f& result) { return depend_on_float(input, vector_get_x(result)); });
+	add("vector_log", positive_vectors, [](const vector4f& input) { return vector_log(input); }, [](const vector4f& input, const vector4f& result) { return depend_on_float(input, vector_get_x(result)); });
+	add("vector_log2", positive_vectors, [](const vector4f& input) { return vector_log2(input); }, [](const vector4f& input, const vector4f& result) { return depend_on_float(input, vector_get_x(result)); });
+	add("vector_pow", positive_vectors, [=](const vector4f& input) { return vector_pow(input, other); }, [](const vector4f& input, const vector4f& result) { return depend_on_float(input, vector_get_x(result)); });
+
+	return 0;
+}
+
+static const int s_vector4f_benchmarks = register_vector4f_benchmarks();
@@ -0,0 +1,994 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "bench_common.h"
+
+#include <rtm/aabbf.h>
+#include <rtm/aabbf_batch.h>
+#include <rtm/arena_allocator.h>
+#include <rtm/cpu_dispatch.h>
+#include <rtm/dualquatf.h>
+#include <rtm/frustumf.h>
+#include <rtm/matrix3x4f.h>
+#include <rtm/matrix3x4f_batch.h>
+#include <rtm/matrix4x4f_batch.h>
+#include <rtm/parallel.h>
+#include <rtm/pose.h>
+#include <rtm/quatf.h>
+#include <rtm/quatf_batch.h>
+#include <rtm/qvvf.h>
+#include <rtm/qvvf_batch.h>
+#include <rtm/qvvf_x8.h>
+#include <rtm/skinning.h>
+#include <rtm/soa_array.h>
+#include <rtm/strided_span.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace rtm;
+using namespace rtm_bench;
+
+namespace
+{
+	//////////////////////////////////////////////////////////////////////////
+	// A synthetic skeleton: every bone has a parent with a lower index except the root.
+	// By default, bones form long chains sorted depth first like most exported rigs.
+	// Wide skeletons are sorted breadth first and every bone has 4 children.
+	//////////////////////////////////////////////////////////////////////////
+	struct synthetic_rig
+	{
+		std::vector<uint16_t> parent_indices;
+		std::vector<qvvf> local_transforms;
+		std::vector<qvvf> world_transforms;
+		std::vector<float3f> euler_angles;
+
+		explicit synthetic_rig(size_t num_bones, bool is_wide = false)
+			: parent_indices(num_bones)
+			, local_transforms(num_bones)
+			, world_transforms(num_bones)
+			, euler_angles(num_bones)
+		{
+			random_generator generator;
+			for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+			{
+				// Parents are biased towards the previous bones to build long chains like real rigs
+				const size_t max_offset = bone_index < 4 ? bone_index : 4;
+				const size_t offset = size_t(generator.next(1.0f, float(max_offset) + 1.0f));
+				const size_t parent_index = is_wide ? ((bone_index - 1) / 4) : (bone_index - offset);
+				parent_indices[bone_index] = bone_index == 0 ? k_invalid_bone_index : uint16_t(parent_index);
+
+				// Unit scale keeps the world transforms bounded on deep chains
+				local_transforms[bone_index] = qvv_set(generator.next_quat(), generator.next_vector(-1.0f, 1.0f), vector_set(1.0f));
+
+				euler_angles[bone_index] = float3f{ generator.next(-3.0f, 3.0f), generator.next(-3.0f, 3.0f), generator.next(-3.0f, 3.0f) };
+			}
+		}
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A synthetic skinned mesh with 4 influences per vertex.
+	//////////////////////////////////////////////////////////////////////////
+	struct synthetic_mesh
+	{
+		static constexpr size_t k_num_bones = 100;
+		static constexpr size_t k_num_influences = 4;
+
+		std::vector<matrix3x4f> matrix_palette;
+		std::vector<dualquatf> dualquat_palette;
+		std::vector<uint16_t> bone_indices;
+		std::vector<float> bone_weights;
+		std::vector<float3f> positions;
+		std::vector<float3f> normals;
+		std::vector<float3f> out_positions;
+		std::vector<float3f> out_normals;
+
+		explicit synthetic_mesh(size_t num_vertices)
+			: matrix_palette(k_num_bones)
+			, dualquat_palette(k_num_bones)
+			, bone_indices(num_vertices * k_num_influences)
+			, bone_weights(num_vertices * k_num_influences)
+			, positions(num_vertices)
+			, normals(num_vertices)
+			, out_positions(num_vertices)
+			, out_normals(num_vertices)
+		{
+			random_generator generator;
+			for (size_t bone_index = 0; bone_index < k_num_bones; ++bone_index)
+			{
+				const quatf rotation = generator.next_quat();
+				const vector4f translation = generator.next_vector(-1.0f, 1.0f);
+				matrix_palette[bone_index] = matrix_from_qvv(rotation, translation, vector_set(1.0f));
+				dualquat_palette[bone_index] = dualquat_from_rotation_translation(rotation, translation);
+			}
+
+			for (size_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+			{
+				// Neighboring vertices share bones like they would in a real mesh
+				const size_t base_bone = (vertex_index * k_num_bones) / num_vertices;
+				float weight_sum = 0.0f;
+				for (size_t influence_index = 0; influence_index < k_num_influences; ++influence_index)
+				{
+					const size_t offset = size_t(generator.next(0.0f, 4.0f));
+					bone_indices[vertex_index * k_num_influences + influence_index] = uint16_t((base_bone + offset) % k_num_bones);
+
+					const float weight = generator.next(0.1f, 1.0f);
+					bone_weights[vertex_index * k_num_influences + influence_index] = weight;
+					weight_sum += weight;
+				}
+
+				for (size_t influence_index = 0; influence_index < k_num_influences; ++influence_index)
+					bone_weights[vertex_index * k_num_influences + influence_index] /= weight_sum;
+
+				positions[vertex_index] = float3f{ generator.next(-1.0f, 1.0f), generator.next(-1.0f, 1.0f), generator.next(-1.0f, 1.0f) };
+
+				float3f normal;
+				vector_store3(vector_normalize3(generator.next_vector(-1.0f, 1.0f), vector_set(0.0f, 0.0f, 1.0f)), &normal);
+				normals[vertex_index] = normal;
+			}
+		}
+	};
+
+	void bm_pose_local_to_world(benchmark::State& state, bool is_wide)
+	{
+		const size_t num_bones = size_t(state.range(0));
+		synthetic_rig rig(num_bones, is_wide);
+
+		for (auto _ : state)
+		{
+			rig.world_transforms[0] = rig.local_transforms[0];
+			for (size_t bone_index = 1; bone_index < num_bones; ++bone_index)
+				rig.world_transforms[bone_index] = qvv_mul(rig.local_transforms[bone_index], rig.world_transforms[rig.parent_indices[bone_index]]);
+
+			benchmark::DoNotOptimize(rig.world_transforms.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_bones));
+	}
+
+	void bm_pose_local_to_object(benchmark::State& state, bool is_wide, bool with_palette)
+	{
+		const size_t num_bones = size_t(state.range(0));
+		synthetic_rig rig(num_bones, is_wide);
+		std::vector<matrix3x4f> palette(num_bones);
+
+		for (auto _ : state)
+		{
+			pose_local_to_object(rig.local_transforms.data(), rig.parent_indices.data(), rig.world_transforms.data(), with_palette ? palette.data() : nullptr, num_bones);
+
+			benchmark::DoNotOptimize(rig.world_transforms.data());
+			benchmark::DoNotOptimize(palette.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_bones));
+	}
+
+	// Sweeps the prefetch distance, the second argument, on a crowd of wide 64 bone rigs
+	// evaluated one character at a time. Large crowds exceed the cache.
+	void bm_pose_local_to_object_prefetch(benchmark::State& state)
+	{
+		const size_t num_bones = 64;
+		const size_t num_instances = size_t(state.range(0));
+		const size_t prefetch_distance = size_t(state.range(1));
+		synthetic_rig rig(num_bones, true);
+		std::vector<qvvf> local_transforms;
+		for (size_t instance_index = 0; instance_index < num_instances; ++instance_index)
+			local_transforms.insert(local_transforms.end(), rig.local_transforms.begin(), rig.local_transforms.end());
+		std::vector<qvvf> object_transforms(local_transforms.size());
+		std::vector<matrix3x4f> palette(local_transforms.size());
+
+		for (auto _ : state)
+		{
+			for (size_t instance_index = 0; instance_index < num_instances; ++instance_index)
+			{
+				const size_t offset = instance_index * num_bones;
+				pose_local_to_object(local_transforms.data() + offset, rig.parent_indices.data(), object_transforms.data() + offset, palette.data() + offset, num_bones, store_mode::cached, prefetch_distance);
+			}
+
+			benchmark::DoNotOptimize(object_transforms.data());
+			benchmark::DoNotOptimize(palette.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_instances * num_bones));
+	}
+
+	void qvv_load_lanes(const qvvf* inputs, qvvf_x4& output) { output = qvv_load_x4(inputs); }
+	void qvv_load_lanes(const qvvf* inputs, qvvf_x8& output) { output = qvv_load_x8(inputs); }
+
+	// The poses of a crowd of characters sharing a 64 bone rig, evaluated one character at a time
+	void bm_pose_local_to_object_instances(benchmark::State& state)
+	{
+		const size_t num_bones = 64;
+		const size_t num_instances = size_t(state.range(0));
+		synthetic_rig rig(num_bones);
+		std::vector<qvvf> local_transforms;
+		for (size_t instance_index = 0; instance_index < num_instances; ++instance_index)
+			local_transforms.insert(local_transforms.end(), rig.local_transforms.begin(), rig.local_transforms.end());
+		std::vector<qvvf> object_transforms(local_transforms.size());
+
+		for (auto _ : state)
+		{
+			for (size_t instance_index = 0; instance_index < num_instances; ++instance_index)
+				pose_local_to_object(local_transforms.data() + instance_index * num_bones, rig.parent_indices.data(), object_transforms.data() + instance_index * num_bones, nullptr, num_bones);
+
+			benchmark::DoNotOptimize(object_transforms.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_instances * num_bones));
+	}
+
+	// The same crowd evaluated in lockstep, one character per SIMD lane
+	template<typename qvv_type, size_t num_lanes>
+	void bm_pose_local_to_object_lockstep(benchmark::State& state)
+	{
+		const size_t num_bones = 64;
+		const size_t num_instances = size_t(state.range(0));
+		const size_t num_groups = num_instances / num_lanes;
+		synthetic_rig rig(num_bones);
+
+		// operator new does not honor the alignment of the wide types before C++17
+		std::vector<uint8_t> buffer(sizeof(qvv_type) * num_groups * num_bones * 2 + 1024);
+		arena_allocator arena = arena_create(buffer.data(), buffer.size());
+		qvv_type* local_transforms = arena_allocate_array<qvv_type>(arena, num_groups * num_bones);
+		qvv_type* object_transforms = arena_allocate_array<qvv_type>(arena, num_groups * num_bones);
+
+		for (size_t group_index = 0; group_index < num_groups; ++group_index)
+		{
+			for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+			{
+				const qvvf bone_transforms[8] = { rig.local_transforms[bone_index], rig.local_transforms[bone_index], rig.local_transforms[bone_index], rig.local_transforms[bone_index],
+					rig.local_transforms[bone_index], rig.local_transforms[bone_index], rig.local_transforms[bone_index], rig.local_transforms[bone_index] };
+				qvv_load_lanes(&bone_transforms[0], local_transforms[group_index * num_bones + bone_index]);
+			}
+		}
+
+		for (auto _ : state)
+		{
+			for (size_t group_index = 0; group_index < num_groups; ++group_index)
+				pose_local_to_object(local_transforms + group_index * num_bones, rig.parent_indices.data(), object_transforms + group_index * num_bones, num_bones);
+
+			benchmark::DoNotOptimize(object_transforms);
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_groups * num_lanes * num_bones));
+	}
+
+	void bm_pose_build_skinning_palette(benchmark::State& state)
+	{
+		const size_t num_bones = size_t(state.range(0));
+		synthetic_rig rig(num_bones);
+		std::vector<matrix3x4f> palette(num_bones);
+
+		for (auto _ : state)
+		{
+			for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+				palette[bone_index] = matrix_from_qvv(rig.local_transforms[bone_index]);
+
+			benchmark::DoNotOptimize(palette.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_bones));
+	}
+
+	void bm_pose_quat_from_euler(benchmark::State& state)
+	{
+		const size_t num_bones = size_t(state.range(0));
+		synthetic_rig rig(num_bones);
+		quatf* rotations = new quatf[num_bones];
+
+		for (auto _ : state)
+		{
+			for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+			{
+				const float3f& angles = rig.euler_angles[bone_index];
+				rotations[bone_index] = quat_from_euler(radians(angles.x), radians(angles.y), radians(angles.z));
+			}
+
+			benchmark::DoNotOptimize(rotations);
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_bones));
+		delete[] rotations;
+	}
+
+	void bm_pose_inverse_bind_pose(benchmark::State& state)
+	{
+		const size_t num_bones = size_t(state.range(0));
+		synthetic_rig rig(num_bones);
+		std::vector<matrix3x4f> bind_pose(num_bones);
+		std::vector<matrix3x4f> inverse_bind_pose(num_bones);
+		for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+			bind_pose[bone_index] = matrix_from_qvv(rig.local_transforms[bone_index]);
+
+		for (auto _ : state)
+		{
+			for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+				inverse_bind_pose[bone_index] = matrix_inverse(bind_pose[bone_index]);
+
+			benchmark::DoNotOptimize(inverse_bind_pose.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_bones));
+	}
+
+	void bm_matrix3x4_inverse_batch(benchmark::State& state)
+	{
+		const size_t num_bones = size_t(state.range(0));
+		synthetic_rig rig(num_bones);
+		std::vector<matrix3x4f> bind_pose(num_bones);
+		std::vector<matrix3x4f> inverse_bind_pose(num_bones);
+		for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+			bind_pose[bone_index] = matrix_from_qvv(rig.local_transforms[bone_index]);
+
+		for (auto _ : state)
+		{
+			matrix_inverse_batch(bind_pose.data(), inverse_bind_pose.data(), num_bones);
+
+			benchmark::DoNotOptimize(inverse_bind_pose.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_bones));
+	}
+
+	void bm_matrix3x4_inverse_rigid_batch(benchmark::State& state)
+	{
+		const size_t num_bones = size_t(state.range(0));
+		synthetic_rig rig(num_bones);
+		std::vector<matrix3x4f> bind_pose(num_bones);
+		std::vector<matrix3x4f> inverse_bind_pose(num_bones);
+		for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+			bind_pose[bone_index] = matrix_from_qvv(rig.local_transforms[bone_index]);
+
+		for (auto _ : state)
+		{
+			matrix_inverse_rigid_batch(bind_pose.data(), inverse_bind_pose.data(), num_bones);
+
+			benchmark::DoNotOptimize(inverse_bind_pose.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_bones));
+	}
+
+	void bm_matrix4x4_inverse(benchmark::State& state)
+	{
+		const size_t num_matrices = size_t(state.range(0));
+		synthetic_rig rig(num_matrices);
+		std::vector<matrix4x4f> matrices(num_matrices);
+		std::vector<matrix4x4f> inverses(num_matrices);
+		for (size_t index = 0; index < num_matrices; ++index)
+			matrices[index] = matrix_cast(matrix_from_qvv(rig.local_transforms[index]));
+
+		for (auto _ : state)
+		{
+			for (size_t index = 0; index < num_matrices; ++index)
+				inverses[index] = matrix_inverse(matrices[index]);
+
+			benchmark::DoNotOptimize(inverses.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_matrices));
+	}
+
+	void bm_matrix4x4_inverse_batch(benchmark::State& state)
+	{
+		const size_t num_matrices = size_t(state.range(0));
+		synthetic_rig rig(num_matrices);
+		std::vector<matrix4x4f> matrices(num_matrices);
+		std::vector<matrix4x4f> inverses(num_matrices);
+		for (size_t index = 0; index < num_matrices; ++index)
+			matrices[index] = matrix_cast(matrix_from_qvv(rig.local_transforms[index]));
+
+		for (auto _ : state)
+		{
+			matrix_inverse_batch(matrices.data(), inverses.data(), num_matrices);
+
+			benchmark::DoNotOptimize(inverses.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_matrices));
+	}
+
+	void bm_quat_mul_batch(benchmark::State& state)
+	{
+		const size_t num_bones = size_t(state.range(0));
+		synthetic_rig rig(num_bones);
+		quatf* lhs = new quatf[num_bones];
+		quatf* rhs = new quatf[num_bones];
+		quatf* output = new quatf[num_bones];
+		for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+		{
+			lhs[bone_index] = rig.local_transforms[bone_index].rotation;
+			rhs[bone_index] = rig.local_transforms[num_bones - bone_index - 1].rotation;
+		}
+
+		for (auto _ : state)
+		{
+			quat_mul_batch(lhs, rhs, output, num_bones);
+
+			benchmark::DoNotOptimize(output);
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_bones));
+
+		delete[] lhs;
+		delete[] rhs;
+		delete[] output;
+	}
+
+	void bm_qvv_mul_batch(benchmark::State& state)
+	{
+		const size_t num_bones = size_t(state.range(0));
+		synthetic_rig rig(num_bones);
+		std::vector<qvvf> rhs(rig.local_transforms.rbegin(), rig.local_transforms.rend());
+
+		for (auto _ : state)
+		{
+			qvv_mul_batch(rig.local_transforms.data(), rhs.data(), rig.world_transforms.data(), num_bones);
+
+			benchmark::DoNotOptimize(rig.world_transforms.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_bones));
+	}
+
+	// Same as bm_qvv_mul_batch with the transforms stored in larger engine components
+	void bm_qvv_mul_strided_span(benchmark::State& state)
+	{
+		struct bone_component
+		{
+			uint32_t flags;
+			qvvf local_transform;
+			qvvf parent_transform;
+			qvvf world_transform;
+		};
+
+		const size_t num_bones = size_t(state.range(0));
+		synthetic_rig rig(num_bones);
+
+		std::vector<bone_component> components(num_bones);
+		for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+		{
+			components[bone_index].flags = 0;
+			components[bone_index].local_transform = rig.local_transforms[bone_index];
+			components[bone_index].parent_transform = rig.local_transforms[num_bones - bone_index - 1];
+			components[bone_index].world_transform = qvv_identity();
+		}
+
+		const strided_span<const qvvf> lhs = strided_span_create<const qvvf>(&components[0].local_transform, sizeof(bone_component), num_bones);
+		const strided_span<const qvvf> rhs = strided_span_create<const qvvf>(&components[0].parent_transform, sizeof(bone_component), num_bones);
+		const strided_span<qvvf> output = strided_span_create(&components[0].world_transform, sizeof(bone_component), num_bones);
+
+		for (auto _ : state)
+		{
+			qvv_mul_batch(lhs, rhs, output);
+
+			benchmark::DoNotOptimize(components.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_bones));
+	}
+
+	// Same as bm_qvv_mul_batch with the transforms stored in structure of arrays form
+	void bm_qvv_mul_soa_array(benchmark::State& state)
+	{
+		const size_t num_bones = size_t(state.range(0));
+		synthetic_rig rig(num_bones);
+
+		std::vector<uint8_t> buffer(sizeof(qvvf) * (num_bones + 16) * 3 + 1024);
+		arena_allocator arena = arena_create(buffer.data(), buffer.size());
+		soa_array<qvvf> lhs = soa_array_allocate<qvvf>(arena, num_bones);
+		soa_array<qvvf> rhs = soa_array_allocate<qvvf>(arena, num_bones);
+		soa_array<qvvf> output = soa_array_allocate<qvvf>(arena, num_bones);
+		for (size_t bone_index = 0; bone_index < num_bones; ++bone_index)
+		{
+			soa_array_set(lhs, bone_index, rig.local_transforms[bone_index]);
+			soa_array_set(rhs, bone_index, rig.local_transforms[num_bones - bone_index - 1]);
+		}
+
+		for (auto _ : state)
+		{
+			// The padding is valid, no tail handling is needed
+#if defined(RTM_AVX_INTRINSICS)
+			for (size_t bone_index = 0; bone_index < output.stride; bone_index += 8)
+				qvv_store_x8(qvv_mul(qvv_load_x8(lhs, bone_index), qvv_load_x8(rhs, bone_index)), output, bone_index);
+#else
+			for (size_t bone_index = 0; bone_index < output.stride; bone_index += 4)
+				qvv_store_x4(qvv_mul(qvv_load_x4(lhs, bone_index), qvv_load_x4(rhs, bone_index)), output, bone_index);
+#endif
+
+			benchmark::DoNotOptimize(output.streams);
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_bones));
+	}
+
+	// Same as bm_qvv_mul_batch on a thread pool with the number of threads as second argument
+	void bm_qvv_mul_batch_parallel(benchmark::State& state)
+	{
+		const size_t num_transforms = size_t(state.range(0));
+		thread_pool pool(uint32_t(state.range(1)));
+		const parallel_executor executor = pool.get_executor();
+
+		synthetic_rig rig(num_transforms);
+		std::vector<qvvf> rhs(rig.local_transforms.rbegin(), rig.local_transforms.rend());
+
+		for (auto _ : state)
+		{
+			qvv_mul_batch(executor, rig.local_transforms.data(), rhs.data(), rig.world_transforms.data(), num_transforms);
+
+			benchmark::DoNotOptimize(rig.world_transforms.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_transforms));
+	}
+
+	// Transforms points on a thread pool with the number of threads as second argument
+	void bm_matrix_mul_point3_batch_parallel(benchmark::State& state)
+	{
+		const size_t num_points = size_t(state.range(0));
+		thread_pool pool(uint32_t(state.range(1)));
+		const parallel_executor executor = pool.get_executor();
+
+		const matrix3x4f mtx = matrix_from_qvv(quat_from_euler(degrees(10.0f), degrees(-20.0f), degrees(30.0f)), vector_set(1.0f, 2.0f, 3.0f), vector_set(1.0f));
+		vector4f* points = new vector4f[num_points];
+		for (size_t point_index = 0; point_index < num_points; ++point_index)
+			points[point_index] = vector_set(float(point_index % 1024), 1.0f, -2.0f);
+
+		for (auto _ : state)
+		{
+			matrix_mul_point3_batch(executor, points, mtx, points, num_points);
+
+			benchmark::DoNotOptimize(points);
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_points));
+		delete[] points;
+	}
+
+	void bm_skin_linear_blend4(benchmark::State& state)
+	{
+		synthetic_mesh mesh(size_t(state.range(0)));
+		const size_t num_vertices = mesh.positions.size();
+
+		for (auto _ : state)
+		{
+			skin_linear_blend4(mesh.matrix_palette.data(), mesh.bone_indices.data(), mesh.bone_weights.data(),
+				mesh.positions.data(), mesh.normals.data(), mesh.out_positions.data(), mesh.out_normals.data(), num_vertices);
+
+			benchmark::DoNotOptimize(mesh.out_positions.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_vertices));
+	}
+
+	// Same as bm_skin_linear_blend4 with the outputs written with streaming stores.
+	// Compare with bm_skin_linear_blend4 on meshes whose outputs exceed the last level cache.
+	void bm_skin_linear_blend4_streaming(benchmark::State& state)
+	{
+		synthetic_mesh mesh(size_t(state.range(0)));
+		const size_t num_vertices = mesh.positions.size();
+
+		for (auto _ : state)
+		{
+			skin_linear_blend4(mesh.matrix_palette.data(), mesh.bone_indices.data(), mesh.bone_weights.data(),
+				mesh.positions.data(), mesh.normals.data(), mesh.out_positions.data(), mesh.out_normals.data(), num_vertices, store_mode::streaming);
+
+			benchmark::DoNotOptimize(mesh.out_positions.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_vertices));
+	}
+
+	void bm_skin_dual_quat4(benchmark::State& state)
+	{
+		synthetic_mesh mesh(size_t(state.range(0)));
+		const size_t num_vertices = mesh.positions.size();
+
+		for (auto _ : state)
+		{
+			skin_dual_quat4(mesh.dualquat_palette.data(), mesh.bone_indices.data(), mesh.bone_weights.data(),
+				mesh.positions.data(), mesh.normals.data(), mesh.out_positions.data(), mesh.out_normals.data(), num_vertices);
+
+			benchmark::DoNotOptimize(mesh.out_positions.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_vertices));
+	}
+
+	// Sweeps the prefetch distance, the second argument, on meshes that exceed the cache
+	void bm_skin_linear_blend4_prefetch(benchmark::State& state)
+	{
+		synthetic_mesh mesh(size_t(state.range(0)));
+		const size_t num_vertices = mesh.positions.size();
+		const size_t prefetch_distance = size_t(state.range(1));
+
+		for (auto _ : state)
+		{
+			skin_linear_blend4(mesh.matrix_palette.data(), mesh.bone_indices.data(), mesh.bone_weights.data(),
+				mesh.positions.data(), mesh.normals.data(), mesh.out_positions.data(), mesh.out_normals.data(), num_vertices, store_mode::cached, prefetch_distance);
+
+			benchmark::DoNotOptimize(mesh.out_positions.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_vertices));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Synthetic local bounds, each with its own transform.
+	//////////////////////////////////////////////////////////////////////////
+	struct synthetic_bounds
+	{
+		std::vector<aabbf> local_bounds;
+		std::vector<aabbf> world_bounds;
+		std::vector<matrix3x4f> transforms_mtx;
+		qvvf* transforms_qvv;
+
+		explicit synthetic_bounds(size_t num_boxes)
+			: local_bounds(num_boxes)
+			, world_bounds(num_boxes)
+			, transforms_mtx(num_boxes)
+			, transforms_qvv(new qvvf[num_boxes])
+		{
+			random_generator generator;
+			for (size_t box_index = 0; box_index < num_boxes; ++box_index)
+			{
+				local_bounds[box_index] = aabb_set(generator.next_vector(-1.0f, 1.0f), generator.next_vector(0.5f, 2.0f));
+				transforms_qvv[box_index] = qvv_set(generator.next_quat(), generator.next_vector(-100.0f, 100.0f), generator.next_vector(0.5f, 2.0f));
+				transforms_mtx[box_index] = matrix_from_qvv(transforms_qvv[box_index]);
+			}
+		}
+
+		~synthetic_bounds() { delete[] transforms_qvv; }
+
+		synthetic_bounds(const synthetic_bounds&) = delete;
+		synthetic_bounds& operator=(const synthetic_bounds&) = delete;
+	};
+
+	void bm_aabb_transform_corners(benchmark::State& state)
+	{
+		const size_t num_boxes = size_t(state.range(0));
+		synthetic_bounds bounds(num_boxes);
+
+		for (auto _ : state)
+		{
+			// Transforms the 8 corners of every box with matrix_mul_point3
+			for (size_t box_index = 0; box_index < num_boxes; ++box_index)
+			{
+				const aabbf& box = bounds.local_bounds[box_index];
+				const matrix3x4f& transform = bounds.transforms_mtx[box_index];
+
+				vector4f min = vector_set(1.0e30f);
+				vector4f max = vector_set(-1.0e30f);
+				for (uint32_t corner_index = 0; corner_index < 8; ++corner_index)
+				{
+					const vector4f sign = vector_set((corner_index & 1) ? 1.0f : -1.0f, (corner_index & 2) ? 1.0f : -1.0f, (corner_index & 4) ? 1.0f : -1.0f);
+					const vector4f corner = matrix_mul_point3(vector_mul_add(box.extents, sign, box.center), transform);
+					min = vector_min(min, corner);
+					max = vector_max(max, corner);
+				}
+
+				bounds.world_bounds[box_index] = aabb_from_min_max(min, max);
+			}
+
+			benchmark::DoNotOptimize(bounds.world_bounds.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_boxes));
+	}
+
+	void bm_aabb_transform(benchmark::State& state)
+	{
+		const size_t num_boxes = size_t(state.range(0));
+		synthetic_bounds bounds(num_boxes);
+
+		for (auto _ : state)
+		{
+			for (size_t box_index = 0; box_index < num_boxes; ++box_index)
+				bounds.world_bounds[box_index] = aabb_transform(bounds.local_bounds[box_index], bounds.transforms_mtx[box_index]);
+
+			benchmark::DoNotOptimize(bounds.world_bounds.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_boxes));
+	}
+
+	void bm_aabb_transform_batch(benchmark::State& state)
+	{
+		const size_t num_boxes = size_t(state.range(0));
+		synthetic_bounds bounds(num_boxes);
+
+		for (auto _ : state)
+		{
+			aabb_transform_batch(bounds.local_bounds.data(), bounds.transforms_mtx.data(), bounds.world_bounds.data(), num_boxes);
+
+			benchmark::DoNotOptimize(bounds.world_bounds.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_boxes));
+	}
+
+	void bm_aabb_transform_qvv_batch(benchmark::State& state)
+	{
+		const size_t num_boxes = size_t(state.range(0));
+		synthetic_bounds bounds(num_boxes);
+
+		for (auto _ : state)
+		{
+			aabb_transform_batch(bounds.local_bounds.data(), bounds.transforms_qvv, bounds.world_bounds.data(), num_boxes);
+
+			benchmark::DoNotOptimize(bounds.world_bounds.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_boxes));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// A synthetic scene of bounding volumes scattered around a camera, stored as SoA streams.
+	//////////////////////////////////////////////////////////////////////////
+	struct synthetic_scene
+	{
+		frustumf frustum;
+		std::vector<float> centers_x;
+		std::vector<float> centers_y;
+		std::vector<float> centers_z;
+		std::vector<float> extents_x;
+		std::vector<float> extents_y;
+		std::vector<float> extents_z;
+		std::vector<float> radii;
+		std::vector<uint32_t> visibility;
+
+		explicit synthetic_scene(size_t num_objects)
+			: centers_x(num_objects)
+			, centers_y(num_objects)
+			, centers_z(num_objects)
+			, extents_x(num_objects)
+			, extents_y(num_objects)
+			, extents_z(num_objects)
+			, radii(num_objects)
+			, visibility((num_objects + 31) / 32)
+		{
+			// 90 degree perspective projection looking down +Z with a [0, 1] depth range
+			const float near_distance = 0.1f;
+			const float far_distance = 500.0f;
+			const float range = far_distance - near_distance;
+			const matrix4x4f projection{ vector_set(1.0f, 0.0f, 0.0f, 0.0f), vector_set(0.0f, 1.0f, 0.0f, 0.0f),
+				vector_set(0.0f, 0.0f, far_distance / range, 1.0f), vector_set(0.0f, 0.0f, -near_distance * far_distance / range, 0.0f) };
+			frustum = frustum_from_view_projection(projection);
+
+			// Roughly a quarter of the objects are visible
+			random_generator generator;
+			for (size_t object_index = 0; object_index < num_objects; ++object_index)
+			{
+				centers_x[object_index] = generator.next(-500.0f, 500.0f);
+				centers_y[object_index] = generator.next(-500.0f, 500.0f);
+				centers_z[object_index] = generator.next(-500.0f, 500.0f);
+				extents_x[object_index] = generator.next(0.5f, 10.0f);
+				extents_y[object_index] = generator.next(0.5f, 10.0f);
+				extents_z[object_index] = generator.next(0.5f, 10.0f);
+				radii[object_index] = generator.next(0.5f, 10.0f);
+			}
+		}
+	};
+
+	void bm_frustum_cull_spheres_scalar(benchmark::State& state)
+	{
+		const size_t num_objects = size_t(state.range(0));
+		synthetic_scene scene(num_objects);
+
+		for (auto _ : state)
+		{
+			// One object at a time with an early out on the first rejecting plane
+			for (size_t word_index = 0; word_index < scene.visibility.size(); ++word_index)
+				scene.visibility[word_index] = 0;
+
+			for (size_t object_index = 0; object_index < num_objects; ++object_index)
+			{
+				const vector4f center = vector_set(scene.centers_x[object_index], scene.centers_y[object_index], scene.centers_z[object_index]);
+				if (frustum_intersects_sphere(scene.frustum, center, scene.radii[object_index]))
+					scene.visibility[object_index / 32] |= 1U << (object_index % 32);
+			}
+
+			benchmark::DoNotOptimize(scene.visibility.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_objects));
+	}
+
+	void bm_frustum_cull_spheres(benchmark::State& state)
+	{
+		const size_t num_objects = size_t(state.range(0));
+		synthetic_scene scene(num_objects);
+
+		for (auto _ : state)
+		{
+			frustum_cull_spheres(scene.frustum, scene.centers_x.data(), scene.centers_y.data(), scene.centers_z.data(), scene.radii.data(), num_objects, scene.visibility.data());
+
+			benchmark::DoNotOptimize(scene.visibility.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_objects));
+	}
+
+	void bm_frustum_cull_aabbs(benchmark::State& state)
+	{
+		const size_t num_objects = size_t(state.range(0));
+		synthetic_scene scene(num_objects);
+
+		for (auto _ : state)
+		{
+			frustum_cull_aabbs(scene.frustum, scene.centers_x.data(), scene.centers_y.data(), scene.centers_z.data(),
+				scene.extents_x.data(), scene.extents_y.data(), scene.extents_z.data(), num_objects, scene.visibility.data());
+
+			benchmark::DoNotOptimize(scene.visibility.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_objects));
+	}
+
+	void bm_aabb_transform_cull(benchmark::State& state)
+	{
+		// Local bounds stored as SoA streams are transformed and culled without converting them
+		const size_t num_objects = size_t(state.range(0));
+		synthetic_scene local_scene(num_objects);
+		synthetic_scene world_scene(num_objects);
+		synthetic_bounds bounds(num_objects);
+
+		for (auto _ : state)
+		{
+			aabb_transform_batch(local_scene.centers_x.data(), local_scene.centers_y.data(), local_scene.centers_z.data(),
+				local_scene.extents_x.data(), local_scene.extents_y.data(), local_scene.extents_z.data(), bounds.transforms_qvv,
+				world_scene.centers_x.data(), world_scene.centers_y.data(), world_scene.centers_z.data(),
+				world_scene.extents_x.data(), world_scene.extents_y.data(), world_scene.extents_z.data(), num_objects);
+
+			frustum_cull_aabbs(world_scene.frustum, world_scene.centers_x.data(), world_scene.centers_y.data(), world_scene.centers_z.data(),
+				world_scene.extents_x.data(), world_scene.extents_y.data(), world_scene.extents_z.data(), num_objects, world_scene.visibility.data());
+
+			benchmark::DoNotOptimize(world_scene.visibility.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_objects));
+	}
+
+	void bm_dispatch_qvv_mul_batch(benchmark::State& state, cpu_isa isa)
+	{
+		const size_t num_bones = 1024;
+		synthetic_rig rig(num_bones);
+		std::vector<qvvf> rhs(rig.local_transforms.rbegin(), rig.local_transforms.rend());
+
+		dispatch::set_dispatch_isa(isa);
+		for (auto _ : state)
+		{
+			dispatch::qvv_mul_batch(rig.local_transforms.data(), rhs.data(), rig.world_transforms.data(), num_bones);
+
+			benchmark::DoNotOptimize(rig.world_transforms.data());
+			benchmark::ClobberMemory();
+		}
+		dispatch::set_dispatch_isa(get_cpu_isa());
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_bones));
+	}
+
+	void bm_dispatch_matrix_mul_point3_batch(benchmark::State& state, cpu_isa isa)
+	{
+		const size_t num_points = 4096;
+		synthetic_mesh mesh(num_points);
+		vector4f* points = new vector4f[num_points];
+		for (size_t point_index = 0; point_index < num_points; ++point_index)
+			points[point_index] = vector_load3(&mesh.positions[point_index]);
+
+		dispatch::set_dispatch_isa(isa);
+		for (auto _ : state)
+		{
+			dispatch::matrix_mul_point3_batch(points, mesh.matrix_palette[0], points, num_points);
+
+			benchmark::DoNotOptimize(points);
+			benchmark::ClobberMemory();
+		}
+		dispatch::set_dispatch_isa(get_cpu_isa());
+
+		state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(num_points));
+		delete[] points;
+	}
+
+	int register_dispatch_benchmarks()
+	{
+		// Only the instruction sets the CPU supports are measured
+		const char* isa_names[] = { "generic", "sse2", "avx2", "avx512" };
+		const cpu_isa cpu_best_isa = get_cpu_isa();
+		for (uint32_t isa_index = uint32_t(cpu_best_isa == cpu_isa::generic ? 0 : 1); isa_index <= uint32_t(cpu_best_isa); ++isa_index)
+		{
+			const cpu_isa isa = cpu_isa(isa_index);
+			benchmark::RegisterBenchmark((std::string("bm_dispatch_qvv_mul_batch/") + isa_names[isa_index]).c_str(), bm_dispatch_qvv_mul_batch, isa);
+			benchmark::RegisterBenchmark((std::string("bm_dispatch_matrix_mul_point3_batch/") + isa_names[isa_index]).c_str(), bm_dispatch_matrix_mul_point3_batch, isa);
+		}
+
+		return 0;
+	}
+
+	const int s_dispatch_benchmarks = register_dispatch_benchmarks();
+}
+
+BENCHMARK_CAPTURE(bm_pose_local_to_world, chains, false)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK_CAPTURE(bm_pose_local_to_world, wide, true)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK_CAPTURE(bm_pose_local_to_object, chains, false, false)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK_CAPTURE(bm_pose_local_to_object, wide, true, false)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK_CAPTURE(bm_pose_local_to_object, wide_palette, true, true)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(bm_pose_local_to_object_instances)->Arg(64)->Arg(256);
+BENCHMARK(bm_pose_local_to_object_prefetch)->ArgsProduct({ { 16, 4096 }, { 0, 2, 4, 8, 16, 32 } });
+BENCHMARK_TEMPLATE(bm_pose_local_to_object_lockstep, qvvf_x4, 4)->Arg(64)->Arg(256);
+BENCHMARK_TEMPLATE(bm_pose_local_to_object_lockstep, qvvf_x8, 8)->Arg(64)->Arg(256);
+BENCHMARK(bm_pose_build_skinning_palette)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(bm_pose_quat_from_euler)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(bm_pose_inverse_bind_pose)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(bm_matrix3x4_inverse_batch)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(bm_matrix3x4_inverse_rigid_batch)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(bm_matrix4x4_inverse)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(bm_matrix4x4_inverse_batch)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(bm_aabb_transform_corners)->Arg(1024)->Arg(16384)->Arg(262144);
+BENCHMARK(bm_aabb_transform)->Arg(1024)->Arg(16384)->Arg(262144);
+BENCHMARK(bm_aabb_transform_batch)->Arg(1024)->Arg(16384)->Arg(262144);
+BENCHMARK(bm_aabb_transform_qvv_batch)->Arg(1024)->Arg(16384)->Arg(262144);
+BENCHMARK(bm_frustum_cull_spheres_scalar)->Arg(1024)->Arg(4096)->Arg(16384);
+BENCHMARK(bm_frustum_cull_spheres)->Arg(1024)->Arg(4096)->Arg(16384);
+BENCHMARK(bm_frustum_cull_aabbs)->Arg(1024)->Arg(4096)->Arg(16384);
+BENCHMARK(bm_aabb_transform_cull)->Arg(1024)->Arg(4096)->Arg(16384);
+BENCHMARK(bm_quat_mul_batch)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(bm_qvv_mul_batch)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(bm_qvv_mul_strided_span)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(bm_qvv_mul_soa_array)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(bm_qvv_mul_batch_parallel)->ArgsProduct({ { 65536, 2097152 }, { 1, 2, 4, 8 } })->UseRealTime();
+BENCHMARK(bm_matrix_mul_point3_batch_parallel)->ArgsProduct({ { 65536, 2097152 }, { 1, 2, 4, 8 } })->UseRealTime();
+BENCHMARK(bm_skin_linear_blend4)->Arg(1024)->Arg(4096)->Arg(16384)->Arg(1048576);
+BENCHMARK(bm_skin_linear_blend4_streaming)->Arg(1024)->Arg(4096)->Arg(16384)->Arg(1048576);
+BENCHMARK(bm_skin_linear_blend4_prefetch)->ArgsProduct({ { 4096, 1048576 }, { 0, 2, 4, 8, 16, 32 } });
+BENCHMARK(bm_skin_dual_quat4)->Arg(1024)->Arg(4096)->Arg(16384);